@@ -0,0 +1,128 @@
+/**
+ * @file Acquisition_BioFilterLib.ino
+ * @brief Adquisición en una ISR de temporizador y filtrado por bloques en loop()
+ * @author Sergio
+ * @version 1.0
+ *
+ * El temporizador TC3 del Arduino Due dispara una interrupción a 960 Hz que lee
+ * A0 y deja la muestra en una SpscBlockQueue. loop() filtra cada bloque completo
+ * con el Notch de 60 Hz directamente en processBuffer(), sin copias ni
+ * noInterrupts(), y envía original y filtrada por telemetría binaria.
+ *
+ * - 4 bloques de 32 muestras: ~133 ms de margen antes de perder muestras
+ * - Las muestras que no caben se descartan en la ISR y se cuentan (overruns)
+ *
+ * En placas distintas del Due el muestreo se simula en loop() con micros().
+ */
+
+#include <BioFilterLib.h>
+
+// ============================================================================
+// CONFIGURACIÓN
+// ============================================================================
+
+#define SAMPLE_RATE 960               // Frecuencia de muestreo (Hz)
+#define BLOCK_SIZE 32                 // Muestras por bloque
+#define NUM_BLOCKS 4                  // Bloques en la cola
+#define ADC_PIN A0
+
+// Notch 60 Hz, Q = 30 (fs = 960 Hz). Formato CMSIS Biquad: {b0, b1, b2, -a1, -a2}
+const float32_t notch_coeffs[5] = {
+    0.99349748f, -1.83574398f,  0.99349748f,
+    1.83574398f,  -0.98699496f
+};
+
+// ============================================================================
+// VARIABLES GLOBALES
+// ============================================================================
+
+IIRFilter notchFilter((float32_t*)notch_coeffs, 1, BLOCK_SIZE);
+SpscBlockQueue queue(NUM_BLOCKS, BLOCK_SIZE);
+TelemetryTx telemetry(2, TELEMETRY_INT16, 1.0f);
+
+float32_t filtered[BLOCK_SIZE];
+
+// ============================================================================
+// MUESTREO
+// ============================================================================
+
+float32_t readSample() {
+    return (analogRead(ADC_PIN) - 2048) / 2048.0f;   // 12 bits -> [-1, 1)
+}
+
+#if defined(ARDUINO_SAM_DUE)
+
+/**
+ * @brief Configura TC1 canal 0 (TC3) en modo forma de onda con disparo en RC
+ */
+void startSampling(uint32_t frequency) {
+    pmc_set_writeprotect(false);
+    pmc_enable_periph_clk(ID_TC3);
+    TC_Configure(TC1, 0, TC_CMR_WAVE | TC_CMR_WAVSEL_UP_RC | TC_CMR_TCCLKS_TIMER_CLOCK4);
+    TC_SetRC(TC1, 0, VARIANT_MCK / 128 / frequency);     // TIMER_CLOCK4 = MCK/128
+    TC_Start(TC1, 0);
+    TC1->TC_CHANNEL[0].TC_IER = TC_IER_CPCS;
+    TC1->TC_CHANNEL[0].TC_IDR = ~TC_IER_CPCS;
+    NVIC_EnableIRQ(TC3_IRQn);
+}
+
+void TC3_Handler() {
+    TC_GetStatus(TC1, 0);             // Limpiar el flag de la interrupción
+    queue.pushSample(readSample());   // Nunca espera a loop()
+}
+
+#else
+
+// Instante de la próxima muestra; el resto de 1e6 / SAMPLE_RATE µs se acumula
+// en periodRemainder para no derivar
+uint32_t nextMicros;
+uint32_t periodRemainder = 0;
+
+void startSampling(uint32_t frequency) {
+    (void)frequency;
+    nextMicros = micros();
+}
+
+#endif
+
+// ============================================================================
+// FUNCIONES
+// ============================================================================
+
+void setup() {
+    Serial.begin(115200);
+    while (!Serial && millis() < 3000);
+
+    analogReadResolution(12);
+    startSampling(SAMPLE_RATE);
+}
+
+void loop() {
+#if !defined(ARDUINO_SAM_DUE)
+    // Sin temporizador: el productor se simula aquí con el reloj. La resta con
+    // signo sigue funcionando cuando micros() se desborda (cada ~71.6 min)
+    while ((int32_t)(micros() - nextMicros) >= 0) {
+        queue.pushSample(readSample());
+
+        nextMicros += 1000000UL / SAMPLE_RATE;
+        periodRemainder += 1000000UL % SAMPLE_RATE;
+        if (periodRemainder >= SAMPLE_RATE) {
+            periodRemainder -= SAMPLE_RATE;
+            nextMicros++;
+        }
+    }
+#endif
+
+    // Consumidor: filtrar todos los bloques completos en su sitio
+    float32_t* block;
+    while ((block = queue.beginRead()) != nullptr) {
+        notchFilter.processBuffer(block, filtered, BLOCK_SIZE);
+        for (uint16_t i = 0; i < BLOCK_SIZE; i++) {
+            float32_t frame[2] = {block[i], filtered[i]};
+            telemetry.push(frame);
+        }
+        queue.endRead();
+    }
+
+    telemetry.pump(Serial);
+}
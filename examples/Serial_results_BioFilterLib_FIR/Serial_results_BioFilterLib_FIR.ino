@@ -20,9 +20,6 @@
 #define SAMPLE_RATE 960               // Frecuencia de muestreo (Hz)
 #define FILTERTAPS 51                 // Número de coeficientes del filtro
 
-// Delay de grupo del filtro FIR (siempre N/2 para FIR simétrico)
-#define FILTER_GROUP_DELAY (FILTERTAPS/2)
-
 // Coeficientes del filtro paso-bajo (fc=40Hz @ fs=960Hz, 51 taps, window='hann')
 float32_t coefs[FILTERTAPS] = {
     +0.00096226f, +0.00110652f, +0.00123488f, +0.00128605f, +0.00115012f, +0.00068979f, -0.00022373f, -0.00166613f,
@@ -80,12 +77,13 @@ void setup() {
     // Serial.println("========================================");
     
     // Imprimir datos para Serial Plotter
-    // Compensar el retardo del filtro (FILTERTAPS/2 ≈ 25 muestras)
-    for (int i = 0; i < NUM_SAMPLES - FILTER_GROUP_DELAY; i++) {
+    // Compensar el retardo del filtro: el propio filtro lo calcula (25 muestras en DC)
+    int delay_samples = (int)(firFilter->getGroupDelay() + 0.5f);
+    for (int i = 0; i < NUM_SAMPLES - delay_samples; i++) {
         // Formato: valor1 valor2 (separados por espacio)
         Serial.print(noisySignal[i], 4);
         Serial.print(" ");
-        Serial.println(filteredSignal[i + FILTER_GROUP_DELAY], 4);
+        Serial.println(filteredSignal[i + delay_samples], 4);
         
         delay(5); // Pequeña pausa para visualización suave
     }
@@ -75,8 +75,8 @@ void setup() {
     Serial.println("OK\n");
     
     // Imprimir datos para Serial Plotter
-    // Los filtros notch tienen delay de grupo muy pequeño (~0-1 muestras)
-    int delay_samples = 0;  // Notch tiene delay mínimo
+    // Retardo de grupo del notch en la banda del ECG (10 Hz): casi nulo fuera de 60 Hz
+    int delay_samples = (int)(notchFilter.getGroupDelay(10.0f / SAMPLE_RATE) + 0.5f);
     
     for (int i = 0; i < NUM_SAMPLES - delay_samples; i++) {
         // Formato: valor1 valor2 (separados por espacio)
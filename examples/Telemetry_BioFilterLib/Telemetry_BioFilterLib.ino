@@ -0,0 +1,88 @@
+/**
+ * @file Telemetry_BioFilterLib.ino
+ * @brief Streaming binario en tiempo real de señal original y filtrada
+ * @author Sergio
+ * @version 1.0
+ *
+ * Genera un ECG sintético con interferencia de red a 960 Hz, lo filtra con el
+ * IIR Notch de 60 Hz y envía ambos canales con el protocolo binario de
+ * Telemetry.h en lugar de texto:
+ * - Sin delay(): el muestreo lo marca micros() y el envío nunca bloquea
+ * - 2 canales int16 a 960 Hz ocupan ~4.2 KB/s (115200 baudios dan ~11.5 KB/s)
+ *
+ * En el PC, decodificar con extras/telemetry_dump.cpp:
+ *   stty -F /dev/ttyACM0 115200 raw
+ *   ./telemetry_dump /dev/ttyACM0 > datos.csv
+ *
+ * El Serial Plotter del IDE no entiende este formato: para él siguen estando
+ * los ejemplos Serial_results_*.
+ */
+
+#include <BioFilterLib.h>
+
+// ============================================================================
+// CONFIGURACIÓN
+// ============================================================================
+
+#define SAMPLE_RATE 960               // Frecuencia de muestreo (Hz)
+#define CHANNELS 2                    // Original y filtrada
+#define FULL_SCALE 4.0f               // ±4.0 -> ±32767 en int16
+
+// Coeficientes del filtro Notch (f0=60Hz, Q=30, fs=960Hz), los mismos que
+// Serial_results_BioFilterLib_IIR. Formato CMSIS Biquad: {b0, b1, b2, -a1, -a2}
+const float32_t notch_coeffs[5] = {
+    0.99349748f, -1.83574398f,  0.99349748f,
+    1.83574398f,  -0.98699496f
+};
+
+// ============================================================================
+// VARIABLES GLOBALES
+// ============================================================================
+
+IIRFilter notchFilter((float32_t*)notch_coeffs, 1, 1);
+
+// ECG de 72 lpm con 60 Hz y armónicos (sin límite de duración)
+BiosignalGenerator generator(SAMPLE_RATE, 1);
+
+TelemetryTx telemetry(CHANNELS, TELEMETRY_INT16, FULL_SCALE);
+
+// Instante de la próxima muestra. El periodo (1e6 / SAMPLE_RATE µs) no es
+// entero: el resto se acumula en periodRemainder para no derivar
+uint32_t nextMicros;
+uint32_t periodRemainder = 0;
+
+// ============================================================================
+// FUNCIONES
+// ============================================================================
+
+void setup() {
+    Serial.begin(115200);
+    while (!Serial && millis() < 3000);
+
+    generator.setECG(72.0f, 1.0f, 5.0f);
+    generator.setPowerline(60.0f, 0.4f, 3, 0.1f);
+    generator.setWhiteNoise(0.02f);
+
+    nextMicros = micros();
+}
+
+void loop() {
+    // Procesar todas las muestras que tocan según el reloj (sin delay). La resta
+    // con signo sigue funcionando cuando micros() se desborda (cada ~71.6 min)
+    while ((int32_t)(micros() - nextMicros) >= 0) {
+        float32_t frame[CHANNELS];
+        frame[0] = generator.next();
+        frame[1] = notchFilter.processSample(frame[0]);
+        telemetry.push(frame);
+
+        nextMicros += 1000000UL / SAMPLE_RATE;
+        periodRemainder += 1000000UL % SAMPLE_RATE;
+        if (periodRemainder >= SAMPLE_RATE) {
+            periodRemainder -= SAMPLE_RATE;
+            nextMicros++;
+        }
+    }
+
+    // Enviar lo que admita el puerto sin esperar
+    telemetry.pump(Serial);
+}
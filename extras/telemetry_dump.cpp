@@ -0,0 +1,55 @@
+/**
+ * @file telemetry_dump.cpp
+ * @brief Decodificador de telemetría BioFilterLib para PC (a CSV)
+ *
+ * Lee el flujo binario de TelemetryTx (src/utils/Telemetry.h) desde un puerto
+ * serie ya configurado, un archivo capturado o la entrada estándar, y escribe
+ * una línea CSV por trama: secuencia, canal 0, canal 1, ...
+ * Al terminar muestra en stderr los paquetes recibidos, perdidos y corruptos.
+ *
+ * Compilación (con CMSIS-DSP para arm_math.h):
+ *   g++ -std=gnu++11 -O2 -I<CMSIS>/Include -Isrc extras/telemetry_dump.cpp \
+ *       src/utils/Telemetry.cpp -o telemetry_dump
+ *
+ * Uso:
+ *   stty -F /dev/ttyACM0 115200 raw
+ *   ./telemetry_dump /dev/ttyACM0 > datos.csv
+ *   ./telemetry_dump captura.bin > datos.csv
+ */
+
+#include <stdio.h>
+#include "utils/Telemetry.h"
+
+static void printPacket(const TelemetryPacket& packet, void* context) {
+    (void)context;
+    for (uint8_t f = 0; f < packet.frames; f++) {
+        printf("%u", packet.sequence);
+        for (uint8_t c = 0; c < packet.channels; c++) {
+            printf(",%.6g", packet.sample(f, c));
+        }
+        printf("\n");
+    }
+}
+
+int main(int argc, char** argv) {
+    FILE* input = (argc > 1) ? fopen(argv[1], "rb") : stdin;
+    if (input == nullptr) {
+        fprintf(stderr, "No se puede abrir %s\n", argv[1]);
+        return 1;
+    }
+
+    TelemetryDecoder decoder(printPacket);
+    uint8_t buffer[4096];
+    size_t n;
+    while ((n = fread(buffer, 1, sizeof(buffer), input)) > 0) {
+        decoder.feed(buffer, n);
+        fflush(stdout);
+    }
+
+    fprintf(stderr, "Paquetes: %u  perdidos: %u  CRC: %u  trama: %u\n",
+            decoder.packets(), decoder.lostPackets(), decoder.crcErrors(), decoder.framingErrors());
+    if (input != stdin) {
+        fclose(input);
+    }
+    return 0;
+}
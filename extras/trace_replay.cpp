@@ -0,0 +1,98 @@
+/**
+ * @file trace_replay.cpp
+ * @brief Traza de la reproducción de las señales de Waveforms.h por el pipeline (PC)
+ *
+ * Reproduce cada señal de prueba (960 Hz) por bloques a través del pipeline típico
+ * notch 60 Hz -> pasa-bajas FIR -> suavizado wavelet, con cada etapa envuelta en
+ * Traced<> y la cadena completa también, y escribe la línea de tiempo en JSON de
+ * Chrome trace: una fila por señal, cada bloque de la cadena con sus tres etapas
+ * anidadas. Se abre en ui.perfetto.dev o chrome://tracing.
+ * Al terminar muestra en stderr los bloques, eventos y llamadas descartadas.
+ *
+ * Compilación (con CMSIS-DSP para arm_math.h):
+ *   g++ -std=gnu++11 -O2 -DBIOFILTERLIB_TRACE=1 -I<CMSIS>/Include -Isrc \
+ *       extras/trace_replay.cpp src/utils/Trace.cpp src/host/TraceExport.cpp \
+ *       src/filters/IIRFilter.cpp src/filters/FIRFilter.cpp src/filters/WaveletFilter.cpp \
+ *       src/utils/Waveforms.cpp src/utils/WaveformsData.cpp src/utils/utils.cpp \
+ *       -o trace_replay
+ *
+ * Uso:
+ *   ./trace_replay [traza.json] [blockSize]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "filters/IIRFilter.h"
+#include "filters/FIRFilter.h"
+#include "filters/WaveletFilter.h"
+#include "filters/FilterChain.h"
+#include "filters/FIRDesign.h"
+#include "utils/Waveforms.h"
+#include "utils/Trace.h"
+#include "host/TraceExport.h"
+
+#define MAX_BLOCK_SIZE 1024
+#define FILTERTAPS     51
+
+typedef FilterChain<Traced<IIRFilter>, Traced<FIRFilter>, Traced<WaveletFilter> > Pipeline;
+
+// Notch 60 Hz, Q = 30 (scipy.signal.iirnotch), a1/a2 negados para CMSIS-DSP
+static float32_t notchCoeffs[5] = {
+    0.99349748f, -1.83574398f,  0.99349748f,
+    1.83574398f, -0.98699496f
+};
+
+static constexpr FIRTable<FILTERTAPS> LOWPASS = FIRDesign::table<FILTERTAPS>(FIRDesign::lowpassSpec(40.0 / 960.0));
+
+static float32_t block[MAX_BLOCK_SIZE];
+
+int main(int argc, char** argv) {
+    const char* path = (argc > 1) ? argv[1] : "trace_replay.json";
+    uint32_t blockSize = (argc > 2) ? (uint32_t)atoi(argv[2]) : 32;
+    if (blockSize == 0 || blockSize > MAX_BLOCK_SIZE) {
+        fprintf(stderr, "blockSize entre 1 y %u\n", MAX_BLOCK_SIZE);
+        return 1;
+    }
+
+    ChromeTraceWriter writer;
+    if (!writer.open(path, "BioFilterLib replay")) {
+        fprintf(stderr, "No se puede crear %s\n", path);
+        return 1;
+    }
+
+    // Una cadena por bloque son 8 eventos: el anillo se vacía tras cada bloque
+    TraceBuffer trace(64);
+    uint32_t blocks = 0;
+
+    for (uint8_t s = 0; s < waveformsNumSignals; s++) {
+        char tag[4];
+        snprintf(tag, sizeof(tag), "%u", s);
+        writer.setThreadName(s + 1, getSignalName(tag));
+
+        IIRFilter notch(notchCoeffs, 1, (uint16_t)blockSize);
+        FIRFilter lowpass(LOWPASS.coeffs, FILTERTAPS, (uint16_t)blockSize);
+        WaveletFilter wavelet((uint16_t)blockSize);
+        Traced<IIRFilter> notchStage(notch, trace, "notch 60 Hz");
+        Traced<FIRFilter> lowpassStage(lowpass, trace, "FIR pasa-bajas");
+        Traced<WaveletFilter> waveletStage(wavelet, trace, "wavelet");
+        Pipeline chain((uint16_t)blockSize, notchStage, lowpassStage, waveletStage);
+        Traced<Pipeline> pipeline(chain, trace, "pipeline");
+
+        WaveformDecoder decoder;
+        decoder.begin(s);
+        uint32_t length;
+        while ((length = decoder.read(block, blockSize)) > 0) {
+            pipeline.processBuffer(block, block, length);
+            writer.drain(trace, s + 1);
+            blocks++;
+        }
+    }
+
+    bool ok = writer.close();
+    fprintf(stderr, "%u señales, %u bloques de %u muestras, %u eventos, %u llamadas descartadas\n",
+            waveformsNumSignals, blocks, blockSize, writer.getEventCount(), trace.getDropped());
+    if (writer.getEventCount() == 0) {
+        fprintf(stderr, "Sin eventos: compilar con -DBIOFILTERLIB_TRACE=1\n");
+    }
+    return ok ? 0 : 1;
+}
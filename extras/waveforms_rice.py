@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+"""
+Genera el flujo delta + Rice de las señales de prueba de BioFilterLib.
+
+Lee la tabla sin comprimir `waveformsTable` de src/utils/WaveformsData.cpp
+y escribe en stdout los arrays `waveformsRiceData` / `waveformsRiceOffset`
+que decodifica WaveformDecoder (src/utils/Waveforms.cpp).
+
+Formato por señal (bits MSB primero, cada señal alineada a byte):
+  - 12 bits: primera muestra sin comprimir
+  - por cada bloque de WAVEFORMS_RICE_BLOCK diferencias:
+      4 bits: parámetro k del bloque
+      por diferencia: zigzag(d) = q * 2^k + r  ->  q unos, un cero, r en k bits
+      si q >= WAVEFORMS_RICE_ESCAPE se escriben ESCAPE unos y zigzag(d) en 13 bits
+
+Uso:
+  python3 extras/waveforms_rice.py src/utils/WaveformsData.cpp > rice.txt
+"""
+import re
+import sys
+
+BLOCK = 32
+ESCAPE = 16
+RAW_BITS = 12
+ESCAPE_BITS = 13
+
+
+def zigzag(d):
+    return (d << 1) if d >= 0 else ((-d << 1) - 1)
+
+
+class BitWriter:
+    def __init__(self):
+        self.bits = []
+
+    def put(self, value, n):
+        for i in range(n - 1, -1, -1):
+            self.bits.append((value >> i) & 1)
+
+    def to_bytes(self):
+        while len(self.bits) % 8:
+            self.bits.append(0)
+        out = []
+        for i in range(0, len(self.bits), 8):
+            b = 0
+            for bit in self.bits[i:i + 8]:
+                b = (b << 1) | bit
+            out.append(b)
+        return out
+
+
+def code_len(z, k):
+    q = z >> k
+    return ESCAPE + ESCAPE_BITS if q >= ESCAPE else q + 1 + k
+
+
+def encode(samples):
+    w = BitWriter()
+    w.put(samples[0], RAW_BITS)
+    deltas = [zigzag(samples[i] - samples[i - 1]) for i in range(1, len(samples))]
+    for start in range(0, len(deltas), BLOCK):
+        block = deltas[start:start + BLOCK]
+        k = min(range(16), key=lambda kk: sum(code_len(z, kk) for z in block))
+        w.put(k, 4)
+        for z in block:
+            q = z >> k
+            if q >= ESCAPE:
+                w.put((1 << ESCAPE) - 1, ESCAPE)
+                w.put(z, ESCAPE_BITS)
+            else:
+                w.put((1 << (q + 1)) - 2, q + 1)
+                w.put(z & ((1 << k) - 1), k)
+    return w.to_bytes()
+
+
+def main(path):
+    src = open(path, encoding='utf-8').read()
+    start = src.index('waveformsTable[')
+    body = src[src.index('{', start) + 1:src.index('\n};', start)]
+    signals = [[int(v, 16) for v in re.findall(r'0x[0-9A-Fa-f]+', b)]
+               for b in re.findall(r'\{([^{}]*)\}', body)]
+
+    data, offsets = [], []
+    for s in signals:
+        offsets.append(len(data))
+        data.extend(encode(s))
+
+    print('const uint32_t waveformsRiceOffset[waveformsNumSignals] = {')
+    print('    ' + ', '.join(str(o) for o in offsets))
+    print('};\n')
+    print('const uint8_t waveformsRiceData[%d] = {' % len(data))
+    for i in range(0, len(data), 16):
+        print('    ' + ', '.join('0x%02X' % b for b in data[i:i + 16]) + ',')
+    print('};')
+    sys.stderr.write('%d bytes (tabla sin comprimir: %d bytes)\n'
+                     % (len(data), 2 * sum(len(s) for s in signals)))
+
+
+if __name__ == '__main__':
+    main(sys.argv[1] if len(sys.argv) > 1 else 'src/utils/WaveformsData.cpp')
@@ -8,13 +8,33 @@
 
  #include <Arduino.h>
  #include <arm_math.h>
+ #include "BioFilterLibConfig.h"
  
  #include "filters/FIRFilter.h"
  #include "filters/IIRFilter.h"
  #include "filters/LMSFilter.h"
  #include "filters/WaveletFilter.h"
+ #include "filters/FilterChain.h"
+ #include "filters/Resampler.h"
+ #include "filters/QRSDetector.h"
+ #include "filters/MovingAverage.h"
+ #include "filters/CICFilter.h"
+ #include "filters/MedianFilter.h"
+ #include "filters/EMGEnvelope.h"
+ #include "filters/InterferenceDetector.h"
+ #include "filters/EEGBandPower.h"
+ #include "filters/STFT.h"
+ #include "filters/FIRDesign.h"
+ #include "filters/SavitzkyGolay.h"
+ #include "filters/HilbertFilter.h"
  #include "utils/utils.h"
  #include "utils/Waveforms.h"
+ #include "utils/SignalSource.h"
+#include "utils/SignalGenerator.h"
+#include "utils/Telemetry.h"
+#include "utils/SpscBlockQueue.h"
+#include "utils/Profiler.h"
+#include "utils/Trace.h"
  #include "utils/utils_extended.h"
  
  #endif // BIOFILTERLIB_H
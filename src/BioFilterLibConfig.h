@@ -0,0 +1,60 @@
+/**
+ * @file BioFilterLibConfig.h
+ * @brief Opciones de compilación de BioFilterLib
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @details El IDE de Arduino compila las librerías por separado del sketch, por lo
+ * que un `#define` en el .ino no llega a los .cpp de la librería. Las opciones
+ * globales se fijan aquí (o con -D en las build flags de la plataforma).
+ */
+
+#ifndef BIOFILTERLIB_CONFIG_H
+#define BIOFILTERLIB_CONFIG_H
+
+/**
+ * @brief Formato de almacenamiento de las señales de prueba (Waveforms.h)
+ *
+ * - 0: tabla uint16_t sin comprimir (~27 KB de flash)
+ * - 1: flujo delta + Rice decodificado en streaming (~16 KB de flash)
+ */
+#ifndef BIOFILTERLIB_WAVEFORMS_RICE
+#define BIOFILTERLIB_WAVEFORMS_RICE 1
+#endif
+
+/**
+ * @brief Separación (bytes) entre los índices de productor y consumidor de SpscBlockQueue
+ *
+ * En PC cada índice ocupa su propia línea de caché para evitar false sharing entre
+ * hilos. El Cortex-M3 del Due no tiene caché de datos: basta con 4 bytes.
+ */
+#ifndef BIOFILTERLIB_CACHE_LINE
+#if defined(ARDUINO)
+#define BIOFILTERLIB_CACHE_LINE 4
+#else
+#define BIOFILTERLIB_CACHE_LINE 64
+#endif
+#endif
+
+/**
+ * @brief Medida de ciclos por llamada (Profiler.h)
+ *
+ * - 0: CycleHistogram y Profiled<Filter> no añaden código ni memoria
+ * - 1: histograma de ciclos, plazos incumplidos y peor llamada (~1 KB por histograma)
+ */
+#ifndef BIOFILTERLIB_PROFILE
+#define BIOFILTERLIB_PROFILE 0
+#endif
+
+/**
+ * @brief Trazas de inicio/fin por llamada (Trace.h)
+ *
+ * - 0: TraceBuffer y Traced<Filter> no añaden código ni memoria
+ * - 1: anillo de eventos para exportar a Chrome trace / Perfetto (12 B por evento)
+ */
+#ifndef BIOFILTERLIB_TRACE
+#define BIOFILTERLIB_TRACE 0
+#endif
+
+#endif // BIOFILTERLIB_CONFIG_H
@@ -0,0 +1,223 @@
+/**
+ * @file CICFilter.cpp
+ * @brief Implementación de los filtros CIC en float e int16
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @see CICFilter.h para la respuesta en frecuencia y los límites de crecimiento
+ */
+
+#include "CICFilter.h"
+#include <string.h>
+
+#define CIC_MAX_GAIN  65536UL    // 16 bits de crecimiento sobre la entrada int16
+
+// ============================================================================
+// CICFilter
+// ============================================================================
+
+CICFilter::CICFilter(uint8_t numStages, uint16_t decimation, uint8_t differentialDelay)
+    : _numStages(numStages ? numStages : 1),
+      _decimation(decimation ? decimation : 1),
+      _phase(0)
+{
+    _window = (uint16_t)(_decimation * (differentialDelay ? differentialDelay : 1));
+    _stages = new MovingAverageFilter*[_numStages];
+    for (uint8_t s = 0; s < _numStages; s++) {
+        _stages[s] = new MovingAverageFilter(_window);
+    }
+}
+
+CICFilter::CICFilter(const CICFilter& other)
+    : _numStages(other._numStages),
+      _decimation(other._decimation),
+      _window(other._window),
+      _phase(other._phase)
+{
+    _stages = new MovingAverageFilter*[_numStages];
+    for (uint8_t s = 0; s < _numStages; s++) {
+        _stages[s] = new MovingAverageFilter(*other._stages[s]);
+    }
+}
+
+CICFilter::~CICFilter() {
+    for (uint8_t s = 0; s < _numStages; s++) {
+        delete _stages[s];
+    }
+    delete[] _stages;
+}
+
+/**
+ * @details Las medias móviles corren a la frecuencia de entrada: al ser O(1) por
+ * muestra, el coste es el mismo que el de los integradores de la forma clásica y se
+ * evita que un acumulador float crezca sin límite.
+ */
+uint32_t CICFilter::processBuffer(float32_t* input, uint32_t inputLength, float32_t* output) {
+    uint32_t produced = 0;
+    for (uint32_t i = 0; i < inputLength; i++) {
+        float32_t value = input[i];
+        for (uint8_t s = 0; s < _numStages; s++) {
+            value = _stages[s]->processSample(value);
+        }
+        if (++_phase == _decimation) {
+            _phase = 0;
+            output[produced++] = value;
+        }
+    }
+    return produced;
+}
+
+uint32_t CICFilter::getMaxOutputLength(uint32_t inputLength) const {
+    return inputLength / _decimation + 1;
+}
+
+float32_t CICFilter::getMagnitude(float32_t normalizedFrequency) const {
+    float32_t x = PI * normalizedFrequency;
+    float32_t denominator = _window * sinf(x);
+    float32_t stage = (fabsf(denominator) < 1e-9f) ? 1.0f : fabsf(sinf(_window * x) / denominator);
+
+    float32_t magnitude = 1.0f;
+    for (uint8_t s = 0; s < _numStages; s++) {
+        magnitude *= stage;
+    }
+    return magnitude;
+}
+
+float32_t CICFilter::getGroupDelay() const {
+    return _numStages * (_window - 1) * 0.5f;
+}
+
+void CICFilter::reset() {
+    for (uint8_t s = 0; s < _numStages; s++) {
+        _stages[s]->reset();
+    }
+    _phase = 0;
+}
+
+uint32_t CICFilter::getMemoryUsage() const {
+    uint32_t total = sizeof(CICFilter) + _numStages * sizeof(MovingAverageFilter*);
+    for (uint8_t s = 0; s < _numStages; s++) {
+        total += _stages[s]->getMemoryUsage();
+    }
+    return total;
+}
+
+// ============================================================================
+// CICFilterInt16
+// ============================================================================
+
+CICFilterInt16::CICFilterInt16(uint8_t numStages, uint16_t decimation, uint8_t differentialDelay)
+    : _numStages(numStages ? numStages : 1),
+      _decimation(decimation ? decimation : 1),
+      _delay(differentialDelay ? differentialDelay : 1),
+      _phase(0),
+      _combPos(0)
+{
+    uint64_t gain = 1;
+    for (uint8_t s = 0; s < _numStages && gain <= CIC_MAX_GAIN; s++) {
+        gain *= (uint32_t)_decimation * _delay;
+    }
+    _gain = (gain <= CIC_MAX_GAIN) ? (uint32_t)gain : 0;
+
+    _integrators = new uint32_t[_numStages]();
+    _combs = new uint32_t[(uint32_t)_numStages * _delay]();
+}
+
+CICFilterInt16::CICFilterInt16(const CICFilterInt16& other)
+    : _numStages(other._numStages),
+      _decimation(other._decimation),
+      _delay(other._delay),
+      _phase(other._phase),
+      _gain(other._gain),
+      _combPos(other._combPos)
+{
+    _integrators = new uint32_t[_numStages];
+    _combs = new uint32_t[(uint32_t)_numStages * _delay];
+    memcpy(_integrators, other._integrators, _numStages * sizeof(uint32_t));
+    memcpy(_combs, other._combs, (uint32_t)_numStages * _delay * sizeof(uint32_t));
+}
+
+CICFilterInt16::~CICFilterInt16() {
+    delete[] _integrators;
+    delete[] _combs;
+}
+
+bool CICFilterInt16::integrate(int16_t input) {
+    uint32_t value = (uint32_t)(int32_t)input;
+    for (uint8_t s = 0; s < _numStages; s++) {
+        _integrators[s] += value;
+        value = _integrators[s];
+    }
+    if (++_phase == _decimation) {
+        _phase = 0;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @details Cada peine resta su entrada de hace M salidas. Con aritmética modular el
+ * resultado final es exacto aunque los integradores hayan desbordado, siempre que
+ * quepa en 32 bits con signo (garantizado por _gain <= 2^16).
+ */
+int32_t CICFilterInt16::comb() {
+    uint32_t value = _integrators[_numStages - 1];
+    for (uint8_t s = 0; s < _numStages; s++) {
+        uint32_t* delayed = _combs + (uint32_t)s * _delay + _combPos;
+        uint32_t previous = *delayed;
+        *delayed = value;
+        value -= previous;
+    }
+    if (++_combPos == _delay) {
+        _combPos = 0;
+    }
+    return (int32_t)value;
+}
+
+uint32_t CICFilterInt16::processBuffer(int16_t* input, uint32_t inputLength, int16_t* output) {
+    if (!isValid()) {
+        return 0;
+    }
+    int64_t half = _gain / 2;
+    uint32_t produced = 0;
+    for (uint32_t i = 0; i < inputLength; i++) {
+        if (integrate(input[i])) {
+            int64_t sum = comb();
+            output[produced++] = (int16_t)((sum >= 0 ? sum + half : sum - half) / (int64_t)_gain);
+        }
+    }
+    return produced;
+}
+
+uint32_t CICFilterInt16::processBufferRaw(int16_t* input, uint32_t inputLength, int32_t* output) {
+    if (!isValid()) {
+        return 0;
+    }
+    uint32_t produced = 0;
+    for (uint32_t i = 0; i < inputLength; i++) {
+        if (integrate(input[i])) {
+            output[produced++] = comb();
+        }
+    }
+    return produced;
+}
+
+uint32_t CICFilterInt16::getMaxOutputLength(uint32_t inputLength) const {
+    return inputLength / _decimation + 1;
+}
+
+float32_t CICFilterInt16::getGroupDelay() const {
+    return _numStages * ((uint32_t)_decimation * _delay - 1) * 0.5f;
+}
+
+void CICFilterInt16::reset() {
+    memset(_integrators, 0, _numStages * sizeof(uint32_t));
+    memset(_combs, 0, (uint32_t)_numStages * _delay * sizeof(uint32_t));
+    _phase = 0;
+    _combPos = 0;
+}
+
+uint32_t CICFilterInt16::getMemoryUsage() const {
+    return sizeof(CICFilterInt16) + ((uint32_t)_numStages * (1 + _delay)) * sizeof(uint32_t);
+}
@@ -0,0 +1,176 @@
+/**
+ * @file CICFilter.h
+ * @brief Filtros CIC (cascaded integrator-comb) de varias etapas con decimación, en float e int16
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @details Un CIC de N etapas, factor de decimación R y retardo diferencial M es la
+ * cascada de N medias móviles de R·M muestras seguida de la decimación por R:
+ *
+ *     H(z) = [ (1 - z^(-R·M)) / (R·M · (1 - z^(-1))) ]^N
+ *
+ * Cada etapa añade un cero de orden 1 en los múltiplos de Fs / (R·M), justo donde caen
+ * las bandas que se pliegan sobre continua al diezmar, y el lóbulo lateral baja unos
+ * 13 dB por etapa. No hay multiplicaciones por coeficientes y el coste por muestra no
+ * depende de R·M: es el diezmador previo habitual antes de un FIR corto de compensación.
+ *
+ * - CICFilter (float32_t): N MovingAverageFilter en cascada (O(1) por etapa, con la
+ *   suma exacta que renuevan en cada vuelta); salida ya normalizada a ganancia 1.
+ * - CICFilterInt16 (int16_t): estructura clásica de Hogenauer, N integradores a la
+ *   frecuencia de entrada y N peines a la de salida, en aritmética entera modular de
+ *   32 bits. El desbordamiento de los integradores se cancela en los peines, así que
+ *   el resultado es exacto mientras N·log2(R·M) <= 16 (isValid()).
+ *
+ * Los dos siguen la interfaz de los conversores de Resampler.h: processBuffer() recibe
+ * un bloque de cualquier longitud y devuelve las salidas producidas.
+ *
+ * @par Ejemplo
+ * @code
+ * // ECG a 960 Hz -> 240 Hz con un CIC de 3 etapas
+ * CICFilter cic(3, 4);
+ * float32_t out[8];
+ * uint32_t n = cic.processBuffer(input, 32, out);    // 8 salidas
+ *
+ * // ADC de 12 bits sobremuestreado a 16 kHz -> 1 kHz
+ * CICFilterInt16 adcCic(4, 16);                      // 4·log2(16) = 16 bits de crecimiento
+ * n = adcCic.processBuffer(adcCounts, 256, decimated);
+ * @endcode
+ */
+
+#ifndef CIC_FILTER_H
+#define CIC_FILTER_H
+
+#include <arm_math.h>
+#include "MovingAverage.h"
+
+/**
+ * @class CICFilter
+ * @brief CIC en coma flotante con ganancia unidad
+ */
+class CICFilter {
+    public:
+        /**
+         * @param numStages Etapas N (>= 1)
+         * @param decimation Factor de decimación R (1 = sin decimación)
+         * @param differentialDelay Retardo diferencial M (normalmente 1 o 2)
+         */
+        CICFilter(uint8_t numStages, uint16_t decimation, uint8_t differentialDelay = 1);
+        CICFilter(const CICFilter& other);
+        ~CICFilter();
+
+        /**
+         * @brief Filtra y diezma un bloque de cualquier longitud
+         *
+         * @param output Destino; debe admitir getMaxOutputLength(inputLength) muestras
+         * @return uint32_t Muestras de salida escritas
+         */
+        uint32_t processBuffer(float32_t* input, uint32_t inputLength, float32_t* output);
+
+        /**
+         * @brief Cota superior de salidas para un bloque de entrada
+         */
+        uint32_t getMaxOutputLength(uint32_t inputLength) const;
+
+        /**
+         * @brief Ganancia en amplitud a una frecuencia normalizada a la entrada (0-0.5)
+         */
+        float32_t getMagnitude(float32_t normalizedFrequency) const;
+
+        /**
+         * @brief Retardo de grupo: N·(R·M - 1)/2 muestras de entrada
+         */
+        float32_t getGroupDelay() const;
+
+        void reset();
+        uint32_t getMemoryUsage() const;
+
+        uint8_t getNumStages() const { return _numStages; }
+        uint16_t getDecimation() const { return _decimation; }
+
+    private:
+        CICFilter& operator=(const CICFilter&);
+
+        uint8_t _numStages;
+        uint16_t _decimation;
+        uint16_t _window;                ///< R·M
+        uint16_t _phase;                 ///< Muestras desde la última salida
+        MovingAverageFilter** _stages;
+};
+
+/**
+ * @class CICFilterInt16
+ * @brief CIC entero de Hogenauer para muestras int16_t
+ */
+class CICFilterInt16 {
+    public:
+        /**
+         * @param numStages Etapas N (>= 1)
+         * @param decimation Factor de decimación R (1 = sin decimación)
+         * @param differentialDelay Retardo diferencial M (normalmente 1 o 2)
+         */
+        CICFilterInt16(uint8_t numStages, uint16_t decimation, uint8_t differentialDelay = 1);
+        CICFilterInt16(const CICFilterInt16& other);
+        ~CICFilterInt16();
+
+        /**
+         * @brief Filtra y diezma un bloque; la salida se divide por (R·M)^N con redondeo
+         *
+         * @return uint32_t Muestras de salida escritas (0 si !isValid())
+         */
+        uint32_t processBuffer(int16_t* input, uint32_t inputLength, int16_t* output);
+
+        /**
+         * @brief Igual que processBuffer() pero sin normalizar: entrega la suma entera
+         * (ganancia (R·M)^N) para no perder los bits de resolución que gana el CIC
+         */
+        uint32_t processBufferRaw(int16_t* input, uint32_t inputLength, int32_t* output);
+
+        uint32_t getMaxOutputLength(uint32_t inputLength) const;
+
+        /**
+         * @brief false si el crecimiento N·log2(R·M) no cabe en 32 bits con entrada de 16
+         */
+        bool isValid() const { return _gain != 0; }
+
+        /**
+         * @brief Ganancia en continua (R·M)^N de la salida sin normalizar
+         */
+        uint32_t getGain() const { return _gain; }
+
+        float32_t getGroupDelay() const;
+
+        void reset();
+        uint32_t getMemoryUsage() const;
+
+        uint8_t getNumStages() const { return _numStages; }
+        uint16_t getDecimation() const { return _decimation; }
+
+    private:
+        CICFilterInt16& operator=(const CICFilterInt16&);
+
+        /**
+         * @brief Integradores sobre una muestra; devuelve true si toca salida
+         */
+        bool integrate(int16_t input);
+
+        /**
+         * @brief Peines a la frecuencia de salida sobre el último integrador
+         */
+        int32_t comb();
+
+        uint8_t _numStages;
+        uint16_t _decimation;
+        uint8_t _delay;                  ///< M
+        uint16_t _phase;
+        uint32_t _gain;                  ///< (R·M)^N, 0 si no es válido
+
+        /**
+         * @brief Aritmética sin signo: el desbordamiento es modular y está definido
+         */
+        uint32_t* _integrators;          ///< N acumuladores
+        uint32_t* _combs;                ///< N × M entradas retrasadas de los peines
+        uint8_t _combPos;
+};
+
+#endif // CIC_FILTER_H
@@ -0,0 +1,319 @@
+/**
+ * @file EEGBandPower.cpp
+ * @brief Implementación del diezmador de media banda y de la potencia por bandas de EEG
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @see EEGBandPower.h para la elección del nivel de cada banda
+ */
+
+#include "EEGBandPower.h"
+#include <string.h>
+
+#define EEG_MAX_LEVELS  8        // Hasta Fs/256: delta a 0.5 Hz con Fs de 2 kHz
+
+static const EEGBand DEFAULT_BANDS[EEG_NUM_BANDS] = {
+    {0.5f, 4.0f}, {4.0f, 8.0f}, {8.0f, 13.0f}, {13.0f, 30.0f}, {30.0f, 45.0f}
+};
+
+// ============================================================================
+// HalfBandDecimator
+// ============================================================================
+
+HalfBandDecimator::HalfBandDecimator(const float32_t* coeffs, uint8_t numCoeffs)
+    : _coeffs(coeffs),
+      _numCoeffs(numCoeffs ? numCoeffs : 1)
+{
+    _history = new float32_t[4 * _numCoeffs];
+    _center = new float32_t[_numCoeffs];
+    reset();
+}
+
+HalfBandDecimator::~HalfBandDecimator() {
+    delete[] _history;
+    delete[] _center;
+}
+
+void HalfBandDecimator::design(float32_t* coeffs, uint8_t numCoeffs) {
+    uint16_t span = 4 * numCoeffs - 2;           // numTaps - 1
+    float32_t sum = 0.0f;
+    for (uint8_t j = 0; j < numCoeffs; j++) {
+        float32_t d = (float32_t)(2 * numCoeffs - 1 - 2 * j);
+        float32_t sinc = sinf(0.5f * PI * d) / (PI * d);
+        float32_t w = 0.54f + 0.46f * cosf(2.0f * PI * d / span);
+        coeffs[j] = sinc * w;
+        sum += coeffs[j];
+    }
+    // Las dos mitades suman 0.5 y el centro otros 0.5
+    float32_t gain = (sum != 0.0f) ? 0.25f / sum : 0.0f;
+    for (uint8_t j = 0; j < numCoeffs; j++) {
+        coeffs[j] *= gain;
+    }
+}
+
+float32_t HalfBandDecimator::getUsableBandwidth(uint8_t numCoeffs) {
+    // Transición de Hamming ~3.3 / N ciclos/muestra centrada en Fs/4; lo que cae más
+    // allá del borde de la banda de rechazo se pliega hasta 0.5 - 3.3/N de la salida
+    return 0.5f - 3.3f / (4.0f * numCoeffs - 1.0f);
+}
+
+/**
+ * @details Las muestras que producen salida (una de cada dos) se guardan duplicadas en
+ * _history: las 2K más recientes, de la más antigua a la más nueva, son
+ * _history[pos .. pos + 2K - 1], y son las que multiplican los coeficientes no nulos
+ * (plegados: coeficiente j con la muestra j y con la 2K-1-j). De las otras solo importa
+ * la que coincide con el centro, la K-ésima más reciente.
+ */
+uint32_t HalfBandDecimator::processBuffer(float32_t* input, uint32_t inputLength, float32_t* output) {
+    uint32_t produced = 0;
+    uint8_t span = 2 * _numCoeffs;
+    for (uint32_t i = 0; i < inputLength; i++) {
+        float32_t x = input[i];
+        if (!_phase) {
+            _center[_centerPos] = x;
+            if (++_centerPos == _numCoeffs) {
+                _centerPos = 0;
+            }
+            _phase = true;
+            continue;
+        }
+
+        _history[_historyPos] = x;
+        _history[_historyPos + span] = x;
+        if (++_historyPos == span) {
+            _historyPos = 0;
+        }
+
+        const float32_t* window = _history + _historyPos;
+        float32_t acc = 0.5f * _center[_centerPos];
+        for (uint8_t j = 0; j < _numCoeffs; j++) {
+            acc += _coeffs[j] * (window[j] + window[span - 1 - j]);
+        }
+        output[produced++] = acc;
+        _phase = false;
+    }
+    return produced;
+}
+
+void HalfBandDecimator::reset() {
+    memset(_history, 0, 4 * _numCoeffs * sizeof(float32_t));
+    memset(_center, 0, _numCoeffs * sizeof(float32_t));
+    _historyPos = 0;
+    _centerPos = 0;
+    _phase = false;
+}
+
+uint32_t HalfBandDecimator::getMemoryUsage() const {
+    return sizeof(HalfBandDecimator) + 5 * _numCoeffs * sizeof(float32_t);
+}
+
+// ============================================================================
+// EEGBandPower
+// ============================================================================
+
+EEGBandPower::EEGBandPower(uint16_t numChannels, float32_t sampleRate, const EEGBand* bands,
+                           uint8_t numBands, float32_t smoothing, uint16_t blockSize,
+                           uint8_t halfBandCoeffs)
+    : _numChannels(numChannels ? numChannels : 1),
+      _sampleRate(sampleRate),
+      _blockSize(blockSize ? blockSize : 1),
+      _halfBandTaps(halfBandCoeffs ? halfBandCoeffs : 1)
+{
+    if (bands == nullptr || numBands == 0) {
+        bands = DEFAULT_BANDS;
+        numBands = EEG_NUM_BANDS;
+    }
+    _numBands = numBands;
+    _bands = new EEGBand[_numBands];
+    memcpy(_bands, bands, _numBands * sizeof(EEGBand));
+
+    _halfBandCoeffs = new float32_t[_halfBandTaps];
+    HalfBandDecimator::design(_halfBandCoeffs, _halfBandTaps);
+    float32_t usable = HalfBandDecimator::getUsableBandwidth(_halfBandTaps);
+
+    // Cada banda baja hasta el último nivel cuya banda útil todavía la contiene
+    _bandLevel = new uint8_t[_numBands];
+    _bandCoeffs = new float32_t[10 * _numBands];
+    _alpha = new float32_t[_numBands];
+    _numLevels = 0;
+    for (uint8_t b = 0; b < _numBands; b++) {
+        uint8_t level = 0;
+        while (level < EEG_MAX_LEVELS && _bands[b].high <= usable * _sampleRate / (1UL << (level + 1))) {
+            level++;
+        }
+        _bandLevel[b] = level;
+        if (level > _numLevels) {
+            _numLevels = level;
+        }
+
+        float32_t rate = getBandRate(b);
+        float32_t high = _bands[b].high < 0.49f * rate ? _bands[b].high : 0.49f * rate;
+        float32_t low = _bands[b].low > 0.001f * rate ? _bands[b].low : 0.001f * rate;
+        designBandpass(_bandCoeffs + 10 * b, low, high, rate);
+        _alpha[b] = (smoothing > 0.0f) ? 1.0f - expf(-1.0f / (rate * smoothing)) : 1.0f;
+    }
+
+    _decimators = new HalfBandDecimator*[_numChannels * _numLevels];
+    for (uint32_t d = 0; d < (uint32_t)_numChannels * _numLevels; d++) {
+        _decimators[d] = new HalfBandDecimator(_halfBandCoeffs, _halfBandTaps);
+    }
+
+    uint32_t filters = (uint32_t)_numChannels * _numBands;
+    _filters = new arm_biquad_casd_df1_inst_f32[filters];
+    _filterState = new float32_t[8 * filters];
+    _power = new float32_t[filters];
+    for (uint32_t f = 0; f < filters; f++) {
+        arm_biquad_cascade_df1_init_f32(&_filters[f], 2, _bandCoeffs + 10 * (f % _numBands), _filterState + 8 * f);
+    }
+
+    _levelBuffer = new float32_t[_blockSize / 2 + 1];
+    _bandBuffer = new float32_t[_blockSize];
+
+    reset();
+}
+
+EEGBandPower::~EEGBandPower() {
+    for (uint32_t d = 0; d < (uint32_t)_numChannels * _numLevels; d++) {
+        delete _decimators[d];
+    }
+    delete[] _decimators;
+    delete[] _filters;
+    delete[] _filterState;
+    delete[] _power;
+    delete[] _levelBuffer;
+    delete[] _bandBuffer;
+    delete[] _halfBandCoeffs;
+    delete[] _alpha;
+    delete[] _bandCoeffs;
+    delete[] _bandLevel;
+    delete[] _bands;
+}
+
+void EEGBandPower::designBandpass(float32_t* coeffs, float32_t low, float32_t high, float32_t sampleRate) {
+    // Predistorsión para la bilineal s = (z - 1) / (z + 1)
+    float32_t wl = tanf(PI * low / sampleRate);
+    float32_t wh = tanf(PI * high / sampleRate);
+    float32_t w0sq = wl * wh;
+    float32_t bw = wh - wl;
+
+    // Polo del prototipo p = (-1 + j) / sqrt(2); cada uno da dos polos pasa-banda,
+    // raíces de s² - p·B·s + w0² = 0. p² = -j, así que el discriminante es -4w0² - j·B²
+    float32_t pReal = -0.70710678f * bw;
+    float32_t pImag = 0.70710678f * bw;
+    float32_t dr = -4.0f * w0sq;
+    float32_t di = -bw * bw;
+    float32_t mag = sqrtf(dr * dr + di * di);
+    float32_t sr = sqrtf(0.5f * (mag + dr));
+    float32_t si = -sqrtf(0.5f * (mag - dr));    // di < 0
+
+    float32_t center = 2.0f * atanf(sqrtf(w0sq));
+    float32_t cos1 = cosf(center), sin1 = sinf(center);
+    float32_t cos2 = cosf(2.0f * center), sin2 = sinf(2.0f * center);
+
+    for (uint8_t k = 0; k < 2; k++) {
+        float32_t sign = k ? -1.0f : 1.0f;
+        float32_t re = 0.5f * (pReal + sign * sr);
+        float32_t im = 0.5f * (pImag + sign * si);
+
+        // z = (1 + s) / (1 - s)
+        float32_t den = (1.0f - re) * (1.0f - re) + im * im;
+        float32_t zr = (1.0f - re * re - im * im) / den;
+        float32_t zi = 2.0f * im / den;
+        float32_t a1 = 2.0f * zr;
+        float32_t a2 = -(zr * zr + zi * zi);
+
+        // Ceros en z = 1 y z = -1; ganancia 1 en el centro de la banda
+        float32_t dre = 1.0f - a1 * cos1 - a2 * cos2;
+        float32_t dim = a1 * sin1 + a2 * sin2;
+        float32_t gain = sqrtf(dre * dre + dim * dim) / (2.0f * sin1);
+
+        float32_t* c = coeffs + 5 * k;
+        c[0] = gain;
+        c[1] = 0.0f;
+        c[2] = -gain;
+        c[3] = a1;
+        c[4] = a2;
+    }
+}
+
+void EEGBandPower::processBuffer(float32_t* const* channels, uint32_t length) {
+    for (uint16_t c = 0; c < _numChannels; c++) {
+        processChannel(c, channels[c], length);
+    }
+}
+
+void EEGBandPower::processChannel(uint16_t channel, float32_t* input, uint32_t length) {
+    HalfBandDecimator** decimators = _decimators + channel * _numLevels;
+    arm_biquad_casd_df1_inst_f32* filters = _filters + channel * _numBands;
+    float32_t* power = _power + channel * _numBands;
+
+    while (length > 0) {
+        uint32_t count = (length < _blockSize) ? length : _blockSize;
+        input += count;
+        length -= count;
+
+        // Nivel 0: la entrada; del 1 en adelante, _levelBuffer diezmado in-place
+        float32_t* signal = input - count;
+        for (uint8_t level = 0; level <= _numLevels && count > 0; level++) {
+            for (uint8_t b = 0; b < _numBands; b++) {
+                if (_bandLevel[b] != level) {
+                    continue;
+                }
+                arm_biquad_cascade_df1_f32(&filters[b], signal, _bandBuffer, count);
+                float32_t p = power[b];
+                float32_t alpha = _alpha[b];
+                for (uint32_t i = 0; i < count; i++) {
+                    p += alpha * (_bandBuffer[i] * _bandBuffer[i] - p);
+                }
+                power[b] = p;
+            }
+            if (level < _numLevels) {
+                count = decimators[level]->processBuffer(signal, count, _levelBuffer);
+                signal = _levelBuffer;
+            }
+        }
+    }
+}
+
+float32_t EEGBandPower::getRelativePower(uint16_t channel, uint8_t band) const {
+    const float32_t* power = _power + channel * _numBands;
+    float32_t total = 0.0f;
+    for (uint8_t b = 0; b < _numBands; b++) {
+        total += power[b];
+    }
+    return (total > 0.0f) ? power[band] / total : 0.0f;
+}
+
+float32_t EEGBandPower::getBandRate(uint8_t band) const {
+    return _sampleRate / (float32_t)(1UL << _bandLevel[band]);
+}
+
+float32_t EEGBandPower::getGroupDelay(uint8_t band) const {
+    // Cada diezmador retrasa 2K-1 muestras de su entrada, que valen 2^nivel de la original
+    return (2.0f * _halfBandTaps - 1.0f) * (float32_t)((1UL << _bandLevel[band]) - 1);
+}
+
+void EEGBandPower::reset() {
+    for (uint32_t d = 0; d < (uint32_t)_numChannels * _numLevels; d++) {
+        _decimators[d]->reset();
+    }
+    uint32_t filters = (uint32_t)_numChannels * _numBands;
+    memset(_filterState, 0, 8 * filters * sizeof(float32_t));
+    memset(_power, 0, filters * sizeof(float32_t));
+}
+
+uint32_t EEGBandPower::getMemoryUsage() const {
+    uint32_t filters = (uint32_t)_numChannels * _numBands;
+    uint32_t decimators = (uint32_t)_numChannels * _numLevels;
+    uint32_t memory = sizeof(EEGBandPower);
+    memory += _numBands * (sizeof(EEGBand) + sizeof(uint8_t) + 11 * sizeof(float32_t));
+    memory += _halfBandTaps * sizeof(float32_t);
+    memory += decimators * sizeof(HalfBandDecimator*);
+    if (decimators > 0) {
+        memory += decimators * _decimators[0]->getMemoryUsage();
+    }
+    memory += filters * (sizeof(arm_biquad_casd_df1_inst_f32) + 9 * sizeof(float32_t));
+    memory += (_blockSize / 2 + 1 + _blockSize) * sizeof(float32_t);
+    return memory;
+}
@@ -0,0 +1,215 @@
+/**
+ * @file EEGBandPower.h
+ * @brief Potencia por bandas de EEG (delta, theta, alfa, beta, gamma) con una cascada de diezmadores de media banda
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @details Calcular las cinco bandas con FIRFilter pasa-banda a plena frecuencia exige
+ * cientos de coeficientes por banda (delta empieza en 0.5 Hz) y por canal. Aquí cada
+ * banda se filtra a la frecuencia más baja que la contiene:
+ *
+ * - HalfBandDecimator: pasa-bajas de media banda (corte en Fs/4) que diezma por 2. En
+ *   un filtro de media banda la mitad de los coeficientes son cero salvo el central, y
+ *   el filtro es simétrico: con 4K-1 coeficientes solo hacen falta K productos por
+ *   salida, es decir, K/2 por muestra de entrada.
+ * - La cascada divide la frecuencia entre 2 en cada nivel. Cada banda se toma en el
+ *   nivel más profundo cuya banda útil (sin aliasing) todavía la cubre, y allí pasa por
+ *   un Butterworth pasa-banda de orden 4 (dos biquads CMSIS).
+ * - La potencia es el cuadrado de la salida del pasa-banda suavizado con un filtro de
+ *   un polo de constante de tiempo fija, igual en todos los niveles.
+ *
+ * El nivel k solo procesa 1/2^k de las muestras, así que toda la cascada cuesta menos
+ * de K productos por muestra de entrada (el doble que el primer diezmador), y los
+ * pasa-banda de las bandas lentas trabajan a 16-30 Hz en vez de a 250 Hz.
+ *
+ * @par Ejemplo
+ * @code
+ * EEGBandPower bands(8, 250.0f);                  // 8 canales, bandas por defecto, 1 s
+ * float32_t* channels[8];                         // un buffer de 32 muestras por canal
+ * bands.processBuffer(channels, 32);
+ * float32_t alpha = bands.getPower(0, EEG_ALPHA); // µV² si la entrada está en µV
+ * @endcode
+ */
+
+#ifndef EEG_BAND_POWER_H
+#define EEG_BAND_POWER_H
+
+#include <arm_math.h>
+
+/**
+ * @brief Índices de las bandas por defecto
+ */
+enum EEGBandIndex {
+    EEG_DELTA = 0,                   ///< 0.5 - 4 Hz
+    EEG_THETA,                       ///< 4 - 8 Hz
+    EEG_ALPHA,                       ///< 8 - 13 Hz
+    EEG_BETA,                        ///< 13 - 30 Hz
+    EEG_GAMMA,                       ///< 30 - 45 Hz
+    EEG_NUM_BANDS
+};
+
+/**
+ * @brief Límites de una banda (Hz)
+ */
+struct EEGBand {
+    float32_t low;
+    float32_t high;
+};
+
+/**
+ * @class HalfBandDecimator
+ * @brief Pasa-bajas de media banda y diezmado por 2 que solo multiplica los coeficientes no nulos
+ */
+class HalfBandDecimator {
+    public:
+        /**
+         * @param coeffs K coeficientes no nulos fuera del centro, del más externo al más
+         * interno (ver design()). No se copian: deben seguir existiendo
+         * @param numCoeffs K; el filtro tiene 4K-1 coeficientes
+         */
+        HalfBandDecimator(const float32_t* coeffs, uint8_t numCoeffs);
+        ~HalfBandDecimator();
+
+        /**
+         * @brief Filtra y diezma un bloque de cualquier longitud (puede trabajar in-place)
+         * @return uint32_t Muestras escritas (getMaxOutputLength(inputLength) como mucho)
+         */
+        uint32_t processBuffer(float32_t* input, uint32_t inputLength, float32_t* output);
+
+        uint32_t getMaxOutputLength(uint32_t inputLength) const { return inputLength / 2 + 1; }
+
+        /**
+         * @brief Retardo en muestras de entrada: (numTaps - 1) / 2
+         */
+        float32_t getGroupDelay() const { return 2.0f * _numCoeffs - 1.0f; }
+
+        uint16_t getNumTaps() const { return 4 * _numCoeffs - 1; }
+
+        void reset();
+        uint32_t getMemoryUsage() const;
+
+        /**
+         * @brief Diseña un media banda con ventana de Hamming (~53 dB de rechazo)
+         *
+         * @details h[d] = sin(πd/2)/(πd)·w(d) es cero para todo d par salvo el centro
+         * (0.5). Se devuelven los K valores de d impar, de d = 2K-1 a d = 1,
+         * normalizados para ganancia 1 en continua.
+         */
+        static void design(float32_t* coeffs, uint8_t numCoeffs);
+
+        /**
+         * @brief Fracción de la frecuencia de salida que queda sin aliasing (< 0.5)
+         */
+        static float32_t getUsableBandwidth(uint8_t numCoeffs);
+
+    private:
+        // No copiable: posee el historial
+        HalfBandDecimator(const HalfBandDecimator&);
+        HalfBandDecimator& operator=(const HalfBandDecimator&);
+
+        const float32_t* _coeffs;
+        uint8_t _numCoeffs;
+        float32_t* _history;             ///< Muestras de la fase de salida, duplicadas (4K)
+        float32_t* _center;              ///< Muestras de la otra fase: solo el coeficiente central (K)
+        uint8_t _historyPos;
+        uint8_t _centerPos;
+        bool _phase;                     ///< true si la siguiente muestra produce salida
+};
+
+/**
+ * @class EEGBandPower
+ * @brief Potencia suavizada por banda y canal a partir de una cascada de HalfBandDecimator
+ */
+class EEGBandPower {
+    public:
+        /**
+         * @param numChannels Número de canales
+         * @param sampleRate Frecuencia de muestreo (Hz)
+         * @param bands Bandas (nullptr = delta, theta, alfa, beta y gamma); se copian
+         * @param numBands Número de bandas (si bands no es nullptr)
+         * @param smoothing Constante de tiempo del suavizado de la potencia (s)
+         * @param blockSize Tamaño de bloque interno (los bloques mayores se trocean)
+         * @param halfBandCoeffs K de los diezmadores (4K-1 coeficientes)
+         */
+        EEGBandPower(uint16_t numChannels, float32_t sampleRate, const EEGBand* bands = nullptr,
+                     uint8_t numBands = 0, float32_t smoothing = 1.0f, uint16_t blockSize = 32,
+                     uint8_t halfBandCoeffs = 8);
+        ~EEGBandPower();
+
+        /**
+         * @brief Procesa length muestras de todos los canales (un buffer por canal)
+         */
+        void processBuffer(float32_t* const* channels, uint32_t length);
+
+        /**
+         * @brief Procesa length muestras de un canal
+         */
+        void processChannel(uint16_t channel, float32_t* input, uint32_t length);
+
+        /**
+         * @brief Potencia suavizada de la banda (unidades de la entrada al cuadrado)
+         */
+        float32_t getPower(uint16_t channel, uint8_t band) const { return _power[channel * _numBands + band]; }
+
+        /**
+         * @brief Potencia de la banda dividida entre la suma de todas las bandas del canal
+         */
+        float32_t getRelativePower(uint16_t channel, uint8_t band) const;
+
+        uint16_t getNumChannels() const { return _numChannels; }
+        uint8_t getNumBands() const { return _numBands; }
+        const EEGBand& getBand(uint8_t band) const { return _bands[band]; }
+
+        /**
+         * @brief Nivel de la cascada en que se filtra la banda (0 = frecuencia de entrada)
+         */
+        uint8_t getLevel(uint8_t band) const { return _bandLevel[band]; }
+        float32_t getBandRate(uint8_t band) const;
+        uint8_t getNumLevels() const { return _numLevels; }
+
+        /**
+         * @brief Retardo de los diezmadores hasta el nivel de la banda, en muestras de entrada
+         */
+        float32_t getGroupDelay(uint8_t band) const;
+
+        void reset();
+        uint32_t getMemoryUsage() const;
+
+        /**
+         * @brief Butterworth pasa-banda de orden 4 como dos biquads CMSIS {b0, b1, b2, a1, a2}
+         *
+         * @details Transformación pasa-banda del prototipo de orden 2 y bilineal con
+         * predistorsión: -3 dB exactos en low y high, ganancia 1 en sqrt(low·high).
+         */
+        static void designBandpass(float32_t* coeffs, float32_t low, float32_t high, float32_t sampleRate);
+
+    private:
+        // No copiable: posee los diezmadores y los estados
+        EEGBandPower(const EEGBandPower&);
+        EEGBandPower& operator=(const EEGBandPower&);
+
+        uint16_t _numChannels;
+        float32_t _sampleRate;
+        uint8_t _numBands;
+        uint8_t _numLevels;              ///< Diezmadores por canal
+        uint16_t _blockSize;
+
+        EEGBand* _bands;
+        uint8_t* _bandLevel;
+        float32_t* _bandCoeffs;          ///< 10 por banda, compartidos por todos los canales
+        float32_t* _alpha;               ///< Coeficiente del suavizado de cada banda (depende del nivel)
+
+        float32_t* _halfBandCoeffs;
+        uint8_t _halfBandTaps;           ///< K
+        HalfBandDecimator** _decimators; ///< [canal · numLevels + nivel]
+
+        arm_biquad_casd_df1_inst_f32* _filters;   ///< [canal · numBands + banda]
+        float32_t* _filterState;         ///< 8 por filtro
+        float32_t* _power;
+
+        float32_t* _levelBuffer;         ///< Señal del nivel actual (blockSize / 2 + 1)
+        float32_t* _bandBuffer;          ///< Salida del pasa-banda (blockSize)
+};
+
+#endif // EEG_BAND_POWER_H
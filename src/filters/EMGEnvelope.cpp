@@ -0,0 +1,118 @@
+/**
+ * @file EMGEnvelope.cpp
+ * @brief Implementación de la envolvente y RMS de EMG diezmadas
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @see EMGEnvelope.h para la estructura del cálculo
+ */
+
+#include "EMGEnvelope.h"
+#include <string.h>
+
+#define EMG_MAX_TAPS  1023
+
+EMGEnvelope::EMGEnvelope(float32_t sampleRate, float32_t outputRate, float32_t cutoff, float32_t rmsWindow)
+    : _sampleRate(sampleRate)
+{
+    _decimation = (outputRate > 0.0f) ? (uint16_t)(sampleRate / outputRate + 0.5f) : 1;
+    if (_decimation == 0) {
+        _decimation = 1;
+    }
+
+    // Transición de Hamming ~3.3 / N ciclos/muestra: de cutoff a la Nyquist de salida
+    float32_t outputNyquist = 0.5f * sampleRate / _decimation;
+    float32_t transition = (outputNyquist > cutoff) ? (outputNyquist - cutoff) / sampleRate : 0.5f / _decimation;
+    uint32_t taps = (uint32_t)(3.3f / transition) | 1;
+    if (taps > EMG_MAX_TAPS) {
+        taps = EMG_MAX_TAPS;
+    }
+    _numTaps = (uint16_t)taps;
+    _coeffs = new float32_t[_numTaps];
+    designLowpass(cutoff);
+
+    _history = new float32_t[2 * _numTaps];
+
+    float32_t period = (float32_t)_decimation / sampleRate;
+    _rmsBlocks = (uint16_t)(rmsWindow / period + 0.5f);
+    if (_rmsBlocks == 0) {
+        _rmsBlocks = 1;
+    }
+    _rmsAverage = new MovingAverageFilter(_rmsBlocks);
+
+    reset();
+}
+
+EMGEnvelope::~EMGEnvelope() {
+    delete[] _coeffs;
+    delete[] _history;
+    delete _rmsAverage;
+}
+
+void EMGEnvelope::designLowpass(float32_t cutoff) {
+    float32_t fc = cutoff / _sampleRate;
+    float32_t center = (_numTaps - 1) * 0.5f;
+    float32_t sum = 0.0f;
+    for (uint16_t n = 0; n < _numTaps; n++) {
+        float32_t t = n - center;
+        float32_t sinc = (fabsf(t) < 1e-6f) ? 2.0f * fc : sinf(2.0f * PI * fc * t) / (PI * t);
+        float32_t w = (_numTaps > 1) ? 0.54f - 0.46f * cosf(2.0f * PI * n / (_numTaps - 1)) : 1.0f;
+        _coeffs[n] = sinc * w;
+        sum += _coeffs[n];
+    }
+    float32_t gain = (sum != 0.0f) ? 1.0f / sum : 0.0f;
+    for (uint16_t n = 0; n < _numTaps; n++) {
+        _coeffs[n] *= gain;
+    }
+}
+
+/**
+ * @details Cada muestra se escribe rectificada en _history[pos] y _history[pos + N];
+ * las N más recientes, de la más antigua a la más nueva, son _history[pos + 1 .. pos + N].
+ * Los coeficientes son simétricos, así que el orden del producto escalar es indiferente.
+ */
+uint32_t EMGEnvelope::processBuffer(float32_t* input, uint32_t length, float32_t* envelope, float32_t* rms) {
+    uint32_t produced = 0;
+    for (uint32_t i = 0; i < length; i++) {
+        float32_t x = input[i];
+        float32_t rectified = fabsf(x);
+        _history[_historyPos] = rectified;
+        _history[_historyPos + _numTaps] = rectified;
+        _blockEnergy += x * x;
+
+        if (++_historyPos == _numTaps) {
+            _historyPos = 0;
+        }
+
+        if (++_phase == _decimation) {
+            _phase = 0;
+            if (envelope != nullptr) {
+                arm_dot_prod_f32(_history + _historyPos, _coeffs, _numTaps, envelope + produced);
+            }
+            float32_t meanSquare = _rmsAverage->processSample(_blockEnergy) / _decimation;
+            _blockEnergy = 0.0f;
+            if (rms != nullptr) {
+                arm_sqrt_f32(meanSquare > 0.0f ? meanSquare : 0.0f, rms + produced);
+            }
+            produced++;
+        }
+    }
+    return produced;
+}
+
+uint32_t EMGEnvelope::getMaxOutputLength(uint32_t inputLength) const {
+    return inputLength / _decimation + 1;
+}
+
+void EMGEnvelope::reset() {
+    memset(_history, 0, 2 * _numTaps * sizeof(float32_t));
+    _historyPos = 0;
+    _phase = 0;
+    _blockEnergy = 0.0f;
+    _rmsAverage->reset();
+}
+
+uint32_t EMGEnvelope::getMemoryUsage() const {
+    return sizeof(EMGEnvelope) + 3 * _numTaps * sizeof(float32_t) + _rmsAverage->getMemoryUsage();
+}
@@ -0,0 +1,125 @@
+/**
+ * @file EMGEnvelope.h
+ * @brief Envolvente y RMS de EMG a la frecuencia del lazo de control, sin señales intermedias a plena frecuencia
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @details El control mioeléctrico necesita la envolvente (rectificado + pasa-bajas) y
+ * la RMS en ventana del EMG a 50-100 Hz, mientras la señal se muestrea a 1-2 kHz. Con
+ * FIRFilter habría que rectificar un buffer completo, filtrarlo entero y después
+ * quedarse con una muestra de cada D. EMGEnvelope fusiona las tres cosas:
+ *
+ * - Rectificado de onda completa al escribir cada muestra en el historial del FIR
+ * - Pasa-bajas FIR diezmador: el producto escalar solo se calcula en los instantes de
+ *   salida, así que cuesta numTaps / D MACs por muestra de entrada
+ * - RMS deslizante: la suma de cuadrados de cada periodo de salida (D muestras) entra
+ *   en una MovingAverageFilter de W periodos. Coste O(1) y memoria de W valores, no de
+ *   W·D muestras
+ *
+ * Lo único que se guarda a plena frecuencia es el historial del FIR (numTaps muestras
+ * rectificadas). La entrada debe ser el EMG ya filtrado pasa-banda (p. ej. 20-450 Hz),
+ * sin continua, para que la RMS tenga sentido.
+ *
+ * @par Ejemplo
+ * @code
+ * EMGEnvelope emg(1000.0f, 100.0f);           // 1 kHz -> 100 Hz, envolvente a 6 Hz, RMS de 100 ms
+ * float32_t envelope[4], rms[4];
+ * uint32_t n = emg.processBuffer(block, 32, envelope, rms);   // 3 o 4 salidas
+ * for (uint32_t i = 0; i < n; i++) {
+ *     servo.write(map(envelope[i] * 1000, 0, 500, 0, 180));
+ * }
+ * @endcode
+ */
+
+#ifndef EMG_ENVELOPE_H
+#define EMG_ENVELOPE_H
+
+#include <arm_math.h>
+#include "MovingAverage.h"
+
+/**
+ * @class EMGEnvelope
+ * @brief Rectificado + pasa-bajas diezmador y RMS deslizante por bloques
+ */
+class EMGEnvelope {
+    public:
+        /**
+         * @param sampleRate Frecuencia del EMG (Hz)
+         * @param outputRate Frecuencia de salida (Hz); el diezmado es round(sampleRate / outputRate)
+         * @param cutoff Corte del pasa-bajas de la envolvente (Hz)
+         * @param rmsWindow Ventana de la RMS (s), redondeada a periodos de salida
+         */
+        EMGEnvelope(float32_t sampleRate, float32_t outputRate = 100.0f,
+                    float32_t cutoff = 6.0f, float32_t rmsWindow = 0.1f);
+        ~EMGEnvelope();
+
+        /**
+         * @brief Procesa un bloque de cualquier longitud
+         *
+         * @param input EMG filtrado pasa-banda
+         * @param length Muestras de entrada
+         * @param envelope Destino de la envolvente (nullptr si no se necesita)
+         * @param rms Destino de la RMS (nullptr si no se necesita)
+         * @return uint32_t Salidas escritas (getMaxOutputLength(length) como mucho)
+         */
+        uint32_t processBuffer(float32_t* input, uint32_t length, float32_t* envelope, float32_t* rms);
+
+        uint32_t getMaxOutputLength(uint32_t inputLength) const;
+
+        /**
+         * @brief Coeficientes del pasa-bajas (simétricos, ganancia en continua 1)
+         */
+        const float32_t* getCoefficients() const { return _coeffs; }
+        uint16_t getNumTaps() const { return _numTaps; }
+
+        uint16_t getDecimation() const { return _decimation; }
+        float32_t getOutputRate() const { return _sampleRate / _decimation; }
+
+        /**
+         * @brief Ventana de la RMS en muestras de entrada (múltiplo del diezmado)
+         */
+        uint32_t getRmsWindow() const { return (uint32_t)_rmsBlocks * _decimation; }
+
+        /**
+         * @brief Retardo de la envolvente, en muestras de entrada: (numTaps - 1) / 2
+         */
+        float32_t getGroupDelay() const { return (_numTaps - 1) * 0.5f; }
+
+        /**
+         * @brief Retardo de la RMS (centro de la ventana), en muestras de entrada
+         */
+        float32_t getRmsDelay() const { return (getRmsWindow() - 1) * 0.5f; }
+
+        void reset();
+        uint32_t getMemoryUsage() const;
+
+    private:
+        // No copiable: posee los coeficientes y el historial
+        EMGEnvelope(const EMGEnvelope&);
+        EMGEnvelope& operator=(const EMGEnvelope&);
+
+        /**
+         * @brief Pasa-bajas sinc con ventana de Hamming y ganancia en continua 1
+         */
+        void designLowpass(float32_t cutoff);
+
+        float32_t _sampleRate;
+        uint16_t _decimation;
+        uint16_t _numTaps;
+        float32_t* _coeffs;
+
+        /**
+         * @brief Historial rectificado duplicado (2·numTaps): la ventana de las últimas
+         * numTaps muestras siempre es contigua y vale para arm_dot_prod_f32()
+         */
+        float32_t* _history;
+        uint16_t _historyPos;
+        uint16_t _phase;                 ///< Muestras desde la última salida
+
+        float32_t _blockEnergy;          ///< Suma de cuadrados del periodo en curso
+        uint16_t _rmsBlocks;
+        MovingAverageFilter* _rmsAverage; ///< Media de las sumas de los últimos W periodos
+};
+
+#endif // EMG_ENVELOPE_H
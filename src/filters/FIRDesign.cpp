@@ -0,0 +1,390 @@
+/**
+ * @file FIRDesign.cpp
+ * @brief Diseño de FIR en ejecución: ventanas (mismas fórmulas que en compilación) y Remez
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @see FIRDesign.h para los tipos de filtro y el orden de los coeficientes
+ */
+
+#include "FIRDesign.h"
+#include "STFT.h"
+#include "../utils/utils.h"
+#include <string.h>
+
+#define REMEZ_GRID_DENSITY   16      // Puntos de la rejilla por extremo
+#define REMEZ_MAX_ITERATIONS 40
+#define REMEZ_TOLERANCE      1e-6    // (max|E| - |δ|) / max|E| para dar por convergido
+
+#define MIN_PHASE_OVERSAMPLING 16     // Puntos de FFT por coeficiente (aliasing del cepstro)
+#define MIN_PHASE_MIN_FFT      256
+#define MIN_PHASE_MAX_FFT      4096
+#define MIN_PHASE_FLOOR        1e-5f  // -100 dB respecto al máximo antes del logaritmo
+#define LATENCY_POINTS         32     // Frecuencias evaluadas en la banda de paso
+
+// ============================================================================
+// Diseño por ventana
+// ============================================================================
+
+bool FIRDesign::design(float32_t* coeffs, uint16_t numTaps, const FIRSpec& spec) {
+    if (numTaps == 0) {
+        return false;
+    }
+    bool odd = (numTaps & 1) != 0;
+    if (!odd && (spec.type == TYPE_HIGHPASS || spec.type == TYPE_BANDSTOP || spec.type == TYPE_HALFBAND)) {
+        return false;
+    }
+
+    // Las sumas de normalización, una sola vez (en compilación las memoriza GCC)
+    double sum1 = sincSum(spec, numTaps, spec.f1, 0, numTaps);
+    double sum2 = sincSum(spec, numTaps, spec.f2, 0, numTaps);
+    for (uint16_t i = 0; i < numTaps; i++) {
+        coeffs[i] = (float32_t)shapedTap(spec, numTaps, numTaps - 1 - i, sum1, sum2);
+    }
+    return true;
+}
+
+bool FIRDesign::lowpass(float32_t* coeffs, uint16_t numTaps, float32_t cutoff, Window window, float32_t beta) {
+    return design(coeffs, numTaps, lowpassSpec(cutoff, window, beta));
+}
+
+bool FIRDesign::highpass(float32_t* coeffs, uint16_t numTaps, float32_t cutoff, Window window, float32_t beta) {
+    return design(coeffs, numTaps, highpassSpec(cutoff, window, beta));
+}
+
+bool FIRDesign::bandpass(float32_t* coeffs, uint16_t numTaps, float32_t low, float32_t high,
+                         Window window, float32_t beta) {
+    return design(coeffs, numTaps, bandpassSpec(low, high, window, beta));
+}
+
+bool FIRDesign::bandstop(float32_t* coeffs, uint16_t numTaps, float32_t low, float32_t high,
+                         Window window, float32_t beta) {
+    return design(coeffs, numTaps, bandstopSpec(low, high, window, beta));
+}
+
+float32_t FIRDesign::getMagnitude(const float32_t* coeffs, uint16_t numTaps, float32_t frequency) {
+    float32_t re = 0.0f, im = 0.0f;
+    for (uint16_t i = 0; i < numTaps; i++) {
+        float32_t phase = 2.0f * PI * frequency * i;
+        re += coeffs[i] * cosf(phase);
+        im -= coeffs[i] * sinf(phase);
+    }
+    return sqrtf(re * re + im * im);
+}
+
+// ============================================================================
+// Parks-McClellan
+// ============================================================================
+
+/**
+ * @details Fase lineal tipo I: H(w) = e^(-jwL)·A(w), con A(w) = Σ c_k·cos(kw), k = 0..L y
+ * L = (N - 1) / 2. En x = cos(w), A es un polinomio de grado L, así que se trabaja con
+ * interpolación baricéntrica en x:
+ *
+ * 1. Con L + 2 frecuencias extremas, δ es el único error que alterna de signo en ellas.
+ * 2. A(x) es el polinomio que pasa por D_k - (-1)^k·δ / W_k en esos puntos (con ese δ
+ *    los L + 2 valores son compatibles con grado L).
+ * 3. Los nuevos extremos son los máximos locales de |E| = |W·(D - A)| en la rejilla,
+ *    con signos alternos. Se repite hasta que max|E| = |δ|.
+ *
+ * Al final se muestrea A en w = 2πk/N y la DFT inversa da los coeficientes.
+ */
+bool FIRDesign::remez(float32_t* coeffs, uint16_t numTaps, const float32_t* bands, const float32_t* desired,
+                      const float32_t* weights, uint8_t numBands, float32_t* ripple) {
+    if (numTaps < 3 || (numTaps & 1) == 0 || numBands == 0) {
+        return false;
+    }
+    for (uint8_t b = 0; b < numBands; b++) {
+        if (bands[2 * b] < 0.0f || bands[2 * b + 1] <= bands[2 * b] || bands[2 * b + 1] > 0.5f ||
+            (b > 0 && bands[2 * b] < bands[2 * b - 1])) {
+            return false;
+        }
+    }
+
+    uint16_t order = (numTaps - 1) / 2;          // L
+    uint16_t numExtremals = order + 2;
+    double step = 0.5 / (REMEZ_GRID_DENSITY * (order + 1));
+
+    uint32_t gridSize = 0;
+    for (uint8_t b = 0; b < numBands; b++) {
+        gridSize += (uint32_t)((bands[2 * b + 1] - bands[2 * b]) / step) + 2;
+    }
+    if (gridSize < numExtremals) {
+        return false;
+    }
+
+    double* gridX = new double[gridSize];
+    uint8_t* gridBand = new uint8_t[gridSize];
+    double* error = new double[gridSize];
+    uint32_t* extremal = new uint32_t[numExtremals];
+    uint32_t* found = new uint32_t[gridSize];
+    double* x = new double[numExtremals];
+    double* a = new double[numExtremals];
+    double* y = new double[numExtremals];
+
+    // Rejilla: cada banda con sus dos bordes incluidos
+    uint32_t g = 0;
+    for (uint8_t b = 0; b < numBands; b++) {
+        double low = bands[2 * b], high = bands[2 * b + 1];
+        uint32_t points = (uint32_t)((high - low) / step) + 1;
+        for (uint32_t i = 0; i <= points; i++) {
+            gridX[g] = cos(2.0 * M_PI * (low + (high - low) * i / points));
+            gridBand[g] = b;
+            g++;
+        }
+    }
+    gridSize = g;
+
+    for (uint16_t k = 0; k < numExtremals; k++) {
+        extremal[k] = (uint32_t)((uint64_t)k * (gridSize - 1) / (numExtremals - 1));
+    }
+
+    bool converged = false;
+    double delta = 0.0;
+    for (uint8_t iteration = 0; iteration < REMEZ_MAX_ITERATIONS; iteration++) {
+        // Pesos baricéntricos (factor 2 para no desbordar con muchos puntos)
+        for (uint16_t k = 0; k < numExtremals; k++) {
+            x[k] = gridX[extremal[k]];
+        }
+        for (uint16_t k = 0; k < numExtremals; k++) {
+            double product = 1.0;
+            for (uint16_t j = 0; j < numExtremals; j++) {
+                if (j != k) {
+                    product *= 2.0 * (x[k] - x[j]);
+                }
+            }
+            a[k] = 1.0 / product;
+        }
+
+        double numerator = 0.0, denominator = 0.0;
+        for (uint16_t k = 0; k < numExtremals; k++) {
+            uint8_t b = gridBand[extremal[k]];
+            double w = weights ? weights[b] : 1.0;
+            double sign = (k & 1) ? -1.0 : 1.0;
+            numerator += a[k] * desired[b];
+            denominator += a[k] * sign / w;
+        }
+        delta = numerator / denominator;
+        for (uint16_t k = 0; k < numExtremals; k++) {
+            uint8_t b = gridBand[extremal[k]];
+            double w = weights ? weights[b] : 1.0;
+            y[k] = desired[b] - ((k & 1) ? -1.0 : 1.0) * delta / w;
+        }
+
+        // Error ponderado en toda la rejilla
+        double maxError = 0.0;
+        for (uint32_t i = 0; i < gridSize; i++) {
+            double sumNum = 0.0, sumDen = 0.0, value = 0.0;
+            bool exact = false;
+            for (uint16_t k = 0; k < numExtremals; k++) {
+                double dx = gridX[i] - x[k];
+                if (dx == 0.0) {
+                    value = y[k];
+                    exact = true;
+                    break;
+                }
+                double c = a[k] / dx;
+                sumNum += c * y[k];
+                sumDen += c;
+            }
+            if (!exact) {
+                value = sumNum / sumDen;
+            }
+            uint8_t b = gridBand[i];
+            error[i] = (weights ? weights[b] : 1.0) * (desired[b] - value);
+            if (fabs(error[i]) > maxError) {
+                maxError = fabs(error[i]);
+            }
+        }
+
+        if (maxError > 0.0 && (maxError - fabs(delta)) / maxError < REMEZ_TOLERANCE) {
+            converged = true;
+            break;
+        }
+
+        // Extremos locales de E con signos alternos (de dos seguidos del mismo signo, el mayor)
+        uint32_t count = 0;
+        for (uint32_t i = 0; i < gridSize; i++) {
+            double e = error[i];
+            bool first = (i == 0) || gridBand[i - 1] != gridBand[i];
+            bool last = (i == gridSize - 1) || gridBand[i + 1] != gridBand[i];
+            bool peak = (e > 0.0) ? ((first || e >= error[i - 1]) && (last || e >= error[i + 1]))
+                                  : ((first || e <= error[i - 1]) && (last || e <= error[i + 1]));
+            if (!peak) {
+                continue;
+            }
+            if (count > 0 && (error[found[count - 1]] > 0.0) == (e > 0.0)) {
+                if (fabs(e) > fabs(error[found[count - 1]])) {
+                    found[count - 1] = i;
+                }
+            } else {
+                found[count++] = i;
+            }
+        }
+        if (count < numExtremals) {
+            break;
+        }
+        // Sobran extremos: se quita el del borde con menos error (la alternancia se mantiene)
+        uint32_t start = 0;
+        while (count - start > numExtremals) {
+            if (fabs(error[found[start]]) < fabs(error[found[count - 1]])) {
+                start++;
+            } else {
+                count--;
+            }
+        }
+        for (uint16_t k = 0; k < numExtremals; k++) {
+            extremal[k] = found[start + k];
+        }
+    }
+
+    if (converged) {
+        // A(2πk/N) por interpolación y DFT inversa de la respuesta real y par
+        double* amplitude = error;               // gridSize >= numExtremals > L + 1
+        for (uint16_t k = 0; k <= order; k++) {
+            double xk = cos(2.0 * M_PI * k / numTaps);
+            double sumNum = 0.0, sumDen = 0.0, value = 0.0;
+            bool exact = false;
+            for (uint16_t j = 0; j < numExtremals; j++) {
+                double dx = xk - x[j];
+                if (dx == 0.0) {
+                    value = y[j];
+                    exact = true;
+                    break;
+                }
+                sumNum += a[j] / dx * y[j];
+                sumDen += a[j] / dx;
+            }
+            amplitude[k] = exact ? value : sumNum / sumDen;
+        }
+        for (uint16_t n = 0; n < numTaps; n++) {
+            double t = (double)n - order;
+            double h = amplitude[0];
+            for (uint16_t k = 1; k <= order; k++) {
+                h += 2.0 * amplitude[k] * cos(2.0 * M_PI * k * t / numTaps);
+            }
+            coeffs[n] = (float32_t)(h / numTaps);
+        }
+        if (ripple != nullptr) {
+            *ripple = (float32_t)fabs(delta);
+        }
+    }
+
+    delete[] gridX;
+    delete[] gridBand;
+    delete[] error;
+    delete[] extremal;
+    delete[] found;
+    delete[] x;
+    delete[] a;
+    delete[] y;
+    return converged;
+}
+
+// ============================================================================
+// Fase mínima y latencia
+// ============================================================================
+
+/**
+ * @details Con el cepstro real c = IFFT(log|H|), la secuencia plegada (c[0], 2c[1], ...,
+ * 2c[M/2 - 1], c[M/2], 0, ...) es el cepstro complejo del filtro de fase mínima con la
+ * misma magnitud; FFT, exponencial compleja e IFFT devuelven su respuesta al impulso.
+ * Todas las transformadas son de señales reales, así que bastan los planes de
+ * arm_rfft_fast_f32 que ya comparte STFT.
+ */
+bool FIRDesign::minimumPhase(float32_t* output, uint16_t outputTaps, const float32_t* coeffs, uint16_t numTaps) {
+    if (numTaps == 0 || outputTaps == 0 || outputTaps > numTaps) {
+        return false;
+    }
+    uint16_t fftSize = MIN_PHASE_MIN_FFT;
+    while (fftSize < (uint32_t)MIN_PHASE_OVERSAMPLING * numTaps && fftSize < MIN_PHASE_MAX_FFT) {
+        fftSize <<= 1;
+    }
+    if (fftSize < 4U * numTaps) {
+        return false;
+    }
+    arm_rfft_fast_instance_f32* plan = STFT::getPlan(fftSize);
+    if (plan == nullptr) {
+        return false;
+    }
+
+    // arm_rfft_fast_f32 modifica su entrada: se alterna entre dos buffers
+    float32_t* a = new float32_t[fftSize];
+    float32_t* b = new float32_t[fftSize];
+    uint16_t half = fftSize / 2;
+
+    // 1. Espectro del filtro original (orden natural)
+    memset(a, 0, fftSize * sizeof(float32_t));
+    for (uint16_t n = 0; n < numTaps; n++) {
+        a[n] = coeffs[numTaps - 1 - n];
+    }
+    arm_rfft_fast_f32(plan, a, b, 0);
+
+    // 2. log|H| con suelo, como espectro real en el formato {X0, X(M/2), Re X1, Im X1, ...}
+    a[0] = fabsf(b[0]);
+    a[1] = fabsf(b[1]);
+    arm_cmplx_mag_f32(b + 2, a + 2, half - 1);
+    float32_t peak = 0.0f;
+    for (uint16_t k = 0; k <= half; k++) {
+        peak = fmaxf(peak, a[k]);
+    }
+    if (peak == 0.0f) {
+        delete[] a;
+        delete[] b;
+        return false;
+    }
+    float32_t minimum = peak * MIN_PHASE_FLOOR;
+    // El módulo del bin k quedó en a[k + 1]: se recorre hacia atrás para no pisarlo
+    for (uint16_t k = half - 1; k >= 1; k--) {
+        a[2 * k] = logf(fmaxf(a[k + 1], minimum));
+        a[2 * k + 1] = 0.0f;
+    }
+    a[0] = logf(fmaxf(a[0], minimum));
+    a[1] = logf(fmaxf(a[1], minimum));
+
+    // 3. Cepstro real y plegado sobre los índices positivos
+    arm_rfft_fast_f32(plan, a, b, 1);
+    for (uint16_t n = 1; n < half; n++) {
+        b[n] *= 2.0f;
+    }
+    memset(b + half + 1, 0, (half - 1) * sizeof(float32_t));
+
+    // 4. exp() del espectro del cepstro plegado e IFFT
+    arm_rfft_fast_f32(plan, b, a, 0);
+    a[0] = expf(a[0]);
+    a[1] = expf(a[1]);
+    for (uint16_t k = 1; k < half; k++) {
+        float32_t magnitude = expf(a[2 * k]);
+        float32_t phase = a[2 * k + 1];
+        a[2 * k] = magnitude * cosf(phase);
+        a[2 * k + 1] = magnitude * sinf(phase);
+    }
+    arm_rfft_fast_f32(plan, a, b, 1);
+
+    for (uint16_t i = 0; i < outputTaps; i++) {
+        output[i] = b[outputTaps - 1 - i];
+    }
+    delete[] a;
+    delete[] b;
+    return true;
+}
+
+FIRLatency FIRDesign::getLatency(const float32_t* coeffs, uint16_t numTaps, float32_t passband) {
+    // calculateGroupDelay() recorre los coeficientes como un polinomio en z⁻¹; en
+    // orden CMSIS el retardo sale medido desde el final (como en FIRFilter)
+    FIRLatency latency;
+    latency.groupDelay = (numTaps - 1) - calculateGroupDelay(coeffs, numTaps, 0.0f);
+    latency.maxGroupDelay = latency.groupDelay;
+    for (uint8_t i = 1; i <= LATENCY_POINTS; i++) {
+        float32_t delay = (numTaps - 1) - calculateGroupDelay(coeffs, numTaps, passband * i / LATENCY_POINTS);
+        latency.maxGroupDelay = fmaxf(latency.maxGroupDelay, delay);
+    }
+    latency.peakDelay = 0;
+    for (uint16_t n = 1; n < numTaps; n++) {
+        if (fabsf(coeffs[numTaps - 1 - n]) > fabsf(coeffs[numTaps - 1 - latency.peakDelay])) {
+            latency.peakDelay = n;
+        }
+    }
+    return latency;
+}
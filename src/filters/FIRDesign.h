@@ -0,0 +1,405 @@
+/**
+ * @file FIRDesign.h
+ * @brief Diseño de filtros FIR en compilación (tablas constexpr en flash) y en ejecución
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @details Hasta ahora los coeficientes de FIRFilter se calculaban fuera (Python,
+ * MATLAB) y se pegaban en el código. FIRDesign los calcula en la propia librería:
+ *
+ * - Ventana (Hamming, Hann, Blackman, Kaiser o rectangular) aplicada al sinc ideal
+ *   para pasa-bajas, pasa-altas, pasa-banda y banda eliminada, y también al
+ *   diferenciador, al transformador de Hilbert y al filtro de media banda.
+ * - Todo el diseño por ventana es constexpr (C++11): seno, coseno, raíz y Bessel I0
+ *   se evalúan con series en double, así que FIRDesign::table<N>() genera la tabla al
+ *   compilar. Declarada static constexpr, queda en flash y no ocupa RAM.
+ * - Las mismas funciones se pueden llamar en ejecución (design(), lowpass(), ...)
+ *   para reescribir el array que usa un FIRFilter y resintonizarlo en caliente:
+ *   FIRFilter solo guarda el puntero a los coeficientes.
+ * - Equirrizado de Parks-McClellan (remez()), solo en ejecución: el algoritmo de
+ *   intercambio de Remez necesita memoria de trabajo y un número de iteraciones
+ *   variable, y no cabe en constexpr de C++11.
+ * - Conversión a fase mínima (minimumPhase()) con la misma magnitud, para los lazos
+ *   en los que el retardo de (N - 1)/2 muestras de la fase lineal es demasiado, y
+ *   informe de latencia (getLatency()).
+ *
+ * Las frecuencias son normalizadas (f / Fs, de 0 a 0.5). Los coeficientes se
+ * entregan en el orden de CMSIS-DSP (invertidos en el tiempo), listos para FIRFilter;
+ * solo importa en los antisimétricos (diferenciador y Hilbert).
+ *
+ * @note En compilación cada coeficiente cuesta unas pocas decenas de llamadas
+ * constexpr. Con el límite por defecto de GCC (-fconstexpr-depth=512) se generan sin
+ * problema tablas de varios cientos de coeficientes.
+ *
+ * @par Ejemplo
+ * @code
+ * // Pasa-bajas de 50 Hz a 960 Hz calculado al compilar, en flash
+ * static constexpr FIRTable<51> LOWPASS = FIRDesign::table<51>(FIRDesign::lowpassSpec(50.0 / 960.0));
+ * FIRFilter ecg(LOWPASS.coeffs, 51, 32);
+ *
+ * // Pasa-bajas resintonizable en ejecución
+ * float32_t coeffs[51];
+ * FIRDesign::lowpass(coeffs, 51, 40.0f / 960.0f);
+ * FIRFilter adjustable(coeffs, 51, 32);
+ * FIRDesign::lowpass(coeffs, 51, 25.0f / 960.0f);     // mismo filtro, nuevo corte
+ * @endcode
+ */
+
+#ifndef FIR_DESIGN_H
+#define FIR_DESIGN_H
+
+#include <arm_math.h>
+
+/**
+ * @brief Tabla de coeficientes generada por FIRDesign::table()
+ */
+template<uint16_t N>
+struct FIRTable {
+    float32_t coeffs[N];
+
+    constexpr uint16_t size() const { return N; }
+};
+
+/**
+ * @brief Parámetros de un diseño por ventana
+ */
+struct FIRSpec {
+    uint8_t type;           ///< FIRDesign::Type
+    uint8_t window;         ///< FIRDesign::Window
+    double f1;              ///< Corte (o borde inferior) normalizado
+    double f2;              ///< Borde superior normalizado (pasa-banda y banda eliminada)
+    double beta;            ///< Parámetro de la ventana de Kaiser
+};
+
+/**
+ * @brief Latencia de unos coeficientes (FIRDesign::getLatency())
+ */
+struct FIRLatency {
+    float32_t groupDelay;       ///< Retardo de grupo en DC (muestras)
+    float32_t maxGroupDelay;    ///< Retardo de grupo máximo en la banda de paso (muestras)
+    uint16_t peakDelay;         ///< Posición del coeficiente de mayor magnitud en la respuesta al impulso
+};
+
+template<uint16_t... I>
+struct FIRIndices {};
+
+template<uint16_t N, uint16_t... I>
+struct FIRMakeIndices : FIRMakeIndices<N - 1, N - 1, I...> {};
+
+template<uint16_t... I>
+struct FIRMakeIndices<0, I...> {
+    typedef FIRIndices<I...> type;
+};
+
+/**
+ * @class FIRDesign
+ * @brief Diseño de FIR por ventana (constexpr) y equirrizado (Remez)
+ */
+class FIRDesign {
+    public:
+        enum Type {
+            TYPE_LOWPASS,
+            TYPE_HIGHPASS,          ///< Requiere un número impar de coeficientes
+            TYPE_BANDPASS,
+            TYPE_BANDSTOP,          ///< Requiere un número impar de coeficientes
+            TYPE_HALFBAND,          ///< Corte en Fs/4, ceros exactos en las posiciones pares
+            TYPE_DIFFERENTIATOR,    ///< H(w) = jw: y ≈ dx/dn (multiplicar por Fs para unidades/s)
+            TYPE_HILBERT            ///< H(w) = -j·sgn(w): desfase de -90°
+        };
+
+        enum Window {
+            WINDOW_RECTANGULAR,
+            WINDOW_HAMMING,
+            WINDOW_HANN,
+            WINDOW_BLACKMAN,
+            WINDOW_KAISER
+        };
+
+        // ====================================================================
+        // Especificaciones
+        // ====================================================================
+
+        static constexpr FIRSpec lowpassSpec(double cutoff, Window window = WINDOW_HAMMING, double beta = 0.0) {
+            return FIRSpec{TYPE_LOWPASS, (uint8_t)window, cutoff, 0.0, beta};
+        }
+        static constexpr FIRSpec highpassSpec(double cutoff, Window window = WINDOW_HAMMING, double beta = 0.0) {
+            return FIRSpec{TYPE_HIGHPASS, (uint8_t)window, cutoff, 0.0, beta};
+        }
+        static constexpr FIRSpec bandpassSpec(double low, double high, Window window = WINDOW_HAMMING, double beta = 0.0) {
+            return FIRSpec{TYPE_BANDPASS, (uint8_t)window, low, high, beta};
+        }
+        static constexpr FIRSpec bandstopSpec(double low, double high, Window window = WINDOW_HAMMING, double beta = 0.0) {
+            return FIRSpec{TYPE_BANDSTOP, (uint8_t)window, low, high, beta};
+        }
+        static constexpr FIRSpec halfbandSpec(Window window = WINDOW_HAMMING, double beta = 0.0) {
+            return FIRSpec{TYPE_HALFBAND, (uint8_t)window, 0.25, 0.0, beta};
+        }
+        static constexpr FIRSpec differentiatorSpec(Window window = WINDOW_HAMMING, double beta = 0.0) {
+            return FIRSpec{TYPE_DIFFERENTIATOR, (uint8_t)window, 0.0, 0.0, beta};
+        }
+        static constexpr FIRSpec hilbertSpec(Window window = WINDOW_HAMMING, double beta = 0.0) {
+            return FIRSpec{TYPE_HILBERT, (uint8_t)window, 0.0, 0.0, beta};
+        }
+
+        // ====================================================================
+        // Diseño en compilación
+        // ====================================================================
+
+        /**
+         * @brief Tabla de N coeficientes (orden CMSIS) evaluable en compilación
+         */
+        template<uint16_t N>
+        static constexpr FIRTable<N> table(const FIRSpec& spec) {
+            return makeTable<N>(spec, typename FIRMakeIndices<N>::type());
+        }
+
+        /**
+         * @brief Coeficiente i en orden CMSIS (h[N - 1 - i])
+         */
+        static constexpr float32_t coefficient(const FIRSpec& spec, uint16_t numTaps, uint16_t i) {
+            return (float32_t)tap(spec, numTaps, numTaps - 1 - i);
+        }
+
+        /**
+         * @brief Beta de Kaiser para una atenuación en dB (fórmula de Kaiser)
+         */
+        static constexpr double kaiserBeta(double attenuationDb) {
+            return attenuationDb > 50.0 ? 0.1102 * (attenuationDb - 8.7)
+                 : attenuationDb > 21.0 ? 0.5842 * root5((attenuationDb - 21.0) * (attenuationDb - 21.0))
+                                          + 0.07886 * (attenuationDb - 21.0)
+                 : 0.0;
+        }
+
+        /**
+         * @brief Coeficientes (impar) para una atenuación y una transición normalizada con Kaiser
+         */
+        static constexpr uint16_t kaiserTaps(double attenuationDb, double transition) {
+            return (uint16_t)((uint16_t)(ceiling((attenuationDb - 7.95) / (14.36 * transition)) + 1.0) | 1);
+        }
+
+        // ====================================================================
+        // Diseño en ejecución (resintonizar un FIRFilter en caliente)
+        // ====================================================================
+
+        /**
+         * @brief Escribe numTaps coeficientes (orden CMSIS) del diseño indicado
+         *
+         * @details Con la misma FIRSpec da la misma tabla que table<N>() bit a bit.
+         * lowpass() y compañía reciben el corte en float32_t, así que pueden diferir en
+         * el último bit de una tabla construida con el corte en double.
+         *
+         * @return false si numTaps es 0 o el tipo exige un número impar y no lo es
+         */
+        static bool design(float32_t* coeffs, uint16_t numTaps, const FIRSpec& spec);
+
+        static bool lowpass(float32_t* coeffs, uint16_t numTaps, float32_t cutoff,
+                            Window window = WINDOW_HAMMING, float32_t beta = 0.0f);
+        static bool highpass(float32_t* coeffs, uint16_t numTaps, float32_t cutoff,
+                             Window window = WINDOW_HAMMING, float32_t beta = 0.0f);
+        static bool bandpass(float32_t* coeffs, uint16_t numTaps, float32_t low, float32_t high,
+                             Window window = WINDOW_HAMMING, float32_t beta = 0.0f);
+        static bool bandstop(float32_t* coeffs, uint16_t numTaps, float32_t low, float32_t high,
+                             Window window = WINDOW_HAMMING, float32_t beta = 0.0f);
+
+        /**
+         * @brief Equirrizado de Parks-McClellan (fase lineal, número impar de coeficientes)
+         *
+         * @param coeffs Destino (numTaps coeficientes, simétricos)
+         * @param numTaps Número de coeficientes (impar)
+         * @param bands 2·numBands bordes normalizados crecientes entre 0 y 0.5
+         * @param desired Amplitud deseada en cada banda (1 paso, 0 rechazo)
+         * @param weights Peso del error en cada banda (nullptr = todos 1)
+         * @param numBands Número de bandas
+         * @param ripple Si no es nullptr, recibe el error ponderado máximo (δ)
+         * @return false si los parámetros no son válidos o no converge
+         */
+        static bool remez(float32_t* coeffs, uint16_t numTaps, const float32_t* bands, const float32_t* desired,
+                          const float32_t* weights, uint8_t numBands, float32_t* ripple = nullptr);
+
+        /**
+         * @brief Respuesta en magnitud de unos coeficientes en una frecuencia normalizada
+         */
+        static float32_t getMagnitude(const float32_t* coeffs, uint16_t numTaps, float32_t frequency);
+
+        // ====================================================================
+        // Fase mínima y latencia
+        // ====================================================================
+
+        /**
+         * @brief Convierte un FIR (normalmente de fase lineal) en el de fase mínima con la misma magnitud
+         *
+         * @details Método del cepstro: log|H| en una FFT de 16·numTaps puntos (entre 256 y
+         * 4096), cepstro real, plegado sobre los índices positivos y exponencial de vuelta.
+         * La energía del resultado se concentra al principio, así que el retardo baja de
+         * (N - 1)/2 a unas pocas muestras y se puede truncar a menos coeficientes: la cola
+         * que se descarta es lo único que cambia la respuesta.
+         *
+         * Los ceros sobre la circunferencia unidad (la banda de rechazo de un FIR de fase
+         * lineal) se limitan a -100 dB antes del logaritmo, así que el rechazo del
+         * resultado llega a unos 100 dB como mucho.
+         *
+         * Necesita dos buffers temporales de la FFT (8 KB con 51 coeficientes).
+         *
+         * @param output Destino: outputTaps coeficientes en orden CMSIS (puede no ser coeffs)
+         * @param outputTaps Coeficientes a conservar (1 .. numTaps)
+         * @param coeffs Coeficientes originales en orden CMSIS
+         * @param numTaps Número de coeficientes originales (hasta 1024)
+         * @return false si los tamaños no son válidos
+         *
+         * @code
+         * float32_t minimum[31];
+         * FIRDesign::minimumPhase(minimum, 31, LOWPASS.coeffs, 51);
+         * FIRFilter fast(minimum, 31, 32);           // getGroupDelay(): ~10 muestras en vez de 25
+         * @endcode
+         */
+        static bool minimumPhase(float32_t* output, uint16_t outputTaps, const float32_t* coeffs, uint16_t numTaps);
+
+        /**
+         * @brief Informe de latencia de unos coeficientes (orden CMSIS)
+         *
+         * @param passband Borde de la banda de paso normalizado (0 .. 0.5) para maxGroupDelay
+         */
+        static FIRLatency getLatency(const float32_t* coeffs, uint16_t numTaps, float32_t passband);
+
+    private:
+        // ====================================================================
+        // Matemáticas constexpr (double, una sola expresión por función)
+        // ====================================================================
+
+        static constexpr double pi() { return 3.14159265358979323846; }
+
+        static constexpr double nearest(double x) {
+            return (double)(long long)(x >= 0.0 ? x + 0.5 : x - 0.5);
+        }
+        static constexpr double ceiling(double x) {
+            return ((double)(long long)x < x) ? (double)(long long)x + 1.0 : (double)(long long)x;
+        }
+
+        // sin(x) con |x| <= π: 16 términos de Taylor (error < 1e-16)
+        static constexpr double sinSeries(double x2, double term, int k, double sum) {
+            return k > 16 ? sum : sinSeries(x2, -term * x2 / ((2.0 * k) * (2.0 * k + 1.0)), k + 1, sum + term);
+        }
+        static constexpr double reduced(double x) {
+            return x - 2.0 * pi() * nearest(x / (2.0 * pi()));
+        }
+        static constexpr double sine(double x) {
+            return sinSeries(reduced(x) * reduced(x), reduced(x), 1, 0.0);
+        }
+        static constexpr double cosine(double x) {
+            return sine(x + 0.5 * pi());
+        }
+
+        static constexpr double sqrtIteration(double x, double guess, int steps) {
+            return (steps == 0 || guess == 0.5 * (guess + x / guess)) ? guess
+                 : sqrtIteration(x, 0.5 * (guess + x / guess), steps - 1);
+        }
+        static constexpr double squareRoot(double x) {
+            return x <= 0.0 ? 0.0 : sqrtIteration(x, x > 1.0 ? x : 1.0, 64);
+        }
+
+        // Raíz quinta por Newton (para la potencia 0.4 de kaiserBeta)
+        static constexpr double root5Iteration(double x, double g, int steps) {
+            return steps == 0 ? g : root5Iteration(x, (4.0 * g + x / (g * g * g * g)) / 5.0, steps - 1);
+        }
+        static constexpr double root5(double x) {
+            return x <= 0.0 ? 0.0 : root5Iteration(x, x > 1.0 ? x : 1.0, 64);
+        }
+
+        // I0(x) = Σ ((x/2)^k / k!)²
+        static constexpr double besselSeries(double q, double term, int k, double sum) {
+            return (k > 60 || term < 1e-17 * sum) ? sum + term : besselSeries(q, term * q / ((double)k * k), k + 1, sum + term);
+        }
+        static constexpr double besselI0(double x) {
+            return besselSeries(0.25 * x * x, 1.0, 1, 0.0);
+        }
+
+        // ====================================================================
+        // Respuesta ideal, ventana y normalización
+        // ====================================================================
+
+        static constexpr double window(const FIRSpec& spec, uint16_t numTaps, uint16_t n) {
+            return numTaps < 2 ? 1.0
+                 : spec.window == WINDOW_HAMMING ? 0.54 - 0.46 * cosine(2.0 * pi() * n / (numTaps - 1))
+                 : spec.window == WINDOW_HANN ? 0.5 - 0.5 * cosine(2.0 * pi() * n / (numTaps - 1))
+                 : spec.window == WINDOW_BLACKMAN ? 0.42 - 0.5 * cosine(2.0 * pi() * n / (numTaps - 1))
+                                                  + 0.08 * cosine(4.0 * pi() * n / (numTaps - 1))
+                 : spec.window == WINDOW_KAISER ? kaiser(spec.beta, 2.0 * n / (numTaps - 1) - 1.0)
+                 : 1.0;
+        }
+        static constexpr double kaiser(double beta, double r) {
+            return besselI0(beta * squareRoot(1.0 - r * r)) / besselI0(beta);
+        }
+
+        // t = n - (N-1)/2: entero con N impar, semientero con N par
+        static constexpr double offset(uint16_t numTaps, uint16_t n) {
+            return n - 0.5 * (numTaps - 1);
+        }
+
+        // Pasa-bajas ideal de corte f, con ventana, sin normalizar
+        static constexpr double sinc(double f, double t) {
+            return t == 0.0 ? 2.0 * f : sine(2.0 * pi() * f * t) / (pi() * t);
+        }
+        static constexpr double windowedSinc(const FIRSpec& spec, uint16_t numTaps, double f, uint16_t n) {
+            return sinc(f, offset(numTaps, n)) * window(spec, numTaps, n);
+        }
+
+        // Σ en divide y vencerás: profundidad log2(N) en vez de N
+        static constexpr double sincSum(const FIRSpec& spec, uint16_t numTaps, double f, uint16_t from, uint16_t to) {
+            return to - from == 1 ? windowedSinc(spec, numTaps, f, from)
+                 : sincSum(spec, numTaps, f, from, from + (to - from) / 2)
+                   + sincSum(spec, numTaps, f, from + (to - from) / 2, to);
+        }
+        static constexpr double impulse(uint16_t numTaps, uint16_t n) {
+            return offset(numTaps, n) == 0.0 ? 1.0 : 0.0;
+        }
+        static constexpr bool isEven(double t) {
+            return t == 2.0 * nearest(0.5 * t);
+        }
+
+        /**
+         * @brief h[n] con las sumas de normalización ya calculadas
+         *
+         * @details sum1 y sum2 son sincSum() de f1 y f2. En compilación las calcula tap()
+         * (GCC memoriza las llamadas constexpr repetidas); en ejecución design() las
+         * calcula una sola vez. Las operaciones son las mismas, así que las tablas de
+         * compilación y de ejecución coinciden bit a bit.
+         */
+        static constexpr double shapedTap(const FIRSpec& spec, uint16_t numTaps, uint16_t n, double sum1, double sum2) {
+            return spec.type == TYPE_LOWPASS ? windowedSinc(spec, numTaps, spec.f1, n) / sum1
+                 : spec.type == TYPE_HIGHPASS ? impulse(numTaps, n) - windowedSinc(spec, numTaps, spec.f1, n) / sum1
+                 : spec.type == TYPE_BANDPASS ? windowedSinc(spec, numTaps, spec.f2, n) / sum2
+                                                - windowedSinc(spec, numTaps, spec.f1, n) / sum1
+                 : spec.type == TYPE_BANDSTOP ? impulse(numTaps, n) - windowedSinc(spec, numTaps, spec.f2, n) / sum2
+                                                + windowedSinc(spec, numTaps, spec.f1, n) / sum1
+                 // Media banda: el central vale 0.5 exacto y los laterales se escalan para sumar otro 0.5
+                 : spec.type == TYPE_HALFBAND ? (offset(numTaps, n) == 0.0 ? 0.5
+                     : isEven(offset(numTaps, n)) ? 0.0
+                     : 0.5 * windowedSinc(spec, numTaps, spec.f1, n)
+                       / (sum1 - windowedSinc(spec, numTaps, spec.f1, (numTaps - 1) / 2)))
+                 : spec.type == TYPE_DIFFERENTIATOR ? (offset(numTaps, n) == 0.0 ? 0.0
+                     : (cosine(pi() * offset(numTaps, n)) / offset(numTaps, n)
+                        - sine(pi() * offset(numTaps, n)) / (pi() * offset(numTaps, n) * offset(numTaps, n)))
+                       * window(spec, numTaps, n))
+                 : spec.type == TYPE_HILBERT ? (offset(numTaps, n) == 0.0 ? 0.0
+                     : (1.0 - cosine(pi() * offset(numTaps, n))) / (pi() * offset(numTaps, n)) * window(spec, numTaps, n))
+                 : 0.0;
+        }
+
+    public:
+        /**
+         * @brief Coeficiente n en orden natural (h[n]), ya normalizado
+         */
+        static constexpr double tap(const FIRSpec& spec, uint16_t numTaps, uint16_t n) {
+            return shapedTap(spec, numTaps, n, sincSum(spec, numTaps, spec.f1, 0, numTaps),
+                             sincSum(spec, numTaps, spec.f2, 0, numTaps));
+        }
+
+    private:
+        template<uint16_t N, uint16_t... I>
+        static constexpr FIRTable<N> makeTable(const FIRSpec& spec, FIRIndices<I...>) {
+            return FIRTable<N>{{ coefficient(spec, N, I)... }};
+        }
+};
+
+#endif // FIR_DESIGN_H
@@ -18,6 +18,8 @@
  */
 
 #include "FIRFilter.h"
+#include "../utils/utils.h"
+#include <string.h>
 
 /**
  * @brief Constructor que inicializa el filtro FIR con parámetros específicos
@@ -45,7 +47,7 @@
  * @warning Si la asignación de memoria falla, el comportamiento es indefinido.
  * En producción se debería verificar el retorno de 'new'.
  */
-FIRFilter::FIRFilter(float32_t* coeffs, uint16_t numTaps, uint16_t blockSize)
+FIRFilter::FIRFilter(const float32_t* coeffs, uint16_t numTaps, uint16_t blockSize)
     : _coeffs(coeffs),           // Almacenar referencia a coeficientes
       _numTaps(numTaps),         // Número de coeficientes del filtro
       _blockSize(blockSize),     // Tamaño de bloque para procesamiento
@@ -64,13 +66,36 @@ FIRFilter::FIRFilter(float32_t* coeffs, uint16_t numTaps, uint16_t blockSize)
     // Inicializar la estructura del filtro FIR de CMSIS-DSP
     // Esta función configura todos los parámetros internos necesarios
     // para el procesamiento optimizado
+    // Las versiones antiguas de CMSIS-DSP declaran pCoeffs sin const, pero solo lo leen
     arm_fir_init_f32(&_firInstance,    // Puntero a la instancia del filtro
                      _numTaps,         // Número de coeficientes
-                     _coeffs,          // Puntero a coeficientes (solo lectura)
+                     const_cast<float32_t*>(_coeffs),   // Puntero a coeficientes (solo lectura)
                      _state,           // Puntero al buffer de estados
                      _blockSize);      // Tamaño de bloque para optimización
 }
 
+/**
+ * @brief Constructor de copia que comparte los coeficientes y duplica el estado
+ * 
+ * @details Solo se reserva el buffer de estados: la tabla de coeficientes (que puede
+ * ser grande y estar en flash) se referencia igual que en el original.
+ */
+FIRFilter::FIRFilter(const FIRFilter& other)
+    : _coeffs(other._coeffs),
+      _numTaps(other._numTaps),
+      _blockSize(other._blockSize),
+      _sampleIndex(other._sampleIndex)
+{
+    uint32_t stateBufferSize = _numTaps + _blockSize - 1;
+    _state = new float32_t[stateBufferSize];
+    memcpy(_state, other._state, stateBufferSize * sizeof(float32_t));
+
+    arm_fir_init_f32(&_firInstance, _numTaps, const_cast<float32_t*>(_coeffs), _state, _blockSize);
+
+    // arm_fir_init_f32() pone el estado a cero: restaurar el historial copiado
+    memcpy(_state, other._state, stateBufferSize * sizeof(float32_t));
+}
+
 /**
  * @details Libera la memoria asignada para el buffer de estados interno.
  * El destructor garantiza que no hay fugas de memoria cuando el objeto
@@ -203,10 +228,22 @@ void FIRFilter::processBuffer(float32_t* inputArray,
     // - inputArray: puntero al primer elemento del buffer de entrada
     // - outputArray: puntero al primer elemento del buffer de salida  
     // - length: número total de muestras a procesar
-    arm_fir_f32(&_firInstance,     // Instancia previamente inicializada
-                inputArray,        // Buffer de entrada (solo lectura)
-                outputArray,       // Buffer de salida (escritura)
-                length);           // Número de muestras a procesar
+    //
+    // arm_fir_f32() copia el bloque completo al buffer de estados, que solo tiene
+    // sitio para _blockSize muestras nuevas: bloques más largos se procesan en
+    // trozos de _blockSize para no escribir fuera del buffer.
+    while (length > 0) {
+        uint32_t chunk = (length < _blockSize) ? length : _blockSize;
+
+        arm_fir_f32(&_firInstance,     // Instancia previamente inicializada
+                    inputArray,        // Buffer de entrada (solo lectura)
+                    outputArray,       // Buffer de salida (escritura)
+                    chunk);            // Número de muestras a procesar
+
+        inputArray += chunk;
+        outputArray += chunk;
+        length -= chunk;
+    }
     
     // Nota: arm_fir_f32() maneja internamente:
     // - Actualización del buffer de estados con nuevas muestras
@@ -215,6 +252,32 @@ void FIRFilter::processBuffer(float32_t* inputArray,
     // - Optimizaciones específicas del hardware ARM
 }
 
+/**
+ * @brief Calcula el retardo de grupo a partir de los coeficientes
+ * 
+ * @details CMSIS-DSP almacena los coeficientes en orden inverso (h[N-1] primero).
+ * Invertir una respuesta real de N coeficientes equivale a conjugarla y retrasarla
+ * N-1 muestras, así que el retardo de h es (N-1) menos el del array almacenado.
+ */
+float32_t FIRFilter::getGroupDelay(float32_t normalizedFrequency) const {
+    return (_numTaps - 1) - calculateGroupDelay(_coeffs, _numTaps, normalizedFrequency);
+}
+
+/**
+ * @brief Pone a cero el historial de muestras del buffer de estados
+ */
+void FIRFilter::reset() {
+    memset(_state, 0, (_numTaps + _blockSize - 1) * sizeof(float32_t));
+    _sampleIndex = 0;
+}
+
+/**
+ * @brief Bytes del objeto más el buffer de estados (numTaps + blockSize - 1 floats)
+ */
+uint32_t FIRFilter::getMemoryUsage() const {
+    return sizeof(FIRFilter) + (uint32_t)(_numTaps + _blockSize - 1) * sizeof(float32_t);
+}
+
 /**
  * @note Consideraciones adicionales de implementación:
  * 
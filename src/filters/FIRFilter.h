@@ -89,7 +89,24 @@ class FIRFilter {
          * FIRFilter ecgFilter(ecgCoeffs, 51, 1);  // Tiempo real
          * @endcode
          */
-        FIRFilter(float32_t* coeffs, uint16_t numTaps, uint16_t blockSize);
+        FIRFilter(const float32_t* coeffs, uint16_t numTaps, uint16_t blockSize);
+
+        /**
+         * @brief Constructor de copia: mismo diseño, buffer de estados propio
+         * 
+         * La copia comparte el array de coeficientes del original (no se duplica) y
+         * recibe un buffer de estados nuevo con el mismo contenido. Permite clonar un
+         * filtro prototipo para procesar varias señales independientes en paralelo.
+         * 
+         * @param other Filtro a copiar
+         * 
+         * @example
+         * @code
+         * FIRFilter prototype(ecgCoeffs, 51, 256);
+         * FIRFilter channel2(prototype);   // mismos coeficientes, estado independiente
+         * @endcode
+         */
+        FIRFilter(const FIRFilter& other);
 
         /**
          * @brief Destructor de la clase FIRFilter
@@ -169,7 +186,44 @@ class FIRFilter {
          */
         void processBuffer(float32_t* inputArray, float32_t* outputArray, uint32_t length);
 
+        /**
+         * @brief Retardo de grupo del filtro a una frecuencia dada
+         * 
+         * @param normalizedFrequency Frecuencia normalizada f/Fs (0.0 a 0.5)
+         * @return float32_t Retardo en muestras
+         * 
+         * @details Para un FIR de fase lineal (coeficientes simétricos) el resultado
+         * es (numTaps - 1) / 2 en toda la banda. Para coeficientes asimétricos (p. ej.
+         * fase mínima o wavelets) depende de la frecuencia.
+         * 
+         * @example
+         * @code
+         * float32_t delayMs = filter.getGroupDelay() * 1000.0f / sampleRate;
+         * @endcode
+         */
+        float32_t getGroupDelay(float32_t normalizedFrequency = 0.0f) const;
+
+        /**
+         * @brief Reinicia el estado interno (historial de muestras a cero)
+         * 
+         * Útil para procesar una nueva señal independiente sin transitorios de la anterior.
+         */
+        void reset();
+
+        /**
+         * @brief Memoria RAM ocupada por el filtro (objeto + buffer de estados)
+         * 
+         * @return uint32_t Bytes ocupados
+         * 
+         * @note No incluye los coeficientes, que son externos y normalmente
+         * constantes en flash.
+         */
+        uint32_t getMemoryUsage() const;
+
     private:
+        // No asignable: el buffer de estados está enlazado a _firInstance
+        FIRFilter& operator=(const FIRFilter&);
+
         /**
          * @brief Puntero a los coeficientes del filtro FIR
          * 
@@ -177,8 +231,9 @@ class FIRFilter {
          * Los coeficientes definen la respuesta de frecuencia del filtro.
          * 
          * @note Esta es solo una referencia, la memoria debe ser gestionada externamente.
+         * Puede ser una tabla constante en flash (p. ej. generada con FIRDesign).
          */
-        float32_t* _coeffs;
+        const float32_t* _coeffs;
 
         /**
          * @brief Buffer de estados interno del filtro
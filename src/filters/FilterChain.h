@@ -0,0 +1,370 @@
+/**
+ * @file FilterChain.h
+ * @brief Cadena de filtros por bloques con dos buffers intermedios reutilizados
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @details Un pipeline típico encadena un notch IIR, un pasa-bajas FIR y un suavizado
+ * wavelet. Hacerlo a mano obliga a reservar un array intermedio de la longitud total
+ * de la señal entre cada par de etapas, y cada etapa recorre la señal entera antes de
+ * que empiece la siguiente. FilterChain procesa la señal en bloques de blockSize
+ * muestras y pasa cada bloque por todas las etapas alternando entre dos buffers de
+ * trabajo (ping-pong): el bloque se mantiene en caché/SRAM entre etapas y la memoria
+ * intermedia es 2 × blockSize floats, sea cual sea la longitud de la señal o el número
+ * de etapas.
+ *
+ * Las etapas se fijan en tiempo de compilación (plantilla variádica), así que cada
+ * llamada se resuelve estáticamente: no hay funciones virtuales ni punteros a función.
+ * Cualquier clase con estos métodos puede ser una etapa:
+ * - void processBuffer(float32_t* in, float32_t* out, uint32_t length)
+ * - float32_t processSample(float32_t input)
+ * - float32_t getGroupDelay(float32_t normalizedFrequency) const
+ * - uint32_t getMemoryUsage() const
+ *
+ * FIRFilter, IIRFilter y WaveletFilter (modo suavizado) cumplen esta interfaz.
+ * LMSFilter no, porque necesita una segunda entrada de referencia (sí informa de su
+ * retardo con getGroupDelay()).
+ *
+ * getLatency() suma al retardo de grupo la espera de bloque y el tiempo de cálculo
+ * medido, para comprobar la latencia de extremo a extremo frente a un plazo.
+ *
+ * @par Ejemplo
+ * @code
+ * IIRFilter notch(notchCoeffs, 1, 64);
+ * FIRFilter lowpass(lowpassCoeffs, 51, 64);
+ * WaveletFilter wavelet(64);
+ *
+ * FilterChain<IIRFilter, FIRFilter, WaveletFilter> chain(64, notch, lowpass, wavelet);
+ *
+ * chain.processBuffer(ecgRaw, ecgClean, 2048);       // Sin arrays intermedios de 2048
+ * float32_t delay = chain.getGroupDelay(10.0f / 1000.0f);   // Muestras a 10 Hz
+ * uint32_t bytes = chain.getMemoryUsage();
+ *
+ * PipelineLatency latency = chain.getLatency(1000.0f, measuredMicros);
+ * bool ok = latency.meets(50.0f);                    // ¿Dentro de 50 ms?
+ * @endcode
+ *
+ * @note Las etapas se guardan por referencia: deben vivir al menos tanto como la cadena.
+ * Cada etapa conserva su estado, así que un mismo filtro no debe usarse a la vez
+ * dentro y fuera de la cadena.
+ *
+ * FilterPipeline es la variante que contiene sus propias etapas, copiadas de unos
+ * filtros prototipo. Es copiable: cada copia tiene estados y buffers de trabajo propios
+ * pero comparte las tablas de coeficientes del prototipo, lo que permite clonar un
+ * mismo diseño para procesar muchas señales en paralelo (ver BatchProcessor en host).
+ *
+ * @code
+ * FilterPipeline<IIRFilter, FIRFilter> prototype(64, notch, lowpass);   // Copia las etapas
+ * FilterPipeline<IIRFilter, FIRFilter> worker2(prototype);              // Mismos coeficientes
+ * worker2.reset();                                                      // Estado a cero
+ * @endcode
+ */
+
+#ifndef FILTER_CHAIN_H
+#define FILTER_CHAIN_H
+
+#include <arm_math.h>
+
+/**
+ * @brief Presupuesto de latencia de una cadena (FilterChainBase::getLatency())
+ *
+ * @details Una muestra que llega al principio de un bloque espera blockSize - 1
+ * muestras a que el bloque se complete, después el cálculo del bloque y, ya en la
+ * salida, el retardo de grupo de las etapas. La suma es la latencia de extremo a
+ * extremo que se compara con el plazo de la aplicación.
+ */
+struct PipelineLatency {
+    float32_t groupDelay;       ///< Retardo de grupo de las etapas (muestras)
+    uint16_t bufferDelay;       ///< Espera hasta completar un bloque: blockSize - 1 muestras
+    float32_t processingMs;     ///< Cálculo de un bloque (medido, 0 si no se conoce)
+    float32_t blockPeriodMs;    ///< Tiempo entre dos bloques a la frecuencia de muestreo
+    float32_t totalMs;          ///< Latencia de extremo a extremo
+
+    /**
+     * @brief Desplazamiento entero que alinea la salida con la entrada (o dos flujos entre sí)
+     */
+    uint32_t getAlignment() const { return (uint32_t)(groupDelay + 0.5f); }
+
+    /**
+     * @brief true si el cálculo cabe en un periodo de bloque y la latencia en el plazo
+     */
+    bool meets(float32_t deadlineMs) const {
+        return processingMs <= blockPeriodMs && totalMs <= deadlineMs;
+    }
+};
+
+/**
+ * @brief Cómo guarda un eslabón su etapa: por referencia (FilterChain) o por valor
+ * (FilterPipeline)
+ */
+template <typename T, bool Owns>
+struct FilterChainStage {
+    typedef T& type;
+    typedef T& param;
+};
+
+template <typename T>
+struct FilterChainStage<T, true> {
+    typedef T type;
+    typedef const T& param;
+};
+
+/**
+ * @brief Eslabón recursivo de la cadena: una etapa y el resto de la cadena
+ *
+ * @details La recursión se expande en tiempo de compilación en una secuencia de
+ * llamadas directas (normalmente inlineadas), una por etapa.
+ */
+template <bool Owns, typename... Stages>
+struct FilterChainLink;
+
+/**
+ * @brief Última etapa: escribe directamente en el buffer de salida
+ */
+template <bool Owns, typename Last>
+struct FilterChainLink<Owns, Last> {
+    typename FilterChainStage<Last, Owns>::type stage;
+
+    explicit FilterChainLink(typename FilterChainStage<Last, Owns>::param last) : stage(last) {}
+
+    void processBuffer(float32_t* input, float32_t* output,
+                       float32_t* scratch, float32_t* spare, uint32_t length) {
+        (void)scratch;
+        (void)spare;
+        stage.processBuffer(input, output, length);
+    }
+
+    float32_t processSample(float32_t input) {
+        return stage.processSample(input);
+    }
+
+    float32_t getGroupDelay(float32_t normalizedFrequency) const {
+        return stage.getGroupDelay(normalizedFrequency);
+    }
+
+    uint32_t getMemoryUsage() const {
+        return stage.getMemoryUsage();
+    }
+
+    void reset() {
+        stage.reset();
+    }
+};
+
+/**
+ * @brief Etapa intermedia: escribe en un buffer de trabajo y cede el otro a la siguiente
+ */
+template <bool Owns, typename First, typename... Rest>
+struct FilterChainLink<Owns, First, Rest...> {
+    typename FilterChainStage<First, Owns>::type stage;
+    FilterChainLink<Owns, Rest...> next;
+
+    FilterChainLink(typename FilterChainStage<First, Owns>::param first,
+                    typename FilterChainStage<Rest, Owns>::param... rest)
+        : stage(first), next(rest...) {}
+
+    void processBuffer(float32_t* input, float32_t* output,
+                       float32_t* scratch, float32_t* spare, uint32_t length) {
+        // Esta etapa escribe en 'scratch'; la siguiente lo lee y escribe en 'spare'
+        stage.processBuffer(input, scratch, length);
+        next.processBuffer(scratch, output, spare, scratch, length);
+    }
+
+    float32_t processSample(float32_t input) {
+        return next.processSample(stage.processSample(input));
+    }
+
+    float32_t getGroupDelay(float32_t normalizedFrequency) const {
+        return stage.getGroupDelay(normalizedFrequency) + next.getGroupDelay(normalizedFrequency);
+    }
+
+    uint32_t getMemoryUsage() const {
+        return stage.getMemoryUsage() + next.getMemoryUsage();
+    }
+
+    void reset() {
+        stage.reset();
+        next.reset();
+    }
+};
+
+/**
+ * @brief Parte común de FilterChain y FilterPipeline: eslabones y buffers ping-pong
+ *
+ * @tparam Owns true si las etapas se guardan por valor
+ * @tparam Stages Tipos de las etapas, en orden de procesamiento
+ */
+template <bool Owns, typename... Stages>
+class FilterChainBase {
+    public:
+        ~FilterChainBase() {
+            delete[] _ping;
+            delete[] _pong;
+        }
+
+        /**
+         * @brief Procesa un buffer de cualquier longitud por todas las etapas
+         *
+         * @param inputArray Muestras de entrada
+         * @param outputArray Destino (puede coincidir con inputArray)
+         * @param length Número de muestras
+         */
+        void processBuffer(float32_t* inputArray, float32_t* outputArray, uint32_t length) {
+            while (length > 0) {
+                uint32_t chunk = (length < _blockSize) ? length : _blockSize;
+                _link.processBuffer(inputArray, outputArray, _ping, _pong, chunk);
+                inputArray += chunk;
+                outputArray += chunk;
+                length -= chunk;
+            }
+        }
+
+        /**
+         * @brief Procesa una muestra por todas las etapas
+         */
+        float32_t processSample(float32_t input) {
+            return _link.processSample(input);
+        }
+
+        /**
+         * @brief Retardo de grupo total (suma de las etapas)
+         *
+         * @param normalizedFrequency Frecuencia normalizada f/Fs (0.0 a 0.5)
+         * @return float32_t Retardo en muestras
+         */
+        float32_t getGroupDelay(float32_t normalizedFrequency = 0.0f) const {
+            return _link.getGroupDelay(normalizedFrequency);
+        }
+
+        /**
+         * @brief Presupuesto de latencia procesando bloques de blockSize muestras
+         *
+         * @param sampleRate Frecuencia de muestreo (Hz)
+         * @param processingMicros Tiempo de un processBuffer() de blockSize muestras,
+         * medido con micros() (0: solo latencia algorítmica y de bloque)
+         * @param normalizedFrequency Frecuencia del retardo de grupo (f/Fs)
+         */
+        PipelineLatency getLatency(float32_t sampleRate, uint32_t processingMicros = 0,
+                                   float32_t normalizedFrequency = 0.0f) const {
+            PipelineLatency latency;
+            latency.groupDelay = getGroupDelay(normalizedFrequency);
+            latency.bufferDelay = _blockSize - 1;
+            latency.processingMs = processingMicros / 1000.0f;
+            latency.blockPeriodMs = 1000.0f * _blockSize / sampleRate;
+            latency.totalMs = 1000.0f * (latency.groupDelay + latency.bufferDelay) / sampleRate
+                            + latency.processingMs;
+            return latency;
+        }
+
+        /**
+         * @brief RAM total: etapas + objeto + dos buffers de trabajo
+         *
+         * @details Si las etapas están dentro del objeto, su sizeof ya lo cuenta
+         * getMemoryUsage() de cada una y no se suma dos veces.
+         */
+        uint32_t getMemoryUsage() const {
+            return _link.getMemoryUsage() + sizeof(*this) - (Owns ? sizeof(_link) : 0u)
+                 + 2u * _blockSize * sizeof(float32_t);
+        }
+
+        /**
+         * @brief Reinicia el estado de todas las etapas (requiere reset() en cada una)
+         */
+        void reset() {
+            _link.reset();
+        }
+
+        uint8_t getNumStages() const { return (uint8_t)sizeof...(Stages); }
+        uint16_t getBlockSize() const { return _blockSize; }
+
+    protected:
+        FilterChainBase(uint16_t blockSize, typename FilterChainStage<Stages, Owns>::param... stages)
+            : _link(stages...),
+              _blockSize(blockSize ? blockSize : 1)
+        {
+            _ping = new float32_t[_blockSize]();
+            _pong = new float32_t[_blockSize]();
+        }
+
+        /**
+         * @brief Copia los eslabones (y con ellos las etapas, si son por valor) y
+         * reserva buffers de trabajo nuevos
+         */
+        FilterChainBase(const FilterChainBase& other)
+            : _link(other._link),
+              _blockSize(other._blockSize)
+        {
+            _ping = new float32_t[_blockSize]();
+            _pong = new float32_t[_blockSize]();
+        }
+
+    private:
+        FilterChainBase& operator=(const FilterChainBase&);
+
+        FilterChainLink<Owns, Stages...> _link;
+        uint16_t _blockSize;
+        float32_t* _ping;
+        float32_t* _pong;
+};
+
+/**
+ * @class FilterChain
+ * @brief Composición de filtros en serie procesada por bloques (etapas por referencia)
+ *
+ * @tparam Stages Tipos de las etapas, en orden de procesamiento
+ */
+template <typename... Stages>
+class FilterChain : public FilterChainBase<false, Stages...> {
+    public:
+        /**
+         * @brief Construye la cadena y reserva los dos buffers de trabajo
+         *
+         * @param blockSize Muestras por bloque (idealmente el blockSize de los filtros:
+         * los bloques más largos los trocea cada FIRFilter internamente)
+         * @param stages Etapas en orden de procesamiento
+         */
+        FilterChain(uint16_t blockSize, Stages&... stages)
+            : FilterChainBase<false, Stages...>(blockSize, stages...)
+        {
+        }
+
+    private:
+        // No copiable: dos cadenas compartirían el estado de las mismas etapas
+        FilterChain(const FilterChain&);
+        FilterChain& operator=(const FilterChain&);
+};
+
+/**
+ * @class FilterPipeline
+ * @brief Cadena de filtros que contiene copias propias de sus etapas
+ *
+ * @details Cada etapa se construye con su constructor de copia a partir del prototipo:
+ * FIRFilter, IIRFilter y WaveletFilter comparten los coeficientes y solo reservan los
+ * buffers de estados. Copiar un FilterPipeline produce otro independiente.
+ *
+ * @tparam Stages Tipos de las etapas, en orden de procesamiento
+ */
+template <typename... Stages>
+class FilterPipeline : public FilterChainBase<true, Stages...> {
+    public:
+        /**
+         * @param blockSize Muestras por bloque
+         * @param prototypes Filtros de los que se copian las etapas (pueden destruirse
+         * después, salvo sus tablas de coeficientes)
+         */
+        FilterPipeline(uint16_t blockSize, const Stages&... prototypes)
+            : FilterChainBase<true, Stages...>(blockSize, prototypes...)
+        {
+        }
+
+        FilterPipeline(const FilterPipeline& other)
+            : FilterChainBase<true, Stages...>(other)
+        {
+        }
+
+    private:
+        FilterPipeline& operator=(const FilterPipeline&);
+};
+
+#endif // FILTER_CHAIN_H
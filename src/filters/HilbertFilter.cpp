@@ -0,0 +1,134 @@
+/**
+ * @file HilbertFilter.cpp
+ * @brief Implementación del Hilbert FIR plegado y de las aproximaciones de magnitud y fase
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @see HilbertFilter.h para la estructura del filtro
+ */
+
+#include "HilbertFilter.h"
+#include <string.h>
+
+// alfa·max + beta·min de error máximo mínimo
+#define MAGNITUDE_ALPHA 0.96043387f
+#define MAGNITUDE_BETA  0.39782473f
+
+HilbertFilter::HilbertFilter(uint16_t numTaps, FIRDesign::Window window)
+    : _numTaps(numTaps),
+      _center((numTaps - 1) / 2),
+      _numCoeffs(0),
+      _coeffs(nullptr),
+      _history(nullptr),
+      _position(0)
+{
+    if (numTaps < 3 || (numTaps & 1) == 0) {
+        return;
+    }
+
+    // Diseño completo (orden CMSIS: índice i <-> t = center - i) y se guardan los impares
+    float32_t* full = new float32_t[numTaps];
+    FIRDesign::design(full, numTaps, FIRDesign::hilbertSpec(window));
+    _numCoeffs = (_center + 1) / 2;
+    _coeffs = new float32_t[_numCoeffs];
+    for (uint16_t j = 0; j < _numCoeffs; j++) {
+        _coeffs[j] = full[_center - (2 * j + 1)];
+    }
+    delete[] full;
+
+    _history = new float32_t[2 * numTaps];
+    reset();
+}
+
+HilbertFilter::~HilbertFilter() {
+    delete[] _coeffs;
+    delete[] _history;
+}
+
+float32_t HilbertFilter::step(float32_t input, float32_t& inPhase) {
+    // Buffer duplicado: la ventana _history[_position .. _position + numTaps - 1] es contigua
+    _history[_position] = input;
+    _history[_position + _numTaps] = input;
+    if (++_position == _numTaps) {
+        _position = 0;
+    }
+    const float32_t* x = _history + _position + _center;
+
+    // x[-t] es la muestra t anterior al centro y x[t] la t posterior
+    float32_t quadrature = 0.0f;
+    for (uint16_t j = 0; j < _numCoeffs; j++) {
+        uint16_t t = 2 * j + 1;
+        quadrature += _coeffs[j] * (x[-(int16_t)t] - x[t]);
+    }
+    inPhase = x[0];
+    return quadrature;
+}
+
+void HilbertFilter::processBuffer(float32_t* input, float32_t* inPhase, float32_t* quadrature, uint32_t length) {
+    if (_coeffs == nullptr) {
+        return;
+    }
+    for (uint32_t i = 0; i < length; i++) {
+        float32_t re;
+        quadrature[i] = step(input[i], re);
+        inPhase[i] = re;
+    }
+}
+
+void HilbertFilter::processPolar(float32_t* input, float32_t* magnitude, float32_t* phase, uint32_t length, bool fast) {
+    if (_coeffs == nullptr) {
+        return;
+    }
+    for (uint32_t i = 0; i < length; i++) {
+        float32_t re;
+        float32_t im = step(input[i], re);
+        magnitude[i] = fast ? fastMagnitude(re, im) : sqrtf(re * re + im * im);
+        if (phase != nullptr) {
+            phase[i] = fast ? fastAtan2(im, re) : atan2f(im, re);
+        }
+    }
+}
+
+void HilbertFilter::reset() {
+    if (_history != nullptr) {
+        memset(_history, 0, 2 * _numTaps * sizeof(float32_t));
+    }
+    _position = 0;
+}
+
+uint32_t HilbertFilter::getMemoryUsage() const {
+    if (_coeffs == nullptr) {
+        return sizeof(HilbertFilter);
+    }
+    return sizeof(HilbertFilter) + (_numCoeffs + 2 * _numTaps) * sizeof(float32_t);
+}
+
+// ============================================================================
+// Aproximaciones
+// ============================================================================
+
+float32_t HilbertFilter::fastMagnitude(float32_t re, float32_t im) {
+    float32_t a = fabsf(re);
+    float32_t b = fabsf(im);
+    return (a > b) ? MAGNITUDE_ALPHA * a + MAGNITUDE_BETA * b : MAGNITUDE_ALPHA * b + MAGNITUDE_BETA * a;
+}
+
+float32_t HilbertFilter::fastAtan2(float32_t y, float32_t x) {
+    float32_t ax = fabsf(x);
+    float32_t ay = fabsf(y);
+    if (ax == 0.0f && ay == 0.0f) {
+        return 0.0f;
+    }
+    // atan(a) con a = min/max en [0, 1] (Abramowitz y Stegun 4.4.49) y después el octante
+    float32_t a = (ax > ay) ? ay / ax : ax / ay;
+    float32_t s = a * a;
+    float32_t r = a * (0.9998660f + s * (-0.3302995f + s * (0.1801410f + s * (-0.0851330f + s * 0.0208351f))));
+    if (ay > ax) {
+        r = 0.5f * PI - r;
+    }
+    if (x < 0.0f) {
+        r = PI - r;
+    }
+    return (y < 0.0f) ? -r : r;
+}
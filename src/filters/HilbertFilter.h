@@ -0,0 +1,120 @@
+/**
+ * @file HilbertFilter.h
+ * @brief Señal analítica con un FIR de Hilbert plegado: amplitud y fase instantáneas
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @details La envolvente y la fase instantánea (respiración a partir de la modulación
+ * de amplitud del ECG, acoplamiento fase-amplitud en EEG) salen de la señal analítica
+ * x + j·H{x}. El transformador de Hilbert FIR de N coeficientes tiene dos propiedades
+ * que un FIRFilter genérico no aprovecha:
+ *
+ * - Los coeficientes en posiciones pares respecto al centro son cero.
+ * - Es antisimétrico: h[-t] = -h[t].
+ *
+ * Así, la cuadratura es Σ h[t]·(x[c - t] - x[c + t]) sobre los t impares: (N + 1)/4
+ * MACs por muestra en vez de N, la cuarta parte. La componente en fase es la muestra
+ * central de la misma ventana, así que las dos salen con el mismo retardo,
+ * (N - 1)/2 muestras, sin una línea de retardo aparte.
+ *
+ * La magnitud y la fase pueden calcularse exactas (sqrtf, atan2f) o con aproximaciones
+ * rápidas para el Cortex-M3 sin FPU: alfa·max + beta·min (error < 4 %) y un polinomio
+ * de arcotangente (error ~1e-5 rad).
+ *
+ * La banda útil es aproximadamente [2/N, 0.5 - 2/N]·Fs con la ventana de Blackman: por
+ * debajo la ganancia cae, como en cualquier Hilbert FIR.
+ *
+ * @par Ejemplo
+ * @code
+ * HilbertFilter hilbert(63);                        // 31 muestras de retardo (32 ms a 960 Hz)
+ * hilbert.processPolar(ecg, envelope, phase, 32);   // aproximaciones rápidas
+ * @endcode
+ */
+
+#ifndef HILBERT_FILTER_H
+#define HILBERT_FILTER_H
+
+#include <arm_math.h>
+#include "FIRDesign.h"
+
+/**
+ * @class HilbertFilter
+ * @brief Par analítico (en fase y cuadratura) con el mismo retardo
+ */
+class HilbertFilter {
+    public:
+        /**
+         * @param numTaps Longitud del Hilbert FIR (impar >= 3; mejor 4K - 1: con 4K + 1
+         *                los extremos son cero)
+         * @param window Ventana del diseño (Blackman: rizado pequeño en la banda útil)
+         */
+        explicit HilbertFilter(uint16_t numTaps = 31, FIRDesign::Window window = FIRDesign::WINDOW_BLACKMAN);
+        ~HilbertFilter();
+
+        /**
+         * @brief false si numTaps es par o menor que 3
+         */
+        bool isValid() const { return _coeffs != nullptr; }
+
+        /**
+         * @brief Señal analítica: inPhase[n] = x[n - D], quadrature[n] = H{x}[n - D]
+         */
+        void processBuffer(float32_t* input, float32_t* inPhase, float32_t* quadrature, uint32_t length);
+
+        /**
+         * @brief Amplitud y fase instantáneas
+         *
+         * @param phase Destino de la fase en (-π, π] (nullptr si solo se quiere la envolvente)
+         * @param fast true: aproximaciones rápidas; false: sqrtf y atan2f
+         */
+        void processPolar(float32_t* input, float32_t* magnitude, float32_t* phase, uint32_t length, bool fast = true);
+
+        /**
+         * @brief Retardo común de las dos salidas: (numTaps - 1)/2 muestras
+         */
+        float32_t getGroupDelay(float32_t normalizedFrequency = 0.0f) const {
+            (void)normalizedFrequency;
+            return _center;
+        }
+
+        uint16_t getNumTaps() const { return _numTaps; }
+
+        /**
+         * @brief Coeficientes distintos de cero: h[1], h[3], ... (MACs por muestra)
+         */
+        uint16_t getNumCoefficients() const { return _numCoeffs; }
+        const float32_t* getCoefficients() const { return _coeffs; }
+
+        void reset();
+        uint32_t getMemoryUsage() const;
+
+        /**
+         * @brief |re + j·im| ≈ alfa·max + beta·min (error máximo 3.96 %)
+         */
+        static float32_t fastMagnitude(float32_t re, float32_t im);
+
+        /**
+         * @brief atan2(y, x) con un polinomio impar de grado 9 (error máximo ~1e-5 rad)
+         */
+        static float32_t fastAtan2(float32_t y, float32_t x);
+
+    private:
+        // No copiable: posee los coeficientes y el historial
+        HilbertFilter(const HilbertFilter&);
+        HilbertFilter& operator=(const HilbertFilter&);
+
+        /**
+         * @brief Añade una muestra y calcula la cuadratura del centro de la ventana
+         */
+        float32_t step(float32_t input, float32_t& inPhase);
+
+        uint16_t _numTaps;
+        uint16_t _center;                ///< (numTaps - 1)/2
+        uint16_t _numCoeffs;
+        float32_t* _coeffs;              ///< h[1], h[3], h[5], ...
+        float32_t* _history;             ///< Buffer circular duplicado de numTaps muestras
+        uint16_t _position;
+};
+
+#endif // HILBERT_FILTER_H
@@ -12,6 +12,8 @@
  */
 
 #include "IIRFilter.h"
+#include "../utils/utils.h"
+#include <string.h>
 
 /**
  * @brief Constructor que inicializa el filtro IIR Biquad.
@@ -51,6 +53,21 @@ IIRFilter::IIRFilter(float32_t* coeffs, uint8_t numStages, uint16_t blockSize)
                                     _state);          // Puntero al buffer de estados
 }
 
+/**
+ * @brief Constructor de copia: mismos coeficientes (compartidos), estado duplicado.
+ */
+IIRFilter::IIRFilter(const IIRFilter& other)
+    : _coeffs(other._coeffs),
+      _numStages(other._numStages),
+      _blockSize(other._blockSize)
+{
+    _state = new float32_t[4 * _numStages];
+    arm_biquad_cascade_df1_init_f32(&_iirInstance, _numStages, _coeffs, _state);
+
+    // arm_biquad_cascade_df1_init_f32() pone el estado a cero: copiar el del original
+    memcpy(_state, other._state, 4 * _numStages * sizeof(float32_t));
+}
+
 /**
  * @brief Destructor que libera la memoria del buffer de estados.
  * * @details Libera de forma segura la memoria asignada dinámicamente en el constructor
@@ -111,4 +128,35 @@ void IIRFilter::processBuffer(float32_t* inputArray, float32_t* outputArray, uin
                                inputArray,    // Buffer de entrada
                                outputArray,   // Buffer de salida
                                length);       // Número de muestras a procesar
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Calcula el retardo de grupo sumando el de cada sección Biquad.
+ * * @details Cada sección es B(z)/A(z), con retardo gd(B) - gd(A). CMSIS-DSP almacena
+ * a1 y a2 con el signo cambiado (y[n] = ... + a1·y[n-1] + a2·y[n-2]), así que el
+ * denominador es A(z) = 1 - a1·z⁻¹ - a2·z⁻².
+ */
+float32_t IIRFilter::getGroupDelay(float32_t normalizedFrequency) const {
+    float32_t delay = 0.0f;
+    for (uint8_t stage = 0; stage < _numStages; stage++) {
+        const float32_t* c = _coeffs + 5 * stage;
+        float32_t denominator[3] = {1.0f, -c[3], -c[4]};
+        delay += calculateGroupDelay(c, 3, normalizedFrequency)
+               - calculateGroupDelay(denominator, 3, normalizedFrequency);
+    }
+    return delay;
+}
+
+/**
+ * @brief Pone a cero los estados de todas las secciones.
+ */
+void IIRFilter::reset() {
+    memset(_state, 0, 4 * _numStages * sizeof(float32_t));
+}
+
+/**
+ * @brief Bytes del objeto más el buffer de estados (4 floats por sección).
+ */
+uint32_t IIRFilter::getMemoryUsage() const {
+    return sizeof(IIRFilter) + 4u * _numStages * sizeof(float32_t);
+}
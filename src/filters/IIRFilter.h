@@ -92,6 +92,13 @@ class IIRFilter {
          */
         IIRFilter(float32_t* coeffs, uint8_t numStages, uint16_t blockSize);
 
+        /**
+         * @brief Constructor de copia: comparte los coeficientes y duplica el estado.
+         * * Permite clonar un filtro prototipo para varias señales independientes sin
+         * duplicar la tabla de coeficientes.
+         */
+        IIRFilter(const IIRFilter& other);
+
         /**
          * @brief Destructor de la clase IIRFilter
          * * Libera la memoria asignada para el buffer de estados interno.
@@ -118,7 +125,30 @@ class IIRFilter {
          */
         void processBuffer(float32_t* inputArray, float32_t* outputArray, uint32_t length);
 
+        /**
+         * @brief Retardo de grupo de la cascada a una frecuencia dada
+         * * @param normalizedFrequency Frecuencia normalizada f/Fs (0.0 a 0.5).
+         * @return float32_t Retardo en muestras (suma de todas las secciones).
+         * * @note La fase de un IIR no es lineal: el retardo varía con la frecuencia y
+         * puede ser grande cerca de polos muy próximos a la circunferencia unidad
+         * (notch estrechos). Evaluarlo en la banda de interés de la señal.
+         */
+        float32_t getGroupDelay(float32_t normalizedFrequency = 0.0f) const;
+
+        /**
+         * @brief Reinicia el estado interno (x[n-1], x[n-2], y[n-1], y[n-2] a cero).
+         */
+        void reset();
+
+        /**
+         * @brief Memoria RAM ocupada por el filtro (objeto + 4 estados por sección).
+         * * @return uint32_t Bytes ocupados, sin contar los coeficientes externos.
+         */
+        uint32_t getMemoryUsage() const;
+
     private:
+        // No asignable: el buffer de estados está enlazado a _iirInstance
+        IIRFilter& operator=(const IIRFilter&);
 
         /**
          * @brief Puntero a los coeficientes del filtro IIR.
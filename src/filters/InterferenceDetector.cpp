@@ -0,0 +1,389 @@
+/**
+ * @file InterferenceDetector.cpp
+ * @brief Implementación del banco de Goertzel, el banco de notch y el notch automático
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @see InterferenceDetector.h para la medida línea/fondo y la histéresis
+ */
+
+#include "InterferenceDetector.h"
+#include <string.h>
+
+static const float32_t MAINS_FREQUENCIES[] = {50.0f, 60.0f, 100.0f, 120.0f, 150.0f, 180.0f};
+#define MAINS_COUNT  6
+
+// ============================================================================
+// NotchBank
+// ============================================================================
+
+NotchBank::NotchBank(float32_t sampleRate, uint8_t maxNotches, float32_t q, uint16_t blockSize)
+    : _sampleRate(sampleRate),
+      _q(q > 0.0f ? q : 30.0f),
+      _maxNotches(maxNotches ? maxNotches : 1)
+{
+    _coeffs = new float32_t[5 * _maxNotches]();
+    _frequencies = new float32_t[_maxNotches]();
+    _stages = new IIRFilter*[_maxNotches];
+    for (uint8_t s = 0; s < _maxNotches; s++) {
+        // Paso directo hasta que se sintonice
+        _coeffs[5 * s] = 1.0f;
+        _stages[s] = new IIRFilter(_coeffs + 5 * s, 1, blockSize);
+    }
+}
+
+NotchBank::~NotchBank() {
+    for (uint8_t s = 0; s < _maxNotches; s++) {
+        delete _stages[s];
+    }
+    delete[] _stages;
+    delete[] _frequencies;
+    delete[] _coeffs;
+}
+
+void NotchBank::designNotch(float32_t* coeffs, float32_t frequency, float32_t sampleRate, float32_t q) {
+    float32_t w0 = 2.0f * PI * frequency / sampleRate;
+    float32_t cosw = cosf(w0);
+    float32_t alpha = sinf(w0) / (2.0f * q);
+    float32_t a0 = 1.0f + alpha;
+
+    coeffs[0] = 1.0f / a0;
+    coeffs[1] = -2.0f * cosw / a0;
+    coeffs[2] = 1.0f / a0;
+    coeffs[3] = 2.0f * cosw / a0;
+    coeffs[4] = -(1.0f - alpha) / a0;
+}
+
+bool NotchBank::setNotch(uint8_t stage, float32_t frequency) {
+    if (stage >= _maxNotches || frequency <= 0.0f || frequency >= 0.5f * _sampleRate) {
+        return false;
+    }
+    if (_frequencies[stage] == 0.0f) {
+        _stages[stage]->reset();
+    }
+    // Los IIRFilter leen los coeficientes por puntero: el cambio es inmediato
+    designNotch(_coeffs + 5 * stage, frequency, _sampleRate, _q);
+    _frequencies[stage] = frequency;
+    return true;
+}
+
+void NotchBank::disable(uint8_t stage) {
+    if (stage < _maxNotches) {
+        _frequencies[stage] = 0.0f;
+    }
+}
+
+float32_t NotchBank::getFrequency(uint8_t stage) const {
+    return (stage < _maxNotches) ? _frequencies[stage] : 0.0f;
+}
+
+int8_t NotchBank::findStage(float32_t frequency, float32_t tolerance) const {
+    for (uint8_t s = 0; s < _maxNotches; s++) {
+        if (_frequencies[s] != 0.0f && fabsf(_frequencies[s] - frequency) <= tolerance) {
+            return (int8_t)s;
+        }
+    }
+    return -1;
+}
+
+int8_t NotchBank::findFreeStage() const {
+    for (uint8_t s = 0; s < _maxNotches; s++) {
+        if (_frequencies[s] == 0.0f) {
+            return (int8_t)s;
+        }
+    }
+    return -1;
+}
+
+void NotchBank::processBuffer(float32_t* input, float32_t* output, uint32_t length) {
+    float32_t* source = input;
+    for (uint8_t s = 0; s < _maxNotches; s++) {
+        if (_frequencies[s] != 0.0f) {
+            _stages[s]->processBuffer(source, output, length);
+            source = output;
+        }
+    }
+    if (source != output) {
+        memmove(output, input, length * sizeof(float32_t));
+    }
+}
+
+float32_t NotchBank::processSample(float32_t input) {
+    float32_t output;
+    processBuffer(&input, &output, 1);
+    return output;
+}
+
+float32_t NotchBank::getGroupDelay(float32_t normalizedFrequency) const {
+    float32_t delay = 0.0f;
+    for (uint8_t s = 0; s < _maxNotches; s++) {
+        if (_frequencies[s] != 0.0f) {
+            delay += _stages[s]->getGroupDelay(normalizedFrequency);
+        }
+    }
+    return delay;
+}
+
+void NotchBank::reset() {
+    for (uint8_t s = 0; s < _maxNotches; s++) {
+        _stages[s]->reset();
+    }
+}
+
+uint32_t NotchBank::getMemoryUsage() const {
+    uint32_t total = sizeof(NotchBank) + _maxNotches * (6 * sizeof(float32_t) + sizeof(IIRFilter*));
+    for (uint8_t s = 0; s < _maxNotches; s++) {
+        total += _stages[s]->getMemoryUsage();
+    }
+    return total;
+}
+
+uint8_t NotchBank::getActiveStages() const {
+    uint8_t active = 0;
+    for (uint8_t s = 0; s < _maxNotches; s++) {
+        if (_frequencies[s] != 0.0f) {
+            active++;
+        }
+    }
+    return active;
+}
+
+// ============================================================================
+// InterferenceDetector
+// ============================================================================
+
+InterferenceDetector::InterferenceDetector(float32_t sampleRate, const float32_t* frequencies,
+                                           uint8_t numFrequencies, float32_t window)
+    : _sampleRate(sampleRate),
+      _count(0),
+      _windowCount(0)
+{
+    _frequencies = new float32_t[numFrequencies ? numFrequencies : 1];
+    for (uint8_t i = 0; i < numFrequencies; i++) {
+        if (frequencies[i] > 0.0f && frequencies[i] < 0.5f * sampleRate) {
+            _frequencies[_count++] = frequencies[i];
+        }
+    }
+
+    uint8_t slots = _count ? _count : 1;
+    _coeffs = new float32_t[slots];
+    _s1 = new float32_t[slots];
+    _s2 = new float32_t[slots];
+    _amplitude = new float32_t[slots];
+    _ratio = new float32_t[slots];
+    _detected = new bool[slots];
+    for (uint8_t i = 0; i < _count; i++) {
+        _coeffs[i] = 2.0f * cosf(2.0f * PI * _frequencies[i] / sampleRate);
+    }
+
+    _windowLength = (uint32_t)(window * sampleRate + 0.5f);
+    if (_windowLength < 16) {
+        _windowLength = 16;
+    }
+    _rotCos = cosf(2.0f * PI / _windowLength);
+    _rotSin = sinf(2.0f * PI / _windowLength);
+
+    setThresholds(10.0f, 6.0f);
+    reset();
+}
+
+InterferenceDetector::~InterferenceDetector() {
+    delete[] _frequencies;
+    delete[] _coeffs;
+    delete[] _s1;
+    delete[] _s2;
+    delete[] _amplitude;
+    delete[] _ratio;
+    delete[] _detected;
+}
+
+void InterferenceDetector::setThresholds(float32_t onDb, float32_t offDb) {
+    _onRatio = powf(10.0f, 0.1f * onDb);
+    _offRatio = powf(10.0f, 0.1f * offDb);
+}
+
+bool InterferenceDetector::processBuffer(const float32_t* input, uint32_t length) {
+    bool finished = false;
+    for (uint32_t n = 0; n < length; n++) {
+        float32_t x = input[n];
+        _sum += x;
+        _sumSquares += x * x;
+
+        float32_t windowed = x * (0.5f - 0.5f * _oscCos);
+        for (uint8_t i = 0; i < _count; i++) {
+            float32_t s = windowed + _coeffs[i] * _s1[i] - _s2[i];
+            _s2[i] = _s1[i];
+            _s1[i] = s;
+        }
+
+        float32_t c = _oscCos * _rotCos - _oscSin * _rotSin;
+        _oscSin = _oscSin * _rotCos + _oscCos * _rotSin;
+        _oscCos = c;
+
+        if (++_position == _windowLength) {
+            finishWindow();
+            finished = true;
+        }
+    }
+    return finished;
+}
+
+/**
+ * @details Con la ventana de Hann periódica Σw = N/2 y Σw² = 3N/8. Una senoide de
+ * amplitud A da |X| = A·Σw/2; ruido blanco de potencia P da E|X|² = P·Σw².
+ */
+void InterferenceDetector::finishWindow() {
+    float32_t n = (float32_t)_windowLength;
+    float32_t sumW = 0.5f * n;
+    float32_t sumW2 = 0.375f * n;
+
+    float32_t mean = _sum / n;
+    float32_t total = _sumSquares / n - mean * mean;
+    float32_t linePower = 0.0f;
+    for (uint8_t i = 0; i < _count; i++) {
+        float32_t power = _s1[i] * _s1[i] + _s2[i] * _s2[i] - _coeffs[i] * _s1[i] * _s2[i];
+        _s1[i] = power > 0.0f ? power : 0.0f;   // |X|² provisional
+        _amplitude[i] = 2.0f * sqrtf(_s1[i]) / sumW;
+        linePower += 0.5f * _amplitude[i] * _amplitude[i];
+    }
+
+    float32_t floor = total - linePower;
+    float32_t minimum = 1e-6f * total + 1e-20f;
+    if (floor < minimum) {
+        floor = minimum;
+    }
+
+    for (uint8_t i = 0; i < _count; i++) {
+        float32_t ratio = _s1[i] / (sumW2 * floor);
+        _ratio[i] = 10.0f * log10f(ratio + 1e-20f);
+        _detected[i] = _detected[i] ? (ratio > _offRatio) : (ratio > _onRatio);
+        _s1[i] = 0.0f;
+        _s2[i] = 0.0f;
+    }
+
+    _position = 0;
+    _windowCount++;
+    _oscCos = 1.0f;
+    _oscSin = 0.0f;
+    _sum = 0.0f;
+    _sumSquares = 0.0f;
+}
+
+uint8_t InterferenceDetector::getDetectedCount() const {
+    uint8_t detected = 0;
+    for (uint8_t i = 0; i < _count; i++) {
+        if (_detected[i]) {
+            detected++;
+        }
+    }
+    return detected;
+}
+
+uint8_t InterferenceDetector::configure(NotchBank& notches) const {
+    // Fuera los notch de líneas que ya no están
+    for (uint8_t s = 0; s < notches.getMaxNotches(); s++) {
+        float32_t frequency = notches.getFrequency(s);
+        if (frequency == 0.0f) {
+            continue;
+        }
+        bool present = false;
+        for (uint8_t i = 0; i < _count; i++) {
+            if (_detected[i] && fabsf(_frequencies[i] - frequency) <= 0.5f) {
+                present = true;
+            }
+        }
+        if (!present) {
+            notches.disable(s);
+        }
+    }
+
+    // Líneas nuevas, de la más fuerte a la más débil, en los notch libres
+    uint32_t assigned = 0;   // Máscara de líneas ya tratadas (hasta 32 frecuencias)
+    while (true) {
+        int16_t best = -1;
+        for (uint8_t i = 0; i < _count && i < 32; i++) {
+            if (_detected[i] && !(assigned & (1UL << i)) && (best < 0 || _ratio[i] > _ratio[best])) {
+                best = i;
+            }
+        }
+        if (best < 0) {
+            break;
+        }
+        assigned |= 1UL << best;
+        if (notches.findStage(_frequencies[best]) >= 0) {
+            continue;
+        }
+        int8_t stage = notches.findFreeStage();
+        if (stage < 0) {
+            break;
+        }
+        notches.setNotch((uint8_t)stage, _frequencies[best]);
+    }
+    return notches.getActiveStages();
+}
+
+void InterferenceDetector::reset() {
+    for (uint8_t i = 0; i < _count; i++) {
+        _s1[i] = 0.0f;
+        _s2[i] = 0.0f;
+        _amplitude[i] = 0.0f;
+        _ratio[i] = -200.0f;
+        _detected[i] = false;
+    }
+    _position = 0;
+    _windowCount = 0;
+    _oscCos = 1.0f;
+    _oscSin = 0.0f;
+    _sum = 0.0f;
+    _sumSquares = 0.0f;
+}
+
+uint32_t InterferenceDetector::getMemoryUsage() const {
+    uint8_t slots = _count ? _count : 1;
+    return sizeof(InterferenceDetector) + slots * (6 * sizeof(float32_t) + sizeof(bool));
+}
+
+// ============================================================================
+// AutoNotchFilter
+// ============================================================================
+
+AutoNotchFilter::AutoNotchFilter(float32_t sampleRate, uint8_t maxNotches, const float32_t* frequencies,
+                                 uint8_t numFrequencies, uint16_t blockSize)
+    : _detector(sampleRate,
+                frequencies ? frequencies : MAINS_FREQUENCIES,
+                frequencies ? numFrequencies : MAINS_COUNT),
+      _notches(sampleRate, maxNotches, 30.0f, blockSize)
+{
+}
+
+void AutoNotchFilter::processBuffer(float32_t* input, float32_t* output, uint32_t length) {
+    // Se analiza la entrada: tras los notch la línea desaparecería y se desactivarían
+    if (_detector.processBuffer(input, length)) {
+        _detector.configure(_notches);
+    }
+    _notches.processBuffer(input, output, length);
+}
+
+float32_t AutoNotchFilter::processSample(float32_t input) {
+    float32_t output;
+    processBuffer(&input, &output, 1);
+    return output;
+}
+
+float32_t AutoNotchFilter::getGroupDelay(float32_t normalizedFrequency) const {
+    return _notches.getGroupDelay(normalizedFrequency);
+}
+
+void AutoNotchFilter::reset() {
+    _detector.reset();
+    for (uint8_t s = 0; s < _notches.getMaxNotches(); s++) {
+        _notches.disable(s);
+    }
+    _notches.reset();
+}
+
+uint32_t AutoNotchFilter::getMemoryUsage() const {
+    return sizeof(AutoNotchFilter) - sizeof(InterferenceDetector) - sizeof(NotchBank)
+         + _detector.getMemoryUsage() + _notches.getMemoryUsage();
+}
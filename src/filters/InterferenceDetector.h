@@ -0,0 +1,257 @@
+/**
+ * @file InterferenceDetector.h
+ * @brief Detector de interferencias con banco de Goertzel y notch que se configuran solos
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @details No se sabe de antemano si la red es de 50 o 60 Hz ni qué armónicos dominan
+ * en cada instalación, así que lo habitual es dejar un IIRFilter con un notch para
+ * cada posibilidad. Este módulo solo gasta CPU en la interferencia que hay:
+ *
+ * - InterferenceDetector: algoritmo de Goertzel para unas pocas frecuencias (1 MAC y
+ *   1 suma por frecuencia y muestra) con ventana de Hann generada por un oscilador
+ *   recursivo (sin tabla). Al final de cada ventana compara la potencia de cada línea
+ *   con el nivel de fondo de la señal y decide, con histéresis, si está presente.
+ * - NotchBank: hasta maxNotches notch de segundo orden que se activan, desactivan y
+ *   resintonizan en tiempo de ejecución. Solo se procesan los activos.
+ * - AutoNotchFilter: las dos cosas juntas con la interfaz de FIRFilter. Analiza la
+ *   entrada (antes de los notch, para no dejar de ver la interferencia que elimina) y
+ *   reconfigura el banco al final de cada ventana.
+ *
+ * La relación línea/fondo es |X|² / (Σw² · P), con P la potencia de la señal sin
+ * continua y sin las líneas. Es 1 (0 dB) para ruido blanco y no depende de la escala
+ * de la señal; el ECG tiene muy poca energía en 50-180 Hz, así que queda por debajo.
+ *
+ * @par Ejemplo
+ * @code
+ * AutoNotchFilter mains(960.0f);              // 50, 60, 100, 120, 150 y 180 Hz; hasta 3 notch
+ * FilterChain<AutoNotchFilter, FIRFilter> chain(32, mains, lowpass);
+ * chain.processBuffer(raw, clean, 32);
+ * Serial.println(mains.getNotchBank().getActiveStages());   // Notch realmente en uso
+ * @endcode
+ */
+
+#ifndef INTERFERENCE_DETECTOR_H
+#define INTERFERENCE_DETECTOR_H
+
+#include <arm_math.h>
+#include "IIRFilter.h"
+
+/**
+ * @class NotchBank
+ * @brief Notch de segundo orden activables y resintonizables en tiempo de ejecución
+ */
+class NotchBank {
+    public:
+        /**
+         * @param sampleRate Frecuencia de muestreo (Hz)
+         * @param maxNotches Número máximo de notch simultáneos
+         * @param q Factor de calidad (f0 / ancho de banda a -3 dB)
+         * @param blockSize Tamaño de bloque de los IIRFilter internos
+         */
+        NotchBank(float32_t sampleRate, uint8_t maxNotches, float32_t q = 30.0f, uint16_t blockSize = 32);
+        ~NotchBank();
+
+        /**
+         * @brief Activa (o resintoniza) un notch
+         *
+         * @details Si el notch ya estaba activo en otra frecuencia se conserva su estado;
+         * si estaba desactivado se pone a cero para no arrastrar un estado antiguo.
+         *
+         * @return false si stage >= maxNotches o la frecuencia no está en (0, Fs/2)
+         */
+        bool setNotch(uint8_t stage, float32_t frequency);
+
+        /**
+         * @brief Desactiva un notch: deja de procesarse
+         */
+        void disable(uint8_t stage);
+
+        /**
+         * @brief Frecuencia de un notch (0 si está desactivado)
+         */
+        float32_t getFrequency(uint8_t stage) const;
+
+        /**
+         * @brief Notch activo en esa frecuencia (±tolerance Hz), o -1
+         */
+        int8_t findStage(float32_t frequency, float32_t tolerance = 0.5f) const;
+
+        /**
+         * @brief Primer notch desactivado, o -1
+         */
+        int8_t findFreeStage() const;
+
+        /**
+         * @brief Aplica los notch activos (puede trabajar in-place)
+         */
+        void processBuffer(float32_t* input, float32_t* output, uint32_t length);
+        float32_t processSample(float32_t input);
+
+        /**
+         * @brief Suma del retardo de los notch activos
+         */
+        float32_t getGroupDelay(float32_t normalizedFrequency = 0.0f) const;
+
+        void reset();
+        uint32_t getMemoryUsage() const;
+
+        uint8_t getActiveStages() const;
+        uint8_t getMaxNotches() const { return _maxNotches; }
+
+        /**
+         * @brief Notch RBJ {b0, b1, b2, a1, a2} con a1/a2 negados para CMSIS-DSP
+         */
+        static void designNotch(float32_t* coeffs, float32_t frequency, float32_t sampleRate, float32_t q);
+
+    private:
+        // No copiable: posee los coeficientes y los filtros
+        NotchBank(const NotchBank&);
+        NotchBank& operator=(const NotchBank&);
+
+        float32_t _sampleRate;
+        float32_t _q;
+        uint8_t _maxNotches;
+        float32_t* _coeffs;              ///< 5 coeficientes por notch, leídos por los IIRFilter
+        float32_t* _frequencies;         ///< 0 = desactivado
+        IIRFilter** _stages;
+};
+
+/**
+ * @class InterferenceDetector
+ * @brief Banco de Goertzel con ventana de Hann y decisión con histéresis
+ */
+class InterferenceDetector {
+    public:
+        /**
+         * @param sampleRate Frecuencia de muestreo (Hz)
+         * @param frequencies Frecuencias vigiladas (se ignoran las >= Fs/2); se copian
+         * @param numFrequencies Número de frecuencias
+         * @param window Duración de la ventana de análisis (s); 1 s da ±2 Hz de lóbulo principal
+         */
+        InterferenceDetector(float32_t sampleRate, const float32_t* frequencies, uint8_t numFrequencies,
+                             float32_t window = 1.0f);
+        ~InterferenceDetector();
+
+        /**
+         * @brief Acumula un bloque de la señal
+         * @return true si ha terminado al menos una ventana (estimaciones nuevas)
+         */
+        bool processBuffer(const float32_t* input, uint32_t length);
+
+        /**
+         * @brief Umbrales de la relación línea/fondo en dB (por defecto 10 y 6)
+         */
+        void setThresholds(float32_t onDb, float32_t offDb);
+
+        uint8_t getNumFrequencies() const { return _count; }
+        float32_t getFrequency(uint8_t index) const { return _frequencies[index]; }
+
+        /**
+         * @brief Amplitud estimada de la línea en la última ventana
+         */
+        float32_t getAmplitude(uint8_t index) const { return _amplitude[index]; }
+
+        /**
+         * @brief Relación línea/fondo en dB de la última ventana
+         */
+        float32_t getRatio(uint8_t index) const { return _ratio[index]; }
+
+        bool isDetected(uint8_t index) const { return _detected[index]; }
+        uint8_t getDetectedCount() const;
+
+        /**
+         * @brief Ajusta un NotchBank a las líneas detectadas
+         *
+         * @details Desactiva los notch de líneas que ya no están, conserva los que siguen
+         * y asigna los libres a las líneas nuevas, de mayor a menor relación línea/fondo.
+         *
+         * @return uint8_t Notch activos tras el ajuste
+         */
+        uint8_t configure(NotchBank& notches) const;
+
+        uint32_t getWindowLength() const { return _windowLength; }
+        uint32_t getWindowCount() const { return _windowCount; }
+
+        void reset();
+        uint32_t getMemoryUsage() const;
+
+    private:
+        // No copiable: posee los acumuladores
+        InterferenceDetector(const InterferenceDetector&);
+        InterferenceDetector& operator=(const InterferenceDetector&);
+
+        /**
+         * @brief Potencias, amplitudes y decisiones al completar la ventana
+         */
+        void finishWindow();
+
+        float32_t _sampleRate;
+        uint8_t _count;
+        uint32_t _windowLength;
+        uint32_t _position;              ///< Muestras de la ventana en curso
+        uint32_t _windowCount;
+
+        float32_t _onRatio;              ///< Umbrales en unidades lineales
+        float32_t _offRatio;
+
+        float32_t* _frequencies;
+        float32_t* _coeffs;              ///< 2·cos(2π·f/Fs)
+        float32_t* _s1;                  ///< Estados de Goertzel
+        float32_t* _s2;
+        float32_t* _amplitude;
+        float32_t* _ratio;
+        bool* _detected;
+
+        // Ventana de Hann: w[n] = 0.5 - 0.5·cos(2πn/N) con un oscilador por rotación
+        float32_t _rotCos;
+        float32_t _rotSin;
+        float32_t _oscCos;
+        float32_t _oscSin;
+
+        float32_t _sum;                  ///< Σx y Σx² (sin ventana) para la potencia de fondo
+        float32_t _sumSquares;
+};
+
+/**
+ * @class AutoNotchFilter
+ * @brief Notch que se activan solo para la interferencia detectada en la entrada
+ */
+class AutoNotchFilter {
+    public:
+        /**
+         * @param sampleRate Frecuencia de muestreo (Hz)
+         * @param maxNotches Notch simultáneos como máximo
+         * @param frequencies Frecuencias vigiladas (nullptr = 50, 60, 100, 120, 150 y 180 Hz)
+         * @param numFrequencies Número de frecuencias (si frequencies no es nullptr)
+         * @param blockSize Tamaño de bloque de los notch
+         */
+        AutoNotchFilter(float32_t sampleRate, uint8_t maxNotches = 3, const float32_t* frequencies = nullptr,
+                        uint8_t numFrequencies = 0, uint16_t blockSize = 32);
+
+        void processBuffer(float32_t* input, float32_t* output, uint32_t length);
+        float32_t processSample(float32_t input);
+
+        /**
+         * @brief Retardo de los notch activos en este momento
+         */
+        float32_t getGroupDelay(float32_t normalizedFrequency = 0.0f) const;
+
+        void reset();
+        uint32_t getMemoryUsage() const;
+
+        InterferenceDetector& getDetector() { return _detector; }
+        NotchBank& getNotchBank() { return _notches; }
+        const NotchBank& getNotchBank() const { return _notches; }
+
+    private:
+        // No copiable: contiene el detector y el banco
+        AutoNotchFilter(const AutoNotchFilter&);
+        AutoNotchFilter& operator=(const AutoNotchFilter&);
+
+        InterferenceDetector _detector;
+        NotchBank _notches;
+};
+
+#endif // INTERFERENCE_DETECTOR_H
@@ -22,6 +22,7 @@
  */
 
 #include "LMSFilter.h"
+#include "../utils/utils.h"
 
 /**
  * @brief Constructor que inicializa el filtro LMS adaptativo con parámetros específicos
@@ -68,9 +69,9 @@ LMSFilter::LMSFilter(float32_t* coeffs, uint16_t numTaps, float32_t mu, uint16_t
       _blockSize(blockSize)      // Tamaño de bloque para optimizaciones
 {
     // Calcular tamaño del buffer de estados para filtros LMS
-    // Para LMS, el tamaño es exactamente numTaps (diferente a FIR)
-    // Esto es porque CMSIS-DSP maneja internamente la gestión circular
-    uint32_t stateBufferSize = _numTaps;
+    // Igual que en FIR, CMSIS-DSP exige numTaps + blockSize - 1 elementos:
+    // arm_lms_norm_f32() copia el bloque de entrada tras las numTaps-1 muestras previas
+    uint32_t stateBufferSize = _numTaps + _blockSize - 1;
     
     // Asignar memoria para buffer de estados e inicializar a cero
     // La inicialización a cero es crítica para evitar transitorios
@@ -275,12 +276,25 @@ void LMSFilter::processBuffer(float32_t* inputArray, float32_t* referenceArray,
     // - outputArray: puntero al primer elemento del buffer de salida filtrada
     // - errorArray: puntero al primer elemento del buffer de error
     // - length: número total de muestras a procesar adaptativamente
-    arm_lms_norm_f32(&_lmsInstance,        // Instancia previamente inicializada
-                inputArray,           // Buffer de entrada (solo lectura)
-                referenceArray,       // Buffer de referencia (solo lectura)
-                outputArray,          // Buffer de salida filtrada (escritura)
-                errorArray,           // Buffer de error de adaptación (escritura)
-                length);              // Número de muestras a procesar
+    //
+    // El buffer de estados se dimensiona para _blockSize muestras nuevas por
+    // llamada: bloques más largos se procesan en trozos de _blockSize.
+    while (length > 0) {
+        uint32_t chunk = (length < _blockSize) ? length : _blockSize;
+
+        arm_lms_norm_f32(&_lmsInstance,        // Instancia previamente inicializada
+                    inputArray,           // Buffer de entrada (solo lectura)
+                    referenceArray,       // Buffer de referencia (solo lectura)
+                    outputArray,          // Buffer de salida filtrada (escritura)
+                    errorArray,           // Buffer de error de adaptación (escritura)
+                    chunk);               // Número de muestras a procesar
+
+        inputArray += chunk;
+        referenceArray += chunk;
+        outputArray += chunk;
+        errorArray += chunk;
+        length -= chunk;
+    }
     
     // Nota: arm_lms_f32() maneja internamente y de forma optimizada:
     // - Actualización progresiva del buffer de estados con nuevas muestras
@@ -417,7 +431,7 @@ void LMSFilter::resetCoefficients(const float32_t* newCoeffs) {
     
     // Limpiar completamente el buffer de estados
     // Esto elimina toda la "memoria" de muestras previas
-    for (uint16_t i = 0; i < _numTaps; i++) {
+    for (uint32_t i = 0; i < (uint32_t)_numTaps + _blockSize - 1; i++) {
         _state[i] = 0.0f;
     }
     
@@ -430,6 +444,23 @@ void LMSFilter::resetCoefficients(const float32_t* newCoeffs) {
     // sin memoria de adaptaciones previas.
 }
 
+/**
+ * @brief Retardo de grupo del FIR formado por los pesos actuales
+ * 
+ * @details CMSIS-DSP guarda los pesos en orden inverso (como en FIRFilter), así que
+ * el retardo es (numTaps - 1) menos el del polinomio tal cual está en memoria.
+ */
+float32_t LMSFilter::getGroupDelay(float32_t normalizedFrequency) const {
+    bool adapted = false;
+    for (uint16_t i = 0; i < _numTaps && !adapted; i++) {
+        adapted = (_coeffs[i] != 0.0f);
+    }
+    if (!adapted) {
+        return 0.0f;
+    }
+    return (_numTaps - 1) - calculateGroupDelay(_coeffs, _numTaps, normalizedFrequency);
+}
+
 /**
  * @note Consideraciones adicionales de implementación:
  * 
@@ -466,4 +497,5 @@ void LMSFilter::resetCoefficients(const float32_t* newCoeffs) {
  *    - Monitorear la señal de error para detectar problemas de estabilidad
  *    - Usar μ adaptativo para optimizar el rendimiento dinámicamente
  *    - Implementar criterios de reinicio automático para robustez
- */
\ No newline at end of file
+ */
+
@@ -244,6 +244,22 @@ class LMSFilter {
          */
         void resetCoefficients(const float32_t* newCoeffs = nullptr);
 
+        /**
+         * @brief Estima el retardo de grupo con los coeficientes actuales
+         * 
+         * @param normalizedFrequency Frecuencia normalizada f/Fs (0.0 a 0.5)
+         * @return float32_t Retardo de la salida respecto a la entrada, en muestras
+         * 
+         * @details Los pesos cambian con cada muestra, así que el valor es el del FIR
+         * instantáneo (mismo cálculo que FIRFilter::getGroupDelay()). Es una estimación:
+         * conviene leerlo una vez convergido el filtro. Con todos los pesos a cero la
+         * salida es nula y se devuelve 0.
+         * 
+         * @note En cancelación de ruido la señal útil es el error e[n] = d[n] - y[n], que
+         * conserva la temporización de la referencia d[n]: su retardo es cero.
+         */
+        float32_t getGroupDelay(float32_t normalizedFrequency = 0.0f) const;
+
     private:
         /**
          * @brief Puntero a los coeficientes adaptativos del filtro LMS
@@ -260,7 +276,7 @@ class LMSFilter {
          * 
          * Almacena el historial de muestras de entrada necesario para el cálculo
          * de la convolución adaptativa y la actualización de coeficientes.
-         * El tamaño del buffer es numTaps elementos.
+         * El tamaño del buffer es (numTaps + blockSize - 1) elementos.
          * 
          * @details El buffer de estados contiene:
          * - Muestras de entrada previas para la convolución
@@ -0,0 +1,360 @@
+/**
+ * @file MedianFilter.h
+ * @brief Mediana móvil O(log N) con doble montículo y eliminación de línea base por medianas 200/600 ms
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @details Ordenar una ventana de 577 muestras (600 ms a 960 Hz) por cada muestra es
+ * inviable en el Due. RunningMedian mantiene las N muestras de la ventana en dos
+ * montículos que comparten un mismo array: un montículo de máximos con la mitad
+ * inferior y uno de mínimos con la mitad superior, con la mediana en el centro. Un
+ * índice por muestra del buffer circular dice en qué posición del montículo está, así
+ * que la muestra que sale se sustituye directamente por la nueva y solo hay que
+ * reordenar un camino del montículo: O(log N) por muestra en el peor caso.
+ *
+ * RAM: N muestras + 2 índices de 16 bits por muestra.
+ *
+ * - MedianFilter / MedianFilterInt16: mediana móvil de N muestras
+ * - BaselineFilter / BaselineFilterInt16: resta la línea base estimada con dos medianas
+ *   en cascada (200 ms elimina QRS y P, 600 ms elimina T) a la entrada retrasada el
+ *   mismo tiempo, el método clásico para la deriva de línea base del ECG
+ *
+ * Las cuatro siguen la interfaz de FIRFilter (processSample, processBuffer,
+ * getGroupDelay, getMemoryUsage, reset) y se pueden usar como etapas de FilterChain.
+ *
+ * @par Ejemplo
+ * @code
+ * MedianFilter despike(5);                    // Elimina impulsos de 1-2 muestras
+ * BaselineFilter baseline(960.0f);            // Medianas de 193 y 577 muestras
+ * FilterChain<IIRFilter, BaselineFilter> chain(32, notch, baseline);
+ * chain.processBuffer(raw, clean, 32);
+ * @endcode
+ *
+ * @note La ventana empieza llena de ceros, como el estado de FIRFilter. Con N par la
+ * salida es el elemento N/2 de la ventana ordenada (la mediana superior).
+ */
+
+#ifndef MEDIAN_FILTER_H
+#define MEDIAN_FILTER_H
+
+#include <arm_math.h>
+#include <string.h>
+
+/**
+ * @class RunningMedian
+ * @brief Mediana de las últimas N muestras con doble montículo indexado
+ *
+ * @tparam Sample Tipo de las muestras (float32_t o int16_t)
+ */
+template <typename Sample>
+class RunningMedian {
+    public:
+        /**
+         * @param windowLength Muestras de la ventana N (1 - 65535, mejor impar)
+         */
+        RunningMedian(uint16_t windowLength)
+            : _length(windowLength ? windowLength : 1)
+        {
+            _data = new Sample[_length];
+            _positions = new int16_t[_length];
+            _heapStorage = new uint16_t[_length];
+            // El montículo de máximos ocupa los índices negativos: [-maxCount, minCount]
+            _maxCount = _length / 2;
+            _minCount = (_length - 1) / 2;
+            _heap = _heapStorage + _maxCount;
+            reset();
+        }
+
+        /**
+         * @brief Constructor de copia: misma ventana y mismo estado (ver FilterPipeline)
+         */
+        RunningMedian(const RunningMedian& other)
+            : _length(other._length),
+              _maxCount(other._maxCount),
+              _minCount(other._minCount),
+              _index(other._index)
+        {
+            _data = new Sample[_length];
+            _positions = new int16_t[_length];
+            _heapStorage = new uint16_t[_length];
+            _heap = _heapStorage + _maxCount;
+            memcpy(_data, other._data, _length * sizeof(Sample));
+            memcpy(_positions, other._positions, _length * sizeof(int16_t));
+            memcpy(_heapStorage, other._heapStorage, _length * sizeof(uint16_t));
+        }
+
+        ~RunningMedian() {
+            delete[] _data;
+            delete[] _positions;
+            delete[] _heapStorage;
+        }
+
+        /**
+         * @brief Sustituye la muestra más antigua y devuelve la mediana de la ventana
+         */
+        Sample processSample(Sample input) {
+            int32_t p = _positions[_index];
+            Sample old = _data[_index];
+            _data[_index] = input;
+            if (++_index == _length) {
+                _index = 0;
+            }
+
+            if (p > 0) {
+                // En el montículo de mínimos: si crece solo puede bajar; si llega a la
+                // mediana hay que compararla con la cima del montículo de máximos
+                if (old < input) {
+                    minSortDown(2 * p);
+                } else if (minSortUp(p)) {
+                    maxSortDown(-1);
+                }
+            } else if (p < 0) {
+                if (input < old) {
+                    maxSortDown(2 * p);
+                } else if (maxSortUp(p)) {
+                    minSortDown(1);
+                }
+            } else {
+                // Era la mediana: puede desplazarse hacia cualquiera de los dos lados
+                if (_maxCount > 0) {
+                    maxSortDown(-1);
+                }
+                if (_minCount > 0) {
+                    minSortDown(1);
+                }
+            }
+            return _data[_heap[0]];
+        }
+
+        /**
+         * @brief Mediana móvil de cada muestra del buffer (puede trabajar in-place)
+         */
+        void processBuffer(Sample* input, Sample* output, uint32_t length) {
+            for (uint32_t i = 0; i < length; i++) {
+                output[i] = processSample(input[i]);
+            }
+        }
+
+        /**
+         * @brief Mediana actual sin añadir muestras
+         */
+        Sample getMedian() const { return _data[_heap[0]]; }
+
+        /**
+         * @brief Retardo: (N - 1) / 2 muestras (filtro simétrico)
+         */
+        float32_t getGroupDelay(float32_t normalizedFrequency = 0.0f) const {
+            (void)normalizedFrequency;
+            return (_length - 1) * 0.5f;
+        }
+
+        uint32_t getMemoryUsage() const {
+            return sizeof(*this) + _length * (sizeof(Sample) + sizeof(int16_t) + sizeof(uint16_t));
+        }
+
+        /**
+         * @brief Ventana a cero; montículos en el orden inicial 0, -1, 1, -2, 2...
+         */
+        void reset() {
+            for (uint16_t i = 0; i < _length; i++) {
+                _data[i] = 0;
+                _positions[i] = (int16_t)(((i + 1) / 2) * ((i & 1) ? -1 : 1));
+                _heap[_positions[i]] = i;
+            }
+            _index = 0;
+        }
+
+        uint16_t getWindowLength() const { return _length; }
+
+    private:
+        RunningMedian& operator=(const RunningMedian&);
+
+        bool less(int32_t i, int32_t j) const {
+            return _data[_heap[i]] < _data[_heap[j]];
+        }
+
+        /**
+         * @brief Intercambia las posiciones i y j si heap[i] < heap[j]
+         */
+        bool exchangeIfLess(int32_t i, int32_t j) {
+            if (!less(i, j)) {
+                return false;
+            }
+            uint16_t t = _heap[i];
+            _heap[i] = _heap[j];
+            _heap[j] = t;
+            _positions[_heap[i]] = (int16_t)i;
+            _positions[_heap[j]] = (int16_t)j;
+            return true;
+        }
+
+        /**
+         * @brief Hunde en el montículo de mínimos empezando por el hijo i (1 = la propia
+         * mediana frente a la cima de mínimos)
+         */
+        void minSortDown(int32_t i) {
+            for (; i <= _minCount; i *= 2) {
+                // Los hermanos son (2k, 2k + 1); 1 no tiene hermano
+                if (i > 1 && i < _minCount && less(i + 1, i)) {
+                    ++i;
+                }
+                if (!exchangeIfLess(i, i / 2)) {
+                    break;
+                }
+            }
+        }
+
+        void maxSortDown(int32_t i) {
+            for (; i >= -_maxCount; i *= 2) {
+                if (i < -1 && i > -_maxCount && less(i, i - 1)) {
+                    --i;
+                }
+                if (!exchangeIfLess(i / 2, i)) {
+                    break;
+                }
+            }
+        }
+
+        /**
+         * @return true si la muestra ha llegado a la mediana
+         */
+        bool minSortUp(int32_t i) {
+            while (i > 0 && exchangeIfLess(i, i / 2)) {
+                i /= 2;
+            }
+            return i == 0;
+        }
+
+        bool maxSortUp(int32_t i) {
+            while (i < 0 && exchangeIfLess(i / 2, i)) {
+                i /= 2;
+            }
+            return i == 0;
+        }
+
+        uint16_t _length;
+        int32_t _maxCount;           ///< Elementos del montículo de máximos (índices -1 .. -maxCount)
+        int32_t _minCount;           ///< Elementos del montículo de mínimos (índices 1 .. minCount)
+        uint16_t _index;             ///< Posición de la muestra más antigua en _data
+
+        Sample* _data;               ///< Buffer circular de la ventana
+        int16_t* _positions;         ///< Posición en el montículo de cada muestra de _data
+        uint16_t* _heapStorage;
+        uint16_t* _heap;             ///< _heapStorage + maxCount: índices de _data, mediana en 0
+};
+
+/**
+ * @class MedianBaseline
+ * @brief Entrada menos la línea base estimada con medianas de 200 ms y 600 ms
+ *
+ * @details La salida es x[n - D] - mediana600(mediana200(x))[n], con
+ * D = (N200 - 1)/2 + (N600 - 1)/2 para que la línea base y la señal estén alineadas.
+ * Las ventanas se redondean a un número impar de muestras.
+ *
+ * @tparam Sample Tipo de las muestras (float32_t o int16_t)
+ */
+template <typename Sample>
+class MedianBaseline {
+    public:
+        /**
+         * @param sampleRate Frecuencia de muestreo (Hz)
+         * @param shortWindow Primera mediana en segundos (QRS y P)
+         * @param longWindow Segunda mediana en segundos (onda T)
+         */
+        MedianBaseline(float32_t sampleRate, float32_t shortWindow = 0.2f, float32_t longWindow = 0.6f)
+            : _short(oddLength(sampleRate * shortWindow)),
+              _long(oddLength(sampleRate * longWindow))
+        {
+            _delayLength = (uint16_t)(_short.getGroupDelay() + _long.getGroupDelay() + 1.0f);
+            _delay = new Sample[_delayLength]();
+            _delayPos = 0;
+            _baseline = 0;
+        }
+
+        MedianBaseline(const MedianBaseline& other)
+            : _short(other._short),
+              _long(other._long),
+              _delayLength(other._delayLength),
+              _delayPos(other._delayPos),
+              _baseline(other._baseline)
+        {
+            _delay = new Sample[_delayLength];
+            memcpy(_delay, other._delay, _delayLength * sizeof(Sample));
+        }
+
+        ~MedianBaseline() {
+            delete[] _delay;
+        }
+
+        /**
+         * @brief Muestra sin línea base (retrasada getGroupDelay() muestras)
+         */
+        Sample processSample(Sample input) {
+            _baseline = _long.processSample(_short.processSample(input));
+            // Con D + 1 casillas, la siguiente a la recién escrita es x[n - D]
+            _delay[_delayPos] = input;
+            if (++_delayPos == _delayLength) {
+                _delayPos = 0;
+            }
+            return (Sample)(_delay[_delayPos] - _baseline);
+        }
+
+        void processBuffer(Sample* input, Sample* output, uint32_t length) {
+            for (uint32_t i = 0; i < length; i++) {
+                output[i] = processSample(input[i]);
+            }
+        }
+
+        /**
+         * @brief Última línea base estimada (alineada con la última salida)
+         */
+        Sample getBaseline() const { return _baseline; }
+
+        /**
+         * @brief Retardo total de las dos medianas, en muestras
+         */
+        float32_t getGroupDelay(float32_t normalizedFrequency = 0.0f) const {
+            (void)normalizedFrequency;
+            return _short.getGroupDelay() + _long.getGroupDelay();
+        }
+
+        uint32_t getMemoryUsage() const {
+            return sizeof(*this) - sizeof(_short) - sizeof(_long)
+                 + _short.getMemoryUsage() + _long.getMemoryUsage()
+                 + _delayLength * sizeof(Sample);
+        }
+
+        void reset() {
+            _short.reset();
+            _long.reset();
+            memset(_delay, 0, _delayLength * sizeof(Sample));
+            _delayPos = 0;
+            _baseline = 0;
+        }
+
+        uint16_t getShortWindow() const { return _short.getWindowLength(); }
+        uint16_t getLongWindow() const { return _long.getWindowLength(); }
+
+    private:
+        MedianBaseline& operator=(const MedianBaseline&);
+
+        static uint16_t oddLength(float32_t samples) {
+            uint16_t n = (uint16_t)(samples + 0.5f);
+            return (uint16_t)(n | 1);
+        }
+
+        RunningMedian<Sample> _short;
+        RunningMedian<Sample> _long;
+        Sample* _delay;              ///< Entrada de las últimas D + 1 muestras
+        uint16_t _delayLength;
+        uint16_t _delayPos;
+        Sample _baseline;
+};
+
+typedef RunningMedian<float32_t> MedianFilter;
+typedef RunningMedian<int16_t> MedianFilterInt16;
+typedef MedianBaseline<float32_t> BaselineFilter;
+typedef MedianBaseline<int16_t> BaselineFilterInt16;
+
+#endif // MEDIAN_FILTER_H
@@ -0,0 +1,203 @@
+/**
+ * @file MovingAverage.h
+ * @brief Media móvil de coste O(1) por muestra (suma acumulada), en float e int16
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @details Un FIRFilter con N coeficientes iguales a 1/N (boxcar) cuesta N MACs por
+ * muestra: 144 para una ventana de 150 ms a 960 Hz. La media móvil mantiene la suma
+ * de las últimas N muestras en un buffer circular: por cada muestra suma la nueva y
+ * resta la que sale, así que el coste es constante sea cual sea la ventana.
+ *
+ * En float la suma acumulada arrastraría el error de redondeo indefinidamente. Para
+ * evitarlo se lleva en paralelo una segunda suma que empieza en cero cada vez que el
+ * índice del buffer da la vuelta: en ese momento contiene exactamente las N muestras
+ * de la ventana y sustituye a la suma acumulada. El error queda acotado a una vuelta
+ * y el coste sigue siendo O(1) en el peor caso (sin recalcular la suma entera).
+ *
+ * La interfaz es la de FIRFilter (processSample, processBuffer, getGroupDelay,
+ * getMemoryUsage, reset), así que sustituye directamente a un boxcar FIR, también
+ * como etapa de FilterChain / FilterPipeline. decimate() entrega además una salida
+ * de cada `decimation` muestras.
+ *
+ * - MovingAverageFilter: float32_t
+ * - MovingAverageInt16: muestras int16_t (cuentas de ADC) con suma exacta en int32_t
+ *
+ * @par Ejemplo
+ * @code
+ * MovingAverageFilter smooth(144);            // 150 ms a 960 Hz, 2 operaciones por muestra
+ * smooth.processBuffer(input, output, 256);
+ *
+ * MovingAverageInt16 adcAverage(16, 16);      // Media de 16 muestras, una salida de cada 16
+ * uint32_t n = adcAverage.decimate(adcCounts, 256, averaged);   // 16 salidas
+ * @endcode
+ */
+
+#ifndef MOVING_AVERAGE_H
+#define MOVING_AVERAGE_H
+
+#include <arm_math.h>
+#include <string.h>
+
+/**
+ * @brief Conversión de la suma a media según el tipo de muestra
+ */
+template <typename Sample, typename Accumulator>
+struct MovingAverageScale {
+    static Sample apply(Accumulator sum, uint16_t length, float32_t inverse) {
+        (void)length;
+        return (Sample)(sum * inverse);
+    }
+};
+
+/**
+ * @brief Enteros: división con redondeo al más cercano
+ */
+template <>
+struct MovingAverageScale<int16_t, int32_t> {
+    static int16_t apply(int32_t sum, uint16_t length, float32_t inverse) {
+        (void)inverse;
+        int32_t half = length / 2;
+        return (int16_t)((sum >= 0 ? sum + half : sum - half) / length);
+    }
+};
+
+/**
+ * @class MovingAverage
+ * @brief Media móvil de N muestras con suma acumulada
+ *
+ * @tparam Sample Tipo de las muestras (float32_t o int16_t)
+ * @tparam Accumulator Tipo de la suma (float32_t o int32_t)
+ */
+template <typename Sample, typename Accumulator>
+class MovingAverage {
+    public:
+        /**
+         * @param windowLength Muestras de la ventana N (>= 1)
+         * @param decimation Salidas de decimate(): una de cada `decimation` muestras
+         */
+        MovingAverage(uint16_t windowLength, uint16_t decimation = 1)
+            : _length(windowLength ? windowLength : 1),
+              _decimation(decimation ? decimation : 1),
+              _position(0),
+              _phase(0),
+              _sum(0),
+              _fresh(0)
+        {
+            _inverse = 1.0f / _length;
+            _ring = new Sample[_length]();
+        }
+
+        /**
+         * @brief Constructor de copia: misma ventana y mismo estado (ver FilterPipeline)
+         */
+        MovingAverage(const MovingAverage& other)
+            : _length(other._length),
+              _decimation(other._decimation),
+              _position(other._position),
+              _phase(other._phase),
+              _sum(other._sum),
+              _fresh(other._fresh),
+              _inverse(other._inverse)
+        {
+            _ring = new Sample[_length];
+            memcpy(_ring, other._ring, _length * sizeof(Sample));
+        }
+
+        ~MovingAverage() {
+            delete[] _ring;
+        }
+
+        /**
+         * @brief Añade una muestra y devuelve la media de las últimas N
+         */
+        Sample processSample(Sample input) {
+            push(input);
+            return MovingAverageScale<Sample, Accumulator>::apply(_sum, _length, _inverse);
+        }
+
+        /**
+         * @brief Media móvil de cada muestra del buffer (puede trabajar in-place)
+         */
+        void processBuffer(Sample* input, Sample* output, uint32_t length) {
+            for (uint32_t i = 0; i < length; i++) {
+                output[i] = processSample(input[i]);
+            }
+        }
+
+        /**
+         * @brief Media móvil diezmada: una salida de cada `decimation` muestras
+         *
+         * @param output Destino (al menos length / decimation + 1 muestras)
+         * @return uint32_t Salidas escritas
+         */
+        uint32_t decimate(Sample* input, uint32_t length, Sample* output) {
+            uint32_t produced = 0;
+            for (uint32_t i = 0; i < length; i++) {
+                push(input[i]);
+                if (++_phase == _decimation) {
+                    _phase = 0;
+                    output[produced++] = MovingAverageScale<Sample, Accumulator>::apply(_sum, _length, _inverse);
+                }
+            }
+            return produced;
+        }
+
+        /**
+         * @brief Suma actual de la ventana (sin dividir por N)
+         */
+        Accumulator getSum() const { return _sum; }
+
+        /**
+         * @brief Retardo de grupo: (N - 1) / 2 muestras a cualquier frecuencia
+         */
+        float32_t getGroupDelay(float32_t normalizedFrequency = 0.0f) const {
+            (void)normalizedFrequency;
+            return (_length - 1) * 0.5f;
+        }
+
+        uint32_t getMemoryUsage() const {
+            return sizeof(*this) + _length * sizeof(Sample);
+        }
+
+        void reset() {
+            memset(_ring, 0, _length * sizeof(Sample));
+            _position = 0;
+            _phase = 0;
+            _sum = 0;
+            _fresh = 0;
+        }
+
+        uint16_t getWindowLength() const { return _length; }
+        uint16_t getDecimation() const { return _decimation; }
+
+    private:
+        MovingAverage& operator=(const MovingAverage&);
+
+        void push(Sample input) {
+            _sum += (Accumulator)input - (Accumulator)_ring[_position];
+            _fresh += (Accumulator)input;
+            _ring[_position] = input;
+            if (++_position == _length) {
+                // La ventana entera se ha sumado desde la última vuelta: suma exacta
+                _position = 0;
+                _sum = _fresh;
+                _fresh = 0;
+            }
+        }
+
+        Sample* _ring;
+        uint16_t _length;
+        uint16_t _decimation;
+        uint16_t _position;
+        uint16_t _phase;
+        Accumulator _sum;
+        Accumulator _fresh;      ///< Suma desde la última vuelta del buffer
+        float32_t _inverse;
+};
+
+typedef MovingAverage<float32_t, float32_t> MovingAverageFilter;
+typedef MovingAverage<int16_t, int32_t> MovingAverageInt16;
+
+#endif // MOVING_AVERAGE_H
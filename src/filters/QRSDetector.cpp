@@ -0,0 +1,337 @@
+/**
+ * @file QRSDetector.cpp
+ * @brief Implementación del detector de QRS Pan-Tompkins en streaming
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @see QRSDetector.h para la descripción de las etapas
+ */
+
+#include "QRSDetector.h"
+#include <string.h>
+
+#define QRS_MIN_RATE        200.0f   // Frecuencia mínima tras el diezmado (Hz)
+#define QRS_WINDOW_SECONDS  0.150f   // Ventana de integración
+#define QRS_REFRACTORY      0.200f   // Periodo refractario
+#define QRS_LEARN_SECONDS   2.0f     // Aprendizaje de los umbrales iniciales
+#define QRS_SEARCH_BACK     1.66f    // RR medio sin latido que dispara la búsqueda atrás
+
+/**
+ * @brief Biquad RBJ de segundo orden (Q = 0.7071) con a1/a2 negados para CMSIS-DSP
+ */
+static void butterworthSection(float32_t* coeffs, float32_t cutoff, float32_t fs, bool highpass) {
+    float32_t w0 = 2.0f * PI * cutoff / fs;
+    float32_t cosw = cosf(w0);
+    float32_t alpha = sinf(w0) / (2.0f * 0.70710678f);
+    float32_t a0 = 1.0f + alpha;
+
+    float32_t b1 = highpass ? -(1.0f + cosw) : (1.0f - cosw);
+    float32_t b0 = highpass ? (1.0f + cosw) * 0.5f : (1.0f - cosw) * 0.5f;
+    coeffs[0] = b0 / a0;
+    coeffs[1] = b1 / a0;
+    coeffs[2] = b0 / a0;
+    coeffs[3] = 2.0f * cosw / a0;
+    coeffs[4] = -(1.0f - alpha) / a0;
+}
+
+QRSDetector::QRSDetector(float32_t sampleRate, uint8_t decimation, uint16_t blockSize)
+    : _sampleRate(sampleRate),
+      _decimation(decimation),
+      _blockSize(blockSize ? blockSize : 1),
+      _inputDelay(0.0f),
+      _beatsOut(nullptr),
+      _beatsMax(0),
+      _beatsFound(0)
+{
+    if (_decimation == 0) {
+        _decimation = (uint8_t)(_sampleRate / QRS_MIN_RATE);
+        if (_decimation == 0) {
+            _decimation = 1;
+        }
+    }
+    _rate = _sampleRate / _decimation;
+
+    butterworthSection(_bandpassCoeffs, 5.0f, _rate, true);
+    butterworthSection(_bandpassCoeffs + 5, 15.0f, _rate, false);
+    _bandpass = new IIRFilter(_bandpassCoeffs, 2, _blockSize);
+    _bandpassDelay = _bandpass->getGroupDelay(10.0f / _rate);
+
+    _block = new float32_t[_blockSize];
+
+    _windowLength = (uint16_t)(QRS_WINDOW_SECONDS * _rate + 0.5f);
+    if (_windowLength == 0) {
+        _windowLength = 1;
+    }
+    _integrator = new MovingAverageFilter(_windowLength);
+
+    // Entrada diezmada reciente: la ventana integrada acaba como mucho W muestras antes
+    // de confirmar el pico, y el pasa-banda la retrasa _bandpassDelay muestras más.
+    // flush() escribe el bloque entero antes de detectar: _blockSize muestras de margen
+    _historyLength = (uint16_t)(3 * _windowLength + _bandpassDelay + 8 + _blockSize);
+    _history = new float32_t[_historyLength];
+
+    _learnSamples = (uint32_t)(QRS_LEARN_SECONDS * _rate);
+    _refractory = (uint32_t)(QRS_REFRACTORY * _rate);
+
+    reset();
+}
+
+QRSDetector::~QRSDetector() {
+    delete _bandpass;
+    delete[] _block;
+    delete _integrator;
+    delete[] _history;
+}
+
+void QRSDetector::reset() {
+    _bandpass->reset();
+    _blockFill = 0;
+    _decimationPhase = 0;
+
+    memset(_derivative, 0, sizeof(_derivative));
+    memset(_history, 0, _historyLength * sizeof(float32_t));
+    _integrator->reset();
+
+    _index = 0;
+    _learnMax = 0.0f;
+    _learnSum = 0.0f;
+    _spki = 0.0f;
+    _npki = 0.0f;
+    _threshold1 = 0.0f;
+    _threshold2 = 0.0f;
+
+    _previous = 0.0f;
+    _falling = false;
+    _peakValue = 0.0f;
+    _peakIndex = 0;
+    _candidateValue = 0.0f;
+    _candidateR = 0;
+
+    _hasBeat = false;
+    _lastR = 0;
+    _rrCount = 0;
+    _rrPos = 0;
+    _rrSum = 0;
+
+    _lastBeat = 0;
+    _beatCount = 0;
+    _searchBackCount = 0;
+}
+
+// ====================
+// Entrada
+// ====================
+
+uint32_t QRSDetector::processBuffer(float32_t* input, uint32_t length, uint32_t* beats, uint32_t maxBeats) {
+    _beatsOut = beats;
+    _beatsMax = (beats != nullptr) ? maxBeats : 0;
+    _beatsFound = 0;
+
+    for (uint32_t i = 0; i < length; i++) {
+        // La entrada ya está limitada en banda por el pipeline: basta con quedarse
+        // con una de cada _decimation muestras
+        if (_decimationPhase == 0) {
+            _block[_blockFill++] = input[i];
+            if (_blockFill == _blockSize) {
+                flush();
+            }
+        }
+        if (++_decimationPhase == _decimation) {
+            _decimationPhase = 0;
+        }
+    }
+
+    // Bloque parcial: no retener muestras entre llamadas (latencia acotada)
+    if (_blockFill > 0) {
+        flush();
+    }
+
+    uint32_t stored = (_beatsFound < _beatsMax) ? _beatsFound : _beatsMax;
+    _beatsOut = nullptr;
+    return stored;
+}
+
+bool QRSDetector::processSample(float32_t input) {
+    uint32_t beat;
+    return processBuffer(&input, 1, &beat, 1) > 0;
+}
+
+void QRSDetector::flush() {
+    for (uint16_t i = 0; i < _blockFill; i++) {
+        _history[(_index + i) % _historyLength] = _block[i];
+    }
+    _bandpass->processBuffer(_block, _block, _blockFill);
+    for (uint16_t i = 0; i < _blockFill; i++) {
+        detect(_block[i]);
+    }
+    _blockFill = 0;
+}
+
+// ====================
+// Detección
+// ====================
+
+void QRSDetector::detect(float32_t bandpassed) {
+    uint32_t n = _index++;
+
+    // Derivada de 5 puntos: (2x[n] + x[n-1] - x[n-3] - 2x[n-4]) / 8
+    float32_t slope = (2.0f * bandpassed + _derivative[0] - _derivative[2] - 2.0f * _derivative[3]) * 0.125f;
+    _derivative[3] = _derivative[2];
+    _derivative[2] = _derivative[1];
+    _derivative[1] = _derivative[0];
+    _derivative[0] = bandpassed;
+
+    // Integración en ventana móvil: suma acumulada O(1)
+    float32_t integrated = _integrator->processSample(slope * slope);
+
+    // Aprendizaje: umbrales iniciales a partir del máximo y la media
+    if (n < _learnSamples) {
+        if (integrated > _learnMax) {
+            _learnMax = integrated;
+        }
+        _learnSum += integrated;
+        if (n + 1 == _learnSamples) {
+            _spki = 0.33f * _learnMax;
+            _npki = 0.5f * _learnSum / _learnSamples;
+            updateThresholds();
+        }
+        _previous = integrated;
+        return;
+    }
+
+    // Búsqueda hacia atrás: demasiado tiempo sin latido, recuperar el mejor candidato
+    if (_hasBeat && _rrCount > 0 && _candidateValue > 0.0f &&
+        n - _lastR > QRS_SEARCH_BACK * _rrSum / _rrCount) {
+        _spki = 0.25f * _candidateValue + 0.75f * _spki;
+        acceptBeat(_candidateR, true);
+        updateThresholds();
+    }
+
+    // Picos de la integración: máximo local confirmado cuando la señal cae a la mitad
+    // (o tras una ventana entera); después se espera a un mínimo antes del siguiente
+    if (_falling) {
+        if (integrated > _previous) {
+            _falling = false;
+        }
+    }
+    if (!_falling) {
+        if (integrated > _peakValue) {
+            _peakValue = integrated;
+            _peakIndex = n;
+        } else if (_peakValue > 0.0f &&
+                   (integrated < 0.5f * _peakValue || n - _peakIndex >= _windowLength)) {
+            classifyPeak(_peakValue, _peakIndex);
+            _peakValue = 0.0f;
+            _falling = true;
+        }
+    }
+    _previous = integrated;
+}
+
+void QRSDetector::classifyPeak(float32_t peak, uint32_t index) {
+    uint32_t r = locateR(index);
+    bool outsideRefractory = !_hasBeat || (r > _lastR && r - _lastR >= _refractory);
+
+    if (peak > _threshold1 && outsideRefractory) {
+        _spki = 0.125f * peak + 0.875f * _spki;
+        acceptBeat(r, false);
+    } else {
+        _npki = 0.125f * peak + 0.875f * _npki;
+        if (peak > _threshold2 && outsideRefractory && peak > _candidateValue) {
+            _candidateValue = peak;
+            _candidateR = r;
+        }
+    }
+    updateThresholds();
+}
+
+uint32_t QRSDetector::locateR(uint32_t peakIndex) const {
+    // La integración en peakIndex cubre el pasa-banda en [peakIndex - W - 1, peakIndex - 2];
+    // en la entrada, ese tramo está _bandpassDelay muestras antes (± W/4 de margen
+    // porque el retardo del pasa-banda depende de la frecuencia)
+    uint32_t margin = _windowLength / 4;
+    uint32_t shift = (uint32_t)(_bandpassDelay + 0.5f) + 2;
+    uint32_t last = (peakIndex >= shift) ? peakIndex - shift + margin : margin;
+    uint32_t span = _windowLength + 2 * margin;
+    uint32_t first = (last >= span) ? last - span : 0;
+    if (last >= _index) {
+        last = _index - 1;
+    }
+
+    float32_t mean = 0.0f;
+    for (uint32_t i = first; i <= last; i++) {
+        mean += _history[i % _historyLength];
+    }
+    mean /= (last - first + 1);
+
+    // Pico R: la mayor desviación respecto a la media del tramo (vale para QRS negativos)
+    uint32_t best = last;
+    float32_t bestValue = -1.0f;
+    for (uint32_t i = first; i <= last; i++) {
+        float32_t value = fabsf(_history[i % _historyLength] - mean);
+        if (value > bestValue) {
+            bestValue = value;
+            best = i;
+        }
+    }
+    return best;
+}
+
+void QRSDetector::acceptBeat(uint32_t rIndex, bool searchBack) {
+    if (_hasBeat) {
+        uint32_t rr = rIndex - _lastR;
+        if (_rrCount == 8) {
+            _rrSum -= _rr[_rrPos];
+        } else {
+            _rrCount++;
+        }
+        _rr[_rrPos] = rr;
+        _rrSum += rr;
+        _rrPos = (uint8_t)((_rrPos + 1) & 7);
+    }
+    _hasBeat = true;
+    _lastR = rIndex;
+    _candidateValue = 0.0f;
+
+    // Índice diezmado -> muestra de la entrada original
+    float32_t sample = (float32_t)rIndex * _decimation - _inputDelay;
+    _lastBeat = (sample > 0.0f) ? (uint32_t)(sample + 0.5f) : 0;
+    _beatCount++;
+    if (searchBack) {
+        _searchBackCount++;
+    }
+
+    if (_beatsFound < _beatsMax) {
+        _beatsOut[_beatsFound] = _lastBeat;
+    }
+    _beatsFound++;
+}
+
+void QRSDetector::updateThresholds() {
+    _threshold1 = _npki + 0.25f * (_spki - _npki);
+    _threshold2 = 0.5f * _threshold1;
+}
+
+// ====================
+// Consultas
+// ====================
+
+float32_t QRSDetector::getRRInterval() const {
+    return (_rrCount > 0) ? (float32_t)_rrSum / _rrCount / _rate : 0.0f;
+}
+
+float32_t QRSDetector::getHeartRate() const {
+    float32_t rr = getRRInterval();
+    return (rr > 0.0f) ? 60.0f / rr : 0.0f;
+}
+
+float32_t QRSDetector::getLatency() const {
+    return (_bandpassDelay + 2.0f + 2.0f * _windowLength) / _rate
+         + (_blockSize - 1) * _decimation / _sampleRate;
+}
+
+uint32_t QRSDetector::getMemoryUsage() const {
+    return sizeof(QRSDetector) + _bandpass->getMemoryUsage() + _integrator->getMemoryUsage()
+         + (_blockSize + _historyLength) * sizeof(float32_t);
+}
@@ -0,0 +1,218 @@
+/**
+ * @file QRSDetector.h
+ * @brief Detector de QRS Pan-Tompkins en streaming sobre la salida del pipeline de filtros
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @details Implementación por bloques del algoritmo de Pan y Tompkins (1985):
+ * 1. Pasa-banda 5-15 Hz (IIRFilter de dos biquads: pasa-altas + pasa-bajas)
+ * 2. Derivada de 5 puntos
+ * 3. Cuadrado
+ * 4. Integración en ventana móvil de 150 ms (MovingAverageFilter, O(1) por muestra)
+ * 5. Umbrales adaptativos de señal y ruido (SPKI / NPKI) con búsqueda hacia atrás
+ *    cuando pasa 1.66 × RR medio sin latido
+ *
+ * El detector no repite el notch ni el pasa-bajas del pipeline: recibe la señal ya
+ * filtrada (salida de FilterChain) y, como esa señal ya está limitada en banda, la
+ * diezma antes del pasa-banda. A 960 Hz con diezmado 4 todo el detector corre a
+ * 240 Hz. setInputDelay() descuenta el retardo del pipeline para que las marcas de
+ * tiempo se refieran a la señal original.
+ *
+ * Las marcas de latido son índices de muestra a la frecuencia de entrada, contados
+ * desde el primer processBuffer() (o reset()). Cada latido normal se confirma con una
+ * latencia acotada (getLatency()); los recuperados por búsqueda hacia atrás llegan
+ * como mucho 1.66 × RR medio después.
+ *
+ * @par Ejemplo
+ * @code
+ * FilterChain<IIRFilter, FIRFilter> chain(32, notch, lowpass);
+ * QRSDetector qrs(960.0f);                         // Diezmado automático (4)
+ * qrs.setInputDelay(chain.getGroupDelay(10.0f / 960.0f));
+ *
+ * chain.processBuffer(raw, clean, 32);
+ * uint32_t beats[4];
+ * uint32_t n = qrs.processBuffer(clean, 32, beats, 4);
+ * for (uint32_t i = 0; i < n; i++) {
+ *     Serial.println(beats[i] / 960.0f, 3);         // Instante del pico R (s)
+ * }
+ * Serial.println(qrs.getHeartRate());
+ * @endcode
+ *
+ * @note Necesita unos 2 s de señal para aprender los umbrales iniciales; los latidos
+ * de ese intervalo no se notifican.
+ */
+
+#ifndef QRS_DETECTOR_H
+#define QRS_DETECTOR_H
+
+#include <arm_math.h>
+#include "IIRFilter.h"
+#include "MovingAverage.h"
+
+/**
+ * @class QRSDetector
+ * @brief Detección de picos R en tiempo real con umbrales adaptativos
+ */
+class QRSDetector {
+    public:
+        /**
+         * @param sampleRate Frecuencia de la señal de entrada (Hz)
+         * @param decimation Factor de diezmado (0 = automático: el mayor que deja al
+         * menos 200 Hz). La entrada debe estar ya filtrada por debajo de la nueva Nyquist.
+         * @param blockSize Muestras diezmadas por bloque del pasa-banda
+         */
+        QRSDetector(float32_t sampleRate, uint8_t decimation = 0, uint16_t blockSize = 32);
+        ~QRSDetector();
+
+        /**
+         * @brief Procesa un bloque y devuelve los latidos confirmados en él
+         *
+         * @param input Señal de ECG filtrada (salida del pipeline)
+         * @param length Número de muestras
+         * @param beats Destino de las marcas de tiempo (índice de muestra de entrada)
+         * @param maxBeats Capacidad de beats (los latidos de más se cuentan pero no se guardan)
+         * @return uint32_t Latidos escritos en beats
+         */
+        uint32_t processBuffer(float32_t* input, uint32_t length, uint32_t* beats, uint32_t maxBeats);
+
+        /**
+         * @brief Procesa una muestra
+         * @return true si se ha confirmado un latido (ver getLastBeat())
+         */
+        bool processSample(float32_t input);
+
+        /**
+         * @brief Índice de muestra del último pico R confirmado
+         */
+        uint32_t getLastBeat() const { return _lastBeat; }
+
+        /**
+         * @brief Frecuencia cardíaca media (lpm) de los últimos 8 intervalos RR
+         */
+        float32_t getHeartRate() const;
+
+        /**
+         * @brief Intervalo RR medio en segundos (0 si aún no hay dos latidos)
+         */
+        float32_t getRRInterval() const;
+
+        uint32_t getBeatCount() const { return _beatCount; }
+
+        /**
+         * @brief Latidos recuperados por búsqueda hacia atrás
+         */
+        uint32_t getSearchBackCount() const { return _searchBackCount; }
+
+        /**
+         * @brief Retardo (muestras de entrada) que se resta a las marcas de tiempo,
+         * normalmente getGroupDelay() del pipeline que precede al detector
+         */
+        void setInputDelay(float32_t samples) { _inputDelay = samples; }
+
+        /**
+         * @brief Latencia máxima de confirmación de un latido normal, en segundos
+         * (pasa-banda + derivada + dos ventanas de integración)
+         */
+        float32_t getLatency() const;
+
+        uint8_t getDecimation() const { return _decimation; }
+        float32_t getDecimatedRate() const { return _rate; }
+
+        /**
+         * @brief Reinicia filtros, umbrales y contador de muestras
+         */
+        void reset();
+
+        uint32_t getMemoryUsage() const;
+
+    private:
+        // No copiable: posee el pasa-banda y los buffers
+        QRSDetector(const QRSDetector&);
+        QRSDetector& operator=(const QRSDetector&);
+
+        /**
+         * @brief Pasa-banda, derivada, integración y decisión sobre el bloque diezmado
+         */
+        void flush();
+
+        /**
+         * @brief Etapas 2-5 para una muestra ya filtrada
+         */
+        void detect(float32_t bandpassed);
+
+        /**
+         * @brief Clasifica un pico de la integración como QRS o ruido
+         */
+        void classifyPeak(float32_t peak, uint32_t index);
+
+        /**
+         * @brief Registra un latido (índice diezmado del pico R)
+         */
+        void acceptBeat(uint32_t rIndex, bool searchBack);
+
+        /**
+         * @brief Pico R en la entrada diezmada, en el tramo que integró el pico
+         */
+        uint32_t locateR(uint32_t peakIndex) const;
+
+        void updateThresholds();
+
+        float32_t _sampleRate;
+        uint8_t _decimation;
+        float32_t _rate;                 ///< Frecuencia tras el diezmado
+        uint16_t _blockSize;
+
+        float32_t _bandpassCoeffs[10];   ///< Pasa-altas 5 Hz + pasa-bajas 15 Hz
+        IIRFilter* _bandpass;
+        float32_t _bandpassDelay;        ///< Retardo del pasa-banda a 10 Hz (muestras diezmadas)
+
+        float32_t* _block;               ///< Muestras diezmadas pendientes de filtrar
+        uint16_t _blockFill;
+        uint8_t _decimationPhase;
+
+        float32_t _derivative[4];        ///< x[n-1] .. x[n-4] del pasa-banda
+
+        MovingAverageFilter* _integrator; ///< Media de los últimos W cuadrados
+        uint16_t _windowLength;
+
+        float32_t* _history;             ///< Entrada diezmada reciente, para situar el pico R
+        uint16_t _historyLength;
+
+        uint32_t _index;                 ///< Muestras diezmadas procesadas
+        uint32_t _learnSamples;
+        float32_t _learnMax;
+        float32_t _learnSum;
+
+        float32_t _spki;
+        float32_t _npki;
+        float32_t _threshold1;
+        float32_t _threshold2;
+
+        float32_t _previous;             ///< Integración en la muestra anterior
+        bool _falling;                   ///< Bajando tras un pico: esperar un mínimo
+        float32_t _peakValue;
+        uint32_t _peakIndex;
+
+        float32_t _candidateValue;       ///< Mejor pico entre umbral 2 y umbral 1
+        uint32_t _candidateR;
+
+        bool _hasBeat;
+        uint32_t _lastR;                 ///< Índice diezmado del último pico R
+        uint32_t _refractory;
+        uint32_t _rr[8];
+        uint8_t _rrCount;
+        uint8_t _rrPos;
+        uint32_t _rrSum;
+
+        uint32_t _lastBeat;
+        uint32_t _beatCount;
+        uint32_t _searchBackCount;
+        float32_t _inputDelay;
+
+        uint32_t* _beatsOut;             ///< Destino de processBuffer() en curso
+        uint32_t _beatsMax;
+        uint32_t _beatsFound;
+};
+
+#endif // QRS_DETECTOR_H
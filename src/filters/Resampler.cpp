@@ -0,0 +1,255 @@
+/**
+ * @file Resampler.cpp
+ * @brief Implementación de los conversores de frecuencia de muestreo
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @see Resampler.h para las convenciones de coeficientes y de razón
+ */
+
+#include "Resampler.h"
+#include <string.h>
+
+// ============================================================================
+// PolyphaseResampler
+// ============================================================================
+
+/**
+ * @details La salida n corresponde al instante n·M de la señal interpolada a L·Fs.
+ * Con n·M = i·L + p, solo intervienen las muestras de entrada x[i - q] y los
+ * coeficientes h[p + q·L]: el subfiltro p. Cada subfiltro se guarda ya alineado con
+ * el historial (del más antiguo al más reciente) para usar arm_dot_prod_f32().
+ */
+PolyphaseResampler::PolyphaseResampler(const float32_t* coeffs, uint16_t numTaps,
+                                       uint16_t interpolation, uint16_t decimation,
+                                       uint16_t blockSize)
+    : _interpolation(interpolation ? interpolation : 1),
+      _decimation(decimation ? decimation : 1),
+      _blockSize(blockSize ? blockSize : 1),
+      _numTaps(numTaps),
+      _phase(0),
+      _index(0)
+{
+    _subLength = (uint16_t)((_numTaps + _interpolation - 1) / _interpolation);
+    if (_subLength == 0) {
+        _subLength = 1;
+    }
+
+    _phases = new float32_t[(uint32_t)_interpolation * _subLength]();
+    for (uint16_t p = 0; p < _interpolation; p++) {
+        float32_t* phase = _phases + (uint32_t)p * _subLength;
+        for (uint16_t j = 0; j < _subLength; j++) {
+            // h[m] con m = p + (subLength - 1 - j)·L; coeffs está en orden invertido
+            uint32_t m = p + (uint32_t)(_subLength - 1 - j) * _interpolation;
+            phase[j] = (m < _numTaps) ? coeffs[_numTaps - 1 - m] : 0.0f;
+        }
+    }
+
+    _buffer = new float32_t[_subLength - 1 + _blockSize]();
+}
+
+PolyphaseResampler::~PolyphaseResampler() {
+    delete[] _phases;
+    delete[] _buffer;
+}
+
+uint32_t PolyphaseResampler::processBuffer(float32_t* input, uint32_t inputLength, float32_t* output) {
+    uint32_t history = _subLength - 1;
+    uint32_t produced = 0;
+
+    while (inputLength > 0) {
+        uint32_t chunk = (inputLength < _blockSize) ? inputLength : _blockSize;
+        arm_copy_f32(input, _buffer + history, chunk);
+
+        // La salida de la muestra i usa _buffer[i .. i + subLength - 1]
+        while (_index < chunk) {
+            arm_dot_prod_f32(_buffer + _index, _phases + (uint32_t)_phase * _subLength,
+                             _subLength, output + produced);
+            produced++;
+
+            _phase += _decimation;
+            _index += _phase / _interpolation;
+            _phase %= _interpolation;
+        }
+        _index -= chunk;
+
+        // Conservar las últimas (subLength - 1) muestras como historial
+        memmove(_buffer, _buffer + chunk, history * sizeof(float32_t));
+
+        input += chunk;
+        inputLength -= chunk;
+    }
+    return produced;
+}
+
+uint32_t PolyphaseResampler::getMaxOutputLength(uint32_t inputLength) const {
+    return (uint32_t)(((uint64_t)inputLength * _interpolation + _decimation - 1) / _decimation);
+}
+
+void PolyphaseResampler::reset() {
+    memset(_buffer, 0, (_subLength - 1 + _blockSize) * sizeof(float32_t));
+    _phase = 0;
+    _index = 0;
+}
+
+float32_t PolyphaseResampler::getGroupDelay() const {
+    return (_numTaps - 1) / (2.0f * _interpolation);
+}
+
+uint32_t PolyphaseResampler::getMemoryUsage() const {
+    return sizeof(PolyphaseResampler)
+         + ((uint32_t)_interpolation * _subLength + _subLength - 1 + _blockSize) * sizeof(float32_t);
+}
+
+/**
+ * @details h[n] = L · 2fc · sinc(2fc·(n - (N-1)/2)) · w[n] con ventana de Blackman,
+ * normalizado después para que la suma sea exactamente L.
+ */
+void PolyphaseResampler::designLowpass(float32_t* coeffs, uint16_t numTaps,
+                                       uint16_t interpolation, uint16_t decimation) {
+    if (numTaps == 0) {
+        return;
+    }
+    uint16_t factor = (interpolation > decimation) ? interpolation : decimation;
+    float32_t cutoff = 0.5f / (factor ? factor : 1);
+    float32_t center = (numTaps - 1) * 0.5f;
+
+    float32_t sum = 0.0f;
+    for (uint16_t n = 0; n < numTaps; n++) {
+        float32_t t = n - center;
+        float32_t x = 2.0f * PI * cutoff * t;
+        float32_t sinc = (fabsf(t) < 1e-6f) ? 2.0f * cutoff : sinf(x) / (PI * t);
+        float32_t w = (numTaps > 1)
+            ? 0.42f - 0.5f * cosf(2.0f * PI * n / (numTaps - 1)) + 0.08f * cosf(4.0f * PI * n / (numTaps - 1))
+            : 1.0f;
+        coeffs[n] = sinc * w;
+        sum += coeffs[n];
+    }
+
+    float32_t gain = (sum != 0.0f) ? interpolation / sum : 0.0f;
+    for (uint16_t n = 0; n < numTaps; n++) {
+        coeffs[n] *= gain;
+    }
+}
+
+// ============================================================================
+// FarrowResampler
+// ============================================================================
+
+FarrowResampler::FarrowResampler(float32_t inputRate, float32_t outputRate, uint16_t blockSize)
+    : _blockSize(blockSize ? blockSize : 1),
+      _kp(1e-4f),
+      _ki(1e-6f),
+      _maxDrift(1000e-6f),
+      _integral(0.0f),
+      _position(1),
+      _mu(0.0f)
+{
+    _nominalRatio = (outputRate > 0.0f) ? inputRate / outputRate : 1.0f;
+    _ratio = _nominalRatio;
+    _buffer = new float32_t[3 + _blockSize]();
+}
+
+FarrowResampler::~FarrowResampler() {
+    delete[] _buffer;
+}
+
+/**
+ * @details _buffer[0..2] son las 3 últimas muestras del bloque anterior y
+ * _buffer[3 + i] = input[i]. La salida en la posición n + mu usa x[n-1], x[n],
+ * x[n+1] y x[n+2], así que se puede calcular mientras n <= chunk. Empezar en n = 1
+ * fija el retardo en 2 muestras de entrada.
+ */
+uint32_t FarrowResampler::processBuffer(float32_t* input, uint32_t inputLength, float32_t* output) {
+    uint32_t produced = 0;
+
+    while (inputLength > 0) {
+        uint32_t chunk = (inputLength < _blockSize) ? inputLength : _blockSize;
+        arm_copy_f32(input, _buffer + 3, chunk);
+
+        while (_position <= chunk) {
+            const float32_t* x = _buffer + _position - 1;
+
+            // Lagrange cúbico en estructura de Farrow: y = ((c3·mu + c2)·mu + c1)·mu + c0
+            float32_t c0 = x[1];
+            float32_t c1 = x[2] - (1.0f / 3.0f) * x[0] - 0.5f * x[1] - (1.0f / 6.0f) * x[3];
+            float32_t c2 = 0.5f * (x[0] + x[2]) - x[1];
+            float32_t c3 = (1.0f / 6.0f) * (x[3] - x[0]) + 0.5f * (x[1] - x[2]);
+            output[produced++] = ((c3 * _mu + c2) * _mu + c1) * _mu + c0;
+
+            _mu += _ratio;
+            uint32_t step = (uint32_t)_mu;
+            _position += step;
+            _mu -= step;
+        }
+        _position -= chunk;
+
+        memmove(_buffer, _buffer + chunk, 3 * sizeof(float32_t));
+
+        input += chunk;
+        inputLength -= chunk;
+    }
+    return produced;
+}
+
+uint32_t FarrowResampler::getMaxOutputLength(uint32_t inputLength) const {
+    float32_t minRatio = _nominalRatio * (1.0f - _maxDrift);
+    if (_ratio < minRatio) {
+        minRatio = _ratio;
+    }
+    return (uint32_t)(inputLength / minRatio) + 2;
+}
+
+void FarrowResampler::correctDrift(float32_t error) {
+    _integral += error;
+
+    // Anti-windup: el integrador no acumula más de lo que puede corregir
+    if (_ki > 0.0f) {
+        float32_t limit = _maxDrift / _ki;
+        if (_integral > limit) {
+            _integral = limit;
+        } else if (_integral < -limit) {
+            _integral = -limit;
+        }
+    }
+
+    float32_t drift = _kp * error + _ki * _integral;
+    if (drift > _maxDrift) {
+        drift = _maxDrift;
+    } else if (drift < -_maxDrift) {
+        drift = -_maxDrift;
+    }
+    _ratio = _nominalRatio * (1.0f + drift);
+}
+
+void FarrowResampler::setDriftGains(float32_t kp, float32_t ki) {
+    _kp = kp;
+    _ki = ki;
+}
+
+void FarrowResampler::setMaxDrift(float32_t ppm) {
+    _maxDrift = fabsf(ppm) * 1e-6f;
+}
+
+void FarrowResampler::setRatio(float32_t ratio) {
+    if (ratio > 0.0f) {
+        _ratio = ratio;
+    }
+}
+
+float32_t FarrowResampler::getDriftPpm() const {
+    return (_ratio / _nominalRatio - 1.0f) * 1e6f;
+}
+
+void FarrowResampler::reset() {
+    memset(_buffer, 0, (3 + _blockSize) * sizeof(float32_t));
+    _position = 1;
+    _mu = 0.0f;
+    _integral = 0.0f;
+    _ratio = _nominalRatio;
+}
+
+uint32_t FarrowResampler::getMemoryUsage() const {
+    return sizeof(FarrowResampler) + (3 + _blockSize) * sizeof(float32_t);
+}
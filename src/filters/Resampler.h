@@ -0,0 +1,243 @@
+/**
+ * @file Resampler.h
+ * @brief Conversores de frecuencia de muestreo por bloques: polifásico L/M y Farrow
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @details Para fusionar sensores con frecuencias distintas (ECG a 960 Hz, EEG a
+ * 250 Hz, acelerómetro a 100 Hz como referencia del LMSFilter) hay que llevarlos a
+ * una frecuencia común en streaming, sin remuestrear la señal completa offline:
+ *
+ * - PolyphaseResampler: razón racional L/M exacta. El pasa-bajas prototipo (a la
+ *   frecuencia L·Fs) se descompone en L subfiltros y solo se calculan las muestras
+ *   de salida que sobreviven a la decimación: coste por salida = numTaps / L MACs.
+ * - FarrowResampler: razón arbitraria (incluso variable) con interpolación de
+ *   Lagrange cúbica en estructura de Farrow, y corrección de deriva de reloj con un
+ *   lazo PI sobre el nivel de un buffer: útil cuando el sensor tiene su propio
+ *   oscilador y su frecuencia real difiere unas ppm de la nominal.
+ *
+ * Ambos reciben bloques de entrada de cualquier longitud y devuelven el número de
+ * muestras de salida producidas, que varía de un bloque a otro.
+ *
+ * @par Ejemplo
+ * @code
+ * // Acelerómetro 100 Hz -> 960 Hz (L = 48, M = 5) como referencia del LMS del ECG
+ * float32_t coeffs[768];
+ * PolyphaseResampler::designLowpass(coeffs, 768, 48, 5);
+ * PolyphaseResampler accelTo960(coeffs, 768, 48, 5, 10);
+ *
+ * float32_t accel[10], reference[100];
+ * uint32_t n = accelTo960.processBuffer(accel, 10, reference);   // 96 muestras
+ * lms.processBuffer(ecg, reference, out, err, n);
+ * @endcode
+ */
+
+#ifndef RESAMPLER_H
+#define RESAMPLER_H
+
+#include <arm_math.h>
+
+/**
+ * @class PolyphaseResampler
+ * @brief Conversor racional L/M con banco polifásico
+ *
+ * @details Los coeficientes siguen la convención de FIRFilter y de
+ * arm_fir_interpolate_f32(): orden temporal invertido y ganancia en continua L
+ * (la interpolación reparte la energía entre L muestras). designLowpass() genera un
+ * prototipo válido. La tabla polifásica se reordena una vez en el constructor; el
+ * array original puede liberarse después.
+ */
+class PolyphaseResampler {
+    public:
+        /**
+         * @param coeffs Pasa-bajas prototipo a la frecuencia L·Fs (orden invertido, ganancia L)
+         * @param numTaps Número de coeficientes (si no es múltiplo de L se rellena con ceros)
+         * @param interpolation Factor de interpolación L (>= 1)
+         * @param decimation Factor de decimación M (>= 1)
+         * @param blockSize Muestras de entrada procesadas por bloque interno
+         *
+         * @note L y M no se simplifican: el prototipo está diseñado para L·Fs.
+         */
+        PolyphaseResampler(const float32_t* coeffs, uint16_t numTaps, uint16_t interpolation,
+                           uint16_t decimation, uint16_t blockSize);
+        ~PolyphaseResampler();
+
+        /**
+         * @brief Procesa un bloque de entrada de cualquier longitud
+         *
+         * @param input Muestras de entrada
+         * @param inputLength Número de muestras de entrada
+         * @param output Destino; debe admitir getMaxOutputLength(inputLength) muestras
+         * @return uint32_t Muestras de salida escritas
+         */
+        uint32_t processBuffer(float32_t* input, uint32_t inputLength, float32_t* output);
+
+        /**
+         * @brief Cota superior de muestras de salida para un bloque de entrada
+         */
+        uint32_t getMaxOutputLength(uint32_t inputLength) const;
+
+        /**
+         * @brief Pone a cero el historial y la fase
+         */
+        void reset();
+
+        /**
+         * @brief Retardo del prototipo de fase lineal, en muestras de entrada
+         */
+        float32_t getGroupDelay() const;
+
+        /**
+         * @brief Bytes del objeto, la tabla polifásica y el buffer de historial
+         */
+        uint32_t getMemoryUsage() const;
+
+        uint16_t getInterpolation() const { return _interpolation; }
+        uint16_t getDecimation() const { return _decimation; }
+
+        /**
+         * @brief Diseña un prototipo válido: sinc con ventana de Blackman
+         *
+         * @details Corte en 0.5 / max(L, M) ciclos/muestra a la frecuencia L·Fs (la menor
+         * de las dos frecuencias de Nyquist) y ganancia en continua L. Unos 16·max(L, M)
+         * coeficientes dan más de 70 dB de rechazo.
+         *
+         * @param coeffs Destino (numTaps valores, simétricos: el orden invertido coincide)
+         */
+        static void designLowpass(float32_t* coeffs, uint16_t numTaps, uint16_t interpolation,
+                                  uint16_t decimation);
+
+    private:
+        // No copiable: posee la tabla polifásica y el historial
+        PolyphaseResampler(const PolyphaseResampler&);
+        PolyphaseResampler& operator=(const PolyphaseResampler&);
+
+        uint16_t _interpolation;
+        uint16_t _decimation;
+        uint16_t _blockSize;
+        uint16_t _subLength;     ///< Coeficientes por subfiltro: ceil(numTaps / L)
+        uint16_t _numTaps;
+
+        /**
+         * @brief L subfiltros de _subLength coeficientes, ordenados del más antiguo al
+         * más reciente para un producto escalar directo con el historial
+         */
+        float32_t* _phases;
+
+        /**
+         * @brief (_subLength - 1) muestras de historial seguidas del bloque actual
+         */
+        float32_t* _buffer;
+
+        uint16_t _phase;         ///< Fase polifásica de la próxima salida (0..L-1)
+        uint32_t _index;         ///< Muestra de entrada (en el bloque) de la próxima salida
+};
+
+/**
+ * @class FarrowResampler
+ * @brief Conversor de razón arbitraria con interpolación cúbica y corrección de deriva
+ *
+ * @details La razón es el avance en muestras de entrada por cada muestra de salida
+ * (Fs_entrada / Fs_salida). Cada salida se calcula con las 4 muestras que rodean su
+ * posición y la fracción mu, evaluando el polinomio de Lagrange cúbico por Horner
+ * (estructura de Farrow): 4 sumas ponderadas fijas y 3 MACs en mu.
+ *
+ * @note Para reducir la frecuencia (razón > 1) la entrada debe filtrarse antes por
+ * debajo de la nueva Nyquist (FIRFilter o PolyphaseResampler), porque el interpolador
+ * no es un filtro antialiasing.
+ */
+class FarrowResampler {
+    public:
+        /**
+         * @param inputRate Frecuencia nominal de entrada (Hz)
+         * @param outputRate Frecuencia de salida (Hz)
+         * @param blockSize Muestras de entrada procesadas por bloque interno
+         */
+        FarrowResampler(float32_t inputRate, float32_t outputRate, uint16_t blockSize);
+        ~FarrowResampler();
+
+        /**
+         * @brief Procesa un bloque de entrada de cualquier longitud
+         *
+         * @param output Destino; debe admitir getMaxOutputLength(inputLength) muestras
+         * @return uint32_t Muestras de salida escritas
+         */
+        uint32_t processBuffer(float32_t* input, uint32_t inputLength, float32_t* output);
+
+        /**
+         * @brief Cota superior de salidas para un bloque, con la deriva máxima permitida
+         */
+        uint32_t getMaxOutputLength(uint32_t inputLength) const;
+
+        /**
+         * @brief Corrige la deriva de reloj con un lazo PI
+         *
+         * @details Llamar periódicamente (p. ej. una vez por bloque) con el error de nivel
+         * de un buffer: positivo si sobran muestras (la fuente va más rápida que su
+         * frecuencia nominal, o se producen más salidas de las que se consumen). La razón
+         * se ajusta a nominal × (1 + kp·error + ki·Σerror), limitada a ±maxDrift.
+         *
+         * @param error Exceso de muestras respecto al nivel objetivo
+         */
+        void correctDrift(float32_t error);
+
+        /**
+         * @brief Ganancias del lazo de deriva (por defecto kp = 1e-4, ki = 1e-6 por llamada)
+         */
+        void setDriftGains(float32_t kp, float32_t ki);
+
+        /**
+         * @brief Corrección máxima en ppm (por defecto 1000 ppm)
+         */
+        void setMaxDrift(float32_t ppm);
+
+        /**
+         * @brief Fija la razón directamente (muestras de entrada por salida)
+         */
+        void setRatio(float32_t ratio);
+
+        float32_t getRatio() const { return _ratio; }
+        float32_t getNominalRatio() const { return _nominalRatio; }
+
+        /**
+         * @brief Corrección actual respecto a la razón nominal, en ppm
+         */
+        float32_t getDriftPpm() const;
+
+        /**
+         * @brief Pone a cero el historial, la posición y el integrador de deriva
+         */
+        void reset();
+
+        /**
+         * @brief Retardo del interpolador: 2 muestras de entrada
+         */
+        float32_t getGroupDelay() const { return 2.0f; }
+
+        uint32_t getMemoryUsage() const;
+
+    private:
+        // No copiable: posee el buffer de historial
+        FarrowResampler(const FarrowResampler&);
+        FarrowResampler& operator=(const FarrowResampler&);
+
+        uint16_t _blockSize;
+        float32_t _nominalRatio;
+        float32_t _ratio;
+
+        float32_t _kp;
+        float32_t _ki;
+        float32_t _maxDrift;     ///< Corrección relativa máxima (ppm × 1e-6)
+        float32_t _integral;
+
+        /**
+         * @brief 3 muestras de historial seguidas del bloque actual
+         */
+        float32_t* _buffer;
+
+        uint32_t _position;      ///< Parte entera de la posición de la próxima salida
+        float32_t _mu;           ///< Parte fraccionaria (0 <= mu < 1)
+};
+
+#endif // RESAMPLER_H
@@ -0,0 +1,175 @@
+/**
+ * @file STFT.cpp
+ * @brief Implementación de la STFT en streaming y de los planes de FFT compartidos
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @see STFT.h para los formatos de salida
+ */
+
+#include "STFT.h"
+#include <string.h>
+
+#define STFT_MIN_LOG2   5        // 32
+#define STFT_MAX_LOG2   12       // 4096
+#define STFT_DB_FLOOR   1e-20f   // Potencia mínima antes de escalar (evita log10(0))
+
+static arm_rfft_fast_instance_f32 plans[STFT_MAX_LOG2 - STFT_MIN_LOG2 + 1];
+static bool planReady[STFT_MAX_LOG2 - STFT_MIN_LOG2 + 1];
+
+arm_rfft_fast_instance_f32* STFT::getPlan(uint16_t fftSize) {
+    for (uint8_t log2 = STFT_MIN_LOG2; log2 <= STFT_MAX_LOG2; log2++) {
+        if (fftSize != (1U << log2)) {
+            continue;
+        }
+        uint8_t slot = log2 - STFT_MIN_LOG2;
+        if (!planReady[slot]) {
+            if (arm_rfft_fast_init_f32(&plans[slot], fftSize) != ARM_MATH_SUCCESS) {
+                return nullptr;
+            }
+            planReady[slot] = true;
+        }
+        return &plans[slot];
+    }
+    return nullptr;
+}
+
+void STFT::designWindow(float32_t* window, uint16_t length, Window type) {
+    for (uint16_t n = 0; n < length; n++) {
+        float32_t phase = 2.0f * PI * n / length;
+        switch (type) {
+            case WINDOW_HANN:
+                window[n] = 0.5f - 0.5f * cosf(phase);
+                break;
+            case WINDOW_HAMMING:
+                window[n] = 0.54f - 0.46f * cosf(phase);
+                break;
+            case WINDOW_BLACKMAN:
+                window[n] = 0.42f - 0.5f * cosf(phase) + 0.08f * cosf(2.0f * phase);
+                break;
+            default:
+                window[n] = 1.0f;
+                break;
+        }
+    }
+}
+
+STFT::STFT(uint16_t fftSize, uint16_t hop, Window window, Output output)
+    : _fftSize(fftSize),
+      _hop(hop),
+      _output(output),
+      _window(nullptr),
+      _scale(0.0f),
+      _buffer(nullptr),
+      _frame(nullptr),
+      _spectrum(nullptr)
+{
+    _plan = getPlan(fftSize);
+    if (_plan == nullptr) {
+        return;
+    }
+    if (_hop == 0 || _hop > _fftSize) {
+        _hop = _fftSize;
+    }
+
+    _window = new float32_t[_fftSize];
+    designWindow(_window, _fftSize, window);
+    float32_t sum = 0.0f;
+    for (uint16_t n = 0; n < _fftSize; n++) {
+        sum += _window[n];
+    }
+    _scale = 2.0f / sum;
+
+    _buffer = new float32_t[_fftSize];
+    _frame = new float32_t[_fftSize];
+    if (_output != OUTPUT_COMPLEX) {
+        _spectrum = new float32_t[_fftSize];
+    }
+    reset();
+}
+
+STFT::~STFT() {
+    delete[] _window;
+    delete[] _buffer;
+    delete[] _frame;
+    delete[] _spectrum;
+}
+
+uint16_t STFT::getFrameLength() const {
+    return (_output == OUTPUT_COMPLEX) ? _fftSize : _fftSize / 2 + 1;
+}
+
+uint32_t STFT::processBuffer(float32_t* input, uint32_t length, float32_t* frames) {
+    if (_plan == nullptr) {
+        return 0;
+    }
+    uint32_t produced = 0;
+    uint16_t frameLength = getFrameLength();
+    while (length > 0) {
+        uint32_t count = _fftSize - _fill;
+        if (count > length) {
+            count = length;
+        }
+        memcpy(_buffer + _fill, input, count * sizeof(float32_t));
+        _fill += count;
+        input += count;
+        length -= count;
+
+        if (_fill == _fftSize) {
+            computeFrame(frames + produced * frameLength);
+            produced++;
+            // Se conservan las fftSize - hop muestras que comparte la trama siguiente
+            memmove(_buffer, _buffer + _hop, (_fftSize - _hop) * sizeof(float32_t));
+            _fill = _fftSize - _hop;
+        }
+    }
+    return produced;
+}
+
+void STFT::computeFrame(float32_t* frame) {
+    arm_mult_f32(_buffer, _window, _frame, _fftSize);
+    _frameCount++;
+
+    if (_output == OUTPUT_COMPLEX) {
+        arm_rfft_fast_f32(_plan, _frame, frame, 0);
+        return;
+    }
+
+    // {X0, X(N/2), Re X1, Im X1, ...}: los bins 0 y N/2 son reales
+    arm_rfft_fast_f32(_plan, _frame, _spectrum, 0);
+    uint16_t half = _fftSize / 2;
+    if (_output == OUTPUT_MAGNITUDE) {
+        arm_cmplx_mag_f32(_spectrum + 2, frame + 1, half - 1);
+        arm_scale_f32(frame + 1, _scale, frame + 1, half - 1);
+        frame[0] = fabsf(_spectrum[0]) * 0.5f * _scale;
+        frame[half] = fabsf(_spectrum[1]) * 0.5f * _scale;
+        return;
+    }
+
+    // En dB se trabaja con la potencia: 10·log10(|X|²·scale²) sin raíces cuadradas
+    arm_cmplx_mag_squared_f32(_spectrum + 2, frame + 1, half - 1);
+    frame[0] = 0.25f * _spectrum[0] * _spectrum[0];
+    frame[half] = 0.25f * _spectrum[1] * _spectrum[1];
+    float32_t offset = 20.0f * log10f(_scale);
+    for (uint16_t k = 0; k <= half; k++) {
+        float32_t power = (frame[k] > STFT_DB_FLOOR) ? frame[k] : STFT_DB_FLOOR;
+        frame[k] = 10.0f * log10f(power) + offset;
+    }
+}
+
+void STFT::reset() {
+    if (_buffer != nullptr) {
+        memset(_buffer, 0, _fftSize * sizeof(float32_t));
+    }
+    _fill = 0;
+    _frameCount = 0;
+}
+
+uint32_t STFT::getMemoryUsage() const {
+    if (_plan == nullptr) {
+        return sizeof(STFT);
+    }
+    uint8_t buffers = (_output == OUTPUT_COMPLEX) ? 3 : 4;
+    return sizeof(STFT) + buffers * _fftSize * sizeof(float32_t);
+}
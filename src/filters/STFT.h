@@ -0,0 +1,150 @@
+/**
+ * @file STFT.h
+ * @brief Transformada de Fourier de tiempo corto en streaming (espectrogramas en el dispositivo)
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @details La señal llega por bloques de cualquier tamaño y STFT entrega una trama cada
+ * hop muestras en cuanto tiene fftSize muestras. Solo guarda la última ventana
+ * (fftSize muestras), no la señal completa.
+ *
+ * - Ventana precalculada una vez en el constructor (Hann, Hamming, Blackman o
+ *   rectangular); aplicarla es un arm_mult_f32.
+ * - FFT real con arm_rfft_fast_f32. La instancia (el "plan") no depende de la señal,
+ *   así que se crea una sola vez por tamaño y la comparten todas las STFT (getPlan()).
+ * - Salida compleja (formato CMSIS), en magnitud o en dB. La magnitud está normalizada
+ *   para que un seno de amplitud A dé un pico de A, sea cual sea la ventana.
+ *
+ * @par Ejemplo
+ * @code
+ * STFT stft(256, 64);                          // Hann, magnitud en dB, 129 bins por trama
+ * float32_t frames[2 * 129];                   // 32 muestras dan como mucho 2 tramas
+ * uint32_t n = stft.processBuffer(block, 32, frames);
+ * for (uint32_t f = 0; f < n; f++) {
+ *     telemetry.send(frames + f * stft.getFrameLength(), stft.getFrameLength());
+ * }
+ * @endcode
+ */
+
+#ifndef STFT_H
+#define STFT_H
+
+#include <arm_math.h>
+
+/**
+ * @class STFT
+ * @brief Tramas espectrales solapadas de una señal que llega por bloques
+ */
+class STFT {
+    public:
+        enum Window {
+            WINDOW_RECTANGULAR,
+            WINDOW_HANN,
+            WINDOW_HAMMING,
+            WINDOW_BLACKMAN
+        };
+
+        enum Output {
+            OUTPUT_COMPLEX,     ///< fftSize valores: {X0, X(N/2), Re X1, Im X1, ...} (formato CMSIS, sin escalar)
+            OUTPUT_MAGNITUDE,   ///< fftSize/2 + 1 amplitudes
+            OUTPUT_DB           ///< fftSize/2 + 1 amplitudes en dB (20·log10)
+        };
+
+        /**
+         * @param fftSize Tamaño de la FFT: potencia de 2 entre 32 y 4096
+         * @param hop Muestras entre tramas consecutivas (1 .. fftSize)
+         * @param window Ventana de análisis
+         * @param output Formato de cada trama
+         */
+        STFT(uint16_t fftSize, uint16_t hop, Window window = WINDOW_HANN, Output output = OUTPUT_DB);
+        ~STFT();
+
+        /**
+         * @brief false si fftSize no está soportado por arm_rfft_fast_f32
+         */
+        bool isValid() const { return _plan != nullptr; }
+
+        /**
+         * @brief Añade un bloque y escribe las tramas que se completen
+         *
+         * @param input Muestras nuevas
+         * @param length Número de muestras
+         * @param frames Destino: getMaxOutputFrames(length) tramas de getFrameLength() valores
+         * @return uint32_t Tramas escritas
+         */
+        uint32_t processBuffer(float32_t* input, uint32_t length, float32_t* frames);
+
+        uint32_t getMaxOutputFrames(uint32_t inputLength) const { return inputLength / _hop + 1; }
+
+        /**
+         * @brief Valores por trama: fftSize (compleja) o fftSize/2 + 1
+         */
+        uint16_t getFrameLength() const;
+
+        uint16_t getFFTSize() const { return _fftSize; }
+        uint16_t getHop() const { return _hop; }
+        const float32_t* getWindow() const { return _window; }
+
+        /**
+         * @brief Frecuencia central del bin k para una frecuencia de muestreo dada
+         */
+        float32_t getBinFrequency(uint16_t bin, float32_t sampleRate) const { return bin * sampleRate / _fftSize; }
+
+        /**
+         * @brief Retardo del centro de la trama respecto a la última muestra: (fftSize - 1) / 2
+         */
+        float32_t getGroupDelay(float32_t normalizedFrequency = 0.0f) const {
+            (void)normalizedFrequency;
+            return 0.5f * (_fftSize - 1);
+        }
+
+        /**
+         * @brief Tramas entregadas desde el último reset()
+         */
+        uint32_t getFrameCount() const { return _frameCount; }
+
+        void reset();
+        uint32_t getMemoryUsage() const;
+
+        /**
+         * @brief Instancia compartida de arm_rfft_fast_f32 para ese tamaño
+         *
+         * @details Se inicializa la primera vez que se pide y se reutiliza después. Solo
+         * contiene punteros a las tablas de CMSIS-DSP, así que compartirla entre
+         * instancias no tiene efectos secundarios.
+         *
+         * @return nullptr si el tamaño no está soportado
+         */
+        static arm_rfft_fast_instance_f32* getPlan(uint16_t fftSize);
+
+        /**
+         * @brief Rellena una ventana de length muestras (periódica, para solapar con hop)
+         */
+        static void designWindow(float32_t* window, uint16_t length, Window type);
+
+    private:
+        // No copiable: posee la ventana y los buffers
+        STFT(const STFT&);
+        STFT& operator=(const STFT&);
+
+        /**
+         * @brief Ventana, FFT y conversión de la trama que está en _buffer
+         */
+        void computeFrame(float32_t* frame);
+
+        uint16_t _fftSize;
+        uint16_t _hop;
+        Output _output;
+        arm_rfft_fast_instance_f32* _plan;
+
+        float32_t* _window;
+        float32_t _scale;                ///< 2 / Σw: amplitud de un seno
+        float32_t* _buffer;              ///< Últimas fftSize muestras
+        uint16_t _fill;
+        float32_t* _frame;               ///< Trama con ventana (arm_rfft_fast_f32 la modifica)
+        float32_t* _spectrum;            ///< Espectro complejo (solo si la salida no es compleja)
+        uint32_t _frameCount;
+};
+
+#endif // STFT_H
@@ -0,0 +1,240 @@
+/**
+ * @file SavitzkyGolay.h
+ * @brief Suavizado y derivadas de Savitzky-Golay con coeficientes en compilación y núcleo plegado
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @details Un filtro de Savitzky-Golay ajusta por mínimos cuadrados un polinomio de
+ * grado Order a las Window muestras de la ventana y devuelve su valor (o su derivada)
+ * en el centro. Conserva la altura y la anchura de los picos (onda R, pico sistólico
+ * de la PPG) mucho mejor que una media móvil de la misma longitud.
+ *
+ * - Los coeficientes salen de los polinomios de Gram (fórmula de Gorry), evaluados
+ *   con constexpr al compilar: no hay tablas que pegar ni cálculo en el arranque.
+ * - El núcleo de suavizado (y el de las derivadas pares) es simétrico y el de las
+ *   derivadas impares antisimétrico. Se pliega la ventana: por cada par de muestras
+ *   a la misma distancia del centro se calculan una suma y una resta, y de una sola
+ *   pasada salen la señal suavizada y la derivada con (Window + 1)/2 MACs cada una.
+ *   Dos FIRFilter costarían 2·Window MACs.
+ * - Las Window muestras se guardan en un buffer circular duplicado dentro del objeto,
+ *   así que la ventana siempre es contigua y no hay memoria dinámica.
+ *
+ * La salida corresponde al centro de la ventana: (Window - 1)/2 muestras de retardo.
+ * La derivada es por muestra; con sampleRate en el constructor se entrega en
+ * unidades por segundo (por segundo^Derivative).
+ *
+ * @tparam Window Longitud de la ventana (impar)
+ * @tparam Order Grado del polinomio (menor que Window)
+ * @tparam Derivative Orden de la derivada que acompaña al suavizado (1 .. Order)
+ *
+ * @par Ejemplo
+ * @code
+ * SavitzkyGolay<15, 3, 1> ppg(125.0f);            // 15 muestras, cúbica, 1ª derivada en u/s
+ * ppg.processBuffer(raw, smooth, slope, 32);      // Una pasada, dos salidas
+ *
+ * // Los mismos coeficientes para FIRFilter (orden CMSIS)
+ * static constexpr FIRTable<15> SMOOTH = SavitzkyGolay<15, 3, 1>::table(0);
+ * @endcode
+ */
+
+#ifndef SAVITZKY_GOLAY_H
+#define SAVITZKY_GOLAY_H
+
+#include <arm_math.h>
+#include <string.h>
+#include "FIRDesign.h"
+
+/**
+ * @brief Coeficientes de Savitzky-Golay en compilación (polinomios de Gram, fórmula de Gorry)
+ *
+ * @tparam Window Longitud de la ventana (impar)
+ * @tparam Order Grado del polinomio
+ */
+template <uint16_t Window, uint8_t Order>
+struct SavitzkyGolayDesign {
+    static constexpr int HALF = (Window - 1) / 2;
+
+    /**
+     * @brief Coeficiente de la muestra i de la ventana (0 = la más antigua) para la derivada d
+     *
+     * @details Es también el orden de CMSIS: la tabla se puede pasar tal cual a FIRFilter.
+     * La derivada es por muestra (sin escalar por la frecuencia de muestreo).
+     */
+    static constexpr float32_t coefficient(uint8_t derivative, uint16_t i) {
+        return (float32_t)weight((int)i - HALF, derivative);
+    }
+
+    /**
+     * @brief Núcleo completo de Window coeficientes
+     */
+    static constexpr FIRTable<Window> table(uint8_t derivative) {
+        return makeTable<Window>(derivative, 0, typename FIRMakeIndices<Window>::type());
+    }
+
+    /**
+     * @brief Mitad del núcleo: [k] es el peso de x[c + k] (y, con signo, de x[c - k])
+     */
+    static constexpr FIRTable<HALF + 1> half(uint8_t derivative) {
+        return makeTable<HALF + 1>(derivative, HALF, typename FIRMakeIndices<HALF + 1>::type());
+    }
+
+    // Polinomio de Gram de grado k sobre 2·HALF + 1 puntos (o su derivada s) evaluado en i
+    static constexpr double gram(int i, int k, int s) {
+        return k > 0 ? (4.0 * k - 2.0) / (k * (2.0 * HALF - k + 1.0))
+                       * (i * gram(i, k - 1, s) + s * gram(i, k - 1, s - 1))
+                       - ((k - 1.0) * (2.0 * HALF + k)) / (k * (2.0 * HALF - k + 1.0)) * gram(i, k - 2, s)
+             : (k == 0 && s == 0) ? 1.0
+             : 0.0;
+    }
+
+    // a·(a - 1)·...·(a - b + 1)
+    static constexpr double factorial(int a, int b) {
+        return b <= 0 ? 1.0 : a * factorial(a - 1, b - 1);
+    }
+
+    // Peso de la muestra i (relativa al centro) para la derivada s en el centro
+    static constexpr double weightSum(int i, int s, int k) {
+        return k > Order ? 0.0
+             : (2.0 * k + 1.0) * factorial(2 * HALF, k) / factorial(2 * HALF + k + 1, k + 1)
+               * gram(i, k, 0) * gram(0, k, s) + weightSum(i, s, k + 1);
+    }
+    static constexpr double weight(int i, int s) {
+        return weightSum(i, s, 0);
+    }
+
+    template<uint16_t N, uint16_t... I>
+    static constexpr FIRTable<N> makeTable(uint8_t derivative, uint16_t first, FIRIndices<I...>) {
+        return FIRTable<N>{{ coefficient(derivative, first + I)... }};
+    }
+};
+
+/**
+ * @class SavitzkyGolay
+ * @brief Señal suavizada y derivada de un ajuste polinómico local, en una pasada
+ */
+template <uint16_t Window, uint8_t Order, uint8_t Derivative = 1>
+class SavitzkyGolay {
+    static_assert(Window % 2 == 1 && Window >= 3, "SavitzkyGolay: la ventana debe ser impar (>= 3)");
+    static_assert(Order < Window, "SavitzkyGolay: el grado debe ser menor que la ventana");
+    static_assert(Derivative >= 1 && Derivative <= Order, "SavitzkyGolay: derivada entre 1 y el grado");
+
+    public:
+        typedef SavitzkyGolayDesign<Window, Order> Design;
+
+        static constexpr uint16_t HALF = (Window - 1) / 2;
+
+        /**
+         * @brief Mitades de los núcleos: [k] multiplica a x[c + k] y a x[c - k], [0] al centro
+         */
+        static constexpr FIRTable<HALF + 1> SMOOTHING = Design::half(0);
+        static constexpr FIRTable<HALF + 1> DERIVATIVE = Design::half(Derivative);
+
+        /**
+         * @param sampleRate Frecuencia de muestreo para la derivada (1 = por muestra)
+         */
+        explicit SavitzkyGolay(float32_t sampleRate = 1.0f)
+            : _scale(1.0f)
+        {
+            for (uint8_t d = 0; d < Derivative; d++) {
+                _scale *= sampleRate;
+            }
+            reset();
+        }
+
+        /**
+         * @brief Añade una muestra y devuelve la señal suavizada (centro de la ventana)
+         */
+        float32_t processSample(float32_t input) {
+            push(input);
+            const float32_t* x = _history + _position + HALF;
+            float32_t smooth = SMOOTHING.coeffs[0] * x[0];
+            for (uint16_t k = 1; k <= HALF; k++) {
+                smooth += SMOOTHING.coeffs[k] * (x[k] + x[-(int16_t)k]);
+            }
+            return smooth;
+        }
+
+        /**
+         * @brief Añade una muestra y entrega suavizado y derivada de la misma pasada
+         */
+        float32_t processSample(float32_t input, float32_t& derivative) {
+            push(input);
+            const float32_t* x = _history + _position + HALF;
+            float32_t smooth = SMOOTHING.coeffs[0] * x[0];
+            float32_t slope = ODD ? 0.0f : DERIVATIVE.coeffs[0] * x[0];
+            for (uint16_t k = 1; k <= HALF; k++) {
+                float32_t sum = x[k] + x[-(int16_t)k];
+                smooth += SMOOTHING.coeffs[k] * sum;
+                slope += DERIVATIVE.coeffs[k] * (ODD ? x[k] - x[-(int16_t)k] : sum);
+            }
+            derivative = slope * _scale;
+            return smooth;
+        }
+
+        /**
+         * @brief Solo suavizado (interfaz de FIRFilter, válida como etapa de FilterChain)
+         */
+        void processBuffer(float32_t* input, float32_t* output, uint32_t length) {
+            for (uint32_t i = 0; i < length; i++) {
+                output[i] = processSample(input[i]);
+            }
+        }
+
+        /**
+         * @brief Suavizado y derivada en una pasada (output puede ser input)
+         */
+        void processBuffer(float32_t* input, float32_t* output, float32_t* derivative, uint32_t length) {
+            for (uint32_t i = 0; i < length; i++) {
+                output[i] = processSample(input[i], derivative[i]);
+            }
+        }
+
+        /**
+         * @brief Retardo de grupo: (Window - 1)/2 muestras a cualquier frecuencia
+         */
+        float32_t getGroupDelay(float32_t normalizedFrequency = 0.0f) const {
+            (void)normalizedFrequency;
+            return HALF;
+        }
+
+        uint32_t getMemoryUsage() const {
+            return sizeof(*this);
+        }
+
+        void reset() {
+            memset(_history, 0, sizeof(_history));
+            _position = 0;
+        }
+
+        /**
+         * @brief Núcleo completo para FIRFilter (orden CMSIS, derivada por muestra)
+         */
+        static constexpr FIRTable<Window> table(uint8_t derivative) {
+            return Design::table(derivative);
+        }
+
+    private:
+        static constexpr bool ODD = (Derivative & 1) != 0;
+
+        void push(float32_t input) {
+            // Buffer duplicado: _history[_position .. _position + Window - 1] es la ventana en orden
+            _history[_position] = input;
+            _history[_position + Window] = input;
+            if (++_position == Window) {
+                _position = 0;
+            }
+        }
+
+        float32_t _history[2 * Window];
+        uint16_t _position;
+        float32_t _scale;               ///< sampleRate^Derivative
+};
+
+template <uint16_t Window, uint8_t Order, uint8_t Derivative>
+constexpr FIRTable<SavitzkyGolay<Window, Order, Derivative>::HALF + 1> SavitzkyGolay<Window, Order, Derivative>::SMOOTHING;
+
+template <uint16_t Window, uint8_t Order, uint8_t Derivative>
+constexpr FIRTable<SavitzkyGolay<Window, Order, Derivative>::HALF + 1> SavitzkyGolay<Window, Order, Derivative>::DERIVATIVE;
+
+#endif // SAVITZKY_GOLAY_H
@@ -151,6 +151,18 @@ WaveletFilter::WaveletFilter(uint16_t blockSize)
     _synthDetailFilter = new FIRFilter(_synthDetailCoeffs, _numTaps, _blockSize);
 }
 
+/**
+ * @brief Constructor de copia: duplica el estado de los cuatro FIR internos
+ */
+WaveletFilter::WaveletFilter(const WaveletFilter& other)
+    : _blockSize(other._blockSize)
+{
+    _approxFilter = new FIRFilter(*other._approxFilter);
+    _detailFilter = new FIRFilter(*other._detailFilter);
+    _synthApproxFilter = new FIRFilter(*other._synthApproxFilter);
+    _synthDetailFilter = new FIRFilter(*other._synthDetailFilter);
+}
+
 /**
  * @brief Destructor que libera recursos asignados dinámicamente
  * 
@@ -279,6 +291,30 @@ void WaveletFilter::processBuffer(float32_t* inputArray, float32_t* approxArray,
     _detailFilter->processBuffer(inputArray, detailArray, length);
 }
 
+/**
+ * @brief Suavizado wavelet de una muestra
+ * 
+ * @details Análisis de aproximación seguido de la síntesis de aproximación con el
+ * detalle a cero, escalado por 0.5 (ganancia en continua del banco sin diezmado = 2).
+ */
+float32_t WaveletFilter::processSample(float32_t input) {
+    float32_t approx = _approxFilter->processSample(input);
+    return 0.5f * _synthApproxFilter->processSample(approx);
+}
+
+/**
+ * @brief Suavizado wavelet de un buffer completo
+ * 
+ * @details La síntesis trabaja sobre el buffer de salida en el mismo sitio:
+ * arm_fir_f32() copia cada muestra de entrada al buffer de estados antes de
+ * escribir la salida correspondiente, así que no hace falta un buffer intermedio.
+ */
+void WaveletFilter::processBuffer(float32_t* inputArray, float32_t* outputArray, uint32_t length) {
+    _approxFilter->processBuffer(inputArray, outputArray, length);
+    _synthApproxFilter->processBuffer(outputArray, outputArray, length);
+    arm_scale_f32(outputArray, 0.5f, outputArray, length);
+}
+
 /**
  * @brief Reconstruye una muestra a partir de coeficientes wavelet
  * 
@@ -388,19 +424,29 @@ float32_t WaveletFilter::reconstruct(float32_t approxCoeff, float32_t detailCoef
  * @endcode
  */
 void WaveletFilter::reset() {
-    // Liberar y recrear filtros de análisis para reinicializar completamente su estado
-    delete _approxFilter;
-    delete _detailFilter;
-    _approxFilter = new FIRFilter(_approxCoeffs, _numTaps, _blockSize);
-    _detailFilter = new FIRFilter(_detailCoeffs, _numTaps, _blockSize);
-    
-    // Liberar y recrear filtros de síntesis para reinicializar completamente su estado
-    delete _synthApproxFilter;
-    delete _synthDetailFilter;
-    _synthApproxFilter = new FIRFilter(_synthApproxCoeffs, _numTaps, _blockSize);
-    _synthDetailFilter = new FIRFilter(_synthDetailCoeffs, _numTaps, _blockSize);
-    
-    // Esta implementación reinicializa completamente los filtros FIR,
-    // garantizando un estado interno completamente limpio sin necesidad
-    // de modificar la clase FIRFilter existente.
-}
\ No newline at end of file
+    // Cada FIRFilter pone a cero su historial sin liberar ni volver a reservar memoria
+    _approxFilter->reset();
+    _detailFilter->reset();
+    _synthApproxFilter->reset();
+    _synthDetailFilter->reset();
+}
+
+/**
+ * @brief Retardo de grupo del camino de suavizado
+ * 
+ * @details Suma del retardo del filtro de análisis y del de síntesis de aproximación,
+ * que están en cascada.
+ */
+float32_t WaveletFilter::getGroupDelay(float32_t normalizedFrequency) const {
+    return _approxFilter->getGroupDelay(normalizedFrequency)
+         + _synthApproxFilter->getGroupDelay(normalizedFrequency);
+}
+
+/**
+ * @brief Memoria del objeto más la de los cuatro filtros FIR del banco
+ */
+uint32_t WaveletFilter::getMemoryUsage() const {
+    return sizeof(WaveletFilter)
+         + _approxFilter->getMemoryUsage() + _detailFilter->getMemoryUsage()
+         + _synthApproxFilter->getMemoryUsage() + _synthDetailFilter->getMemoryUsage();
+}
@@ -111,6 +111,14 @@ class WaveletFilter {
          */
         WaveletFilter(uint16_t blockSize);
 
+        /**
+         * @brief Constructor de copia: los cuatro FIR internos se copian con estado propio
+         * 
+         * Los coeficientes Daubechies-4 son estáticos, así que la copia solo reserva
+         * los buffers de estados.
+         */
+        WaveletFilter(const WaveletFilter& other);
+
         /**
          * @brief Destructor que libera los recursos asignados
          * 
@@ -204,6 +212,39 @@ class WaveletFilter {
         void processBuffer(float32_t* inputArray, float32_t* approxArray, 
                           float32_t* detailArray, uint32_t length);
 
+        /**
+         * @brief Suavizado wavelet de una muestra (análisis + síntesis de la aproximación)
+         * 
+         * Equivale a 0.5 × reconstruct(approx, 0): la aproximación se resintetiza con
+         * el detalle suprimido. El factor 0.5 compensa la ganancia 2 del banco sin
+         * diezmado, de modo que la salida tiene ganancia unitaria en continua.
+         * 
+         * @param input Muestra de entrada
+         * @return float32_t Muestra suavizada
+         * 
+         * @note Usa los mismos filtros internos que processSample(input, &a, &d) y
+         * reconstruct(): no mezclar ambos modos sobre el mismo flujo sin reset().
+         */
+        float32_t processSample(float32_t input);
+
+        /**
+         * @brief Suavizado wavelet de un buffer completo (misma salida que processSample(input))
+         * 
+         * Permite usar el filtro wavelet como una etapa más de un FilterChain o de
+         * cualquier cadena de procesamiento por bloques con una entrada y una salida.
+         * 
+         * @param inputArray Puntero al array de muestras de entrada
+         * @param outputArray Puntero al array donde escribir la señal suavizada
+         * @param length Número de muestras a procesar
+         * 
+         * @example
+         * @code
+         * float32_t ecgBuffer[256], smoothBuffer[256];
+         * waveletFilter.processBuffer(ecgBuffer, smoothBuffer, 256);
+         * @endcode
+         */
+        void processBuffer(float32_t* inputArray, float32_t* outputArray, uint32_t length);
+
         /**
          * @brief Reconstruye una muestra a partir de coeficientes wavelet
          * 
@@ -279,7 +320,26 @@ class WaveletFilter {
          */
         void reset();
 
+        /**
+         * @brief Retardo de grupo del suavizado (análisis + síntesis de aproximación)
+         * 
+         * @param normalizedFrequency Frecuencia normalizada f/Fs (0.0 a 0.5)
+         * @return float32_t Retardo en muestras
+         */
+        float32_t getGroupDelay(float32_t normalizedFrequency = 0.0f) const;
+
+        /**
+         * @brief Memoria RAM ocupada por el objeto y sus cuatro filtros FIR internos
+         * 
+         * @return uint32_t Bytes ocupados (los coeficientes Daubechies-4 son estáticos
+         * y compartidos entre instancias, no se incluyen)
+         */
+        uint32_t getMemoryUsage() const;
+
     private:
+        // No asignable: posee los filtros FIR internos
+        WaveletFilter& operator=(const WaveletFilter&);
+
         /**
          * @brief Coeficientes del filtro de aproximación Daubechies-4 (pasa-bajo)
          * 
@@ -0,0 +1,304 @@
+/**
+ * @file BatchProcessor.h
+ * @brief Procesamiento offline en paralelo de muchos registros con un mismo pipeline (solo host)
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @details Para reprocesar una base de datos completa (cientos de registros WFDB o
+ * EDF) con el mismo diseño de filtros, BatchProcessor reparte los registros entre
+ * varios hilos:
+ * - Cada trabajador clona una vez el pipeline prototipo (constructor de copia de
+ *   FilterPipeline / FIRFilter / IIRFilter / WaveletFilter). Las tablas de
+ *   coeficientes se comparten; solo se reservan estados y buffers de trabajo.
+ * - Los registros se toman de un contador atómico en orden: un trabajador que acaba un
+ *   registro corto toma el siguiente, así que registros de longitudes muy distintas se
+ *   equilibran solos. Antes de cada registro el pipeline se reinicia con reset().
+ * - Memoria acotada: cada trabajador tiene como máximo un registro abierto, y los
+ *   registros se abren y cierran bajo demanda con las funciones open/close del
+ *   usuario. La memoria en vuelo es numWorkers × (pipeline + 2 bloques + una fuente),
+ *   independiente del número y la longitud de los registros.
+ *
+ * @par Ejemplo
+ * @code
+ * struct OpenedRecord : public SignalSource {       // Registro y fuente, se liberan juntos
+ *     WfdbRecord record;
+ *     WfdbSource* source;
+ *     uint32_t read(float32_t* buffer, uint32_t length) { return source->read(buffer, length); }
+ *     ~OpenedRecord() { delete source; }
+ * };
+ *
+ * static SignalSource* openRecord(uint32_t r, void* paths) {
+ *     OpenedRecord* opened = new OpenedRecord();
+ *     opened->source = nullptr;
+ *     if (!opened->record.open(((const char**)paths)[r])) { delete opened; return nullptr; }
+ *     opened->source = new WfdbSource(opened->record, 0);
+ *     return opened;
+ * }
+ * static void closeRecord(SignalSource* s, uint32_t r, void* paths) { delete s; }
+ *
+ * FilterPipeline<IIRFilter, FIRFilter> prototype(1024, notch, lowpass);
+ * BatchProcessor<FilterPipeline<IIRFilter, FIRFilter> > batch(prototype, 8);
+ * batch.setSink(onBlock, &results);
+ * batch.run(openRecord, closeRecord, paths, numRecords);
+ * printf("%.1f Msps por núcleo\n", batch.getThroughputPerCore() / 1e6);
+ * @endcode
+ *
+ * @note Solo host (C++11, std::thread). Se usa std::thread en lugar de OpenMP para no
+ * añadir dependencias de compilación, igual que StreamRuntime.
+ */
+
+#ifndef BATCH_PROCESSOR_H
+#define BATCH_PROCESSOR_H
+
+#if !defined(ARDUINO)
+
+#include <arm_math.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "../utils/SignalSource.h"
+
+/**
+ * @class BatchProcessor
+ * @brief Reparte registros entre hilos, cada uno con su copia del pipeline
+ *
+ * @tparam Pipeline Clase copiable con processBuffer(in, out, length), reset() y
+ * getMemoryUsage() (FilterPipeline, FIRFilter, IIRFilter, WaveletFilter)
+ */
+template <class Pipeline>
+class BatchProcessor {
+    public:
+        /**
+         * @brief Abre el registro 'record' y devuelve su fuente (nullptr si falla)
+         */
+        typedef SignalSource* (*OpenRecord)(uint32_t record, void* context);
+
+        /**
+         * @brief Libera la fuente devuelta por OpenRecord al terminar el registro
+         */
+        typedef void (*CloseRecord)(SignalSource* source, uint32_t record, void* context);
+
+        /**
+         * @brief Recibe cada bloque filtrado de un registro, en orden dentro del registro
+         *
+         * @note Se llama desde varios hilos a la vez con registros distintos
+         */
+        typedef void (*RecordSink)(uint32_t record, const float32_t* block, uint32_t length, void* context);
+
+        /**
+         * @param prototype Pipeline que se clona en cada trabajador (no se modifica)
+         * @param numWorkers Hilos trabajadores (0 = uno por núcleo)
+         * @param blockSize Muestras por bloque leído de cada fuente
+         */
+        BatchProcessor(const Pipeline& prototype, uint16_t numWorkers = 0, uint16_t blockSize = 1024)
+            : _prototype(prototype),
+              _numWorkers(numWorkers),
+              _blockSize(blockSize ? blockSize : 1),
+              _sink(nullptr),
+              _sinkContext(nullptr),
+              _open(nullptr),
+              _close(nullptr),
+              _context(nullptr),
+              _numRecords(0),
+              _nextRecord(0),
+              _samples(0),
+              _failed(0),
+              _inFlight(0),
+              _maxInFlight(0),
+              _startTime(0),
+              _endTime(0)
+        {
+            if (_numWorkers == 0) {
+                _numWorkers = (uint16_t)std::thread::hardware_concurrency();
+                if (_numWorkers == 0) {
+                    _numWorkers = 1;
+                }
+            }
+        }
+
+        /**
+         * @brief Destino de los bloques filtrados (nullptr = descartar)
+         */
+        void setSink(RecordSink sink, void* context = nullptr) {
+            _sink = sink;
+            _sinkContext = context;
+        }
+
+        /**
+         * @brief Procesa numRecords registros abiertos bajo demanda
+         *
+         * @param open Abre un registro (se llama desde el trabajador que lo procesa)
+         * @param close Libera la fuente (nullptr si las fuentes no se liberan)
+         * @param context Puntero opaco para open y close
+         * @param numRecords Número de registros (0 .. numRecords-1)
+         * @return true al terminar; false si open es nullptr
+         */
+        bool run(OpenRecord open, CloseRecord close, void* context, uint32_t numRecords) {
+            if (open == nullptr) {
+                return false;
+            }
+            _open = open;
+            _close = close;
+            _context = context;
+            _numRecords = numRecords;
+            _nextRecord = 0;
+            _samples = 0;
+            _failed = 0;
+            _inFlight = 0;
+            _maxInFlight = 0;
+            _startTime = monotonicNanos();
+            _endTime = 0;
+
+            std::thread* threads = new std::thread[_numWorkers];
+            for (uint16_t w = 0; w < _numWorkers; w++) {
+                threads[w] = std::thread(&BatchProcessor::workerLoop, this);
+            }
+            for (uint16_t w = 0; w < _numWorkers; w++) {
+                threads[w].join();
+            }
+            delete[] threads;
+
+            _endTime = monotonicNanos();
+            return true;
+        }
+
+        /**
+         * @brief Procesa fuentes ya abiertas (cada una se lee una sola vez)
+         */
+        bool run(SignalSource* const* sources, uint32_t numRecords) {
+            return run(&BatchProcessor::openFromArray, nullptr, (void*)sources, numRecords);
+        }
+
+        uint16_t getNumWorkers() const { return _numWorkers; }
+        uint16_t getBlockSize() const { return _blockSize; }
+
+        uint64_t getSamplesProcessed() const { return _samples.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Registros cuyo open devolvió nullptr
+         */
+        uint32_t getFailedRecords() const { return _failed.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Máximo de registros abiertos a la vez durante el último run()
+         */
+        uint32_t getMaxRecordsInFlight() const { return _maxInFlight.load(std::memory_order_relaxed); }
+
+        double getElapsedSeconds() const {
+            if (_startTime == 0) {
+                return 0.0;
+            }
+            int64_t end = (_endTime != 0) ? _endTime : monotonicNanos();
+            return (end - _startTime) * 1e-9;
+        }
+
+        /**
+         * @brief Muestras por segundo en total
+         */
+        double getThroughput() const {
+            double seconds = getElapsedSeconds();
+            return (seconds > 0.0) ? getSamplesProcessed() / seconds : 0.0;
+        }
+
+        /**
+         * @brief Muestras por segundo por núcleo ocupado (min(trabajadores, núcleos))
+         */
+        double getThroughputPerCore() const {
+            unsigned cores = std::thread::hardware_concurrency();
+            unsigned used = (cores != 0 && cores < _numWorkers) ? cores : _numWorkers;
+            return getThroughput() / used;
+        }
+
+        /**
+         * @brief RAM de los trabajadores: un pipeline clonado y dos bloques por hilo
+         * (sin contar las fuentes abiertas)
+         */
+        uint32_t getMemoryUsage() const {
+            return sizeof(*this)
+                 + _numWorkers * (_prototype.getMemoryUsage() + 2u * _blockSize * sizeof(float32_t));
+        }
+
+    private:
+        // No copiable: referencia al prototipo y estado de la ejecución en curso
+        BatchProcessor(const BatchProcessor&);
+        BatchProcessor& operator=(const BatchProcessor&);
+
+        static int64_t monotonicNanos() {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        static SignalSource* openFromArray(uint32_t record, void* context) {
+            return ((SignalSource* const*)context)[record];
+        }
+
+        void workerLoop() {
+            // Clon propio, reservado y tocado desde este hilo
+            Pipeline pipeline(_prototype);
+            float32_t* in = new float32_t[_blockSize];
+            float32_t* out = new float32_t[_blockSize];
+            uint64_t processed = 0;
+
+            for (;;) {
+                uint32_t record = _nextRecord.fetch_add(1, std::memory_order_relaxed);
+                if (record >= _numRecords) {
+                    break;
+                }
+
+                SignalSource* source = _open(record, _context);
+                if (source == nullptr) {
+                    _failed.fetch_add(1, std::memory_order_relaxed);
+                    continue;
+                }
+                uint32_t open = _inFlight.fetch_add(1, std::memory_order_relaxed) + 1;
+                uint32_t peak = _maxInFlight.load(std::memory_order_relaxed);
+                while (open > peak &&
+                       !_maxInFlight.compare_exchange_weak(peak, open, std::memory_order_relaxed)) {
+                }
+
+                pipeline.reset();
+                uint32_t count;
+                while ((count = source->read(in, _blockSize)) > 0) {
+                    pipeline.processBuffer(in, out, count);
+                    if (_sink != nullptr) {
+                        _sink(record, out, count, _sinkContext);
+                    }
+                    processed += count;
+                }
+
+                _inFlight.fetch_sub(1, std::memory_order_relaxed);
+                if (_close != nullptr) {
+                    _close(source, record, _context);
+                }
+            }
+
+            _samples.fetch_add(processed, std::memory_order_relaxed);
+            delete[] in;
+            delete[] out;
+        }
+
+        const Pipeline& _prototype;
+        uint16_t _numWorkers;
+        uint16_t _blockSize;
+        RecordSink _sink;
+        void* _sinkContext;
+
+        OpenRecord _open;
+        CloseRecord _close;
+        void* _context;
+        uint32_t _numRecords;
+
+        std::atomic<uint32_t> _nextRecord;
+        std::atomic<uint64_t> _samples;
+        std::atomic<uint32_t> _failed;
+        std::atomic<uint32_t> _inFlight;
+        std::atomic<uint32_t> _maxInFlight;
+
+        int64_t _startTime;                 ///< Nanosegundos (reloj monótono)
+        int64_t _endTime;
+};
+
+#endif // !ARDUINO
+
+#endif // BATCH_PROCESSOR_H
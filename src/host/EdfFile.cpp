@@ -0,0 +1,869 @@
+/**
+ * @file EdfFile.cpp
+ * @brief Implementación del lector y escritor EDF/EDF+ (solo host)
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @see EdfFile.h para documentación de la interfaz pública
+ * @see https://www.edfplus.info/specs/edf.html
+ * @see https://www.edfplus.info/specs/edfplus.html
+ */
+
+#if !defined(ARDUINO)
+
+// Desplazamientos de 64 bits en fseeko para archivos de más de 2 GB
+#define _FILE_OFFSET_BITS 64
+
+#include "EdfFile.h"
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+
+#define EDF_HEADER_BLOCK        256     // Bytes de la cabecera fija y de cada canal
+#define EDF_ANNOTATION_SAMPLES  30      // Muestras (60 bytes) del canal de anotaciones al escribir
+#define EDF_TAL_DURATION        0x15
+#define EDF_TAL_SEPARATOR       0x14
+#define EDF_TAL_ONSET_BYTES     24      // "+<onset>\x14\x14\0" con onset < 1e9 s y 6 decimales
+
+static const char edfAnnotationLabel[] = "EDF Annotations";
+
+static int seekTo(FILE* file, uint64_t position) {
+#if defined(_WIN32)
+    return _fseeki64(file, (__int64)position, SEEK_SET);
+#else
+    return fseeko(file, (off_t)position, SEEK_SET);
+#endif
+}
+
+/**
+ * @brief Copia un campo ASCII de ancho fijo quitando los espacios finales
+ */
+static void readField(char* dest, const char* src, uint32_t width) {
+    memcpy(dest, src, width);
+    dest[width] = '\0';
+    while (width > 0 && dest[width - 1] == ' ') {
+        dest[--width] = '\0';
+    }
+}
+
+static long fieldToInt(const char* src, uint32_t width) {
+    char field[81];
+    readField(field, src, width);
+    return strtol(field, nullptr, 10);
+}
+
+static double fieldToDouble(const char* src, uint32_t width) {
+    char field[81];
+    readField(field, src, width);
+    return strtod(field, nullptr);
+}
+
+/**
+ * @brief Escribe un texto en un campo ASCII de ancho fijo, relleno con espacios
+ */
+static void writeField(char* dest, const char* text, uint32_t width) {
+    uint32_t length = (uint32_t)strlen(text);
+    if (length > width) {
+        length = width;
+    }
+    memcpy(dest, text, length);
+    memset(dest + length, ' ', width - length);
+}
+
+/**
+ * @brief Escribe un número en un campo de 8 caracteres con la mayor precisión que quepa
+ */
+static void writeNumber(char* dest, double value) {
+    char text[32];
+    for (int precision = 8; precision > 0; precision--) {
+        snprintf(text, sizeof(text), "%.*g", precision, value);
+        if (strlen(text) <= 8) {
+            break;
+        }
+    }
+    writeField(dest, text, 8);
+}
+
+/**
+ * @brief Valor que leerá un lector tras escribir el número en un campo de 8 caracteres
+ */
+static double fieldValue(double value) {
+    char field[8];
+    writeNumber(field, value);
+    return fieldToDouble(field, 8);
+}
+
+/**
+ * @brief Escribe segundos con 6 decimales como máximo, sin ceros finales
+ */
+static void formatSeconds(char* dest, uint32_t size, double seconds) {
+    snprintf(dest, size, "%.6f", seconds);
+    char* end = dest + strlen(dest) - 1;
+    while (*end == '0') {
+        *end-- = '\0';
+    }
+    if (*end == '.') {
+        *end = '\0';
+    }
+}
+
+static bool labelEquals(const char* label, const char* name) {
+    while (*label && *name) {
+        if (tolower((unsigned char)*label) != tolower((unsigned char)*name)) {
+            return false;
+        }
+        label++;
+        name++;
+    }
+    // Ignorar espacios finales de la etiqueta
+    while (*label == ' ') {
+        label++;
+    }
+    return *label == *name;
+}
+
+// ====================
+// EdfReader
+// ====================
+
+EdfReader::EdfReader()
+    : _file(nullptr),
+      _numSignals(0),
+      _numRecords(0),
+      _recordDuration(0.0),
+      _headerBytes(0),
+      _recordSamples(0),
+      _edfPlus(false),
+      _continuous(true),
+      _annotationChannel(-1),
+      _signals(nullptr),
+      _raw(nullptr)
+{
+    _patient[0] = '\0';
+    _recording[0] = '\0';
+    _startDate[0] = '\0';
+    _startTime[0] = '\0';
+}
+
+EdfReader::~EdfReader() {
+    close();
+}
+
+void EdfReader::close() {
+    if (_file != nullptr) {
+        fclose(_file);
+    }
+    delete[] _signals;
+    delete[] _raw;
+    _file = nullptr;
+    _signals = nullptr;
+    _raw = nullptr;
+    _numSignals = 0;
+    _numRecords = 0;
+    _recordSamples = 0;
+    _annotationChannel = -1;
+}
+
+bool EdfReader::open(const char* path) {
+    close();
+
+    _file = fopen(path, "rb");
+    if (_file == nullptr) {
+        return false;
+    }
+    if (!parseHeader()) {
+        close();
+        return false;
+    }
+    _raw = new uint8_t[2 * _recordSamples];
+    return true;
+}
+
+bool EdfReader::parseHeader() {
+    char fixed[EDF_HEADER_BLOCK];
+    if (fread(fixed, 1, EDF_HEADER_BLOCK, _file) != EDF_HEADER_BLOCK || fixed[0] != '0') {
+        return false;
+    }
+
+    readField(_patient, fixed + 8, 80);
+    readField(_recording, fixed + 88, 80);
+    readField(_startDate, fixed + 168, 8);
+    readField(_startTime, fixed + 176, 8);
+    _headerBytes = (uint32_t)fieldToInt(fixed + 184, 8);
+
+    char reserved[45];
+    readField(reserved, fixed + 192, 44);
+    _edfPlus = strncmp(reserved, "EDF+", 4) == 0;
+    _continuous = strncmp(reserved, "EDF+D", 5) != 0;
+
+    long records = fieldToInt(fixed + 236, 8);
+    _recordDuration = fieldToDouble(fixed + 244, 8);
+    long numSignals = fieldToInt(fixed + 252, 4);
+    if (numSignals <= 0 || numSignals > EDF_MAX_SIGNALS ||
+        _headerBytes != (uint32_t)(EDF_HEADER_BLOCK * (numSignals + 1))) {
+        return false;
+    }
+    _numSignals = (uint16_t)numSignals;
+
+    // Campos de canal: cada campo va seguido para todos los canales
+    uint32_t size = EDF_HEADER_BLOCK * _numSignals;
+    char* header = new char[size];
+    if (fread(header, 1, size, _file) != size) {
+        delete[] header;
+        return false;
+    }
+
+    _signals = new EdfSignalInfo[_numSignals];
+    const char* p = header;
+    uint16_t ns = _numSignals;
+    bool ok = true;
+    for (uint16_t i = 0; i < ns; i++) {
+        EdfSignalInfo& info = _signals[i];
+        readField(info.label, p + i * 16, 16);
+        readField(info.transducer, p + ns * 16 + i * 80, 80);
+        readField(info.physicalDimension, p + ns * 96 + i * 8, 8);
+        info.physicalMin = (float32_t)fieldToDouble(p + ns * 104 + i * 8, 8);
+        info.physicalMax = (float32_t)fieldToDouble(p + ns * 112 + i * 8, 8);
+        info.digitalMin = (int32_t)fieldToInt(p + ns * 120 + i * 8, 8);
+        info.digitalMax = (int32_t)fieldToInt(p + ns * 128 + i * 8, 8);
+        readField(info.prefiltering, p + ns * 136 + i * 80, 80);
+        long samples = fieldToInt(p + ns * 216 + i * 8, 8);
+
+        info.isAnnotation = _edfPlus && strcmp(info.label, edfAnnotationLabel) == 0;
+        if (info.isAnnotation && _annotationChannel < 0) {
+            _annotationChannel = (int16_t)i;
+        }
+
+        if (samples <= 0 || info.digitalMax == info.digitalMin) {
+            ok = false;
+            break;
+        }
+        info.samplesPerRecord = (uint32_t)samples;
+        info.scale = (info.physicalMax - info.physicalMin) / (float32_t)(info.digitalMax - info.digitalMin);
+        info.offset = info.physicalMin - info.digitalMin * info.scale;
+        info.recordOffset = _recordSamples;
+        _recordSamples += info.samplesPerRecord;
+    }
+    delete[] header;
+    if (!ok) {
+        return false;
+    }
+
+    // -1 registros: archivo sin cerrar; deducirlo del tamaño
+    if (records < 0) {
+        fseek(_file, 0, SEEK_END);
+#if defined(_WIN32)
+        uint64_t fileSize = (uint64_t)_ftelli64(_file);
+#else
+        uint64_t fileSize = (uint64_t)ftello(_file);
+#endif
+        records = (long)((fileSize - _headerBytes) / (2ULL * _recordSamples));
+    }
+    _numRecords = (uint32_t)records;
+    return true;
+}
+
+float32_t EdfReader::getSampleRate(uint16_t channel) const {
+    if (_recordDuration <= 0.0) {
+        return 0.0f;
+    }
+    return (float32_t)(_signals[channel].samplesPerRecord / _recordDuration);
+}
+
+uint64_t EdfReader::getNumSamples(uint16_t channel) const {
+    return (uint64_t)_numRecords * _signals[channel].samplesPerRecord;
+}
+
+int16_t EdfReader::findSignal(const char* label) const {
+    for (uint16_t i = 0; i < _numSignals; i++) {
+        if (labelEquals(_signals[i].label, label)) {
+            return (int16_t)i;
+        }
+    }
+    return -1;
+}
+
+bool EdfReader::readRaw(uint32_t record, uint32_t sampleOffset, uint32_t count) {
+    uint64_t position = _headerBytes + 2ULL * ((uint64_t)record * _recordSamples + sampleOffset);
+    if (seekTo(_file, position) != 0) {
+        return false;
+    }
+    return fread(_raw, 2, count, _file) == count;
+}
+
+void EdfReader::decode(const EdfSignalInfo& info, const uint8_t* raw, uint32_t count, float32_t* output) const {
+    const float32_t scale = info.scale;
+    const float32_t offset = info.offset;
+    for (uint32_t i = 0; i < count; i++) {
+        int16_t digital = (int16_t)(raw[2 * i] | (raw[2 * i + 1] << 8));
+        output[i] = digital * scale + offset;
+    }
+}
+
+bool EdfReader::readRecord(uint32_t record, float32_t* const* channels) {
+    if (_file == nullptr || record >= _numRecords || !readRaw(record, 0, _recordSamples)) {
+        return false;
+    }
+    for (uint16_t i = 0; i < _numSignals; i++) {
+        const EdfSignalInfo& info = _signals[i];
+        if (channels[i] != nullptr && !info.isAnnotation) {
+            decode(info, _raw + 2 * info.recordOffset, info.samplesPerRecord, channels[i]);
+        }
+    }
+    return true;
+}
+
+uint32_t EdfReader::readChannel(uint16_t channel, uint64_t start, float32_t* output, uint32_t length) {
+    if (_file == nullptr || channel >= _numSignals) {
+        return 0;
+    }
+
+    const EdfSignalInfo& info = _signals[channel];
+    const uint32_t spr = info.samplesPerRecord;
+    uint32_t written = 0;
+
+    // Leer solo el tramo del canal dentro de cada registro
+    while (written < length) {
+        uint64_t sample = start + written;
+        uint32_t record = (uint32_t)(sample / spr);
+        uint32_t within = (uint32_t)(sample % spr);
+        if (record >= _numRecords) {
+            break;
+        }
+
+        uint32_t count = spr - within;
+        if (count > length - written) {
+            count = length - written;
+        }
+        if (!readRaw(record, info.recordOffset + within, count)) {
+            break;
+        }
+        decode(info, _raw, count, output + written);
+        written += count;
+    }
+    return written;
+}
+
+uint32_t EdfReader::parseTal(const uint8_t* bytes, uint32_t length, EdfAnnotationFn callback,
+                             void* context, double* firstOnset) const {
+    uint32_t delivered = 0;
+    uint32_t i = 0;
+    bool first = true;
+    char text[256];
+
+    while (i < length) {
+        if (bytes[i] == 0) {
+            i++;        // Fin de TAL o relleno
+            continue;
+        }
+
+        // Onset: "+12.5" o "-3"
+        uint32_t begin = i;
+        while (i < length && bytes[i] != EDF_TAL_DURATION && bytes[i] != EDF_TAL_SEPARATOR && bytes[i] != 0) {
+            i++;
+        }
+        uint32_t fieldLength = i - begin < sizeof(text) - 1 ? i - begin : sizeof(text) - 1;
+        memcpy(text, bytes + begin, fieldLength);
+        text[fieldLength] = '\0';
+        double onset = strtod(text, nullptr);
+
+        double duration = -1.0;
+        if (i < length && bytes[i] == EDF_TAL_DURATION) {
+            begin = ++i;
+            while (i < length && bytes[i] != EDF_TAL_SEPARATOR && bytes[i] != 0) {
+                i++;
+            }
+            fieldLength = i - begin < sizeof(text) - 1 ? i - begin : sizeof(text) - 1;
+            memcpy(text, bytes + begin, fieldLength);
+            text[fieldLength] = '\0';
+            duration = strtod(text, nullptr);
+        }
+
+        if (first && firstOnset != nullptr) {
+            *firstOnset = onset;
+        }
+        first = false;
+
+        // Textos separados por 0x14; el TAL termina con 0x14 0x00
+        while (i < length && bytes[i] == EDF_TAL_SEPARATOR) {
+            begin = ++i;
+            while (i < length && bytes[i] != EDF_TAL_SEPARATOR && bytes[i] != 0) {
+                i++;
+            }
+            if (i > begin && callback != nullptr) {
+                fieldLength = i - begin < sizeof(text) - 1 ? i - begin : sizeof(text) - 1;
+                memcpy(text, bytes + begin, fieldLength);
+                text[fieldLength] = '\0';
+                callback(onset, duration, text, context);
+                delivered++;
+            }
+            if (i < length && bytes[i] == 0) {
+                break;
+            }
+        }
+    }
+    return delivered;
+}
+
+uint32_t EdfReader::readAnnotations(uint32_t record, EdfAnnotationFn callback, void* context) {
+    uint32_t delivered = 0;
+    if (_file == nullptr || record >= _numRecords) {
+        return 0;
+    }
+    for (uint16_t c = 0; c < _numSignals; c++) {
+        const EdfSignalInfo& info = _signals[c];
+        if (info.isAnnotation && readRaw(record, info.recordOffset, info.samplesPerRecord)) {
+            delivered += parseTal(_raw, 2 * info.samplesPerRecord, callback, context, nullptr);
+        }
+    }
+    return delivered;
+}
+
+double EdfReader::getRecordOnset(uint32_t record) {
+    double onset = (double)record * _recordDuration;
+    if (_annotationChannel >= 0 && record < _numRecords) {
+        const EdfSignalInfo& info = _signals[_annotationChannel];
+        if (readRaw(record, info.recordOffset, info.samplesPerRecord)) {
+            parseTal(_raw, 2 * info.samplesPerRecord, nullptr, nullptr, &onset);
+        }
+    }
+    return onset;
+}
+
+// ====================
+// EdfSource
+// ====================
+
+EdfSource::EdfSource(EdfReader& reader, uint16_t channel, uint64_t start, uint64_t count)
+    : _reader(reader),
+      _channel(channel),
+      _start(start),
+      _end(reader.getNumSamples(channel)),
+      _position(start)
+{
+    if (count != 0 && start + count < _end) {
+        _end = start + count;
+    }
+}
+
+uint32_t EdfSource::read(float32_t* buffer, uint32_t length) {
+    if (_position >= _end) {
+        return 0;
+    }
+    if (length > _end - _position) {
+        length = (uint32_t)(_end - _position);
+    }
+    uint32_t got = _reader.readChannel(_channel, _position, buffer, length);
+    _position += got;
+    return got;
+}
+
+void EdfSource::seekTime(float32_t seconds) {
+    double sample = (double)seconds * _reader.getSampleRate(_channel) + 0.5;
+    seek(sample > 0.0 ? (uint64_t)sample : 0);
+}
+
+// ====================
+// EdfWriter
+// ====================
+
+EdfWriter::EdfWriter()
+    : _file(nullptr),
+      _numSignals(0),
+      _recordDuration(1.0),
+      _edfPlus(false),
+      _continuous(true),
+      _annotationChannel(-1),
+      _headerWritten(false),
+      _numRecords(0),
+      _onsetShift(0.0),
+      _signals(nullptr),
+      _record(nullptr),
+      _recordSamples(0),
+      _filled(nullptr),
+      _annotations(nullptr),
+      _annotationBytes(0)
+{
+    _patient[0] = '\0';
+    _recording[0] = '\0';
+    _startDate[0] = '\0';
+    _startTime[0] = '\0';
+}
+
+EdfWriter::~EdfWriter() {
+    close();
+}
+
+bool EdfWriter::open(const char* path, uint16_t numSignals, double recordDuration, bool edfPlus) {
+    close();
+    if (numSignals == 0 || numSignals + (edfPlus ? 1 : 0) > EDF_MAX_SIGNALS) {
+        return false;
+    }
+
+    _file = fopen(path, "wb");
+    if (_file == nullptr) {
+        return false;
+    }
+
+    _numSignals = numSignals + (edfPlus ? 1 : 0);
+    // Los instantes se calculan con la duración que quedará en la cabecera
+    _recordDuration = fieldValue(recordDuration);
+    _edfPlus = edfPlus;
+    _continuous = true;
+    _annotationChannel = edfPlus ? (int16_t)numSignals : -1;
+    _headerWritten = false;
+    _numRecords = 0;
+    _onsetShift = 0.0;
+    _annotationBytes = 0;
+    _signals = new EdfSignalInfo[_numSignals];
+    _filled = new uint32_t[_numSignals];
+
+    for (uint16_t i = 0; i < _numSignals; i++) {
+        setSignal(i, "", "", -1.0f, 1.0f, 1);
+        _filled[i] = 0;
+    }
+    if (edfPlus) {
+        setSignal(_annotationChannel, edfAnnotationLabel, "", -1.0f, 1.0f, EDF_ANNOTATION_SAMPLES);
+        _signals[_annotationChannel].isAnnotation = true;
+        _annotations = new char[2 * EDF_ANNOTATION_SAMPLES];
+    }
+
+    // Valores de "desconocido" según la especificación EDF+
+    snprintf(_patient, sizeof(_patient), "X X X X");
+    snprintf(_recording, sizeof(_recording), edfPlus ? "Startdate X X X X" : "BioFilterLib");
+    snprintf(_startDate, sizeof(_startDate), "01.01.85");
+    snprintf(_startTime, sizeof(_startTime), "00.00.00");
+    return true;
+}
+
+bool EdfWriter::open(const char* path, const EdfReader& reference) {
+    close();
+    uint16_t total = reference.getNumSignals();
+
+    _file = fopen(path, "wb");
+    if (_file == nullptr) {
+        return false;
+    }
+
+    // Misma disposición de canales, incluida la posición del canal de anotaciones
+    _numSignals = total;
+    _recordDuration = reference.getRecordDuration();
+    _edfPlus = reference.isEdfPlus();
+    _continuous = reference.isContinuous();
+    _annotationChannel = -1;
+    _headerWritten = false;
+    _numRecords = 0;
+    _onsetShift = 0.0;
+    _annotationBytes = 0;
+    _signals = new EdfSignalInfo[_numSignals];
+    _filled = new uint32_t[_numSignals];
+
+    for (uint16_t i = 0; i < _numSignals; i++) {
+        _signals[i] = reference.getSignalInfo(i);
+        _filled[i] = 0;
+        if (_signals[i].isAnnotation && _annotationChannel < 0) {
+            _annotationChannel = (int16_t)i;
+        }
+    }
+    if (_edfPlus && _annotationChannel < 0) {
+        close();
+        return false;
+    }
+    if (_edfPlus) {
+        _annotations = new char[2 * _signals[_annotationChannel].samplesPerRecord];
+    }
+
+    snprintf(_patient, sizeof(_patient), "%s", reference.getPatient());
+    snprintf(_recording, sizeof(_recording), "%s", reference.getRecording());
+    snprintf(_startDate, sizeof(_startDate), "%s", reference.getStartDate());
+    snprintf(_startTime, sizeof(_startTime), "%s", reference.getStartTime());
+    return true;
+}
+
+void EdfWriter::setSignal(uint16_t channel, const char* label, const char* physicalDimension,
+                          float32_t physicalMin, float32_t physicalMax, uint32_t samplesPerRecord,
+                          const char* prefiltering) {
+    if (_headerWritten || channel >= _numSignals) {
+        return;
+    }
+
+    EdfSignalInfo& info = _signals[channel];
+    memset(&info, 0, sizeof(info));
+    snprintf(info.label, sizeof(info.label), "%s", label);
+    snprintf(info.physicalDimension, sizeof(info.physicalDimension), "%s", physicalDimension);
+    snprintf(info.prefiltering, sizeof(info.prefiltering), "%s", prefiltering);
+    info.physicalMin = physicalMin;
+    info.physicalMax = physicalMax;
+    info.digitalMin = -32768;
+    info.digitalMax = 32767;
+    info.samplesPerRecord = samplesPerRecord ? samplesPerRecord : 1;
+}
+
+void EdfWriter::setPatient(const char* patient) {
+    snprintf(_patient, sizeof(_patient), "%s", patient);
+}
+
+void EdfWriter::setRecording(const char* recording) {
+    snprintf(_recording, sizeof(_recording), "%s", recording);
+}
+
+void EdfWriter::setStartDateTime(const char* date, const char* time) {
+    snprintf(_startDate, sizeof(_startDate), "%s", date);
+    snprintf(_startTime, sizeof(_startTime), "%s", time);
+}
+
+void EdfWriter::setRecordOnset(double onset) {
+    _onsetShift = onset - (double)_numRecords * _recordDuration;
+}
+
+bool EdfWriter::addAnnotation(double onset, double duration, const char* text) {
+    if (_file == nullptr || !_edfPlus) {
+        return false;
+    }
+
+    // TAL "+<onset>[\x15<duración>]\x14<texto>\x14\0"
+    char tal[160];
+    char value[32];
+    formatSeconds(value, sizeof(value), fabs(onset));
+    int length = snprintf(tal, sizeof(tal), "%c%s", onset < 0.0 ? '-' : '+', value);
+    if (duration >= 0.0) {
+        formatSeconds(value, sizeof(value), duration);
+        length += snprintf(tal + length, sizeof(tal) - length, "\x15%s", value);
+    }
+    length += snprintf(tal + length, sizeof(tal) - length, "\x14%s\x14", text);
+    if ((uint32_t)length + 1 > sizeof(tal)) {
+        return false;
+    }
+
+    // Sitio también para el TAL de marca de tiempo del registro
+    uint32_t capacity = 2 * _signals[_annotationChannel].samplesPerRecord;
+    if (_annotationBytes + length + 1 + EDF_TAL_ONSET_BYTES > capacity) {
+        return false;
+    }
+    memcpy(_annotations + _annotationBytes, tal, length + 1);
+    _annotationBytes += length + 1;
+    return true;
+}
+
+struct AnnotationCopy {
+    EdfWriter* writer;
+    bool ok;
+};
+
+static void copyAnnotation(double onset, double duration, const char* text, void* context) {
+    AnnotationCopy* copy = (AnnotationCopy*)context;
+    copy->ok = copy->writer->addAnnotation(onset, duration, text) && copy->ok;
+}
+
+bool EdfWriter::copyRecordAnnotations(EdfReader& reader, uint32_t record) {
+    setRecordOnset(reader.getRecordOnset(record));
+    AnnotationCopy copy = {this, true};
+    reader.readAnnotations(record, copyAnnotation, &copy);
+    return copy.ok;
+}
+
+bool EdfWriter::writeHeader() {
+    uint16_t ns = _numSignals;
+    uint32_t size = EDF_HEADER_BLOCK * (ns + 1);
+    char* header = new char[size];
+    memset(header, ' ', size);
+
+    writeField(header, "0", 8);
+    writeField(header + 8, _patient, 80);
+    writeField(header + 88, _recording, 80);
+    writeField(header + 168, _startDate, 8);
+    writeField(header + 176, _startTime, 8);
+    writeNumber(header + 184, size);
+    writeField(header + 192, _edfPlus ? (_continuous ? "EDF+C" : "EDF+D") : "", 44);
+    writeField(header + 236, "-1", 8);          // Se completa en close()
+    writeNumber(header + 244, _recordDuration);
+    writeNumber(header + 252, ns);
+
+    char* p = header + EDF_HEADER_BLOCK;
+    _recordSamples = 0;
+    for (uint16_t i = 0; i < ns; i++) {
+        EdfSignalInfo& info = _signals[i];
+        if (info.physicalMax == info.physicalMin) {
+            info.physicalMax = info.physicalMin + 1.0f;
+        }
+        info.scale = (info.physicalMax - info.physicalMin) / (float32_t)(info.digitalMax - info.digitalMin);
+        info.offset = info.physicalMin - info.digitalMin * info.scale;
+        info.recordOffset = _recordSamples;
+        _recordSamples += info.samplesPerRecord;
+
+        writeField(p + i * 16, info.label, 16);
+        writeField(p + ns * 16 + i * 80, info.transducer, 80);
+        writeField(p + ns * 96 + i * 8, info.physicalDimension, 8);
+        writeNumber(p + ns * 104 + i * 8, info.physicalMin);
+        writeNumber(p + ns * 112 + i * 8, info.physicalMax);
+        writeNumber(p + ns * 120 + i * 8, info.digitalMin);
+        writeNumber(p + ns * 128 + i * 8, info.digitalMax);
+        writeField(p + ns * 136 + i * 80, info.prefiltering, 80);
+        writeNumber(p + ns * 216 + i * 8, info.samplesPerRecord);
+    }
+
+    bool ok = fwrite(header, 1, size, _file) == size;
+    delete[] header;
+
+    _record = new uint8_t[2 * _recordSamples];
+    memset(_record, 0, 2 * _recordSamples);
+    _headerWritten = true;
+    return ok;
+}
+
+bool EdfWriter::flushRecord() {
+    if (_edfPlus) {
+        // TAL de marca de tiempo "+<onset>\x14\x14\0", después las anotaciones y el resto a cero
+        const EdfSignalInfo& info = _signals[_annotationChannel];
+        uint8_t* tal = _record + 2 * info.recordOffset;
+        uint32_t bytes = 2 * info.samplesPerRecord;
+        // Solo es hueco si supera media muestra del canal más rápido; por debajo es
+        // redondeo del instante leído del origen y el registro sigue siendo contiguo
+        uint32_t fastest = 1;
+        for (uint16_t i = 0; i < _numSignals; i++) {
+            if (!_signals[i].isAnnotation && _signals[i].samplesPerRecord > fastest) {
+                fastest = _signals[i].samplesPerRecord;
+            }
+        }
+        if (fabs(_onsetShift) < 0.5 * _recordDuration / fastest) {
+            _onsetShift = 0.0;
+        } else {
+            _continuous = false;
+        }
+        char text[32];
+        formatSeconds(text, sizeof(text), (double)_numRecords * _recordDuration + _onsetShift);
+
+        memset(tal, 0, bytes);
+        int length = snprintf((char*)tal, bytes, "+%s\x14\x14", text);
+        if (length < 0 || (uint32_t)length + 1 + _annotationBytes > bytes) {
+            return false;
+        }
+        memcpy(tal + length + 1, _annotations, _annotationBytes);
+        _annotationBytes = 0;
+    }
+
+    bool ok = fwrite(_record, 2, _recordSamples, _file) == _recordSamples;
+    memset(_record, 0, 2 * _recordSamples);
+    for (uint16_t i = 0; i < _numSignals; i++) {
+        _filled[i] = 0;
+    }
+    _numRecords++;
+    return ok;
+}
+
+static void encodeSamples(const EdfSignalInfo& info, const float32_t* data, uint32_t count, uint8_t* raw) {
+    const float32_t invScale = 1.0f / info.scale;
+    for (uint32_t i = 0; i < count; i++) {
+        float32_t value = roundf((data[i] - info.offset) * invScale);
+        if (value < info.digitalMin) value = (float32_t)info.digitalMin;
+        if (value > info.digitalMax) value = (float32_t)info.digitalMax;
+        int16_t digital = (int16_t)value;
+        raw[2 * i] = (uint8_t)(digital & 0xFF);
+        raw[2 * i + 1] = (uint8_t)((digital >> 8) & 0xFF);
+    }
+}
+
+bool EdfWriter::writeRecord(const float32_t* const* channels) {
+    if (_file == nullptr || (!_headerWritten && !writeHeader())) {
+        return false;
+    }
+    for (uint16_t i = 0; i < _numSignals; i++) {
+        const EdfSignalInfo& info = _signals[i];
+        if (!info.isAnnotation && channels[i] != nullptr) {
+            encodeSamples(info, channels[i], info.samplesPerRecord, _record + 2 * info.recordOffset);
+        }
+    }
+    return flushRecord();
+}
+
+uint32_t EdfWriter::writeSamples(uint16_t channel, const float32_t* data, uint32_t length) {
+    if (_file == nullptr || channel >= _numSignals || _signals[channel].isAnnotation) {
+        return 0;
+    }
+    if (!_headerWritten && !writeHeader()) {
+        return 0;
+    }
+
+    const EdfSignalInfo& info = _signals[channel];
+    uint32_t accepted = 0;
+    while (accepted < length) {
+        uint32_t space = info.samplesPerRecord - _filled[channel];
+        if (space == 0) {
+            break;      // Este canal ya completó el registro: esperar a los demás
+        }
+        uint32_t count = length - accepted < space ? length - accepted : space;
+        encodeSamples(info, data + accepted,
+                      count, _record + 2 * (info.recordOffset + _filled[channel]));
+        _filled[channel] += count;
+        accepted += count;
+
+        bool complete = true;
+        for (uint16_t i = 0; i < _numSignals; i++) {
+            if (!_signals[i].isAnnotation && _filled[i] < _signals[i].samplesPerRecord) {
+                complete = false;
+                break;
+            }
+        }
+        if (complete && !flushRecord()) {
+            break;
+        }
+    }
+    return accepted;
+}
+
+bool EdfWriter::close() {
+    if (_file == nullptr) {
+        return false;
+    }
+
+    bool ok = true;
+    if (!_headerWritten) {
+        ok = writeHeader();
+    } else {
+        // Registro a medias: completar con el código digital del valor físico 0
+        bool partial = false;
+        for (uint16_t i = 0; i < _numSignals; i++) {
+            partial |= (_filled[i] > 0);
+        }
+        if (partial) {
+            const float32_t zero = 0.0f;
+            for (uint16_t i = 0; i < _numSignals; i++) {
+                const EdfSignalInfo& info = _signals[i];
+                if (info.isAnnotation) {
+                    continue;
+                }
+                for (uint32_t n = _filled[i]; n < info.samplesPerRecord; n++) {
+                    encodeSamples(info, &zero, 1, _record + 2 * (info.recordOffset + n));
+                }
+            }
+            ok = flushRecord();
+        }
+    }
+
+    // Número real de registros en la cabecera y EDF+D si algún registro dejó un hueco
+    char count[8];
+    writeNumber(count, _numRecords);
+    ok = ok && fseek(_file, 236, SEEK_SET) == 0 && fwrite(count, 1, 8, _file) == 8;
+    if (_edfPlus && !_continuous) {
+        ok = ok && fseek(_file, 192, SEEK_SET) == 0 && fwrite("EDF+D", 1, 5, _file) == 5;
+    }
+    ok = (fclose(_file) == 0) && ok;
+
+    delete[] _signals;
+    delete[] _record;
+    delete[] _filled;
+    delete[] _annotations;
+    _file = nullptr;
+    _signals = nullptr;
+    _record = nullptr;
+    _filled = nullptr;
+    _annotations = nullptr;
+    _annotationBytes = 0;
+    _numSignals = 0;
+    _headerWritten = false;
+    return ok;
+}
+
+#endif // !ARDUINO
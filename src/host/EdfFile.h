@@ -0,0 +1,371 @@
+/**
+ * @file EdfFile.h
+ * @brief Lectura y escritura en streaming de archivos EDF/EDF+ (solo host)
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @details EDF almacena las señales en registros de datos ("data records") de
+ * duración fija; dentro de cada registro van seguidas las muestras int16 de cada
+ * canal, con un número de muestras por registro propio de cada canal. La
+ * conversión a unidades físicas es lineal: físico = digital × escala + offset,
+ * con escala y offset derivados de los mínimos/máximos físico y digital de la
+ * cabecera.
+ *
+ * - EdfReader decodifica un registro completo a buffers float32_t por canal
+ *   (readRecord) o un tramo de un canal con acceso aleatorio (readChannel), sin
+ *   cargar nunca más de un registro en memoria. Registros de varios GB se leen
+ *   con memoria constante.
+ * - EdfSource expone un canal como SignalSource para processSource().
+ * - EdfWriter escribe la salida filtrada registro a registro, con buffer de un
+ *   registro por canal, y completa el número de registros al cerrar.
+ *
+ * En EDF+ el canal "EDF Annotations" contiene listas de anotaciones con tiempo
+ * (TAL); el lector las entrega con readAnnotations() y el escritor genera el TAL
+ * de marca de tiempo obligatorio en cada registro.
+ *
+ * @par Ejemplo
+ * @code
+ * EdfReader reader;
+ * EdfWriter writer;
+ * reader.open("psg.edf");
+ * writer.open("psg_filtrado.edf", reader);          // misma estructura de canales
+ *
+ * float32_t* channels[EDF_MAX_SIGNALS];             // un buffer por canal, de
+ * ...                                               // getSignalInfo(i).samplesPerRecord
+ * for (uint32_t r = 0; r < reader.getNumRecords(); r++) {
+ *     reader.readRecord(r, channels);
+ *     for (uint16_t i = 0; i < reader.getNumSignals(); i++) {
+ *         if (filters[i] != nullptr) {
+ *             filters[i]->processBuffer(channels[i], channels[i], reader.getSignalInfo(i).samplesPerRecord);
+ *         }
+ *     }
+ *     writer.copyRecordAnnotations(reader, r);      // instante y anotaciones (EDF+)
+ *     writer.writeRecord(channels);
+ * }
+ * writer.close();
+ * @endcode
+ *
+ * @note Solo host. Se admiten EDF, EDF+C y EDF+D (en EDF+D readChannel() concatena
+ * los registros; use getRecordOnset() para conocer el instante real de cada uno).
+ */
+
+#ifndef EDF_FILE_H
+#define EDF_FILE_H
+
+#if !defined(ARDUINO)
+
+#include <arm_math.h>
+#include <stdio.h>
+#include "../utils/SignalSource.h"
+
+/// Máximo de canales por archivo (el formato admite hasta 9999)
+#define EDF_MAX_SIGNALS 256
+
+/**
+ * @brief Descripción de un canal según la cabecera EDF
+ */
+struct EdfSignalInfo {
+    char label[17];             ///< Etiqueta (p. ej. "EEG Fpz-Cz")
+    char transducer[81];
+    char physicalDimension[9];  ///< Unidades (p. ej. "uV")
+    char prefiltering[81];
+    float32_t physicalMin;
+    float32_t physicalMax;
+    int32_t digitalMin;
+    int32_t digitalMax;
+    uint32_t samplesPerRecord;
+    float32_t scale;            ///< Unidades físicas por unidad digital
+    float32_t offset;           ///< físico = digital × scale + offset
+    uint32_t recordOffset;      ///< Primera muestra del canal dentro del registro
+    bool isAnnotation;          ///< Canal "EDF Annotations" (EDF+)
+};
+
+/**
+ * @brief Función que recibe cada anotación EDF+ (onset y duración en segundos;
+ * duration < 0 si no se indica)
+ */
+typedef void (*EdfAnnotationFn)(double onset, double duration, const char* text, void* context);
+
+/**
+ * @class EdfReader
+ * @brief Lector en streaming de archivos EDF/EDF+
+ */
+class EdfReader {
+    public:
+        EdfReader();
+        ~EdfReader();
+
+        /**
+         * @brief Abre el archivo y lee la cabecera
+         * @return true si la cabecera es válida
+         */
+        bool open(const char* path);
+
+        void close();
+
+        bool isOpen() const { return _file != nullptr; }
+
+        /// true en EDF+ (campo reservado "EDF+C" o "EDF+D")
+        bool isEdfPlus() const { return _edfPlus; }
+
+        /// false solo en EDF+D (registros no contiguos en el tiempo)
+        bool isContinuous() const { return _continuous; }
+
+        uint16_t getNumSignals() const { return _numSignals; }
+        uint32_t getNumRecords() const { return _numRecords; }
+        double getRecordDuration() const { return _recordDuration; }
+
+        const EdfSignalInfo& getSignalInfo(uint16_t channel) const { return _signals[channel]; }
+
+        /**
+         * @brief Frecuencia de muestreo de un canal (muestras por registro / duración)
+         */
+        float32_t getSampleRate(uint16_t channel) const;
+
+        /**
+         * @brief Muestras totales de un canal
+         */
+        uint64_t getNumSamples(uint16_t channel) const;
+
+        /**
+         * @brief Busca un canal por su etiqueta (sin distinguir mayúsculas ni espacios finales)
+         * @return Índice del canal o -1
+         */
+        int16_t findSignal(const char* label) const;
+
+        const char* getPatient() const { return _patient; }
+        const char* getRecording() const { return _recording; }
+        const char* getStartDate() const { return _startDate; }    ///< "dd.mm.yy"
+        const char* getStartTime() const { return _startTime; }    ///< "hh.mm.ss"
+
+        /**
+         * @brief Decodifica un registro completo
+         * @param record Índice del registro
+         * @param channels Un buffer por canal con samplesPerRecord muestras; los
+         * punteros nulos (p. ej. el canal de anotaciones) se omiten
+         * @return true si el registro se leyó completo
+         */
+        bool readRecord(uint32_t record, float32_t* const* channels);
+
+        /**
+         * @brief Decodifica un tramo de un canal con acceso aleatorio
+         * @return Muestras escritas (menos que length al llegar al final)
+         */
+        uint32_t readChannel(uint16_t channel, uint64_t start, float32_t* output, uint32_t length);
+
+        /**
+         * @brief Entrega las anotaciones de un registro EDF+
+         * @details El TAL de marca de tiempo (sin texto) no se entrega.
+         * @return Número de anotaciones entregadas
+         */
+        uint32_t readAnnotations(uint32_t record, EdfAnnotationFn callback, void* context = nullptr);
+
+        /**
+         * @brief Instante de inicio del registro en segundos desde el inicio del archivo
+         * @details En EDF+ se lee del TAL de marca de tiempo; en EDF es record × duración.
+         */
+        double getRecordOnset(uint32_t record);
+
+    private:
+        // No copiable: posee el archivo y el buffer de registro
+        EdfReader(const EdfReader&);
+        EdfReader& operator=(const EdfReader&);
+
+        bool parseHeader();
+        bool readRaw(uint32_t record, uint32_t sampleOffset, uint32_t count);
+        void decode(const EdfSignalInfo& info, const uint8_t* raw, uint32_t count, float32_t* output) const;
+        uint32_t parseTal(const uint8_t* bytes, uint32_t length, EdfAnnotationFn callback,
+                          void* context, double* firstOnset) const;
+
+        FILE* _file;
+        uint16_t _numSignals;
+        uint32_t _numRecords;
+        double _recordDuration;
+        uint32_t _headerBytes;
+        uint32_t _recordSamples;    ///< Muestras int16 por registro (todos los canales)
+        bool _edfPlus;
+        bool _continuous;
+        int16_t _annotationChannel;
+
+        char _patient[81];
+        char _recording[81];
+        char _startDate[9];
+        char _startTime[9];
+
+        EdfSignalInfo* _signals;
+        uint8_t* _raw;              ///< Buffer de un registro completo (int16 little-endian)
+};
+
+/**
+ * @class EdfSource
+ * @brief Fuente de señal sobre un canal de un EdfReader
+ *
+ * @details Lee solo las muestras de su canal en cada registro, con la memoria
+ * del bloque pedido.
+ */
+class EdfSource : public SignalSource {
+    public:
+        /**
+         * @param reader Lector abierto (debe seguir vivo mientras se use la fuente)
+         * @param channel Índice del canal
+         * @param start Primera muestra
+         * @param count Muestras a entregar (0 = hasta el final)
+         */
+        EdfSource(EdfReader& reader, uint16_t channel, uint64_t start = 0, uint64_t count = 0);
+
+        uint32_t read(float32_t* buffer, uint32_t length);
+        void rewind() { _position = _start; }
+
+        void seek(uint64_t sample) { _position = sample < _end ? sample : _end; }
+        void seekTime(float32_t seconds);
+
+        uint64_t position() const { return _position; }
+
+    private:
+        EdfReader& _reader;
+        uint16_t _channel;
+        uint64_t _start;
+        uint64_t _end;
+        uint64_t _position;
+};
+
+/**
+ * @class EdfWriter
+ * @brief Escritor en streaming de archivos EDF/EDF+C/EDF+D
+ *
+ * @details Uso: open(), setSignal() por canal, y después writeRecord() o
+ * writeSamples(). La cabecera se escribe con el primer registro y el número de
+ * registros se completa en close(). En EDF+ cada registro lleva su instante de
+ * inicio (por defecto, contiguo al anterior) y las anotaciones añadidas con
+ * addAnnotation(); si algún instante deja un hueco, close() marca el archivo como
+ * EDF+D.
+ */
+class EdfWriter {
+    public:
+        EdfWriter();
+        ~EdfWriter();
+
+        /**
+         * @brief Crea el archivo
+         * @param path Ruta de salida
+         * @param numSignals Canales de datos (sin contar el de anotaciones)
+         * @param recordDuration Duración de cada registro en segundos
+         * @param edfPlus true para EDF+C (añade el canal "EDF Annotations" con índice numSignals)
+         */
+        bool open(const char* path, uint16_t numSignals, double recordDuration, bool edfPlus = false);
+
+        /**
+         * @brief Crea el archivo con los mismos canales (y mismos índices), duración,
+         * datos de paciente y tipo (EDF+C o EDF+D) que un archivo abierto, para guardar
+         * su versión filtrada
+         *
+         * @note Con un origen EDF+D, llame a copyRecordAnnotations() antes de escribir
+         * cada registro para conservar su instante real.
+         */
+        bool open(const char* path, const EdfReader& reference);
+
+        /**
+         * @brief Configura un canal (antes de escribir datos)
+         *
+         * @param channel Índice del canal
+         * @param label Etiqueta (máx. 16 caracteres)
+         * @param physicalDimension Unidades (máx. 8 caracteres)
+         * @param physicalMin Mínimo físico representable (se recorta por debajo)
+         * @param physicalMax Máximo físico representable (se recorta por encima)
+         * @param samplesPerRecord Muestras por registro de datos
+         * @param prefiltering Texto de prefiltrado (p. ej. "HP:0.5Hz LP:40Hz")
+         */
+        void setSignal(uint16_t channel, const char* label, const char* physicalDimension,
+                       float32_t physicalMin, float32_t physicalMax, uint32_t samplesPerRecord,
+                       const char* prefiltering = "");
+
+        void setPatient(const char* patient);
+        void setRecording(const char* recording);
+
+        /**
+         * @brief Fecha y hora de inicio ("dd.mm.yy", "hh.mm.ss")
+         */
+        void setStartDateTime(const char* date, const char* time);
+
+        /**
+         * @brief Escribe un registro completo
+         * @param channels Un buffer por canal con samplesPerRecord muestras, con los
+         * mismos índices que setSignal(); la entrada del canal de anotaciones se ignora
+         * (puede ser nula), así que sirve el mismo array que EdfReader::readRecord()
+         */
+        bool writeRecord(const float32_t* const* channels);
+
+        /**
+         * @brief Instante de inicio (s desde el inicio del archivo) del registro en
+         * construcción, en EDF+; sin llamarla, el registro sigue al anterior
+         */
+        void setRecordOnset(double onset);
+
+        /**
+         * @brief Añade una anotación EDF+ al registro en construcción
+         *
+         * @param onset Inicio en segundos desde el inicio del archivo
+         * @param duration Duración en segundos (< 0 si no se indica)
+         * @return false si no es EDF+ o no cabe en el canal de anotaciones del registro
+         */
+        bool addAnnotation(double onset, double duration, const char* text);
+
+        /**
+         * @brief Copia el instante de inicio y las anotaciones de un registro de otro
+         * archivo EDF+ al registro en construcción
+         * @return false si alguna anotación no cabe
+         */
+        bool copyRecordAnnotations(EdfReader& reader, uint32_t record);
+
+        /**
+         * @brief Añade muestras de un canal; el registro se escribe cuando todos los
+         * canales lo han completado
+         * @return Muestras aceptadas (menos que length si el canal va un registro
+         * por delante de los demás)
+         */
+        uint32_t writeSamples(uint16_t channel, const float32_t* data, uint32_t length);
+
+        /**
+         * @brief Completa el último registro con el valor físico 0, actualiza la
+         * cabecera y cierra
+         */
+        bool close();
+
+        bool isOpen() const { return _file != nullptr; }
+        uint32_t getNumRecords() const { return _numRecords; }
+
+    private:
+        // No copiable: posee el archivo y los buffers
+        EdfWriter(const EdfWriter&);
+        EdfWriter& operator=(const EdfWriter&);
+
+        bool writeHeader();
+        bool flushRecord();
+
+        FILE* _file;
+        uint16_t _numSignals;       ///< Canales, incluido el de anotaciones
+        double _recordDuration;     ///< Tal como queda en el campo de 8 caracteres de la cabecera
+        bool _edfPlus;
+        bool _continuous;           ///< Pasa a false si un registro deja un hueco
+        int16_t _annotationChannel;
+        bool _headerWritten;
+        uint32_t _numRecords;
+        double _onsetShift;         ///< Huecos acumulados (s): el registro n empieza en n × duración + _onsetShift
+
+        char _patient[81];
+        char _recording[81];
+        char _startDate[9];
+        char _startTime[9];
+
+        EdfSignalInfo* _signals;
+        uint8_t* _record;           ///< Registro en construcción (int16 little-endian)
+        uint32_t _recordSamples;
+        uint32_t* _filled;          ///< Muestras ya escritas de cada canal en el registro
+        char* _annotations;         ///< TAL con texto del registro en construcción
+        uint32_t _annotationBytes;
+};
+
+#endif // !ARDUINO
+
+#endif // EDF_FILE_H
@@ -0,0 +1,143 @@
+/**
+ * @file MappedFile.cpp
+ * @brief Implementación de la proyección de archivos en memoria (solo host)
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ */
+
+#if !defined(ARDUINO)
+
+#include "MappedFile.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile()
+    : _data(nullptr),
+      _size(0),
+      _open(false)
+#if defined(_WIN32)
+      , _file(nullptr),
+      _mapping(nullptr)
+#endif
+{
+}
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+#if defined(_WIN32)
+
+bool MappedFile::open(const char* path) {
+    close();
+
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL,
+                              OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        CloseHandle(file);
+        return false;
+    }
+
+    _file = file;
+    _size = (size_t)size.QuadPart;
+    _open = true;
+
+    // Un archivo vacío no se puede proyectar pero es válido (0 muestras)
+    if (_size == 0) {
+        return true;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping == NULL) {
+        close();
+        return false;
+    }
+    _mapping = mapping;
+
+    _data = (const uint8_t*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (_data == nullptr) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void MappedFile::close() {
+    if (_data != nullptr) {
+        UnmapViewOfFile(_data);
+    }
+    if (_mapping != nullptr) {
+        CloseHandle((HANDLE)_mapping);
+    }
+    if (_file != nullptr) {
+        CloseHandle((HANDLE)_file);
+    }
+    _data = nullptr;
+    _mapping = nullptr;
+    _file = nullptr;
+    _size = 0;
+    _open = false;
+}
+
+#else
+
+bool MappedFile::open(const char* path) {
+    close();
+
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        ::close(fd);
+        return false;
+    }
+
+    _size = (size_t)info.st_size;
+    _open = true;
+
+    if (_size > 0) {
+        void* data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {
+            ::close(fd);
+            _size = 0;
+            _open = false;
+            return false;
+        }
+        // Lectura mayoritariamente secuencial: pedir lectura anticipada agresiva
+        madvise(data, _size, MADV_SEQUENTIAL);
+        _data = (const uint8_t*)data;
+    }
+
+    // La proyección sigue siendo válida tras cerrar el descriptor
+    ::close(fd);
+    return true;
+}
+
+void MappedFile::close() {
+    if (_data != nullptr) {
+        munmap((void*)_data, _size);
+    }
+    _data = nullptr;
+    _size = 0;
+    _open = false;
+}
+
+#endif
+
+#endif // !ARDUINO
@@ -0,0 +1,61 @@
+/**
+ * @file MappedFile.h
+ * @brief Archivo proyectado en memoria de solo lectura (solo host)
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @details Envoltorio mínimo sobre mmap (POSIX) y CreateFileMapping (Windows). El
+ * sistema operativo carga las páginas bajo demanda, de modo que un registro de
+ * varios GB se recorre a velocidad de disco sin copiarlo a un buffer propio y
+ * el acceso aleatorio por posición es inmediato.
+ *
+ * @note Todo el directorio src/host/ se excluye de la compilación en Arduino.
+ */
+
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#if !defined(ARDUINO)
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @class MappedFile
+ * @brief Proyección de un archivo completo en memoria
+ */
+class MappedFile {
+    public:
+        MappedFile();
+        ~MappedFile();
+
+        /**
+         * @brief Proyecta el archivo indicado (cierra el anterior si lo hubiera)
+         * @return true si el archivo existe y se pudo proyectar
+         */
+        bool open(const char* path);
+
+        void close();
+
+        bool isOpen() const { return _open; }
+        const uint8_t* data() const { return _data; }
+        size_t size() const { return _size; }
+
+    private:
+        // No copiable: la proyección pertenece a un único objeto
+        MappedFile(const MappedFile&);
+        MappedFile& operator=(const MappedFile&);
+
+        const uint8_t* _data;
+        size_t _size;
+        bool _open;
+#if defined(_WIN32)
+        void* _file;
+        void* _mapping;
+#endif
+};
+
+#endif // !ARDUINO
+
+#endif // MAPPED_FILE_H
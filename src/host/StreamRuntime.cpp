@@ -0,0 +1,270 @@
+/**
+ * @file StreamRuntime.cpp
+ * @brief Implementación del runtime multihilo de flujos (solo host)
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @see StreamRuntime.h para el modelo de propiedad y robo de trabajo
+ */
+
+#if !defined(ARDUINO)
+
+#include "StreamRuntime.h"
+#include <chrono>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+static int64_t monotonicNanos() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+StreamRuntime::StreamRuntime(uint16_t numWorkers, uint32_t maxStreams)
+    : _numWorkers(numWorkers),
+      _maxStreams(maxStreams),
+      _numStreams(0),
+      _batchBlocks(8),
+      _affinity(false),
+      _running(false),
+      _remaining(0),
+      _stop(false),
+      _startTime(0),
+      _endTime(0)
+{
+    if (_numWorkers == 0) {
+        _numWorkers = (uint16_t)std::thread::hardware_concurrency();
+        if (_numWorkers == 0) {
+            _numWorkers = 1;
+        }
+    }
+
+    _slots = new Slot[_maxStreams];
+    _workers = new Worker[_numWorkers];
+    for (uint16_t w = 0; w < _numWorkers; w++) {
+        _workers[w].samples = 0;
+        _workers[w].load = 0;
+        _workers[w].steals = 0;
+    }
+}
+
+StreamRuntime::~StreamRuntime() {
+    stop();
+    delete[] _slots;
+    delete[] _workers;
+}
+
+int32_t StreamRuntime::addStream(RuntimeStream* stream) {
+    if (_running || stream == nullptr || _numStreams >= _maxStreams) {
+        return -1;
+    }
+
+    // Reparto inicial: al trabajador con menos flujos
+    uint16_t owner = 0;
+    for (uint16_t w = 1; w < _numWorkers; w++) {
+        if (_workers[w].load < _workers[owner].load) {
+            owner = w;
+        }
+    }
+
+    Slot& slot = _slots[_numStreams];
+    slot.stream = stream;
+    slot.owner = owner;
+    slot.busy = false;
+    slot.done = stream->finished();
+    if (!slot.done) {
+        _workers[owner].load++;
+        _remaining++;
+    }
+    return (int32_t)_numStreams++;
+}
+
+bool StreamRuntime::start() {
+    if (_running) {
+        return false;
+    }
+    _running = true;
+    _stop = false;
+    _startTime = monotonicNanos();
+    _endTime = 0;
+
+    for (uint16_t w = 0; w < _numWorkers; w++) {
+        _workers[w].thread = std::thread(&StreamRuntime::workerLoop, this, w);
+#if defined(__linux__)
+        if (_affinity) {
+            unsigned cores = std::thread::hardware_concurrency();
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(w % (cores ? cores : 1), &set);
+            pthread_setaffinity_np(_workers[w].thread.native_handle(), sizeof(set), &set);
+        }
+#endif
+    }
+    return true;
+}
+
+void StreamRuntime::join() {
+    for (uint16_t w = 0; w < _numWorkers; w++) {
+        if (_workers[w].thread.joinable()) {
+            _workers[w].thread.join();
+        }
+    }
+    if (_running) {
+        _endTime = monotonicNanos();
+        _running = false;
+    }
+}
+
+void StreamRuntime::wait() {
+    join();
+}
+
+void StreamRuntime::stop() {
+    _stop.store(true, std::memory_order_relaxed);
+    join();
+}
+
+bool StreamRuntime::run() {
+    if (!start()) {
+        return false;
+    }
+    wait();
+    return true;
+}
+
+// ====================
+// Trabajadores
+// ====================
+
+void StreamRuntime::workerLoop(uint16_t worker) {
+    Worker& self = _workers[worker];
+
+    while (!_stop.load(std::memory_order_relaxed) &&
+           _remaining.load(std::memory_order_acquire) > 0) {
+        uint64_t processed = 0;
+
+        for (uint32_t i = 0; i < _numStreams; i++) {
+            Slot& slot = _slots[i];
+            if (slot.owner.load(std::memory_order_relaxed) != worker ||
+                slot.done.load(std::memory_order_relaxed)) {
+                continue;
+            }
+            // Acceso exclusivo al flujo durante el lote (acquire: ve el estado que dejó
+            // el dueño anterior si el flujo acaba de ser robado)
+            if (slot.busy.exchange(true, std::memory_order_acquire)) {
+                continue;
+            }
+            if (slot.owner.load(std::memory_order_relaxed) != worker) {
+                slot.busy.store(false, std::memory_order_release);
+                continue;
+            }
+
+            uint32_t count = slot.stream->process(_batchBlocks);
+            processed += count;
+
+            if (slot.stream->finished()) {
+                slot.done.store(true, std::memory_order_relaxed);
+                self.load.fetch_sub(1, std::memory_order_relaxed);
+                _remaining.fetch_sub(1, std::memory_order_release);
+            }
+            slot.busy.store(false, std::memory_order_release);
+        }
+
+        if (processed > 0) {
+            self.samples.fetch_add(processed, std::memory_order_relaxed);
+        } else if (!steal(worker)) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+bool StreamRuntime::steal(uint16_t worker) {
+    // Víctima: el trabajador con más flujos pendientes
+    uint16_t victim = worker;
+    uint32_t victimLoad = 0;
+    for (uint16_t w = 0; w < _numWorkers; w++) {
+        uint32_t load = _workers[w].load.load(std::memory_order_relaxed);
+        if (w != worker && load > victimLoad) {
+            victim = w;
+            victimLoad = load;
+        }
+    }
+
+    // Solo compensa si la víctima queda con al menos tantos flujos como el ladrón
+    uint32_t ownLoad = _workers[worker].load.load(std::memory_order_relaxed);
+    if (victim == worker || victimLoad < ownLoad + 2) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < _numStreams; i++) {
+        Slot& slot = _slots[i];
+        if (slot.done.load(std::memory_order_relaxed) ||
+            slot.owner.load(std::memory_order_relaxed) != victim) {
+            continue;
+        }
+        // Cambio de dueño con el flujo parado: el dueño no puede terminarlo (y restar
+        // su carga) entre la comprobación de done y el traspaso
+        if (slot.busy.exchange(true, std::memory_order_acquire)) {
+            continue;
+        }
+        bool stolen = !slot.done.load(std::memory_order_relaxed) &&
+                      slot.owner.load(std::memory_order_relaxed) == victim;
+        if (stolen) {
+            slot.owner.store(worker, std::memory_order_relaxed);
+            _workers[victim].load.fetch_sub(1, std::memory_order_relaxed);
+            _workers[worker].load.fetch_add(1, std::memory_order_relaxed);
+            _workers[worker].steals.fetch_add(1, std::memory_order_relaxed);
+        }
+        slot.busy.store(false, std::memory_order_release);
+        if (stolen) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// ====================
+// Estadísticas
+// ====================
+
+uint16_t StreamRuntime::getStreamOwner(uint32_t index) const {
+    return (index < _numStreams) ? _slots[index].owner.load(std::memory_order_relaxed) : 0;
+}
+
+uint64_t StreamRuntime::getSamplesProcessed() const {
+    uint64_t total = 0;
+    for (uint16_t w = 0; w < _numWorkers; w++) {
+        total += _workers[w].samples.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+uint64_t StreamRuntime::getWorkerSamples(uint16_t worker) const {
+    return (worker < _numWorkers) ? _workers[worker].samples.load(std::memory_order_relaxed) : 0;
+}
+
+uint32_t StreamRuntime::getSteals() const {
+    uint32_t total = 0;
+    for (uint16_t w = 0; w < _numWorkers; w++) {
+        total += _workers[w].steals.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+double StreamRuntime::getElapsedSeconds() const {
+    if (_startTime == 0) {
+        return 0.0;
+    }
+    int64_t end = (_endTime != 0) ? _endTime : monotonicNanos();
+    return (end - _startTime) * 1e-9;
+}
+
+double StreamRuntime::getThroughput() const {
+    double seconds = getElapsedSeconds();
+    return (seconds > 0.0) ? getSamplesProcessed() / seconds : 0.0;
+}
+
+#endif // !ARDUINO
@@ -0,0 +1,284 @@
+/**
+ * @file StreamRuntime.h
+ * @brief Runtime multihilo para filtrar muchos flujos de paciente en un servidor (solo host)
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @details Una central de monitorización filtra cientos de ECG de cabecera con los
+ * mismos diseños de filtro. StreamRuntime reparte los flujos entre un conjunto de
+ * hilos trabajadores:
+ * - Cada flujo (RuntimeStream) tiene un único dueño en cada momento. Su estado
+ *   (FIRFilter, IIRFilter, LMSFilter, buffers de bloque) solo lo toca ese hilo, que lo
+ *   mantiene en su caché; los buffers de bloque se reservan en el primer uso, desde el
+ *   propio trabajador.
+ * - Los flujos se procesan por lotes de varios bloques seguidos (setBatchBlocks()), lo
+ *   que amortiza el cambio de flujo y la llamada virtual (una por bloque, no por muestra).
+ * - Robo de trabajo: un trabajador sin nada que hacer toma la propiedad de un flujo
+ *   del trabajador más cargado. El flujo migra una vez y vuelve a quedar fijo en su
+ *   nuevo dueño, en lugar de rotar entre hilos.
+ * - Sin mutex: la propiedad y el acceso exclusivo a cada flujo se gestionan con
+ *   operaciones atómicas por lote. El camino por muestra (processBuffer) no tiene
+ *   ninguna sincronización.
+ *
+ * @par Ejemplo
+ * @code
+ * StreamRuntime runtime(8);                            // 8 trabajadores
+ * for (uint32_t i = 0; i < numBeds; i++) {
+ *     // Cada cama: su fuente, su cadena de filtros y un sumidero
+ *     streams[i] = new FilterStream<MyChain>(i, *sources[i], *chains[i], 256, onBlock, ctx);
+ *     runtime.addStream(streams[i]);
+ * }
+ * runtime.run();                                       // Hasta agotar todas las fuentes
+ * printf("%.1f Msps\n", runtime.getThroughput() / 1e6);
+ * @endcode
+ *
+ * @note Solo host (C++11, std::thread). En Linux los trabajadores pueden fijarse a
+ * núcleos concretos con setCpuAffinity(true).
+ */
+
+#ifndef STREAM_RUNTIME_H
+#define STREAM_RUNTIME_H
+
+#if !defined(ARDUINO)
+
+#include <arm_math.h>
+#include <atomic>
+#include <thread>
+#include "../utils/SignalSource.h"
+#include "../BioFilterLibConfig.h"
+
+/**
+ * @class RuntimeStream
+ * @brief Flujo que el runtime puede procesar: una fuente, sus filtros y un destino
+ */
+class RuntimeStream {
+    public:
+        RuntimeStream() : _finished(false) {}
+        virtual ~RuntimeStream() {}
+
+        /**
+         * @brief Procesa hasta maxBlocks bloques
+         * @return Muestras procesadas (0 si no había datos disponibles)
+         */
+        virtual uint32_t process(uint32_t maxBlocks) = 0;
+
+        /**
+         * @brief La fuente se ha agotado; el runtime no volverá a llamar a process()
+         */
+        bool finished() const { return _finished; }
+
+    protected:
+        bool _finished;
+};
+
+/**
+ * @class FilterStream
+ * @brief Adapta una SignalSource y un filtro (o FilterChain) a RuntimeStream
+ *
+ * @tparam Filter Cualquier clase con processBuffer(in, out, length)
+ */
+template <class Filter>
+class FilterStream : public RuntimeStream {
+    public:
+        /**
+         * @brief Recibe cada bloque filtrado: identificador del flujo, datos y contexto
+         */
+        typedef void (*BlockSink)(uint32_t streamId, const float32_t* block, uint32_t length, void* context);
+
+        /**
+         * @param streamId Identificador que se pasa al sumidero
+         * @param source Fuente de muestras del flujo
+         * @param filter Filtro propio de este flujo (no compartir entre flujos)
+         * @param blockSize Muestras por bloque
+         * @param sink Destino de los bloques filtrados (nullptr = descartar)
+         * @param context Puntero opaco para el sumidero
+         * @param live true si la fuente es en tiempo real: read() == 0 significa
+         * "aún no hay datos" en lugar de fin de señal
+         */
+        FilterStream(uint32_t streamId, SignalSource& source, Filter& filter, uint16_t blockSize,
+                     BlockSink sink = nullptr, void* context = nullptr, bool live = false)
+            : _id(streamId),
+              _source(source),
+              _filter(filter),
+              _blockSize(blockSize ? blockSize : 1),
+              _sink(sink),
+              _context(context),
+              _live(live),
+              _in(nullptr),
+              _out(nullptr)
+        {
+        }
+
+        ~FilterStream() {
+            delete[] _in;
+            delete[] _out;
+        }
+
+        uint32_t process(uint32_t maxBlocks) {
+            // Primer uso: los buffers se reservan (y se tocan) desde el trabajador dueño
+            if (_in == nullptr) {
+                _in = new float32_t[_blockSize];
+                _out = new float32_t[_blockSize];
+            }
+
+            uint32_t total = 0;
+            for (uint32_t b = 0; b < maxBlocks; b++) {
+                uint32_t count = _source.read(_in, _blockSize);
+                if (count == 0) {
+                    _finished = !_live;
+                    break;
+                }
+                _filter.processBuffer(_in, _out, count);
+                if (_sink != nullptr) {
+                    _sink(_id, _out, count, _context);
+                }
+                total += count;
+            }
+            return total;
+        }
+
+    private:
+        // No copiable: posee los buffers de bloque
+        FilterStream(const FilterStream&);
+        FilterStream& operator=(const FilterStream&);
+
+        uint32_t _id;
+        SignalSource& _source;
+        Filter& _filter;
+        uint16_t _blockSize;
+        BlockSink _sink;
+        void* _context;
+        bool _live;
+        float32_t* _in;
+        float32_t* _out;
+};
+
+/**
+ * @class StreamRuntime
+ * @brief Conjunto de hilos que procesa flujos fijados a un trabajador, con robo de trabajo
+ */
+class StreamRuntime {
+    public:
+        /**
+         * @param numWorkers Hilos trabajadores (0 = uno por núcleo)
+         * @param maxStreams Flujos como máximo
+         */
+        StreamRuntime(uint16_t numWorkers = 0, uint32_t maxStreams = 1024);
+        ~StreamRuntime();
+
+        /**
+         * @brief Registra un flujo (antes de start()). Se asigna al trabajador menos cargado.
+         * @return Índice del flujo, o -1 si no caben más o el runtime está en marcha
+         */
+        int32_t addStream(RuntimeStream* stream);
+
+        /**
+         * @brief Bloques seguidos de un flujo antes de pasar al siguiente (por defecto 8)
+         */
+        void setBatchBlocks(uint16_t blocks) { _batchBlocks = blocks ? blocks : 1; }
+
+        /**
+         * @brief Fija cada trabajador a un núcleo (solo Linux; por defecto desactivado)
+         */
+        void setCpuAffinity(bool enable) { _affinity = enable; }
+
+        /**
+         * @brief Lanza los trabajadores
+         */
+        bool start();
+
+        /**
+         * @brief Espera a que se agoten todos los flujos (los flujos live no terminan: usar stop())
+         */
+        void wait();
+
+        /**
+         * @brief Detiene los trabajadores tras el lote en curso
+         */
+        void stop();
+
+        /**
+         * @brief start() + wait()
+         */
+        bool run();
+
+        uint16_t getNumWorkers() const { return _numWorkers; }
+        uint32_t getNumStreams() const { return _numStreams; }
+
+        /**
+         * @brief Trabajador dueño actual de un flujo
+         */
+        uint16_t getStreamOwner(uint32_t index) const;
+
+        uint64_t getSamplesProcessed() const;
+        uint64_t getWorkerSamples(uint16_t worker) const;
+
+        /**
+         * @brief Flujos que han cambiado de trabajador por robo
+         */
+        uint32_t getSteals() const;
+
+        /**
+         * @brief Segundos entre start() y el final (o hasta ahora si sigue en marcha)
+         */
+        double getElapsedSeconds() const;
+
+        /**
+         * @brief Muestras por segundo en total
+         */
+        double getThroughput() const;
+
+    private:
+        // No copiable: posee los hilos
+        StreamRuntime(const StreamRuntime&);
+        StreamRuntime& operator=(const StreamRuntime&);
+
+        /**
+         * @brief Estado compartido de un flujo
+         *
+         * @details El relleno separa los campos de dos flujos consecutivos al menos una
+         * línea de caché, sin depender de la alineación de new[] (C++11).
+         */
+        struct Slot {
+            RuntimeStream* stream;
+            std::atomic<uint16_t> owner;
+            std::atomic<bool> busy;        ///< Un trabajador está procesando el flujo
+            std::atomic<bool> done;
+            char padding[BIOFILTERLIB_CACHE_LINE];
+        };
+
+        /**
+         * @brief Estado de un trabajador (contadores escritos solo por él, salvo al robar)
+         */
+        struct Worker {
+            std::thread thread;
+            std::atomic<uint64_t> samples;
+            std::atomic<uint32_t> load;     ///< Flujos sin terminar de los que es dueño
+            std::atomic<uint32_t> steals;
+            char padding[BIOFILTERLIB_CACHE_LINE];
+        };
+
+        void workerLoop(uint16_t worker);
+        bool steal(uint16_t worker);
+        void join();
+
+        uint16_t _numWorkers;
+        uint32_t _maxStreams;
+        uint32_t _numStreams;
+        uint16_t _batchBlocks;
+        bool _affinity;
+        bool _running;
+
+        Slot* _slots;
+        Worker* _workers;
+        std::atomic<uint32_t> _remaining;   ///< Flujos sin terminar
+        std::atomic<bool> _stop;
+
+        int64_t _startTime;                 ///< Nanosegundos (reloj monótono)
+        int64_t _endTime;
+};
+
+#endif // !ARDUINO
+
+#endif // STREAM_RUNTIME_H
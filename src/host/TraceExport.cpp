@@ -0,0 +1,130 @@
+/**
+ * @file TraceExport.cpp
+ * @brief Implementación del escritor de Chrome trace (solo host)
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @see TraceExport.h para el formato de salida
+ * @see https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU
+ */
+
+#if !defined(ARDUINO)
+
+#include "TraceExport.h"
+
+ChromeTraceWriter::ChromeTraceWriter()
+    : _file(nullptr),
+      _events(0),
+      _first(true),
+      _started(false),
+      _lastStamp(0),
+      _time(0),
+      _pid(1)
+{
+}
+
+ChromeTraceWriter::~ChromeTraceWriter() {
+    close();
+}
+
+bool ChromeTraceWriter::open(const char* path, const char* processName) {
+    close();
+    _file = fopen(path, "w");
+    if (_file == nullptr) {
+        return false;
+    }
+    _events = 0;
+    _first = true;
+    _started = false;
+    _time = 0;
+
+    fprintf(_file, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    separator();
+    fprintf(_file, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%u,\"args\":{\"name\":", _pid);
+    writeString(processName);
+    fprintf(_file, "}}");
+    return true;
+}
+
+void ChromeTraceWriter::setThreadName(uint32_t thread, const char* name) {
+    if (_file == nullptr) {
+        return;
+    }
+    separator();
+    fprintf(_file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%u,\"tid\":%u,\"args\":{\"name\":",
+            _pid, thread);
+    writeString(name);
+    fprintf(_file, "}}");
+}
+
+uint32_t ChromeTraceWriter::drain(TraceBuffer& trace, uint32_t thread) {
+    if (_file == nullptr) {
+        return 0;
+    }
+    uint32_t written = 0;
+    TraceEvent event;
+    while (trace.pop(event)) {
+        write(event, trace.getTrackName(event.track), thread);
+        written++;
+    }
+    return written;
+}
+
+void ChromeTraceWriter::write(const TraceEvent& event, const char* name, uint32_t thread) {
+    if (_file == nullptr) {
+        return;
+    }
+    // Desenrollado: diferencia con signo respecto al evento anterior
+    if (_started) {
+        _time += (int32_t)(event.timestamp - _lastStamp);
+    }
+    _started = true;
+    _lastStamp = event.timestamp;
+
+    separator();
+    fprintf(_file, "{\"name\":");
+    writeString(name);
+    fprintf(_file, ",\"cat\":\"filter\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":%u,\"tid\":%u",
+            event.phase == TRACE_BEGIN ? 'B' : 'E', _time * (1e6 / CycleCounter::frequency()), _pid, thread);
+    if (event.phase == TRACE_BEGIN) {
+        fprintf(_file, ",\"args\":{\"length\":%u}", event.length);
+    }
+    fprintf(_file, "}");
+    _events++;
+}
+
+bool ChromeTraceWriter::close() {
+    if (_file == nullptr) {
+        return true;
+    }
+    fprintf(_file, "\n]}\n");
+    bool ok = (ferror(_file) == 0);
+    ok = (fclose(_file) == 0) && ok;
+    _file = nullptr;
+    return ok;
+}
+
+void ChromeTraceWriter::separator() {
+    if (!_first) {
+        fputs(",\n", _file);
+    }
+    _first = false;
+}
+
+void ChromeTraceWriter::writeString(const char* text) {
+    fputc('"', _file);
+    for (const char* c = text; *c != '\0'; c++) {
+        if (*c == '"' || *c == '\\') {
+            fputc('\\', _file);
+            fputc(*c, _file);
+        } else if ((unsigned char)*c < 0x20) {
+            fprintf(_file, "\\u%04x", (unsigned char)*c);
+        } else {
+            fputc(*c, _file);
+        }
+    }
+    fputc('"', _file);
+}
+
+#endif // !ARDUINO
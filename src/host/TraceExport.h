@@ -0,0 +1,108 @@
+/**
+ * @file TraceExport.h
+ * @brief Exportación de TraceBuffer a JSON de Chrome trace / Perfetto (solo host)
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @details ChromeTraceWriter vacía uno o varios TraceBuffer a un archivo en el
+ * formato "Trace Event" de Chrome: un objeto {"traceEvents": [...]} con un evento
+ * "B" (inicio) y otro "E" (fin) por llamada. chrome://tracing y ui.perfetto.dev lo
+ * muestran como una línea de tiempo con una fila por hilo y las etapas anidadas.
+ *
+ * - Las marcas de CycleCounter son de 32 bits y se desbordan (51 s a 84 MHz, 4.3 s
+ *   en PC). El escritor las convierte a 64 bits sumando la diferencia con signo
+ *   entre eventos consecutivos, así que basta con vaciar el anillo más a menudo que
+ *   la mitad de ese periodo.
+ * - Los tiempos se escriben en microsegundos desde el primer evento; la longitud
+ *   del bloque va en args.length del evento de inicio.
+ * - drain() puede llamarse tantas veces como haga falta durante la reproducción:
+ *   el anillo no necesita tener el tamaño de toda la traza.
+ *
+ * @par Ejemplo
+ * @code
+ * ChromeTraceWriter writer;
+ * writer.open("pipeline.json");
+ * for (...) {
+ *     chain.processBuffer(block, block, 32);
+ *     writer.drain(trace);                       // hilo 1
+ * }
+ * writer.close();                                // abrir en ui.perfetto.dev
+ * @endcode
+ *
+ * @note Solo host. Requiere BIOFILTERLIB_TRACE = 1 para que haya eventos.
+ */
+
+#ifndef TRACE_EXPORT_H
+#define TRACE_EXPORT_H
+
+#if !defined(ARDUINO)
+
+#include <arm_math.h>
+#include <stdio.h>
+#include "../utils/Trace.h"
+
+/**
+ * @class ChromeTraceWriter
+ * @brief Escritor en streaming de eventos de traza en JSON de Chrome trace
+ */
+class ChromeTraceWriter {
+    public:
+        ChromeTraceWriter();
+        ~ChromeTraceWriter();
+
+        /**
+         * @brief Crea el archivo y escribe la cabecera
+         * @param processName Nombre del proceso en el visor
+         */
+        bool open(const char* path, const char* processName = "BioFilterLib");
+
+        /**
+         * @brief Escribe todos los eventos pendientes del anillo
+         *
+         * @param thread Fila del visor (un TraceBuffer por hilo de procesamiento)
+         * @return Eventos escritos
+         */
+        uint32_t drain(TraceBuffer& trace, uint32_t thread = 1);
+
+        /**
+         * @brief Escribe un evento suelto (p. ej. recibido de la placa por Serial)
+         *
+         * @param name Nombre de la etapa (TraceBuffer::getTrackName())
+         */
+        void write(const TraceEvent& event, const char* name, uint32_t thread = 1);
+
+        /**
+         * @brief Nombra una fila del visor
+         */
+        void setThreadName(uint32_t thread, const char* name);
+
+        /**
+         * @brief Cierra el array de eventos y el archivo
+         * @return false si hubo errores de escritura
+         */
+        bool close();
+
+        bool isOpen() const { return _file != nullptr; }
+        uint32_t getEventCount() const { return _events; }
+
+    private:
+        // No copiable: posee el archivo
+        ChromeTraceWriter(const ChromeTraceWriter&);
+        ChromeTraceWriter& operator=(const ChromeTraceWriter&);
+
+        void separator();
+        void writeString(const char* text);
+
+        FILE* _file;
+        uint32_t _events;
+        bool _first;            ///< Ningún elemento escrito aún en traceEvents
+        bool _started;          ///< Ya hay marca de referencia
+        uint32_t _lastStamp;    ///< Última marca de 32 bits leída
+        int64_t _time;          ///< Marca desenrollada, en cuentas desde el primer evento
+        uint32_t _pid;
+};
+
+#endif // !ARDUINO
+
+#endif // TRACE_EXPORT_H
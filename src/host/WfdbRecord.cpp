@@ -0,0 +1,515 @@
+/**
+ * @file WfdbRecord.cpp
+ * @brief Implementación del lector de registros WFDB (solo host)
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @see WfdbRecord.h para documentación de la interfaz pública
+ * @see https://physionet.org/physiotools/wag/header-5.htm (cabecera)
+ * @see https://physionet.org/physiotools/wag/signal-5.htm (formatos de señal)
+ * @see https://physionet.org/physiotools/wag/annot-5.htm (anotaciones)
+ */
+
+#if !defined(ARDUINO)
+
+#include "WfdbRecord.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+// Códigos especiales del formato de anotaciones MIT
+#define WFDB_ANN_SKIP   59
+#define WFDB_ANN_NUM    60
+#define WFDB_ANN_SUB    61
+#define WFDB_ANN_CHN    62
+#define WFDB_ANN_AUX    63
+
+// Valores WFDB que marcan una muestra inválida
+#define WFDB_INVALID_212    (-2048)
+#define WFDB_INVALID_16     (-32768)
+
+/**
+ * @brief Símbolos de los códigos de anotación 0-41 (ecgcodes.h de WFDB)
+ */
+static const char annotationSymbols[] = " NLRaVFJASEj/Q~ | sT*D\"=pB^t+u?![]en@xf()r";
+
+static bool nameEquals(const char* a, const char* b) {
+    while (*a && *b) {
+        if (tolower((unsigned char)*a) != tolower((unsigned char)*b)) {
+            return false;
+        }
+        a++;
+        b++;
+    }
+    return *a == *b;
+}
+
+static void copyToken(char* dest, size_t size, const char* src) {
+    snprintf(dest, size, "%s", src);
+}
+
+// ====================
+// WfdbRecord
+// ====================
+
+WfdbRecord::WfdbRecord()
+    : _numSignals(0),
+      _numFiles(0),
+      _fs(0.0f),
+      _numSamples(0),
+      _signals(nullptr),
+      _files(nullptr),
+      _annotations(nullptr),
+      _numAnnotations(0)
+{
+    _basePath[0] = '\0';
+    _directory[0] = '\0';
+}
+
+WfdbRecord::~WfdbRecord() {
+    close();
+}
+
+void WfdbRecord::close() {
+    delete[] _signals;
+    delete[] _files;
+    delete[] _annotations;
+    _signals = nullptr;
+    _files = nullptr;
+    _annotations = nullptr;
+    _numSignals = 0;
+    _numFiles = 0;
+    _numSamples = 0;
+    _numAnnotations = 0;
+}
+
+bool WfdbRecord::open(const char* recordPath) {
+    close();
+
+    // Ruta base sin ".hea" y directorio de la cabecera
+    copyToken(_basePath, sizeof(_basePath), recordPath);
+    size_t length = strlen(_basePath);
+    if (length > 4 && nameEquals(_basePath + length - 4, ".hea")) {
+        _basePath[length - 4] = '\0';
+    }
+
+    copyToken(_directory, sizeof(_directory), _basePath);
+    char* slash = strrchr(_directory, '/');
+    char* backslash = strrchr(_directory, '\\');
+    if (backslash > slash) {
+        slash = backslash;
+    }
+    if (slash != nullptr) {
+        slash[1] = '\0';
+    } else {
+        _directory[0] = '\0';
+    }
+
+    char headerPath[520];
+    snprintf(headerPath, sizeof(headerPath), "%s.hea", _basePath);
+    if (!parseHeader(headerPath)) {
+        close();
+        return false;
+    }
+
+    // Agrupar señales consecutivas que comparten archivo (entrelazadas por trama)
+    _files = new MappedFile[_numSignals];
+    uint8_t first = 0;
+    for (uint16_t i = 0; i <= _numSignals; i++) {
+        if (i < _numSignals && strcmp(_signals[i].fileName, _signals[first].fileName) == 0) {
+            continue;
+        }
+
+        uint8_t groupSize = (uint8_t)(i - first);
+        for (uint16_t j = first; j < i; j++) {
+            if (_signals[j].format != _signals[first].format) {
+                close();
+                return false;
+            }
+            _signals[j].file = _numFiles;
+            _signals[j].framePosition = (uint8_t)(j - first);
+            _signals[j].frameSignals = groupSize;
+        }
+
+        char dataPath[600];
+        snprintf(dataPath, sizeof(dataPath), "%s%s", _directory, _signals[first].fileName);
+        MappedFile& file = _files[_numFiles];
+        if (!file.open(dataPath)) {
+            close();
+            return false;
+        }
+
+        // Tramas completas disponibles en el archivo
+        size_t offset = _signals[first].byteOffset;
+        uint64_t bytes = file.size() > offset ? file.size() - offset : 0;
+        uint64_t frames = (_signals[first].format == 16)
+                          ? bytes / (2u * groupSize)
+                          : (bytes * 2 / 3) / groupSize;
+        if (_numSamples == 0 || frames < _numSamples) {
+            _numSamples = (uint32_t)frames;
+        }
+
+        _numFiles++;
+        first = (uint8_t)i;
+    }
+
+    return true;
+}
+
+bool WfdbRecord::parseHeader(const char* headerPath) {
+    FILE* header = fopen(headerPath, "r");
+    if (header == nullptr) {
+        return false;
+    }
+
+    char line[512];
+    bool recordLine = false;
+    uint8_t signal = 0;
+    uint8_t numSignals = 0;
+    bool ok = true;
+
+    while (ok && fgets(line, sizeof(line), header) != nullptr) {
+        // Quitar fin de línea y comentarios
+        line[strcspn(line, "\r\n")] = '\0';
+        char* start = line;
+        while (isspace((unsigned char)*start)) {
+            start++;
+        }
+        if (*start == '\0' || *start == '#') {
+            continue;
+        }
+
+        if (!recordLine) {
+            // nombre[/segmentos] nsig [fs[/fcont][(base)] [nsamp [hora [fecha]]]]
+            char* name = strtok(start, " \t");
+            char* nsig = strtok(nullptr, " \t");
+            char* fs = strtok(nullptr, " \t");
+            char* nsamp = strtok(nullptr, " \t");
+
+            if (nsig == nullptr || strchr(name, '/') != nullptr) {
+                ok = false;     // Multisegmento no admitido
+                break;
+            }
+            long count = strtol(nsig, nullptr, 10);
+            if (count <= 0 || count > 255) {
+                ok = false;
+                break;
+            }
+            numSignals = (uint8_t)count;
+            _fs = (fs != nullptr) ? strtof(fs, nullptr) : 250.0f;
+            if (_fs <= 0.0f) {
+                _fs = 250.0f;
+            }
+            _numSamples = (nsamp != nullptr) ? (uint32_t)strtoul(nsamp, nullptr, 10) : 0;
+
+            _signals = new WfdbSignalInfo[numSignals];
+            recordLine = true;
+            continue;
+        }
+
+        if (signal < numSignals) {
+            ok = parseSignalLine(start, _signals[signal]);
+            signal++;
+        }
+    }
+    fclose(header);
+
+    if (!ok || !recordLine || signal < numSignals) {
+        return false;
+    }
+    _numSignals = numSignals;
+    return true;
+}
+
+bool WfdbRecord::parseSignalLine(char* line, WfdbSignalInfo& info) {
+    memset(&info, 0, sizeof(info));
+    copyToken(info.units, sizeof(info.units), "mV");
+    info.gain = 200.0f;
+    info.adcResolution = 12;
+
+    // archivo formato[xmuestras][:skew][+offset] ganancia[(base)][/unidades] res cero inicial checksum bloque descripción
+    char* token = strtok(line, " \t");
+    char* format = strtok(nullptr, " \t");
+    if (token == nullptr || format == nullptr || strcmp(token, "~") == 0) {
+        return false;
+    }
+    copyToken(info.fileName, sizeof(info.fileName), token);
+
+    char* cursor;
+    info.format = (uint16_t)strtoul(format, &cursor, 10);
+    if (info.format != 212 && info.format != 16) {
+        return false;
+    }
+    while (*cursor != '\0') {
+        char tag = *cursor++;
+        long value = strtol(cursor, &cursor, 10);
+        if (tag == 'x' && value > 1) {
+            return false;       // Varias muestras por trama no admitidas
+        }
+        if (tag == '+') {
+            info.byteOffset = (uint32_t)value;
+        }
+        // ':' (skew) se ignora
+    }
+
+    bool hasBaseline = false;
+    token = strtok(nullptr, " \t");
+    if (token != nullptr) {
+        float32_t gain = strtof(token, &cursor);
+        if (gain != 0.0f) {
+            info.gain = gain;
+        }
+        if (*cursor == '(') {
+            info.baseline = (int32_t)strtol(cursor + 1, &cursor, 10);
+            hasBaseline = true;
+            if (*cursor == ')') {
+                cursor++;
+            }
+        }
+        if (*cursor == '/') {
+            copyToken(info.units, sizeof(info.units), cursor + 1);
+        }
+
+        token = strtok(nullptr, " \t");
+        if (token != nullptr) {
+            long resolution = strtol(token, nullptr, 10);
+            if (resolution > 0) {
+                info.adcResolution = (uint8_t)resolution;
+            }
+            token = strtok(nullptr, " \t");
+        }
+        if (token != nullptr) {
+            info.adcZero = (int32_t)strtol(token, nullptr, 10);
+            // initval, checksum y blocksize no se usan
+            for (uint8_t i = 0; i < 3 && token != nullptr; i++) {
+                token = strtok(nullptr, " \t");
+            }
+            // El resto de la línea es la descripción (puede contener espacios)
+            token = strtok(nullptr, "");
+            if (token != nullptr) {
+                while (isspace((unsigned char)*token)) {
+                    token++;
+                }
+                copyToken(info.description, sizeof(info.description), token);
+            }
+        }
+    }
+
+    if (!hasBaseline) {
+        info.baseline = info.adcZero;
+    }
+    return true;
+}
+
+int8_t WfdbRecord::findSignal(const char* description) const {
+    for (uint8_t i = 0; i < _numSignals; i++) {
+        if (nameEquals(_signals[i].description, description)) {
+            return (int8_t)i;
+        }
+    }
+    return -1;
+}
+
+uint32_t WfdbRecord::timeToSample(float32_t seconds) const {
+    if (seconds <= 0.0f) {
+        return 0;
+    }
+    double sample = (double)seconds * _fs + 0.5;
+    return sample >= _numSamples ? _numSamples : (uint32_t)sample;
+}
+
+uint32_t WfdbRecord::readSamples(uint8_t channel, uint32_t start, float32_t* output, uint32_t length) const {
+    if (channel >= _numSignals || start >= _numSamples) {
+        return 0;
+    }
+    if (length > _numSamples - start) {
+        length = _numSamples - start;
+    }
+
+    const WfdbSignalInfo& info = _signals[channel];
+    const uint8_t* base = _files[info.file].data() + info.byteOffset;
+    const uint32_t stride = info.frameSignals;
+    const float32_t invGain = 1.0f / info.gain;
+    const int32_t baseline = info.baseline;
+
+    // Índice de la muestra dentro del flujo entrelazado del archivo
+    uint64_t k = (uint64_t)start * stride + info.framePosition;
+
+    if (info.format == 16) {
+        const uint8_t* ptr = base + 2 * k;
+        for (uint32_t i = 0; i < length; i++) {
+            int32_t value = (int16_t)(ptr[0] | (ptr[1] << 8));
+            output[i] = (value == WFDB_INVALID_16) ? 0.0f : (value - baseline) * invGain;
+            ptr += 2 * stride;
+        }
+    } else {
+        // 212: cada par de muestras ocupa 3 bytes; la impar lleva el nibble alto del byte central
+        for (uint32_t i = 0; i < length; i++) {
+            const uint8_t* pair = base + 3 * (k >> 1);
+            int32_t value = (k & 1)
+                            ? (pair[2] | ((pair[1] & 0xF0) << 4))
+                            : (pair[0] | ((pair[1] & 0x0F) << 8));
+            if (value & 0x800) {
+                value -= 0x1000;
+            }
+            output[i] = (value == WFDB_INVALID_212) ? 0.0f : (value - baseline) * invGain;
+            k += stride;
+        }
+    }
+    return length;
+}
+
+// ====================
+// Anotaciones
+// ====================
+
+bool WfdbRecord::loadAnnotations(const char* annotator) {
+    delete[] _annotations;
+    _annotations = nullptr;
+    _numAnnotations = 0;
+
+    char path[600];
+    snprintf(path, sizeof(path), "%s.%s", _basePath, annotator);
+    MappedFile file;
+    if (!file.open(path)) {
+        return false;
+    }
+
+    // Dos pasadas: contar y luego rellenar, sin realojar
+    uint32_t count = parseAnnotations(file.data(), file.size(), nullptr);
+    if (count > 0) {
+        _annotations = new WfdbAnnotation[count];
+        _numAnnotations = parseAnnotations(file.data(), file.size(), _annotations);
+    }
+    return true;
+}
+
+uint32_t WfdbRecord::parseAnnotations(const uint8_t* data, size_t size, WfdbAnnotation* output) const {
+    const uint8_t* p = data;
+    const uint8_t* end = data + size;
+    uint32_t time = 0;
+    uint32_t count = 0;
+    uint8_t channel = 0;
+    int8_t num = 0;
+
+    while (p + 2 <= end) {
+        uint16_t word = (uint16_t)(p[0] | (p[1] << 8));
+        p += 2;
+        uint8_t code = word >> 10;
+        uint16_t value = word & 0x3FF;
+
+        if (code == 0 && value == 0) {
+            break;      // Fin de archivo
+        }
+
+        switch (code) {
+            case WFDB_ANN_SKIP:
+                // Intervalo de 32 bits en orden PDP-11 (palabra alta primero)
+                if (p + 4 > end) {
+                    return count;
+                }
+                time += (uint32_t)((p[1] << 24) | (p[0] << 16) | (p[3] << 8) | p[2]);
+                p += 4;
+                break;
+
+            case WFDB_ANN_NUM:
+                num = (int8_t)value;
+                if (output != nullptr && count > 0) {
+                    output[count - 1].num = num;
+                }
+                break;
+
+            case WFDB_ANN_SUB:
+                if (output != nullptr && count > 0) {
+                    output[count - 1].subtype = (int8_t)value;
+                }
+                break;
+
+            case WFDB_ANN_CHN:
+                channel = (uint8_t)value;
+                if (output != nullptr && count > 0) {
+                    output[count - 1].channel = channel;
+                }
+                break;
+
+            case WFDB_ANN_AUX:
+                // Texto auxiliar (p. ej. "(AFIB"), rellenado a longitud par: se omite
+                p += (value + 1) & ~1u;
+                break;
+
+            default:
+                time += value;
+                if (output != nullptr) {
+                    // num y chan se heredan de la anotación anterior; subtype no
+                    output[count].sample = time;
+                    output[count].code = code;
+                    output[count].subtype = 0;
+                    output[count].channel = channel;
+                    output[count].num = num;
+                }
+                count++;
+                break;
+        }
+    }
+    return count;
+}
+
+uint32_t WfdbRecord::findAnnotation(uint32_t sample) const {
+    uint32_t low = 0;
+    uint32_t high = _numAnnotations;
+    while (low < high) {
+        uint32_t mid = low + (high - low) / 2;
+        if (_annotations[mid].sample < sample) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+char WfdbRecord::annotationSymbol(uint8_t code) {
+    return code < sizeof(annotationSymbols) - 1 ? annotationSymbols[code] : ' ';
+}
+
+bool WfdbRecord::isBeat(uint8_t code) {
+    // NORMAL..UNKNOWN, BBB, AESC, SVESC, NAPC, PFUS, RONT
+    return (code >= 1 && code <= 13) || code == 25 || code == 34 || code == 35 ||
+           code == 37 || code == 38 || code == 41;
+}
+
+// ====================
+// WfdbSource
+// ====================
+
+WfdbSource::WfdbSource(const WfdbRecord& record, uint8_t channel, uint32_t start, uint32_t count)
+    : _record(record),
+      _channel(channel),
+      _start(start),
+      _end(record.getNumSamples()),
+      _position(start)
+{
+    if (count != 0 && count < _end - (start < _end ? start : _end)) {
+        _end = start + count;
+    }
+}
+
+uint32_t WfdbSource::read(float32_t* buffer, uint32_t length) {
+    if (_position >= _end) {
+        return 0;
+    }
+    if (length > _end - _position) {
+        length = _end - _position;
+    }
+    uint32_t got = _record.readSamples(_channel, _position, buffer, length);
+    _position += got;
+    return got;
+}
+
+void WfdbSource::seek(uint32_t sample) {
+    _position = sample < _end ? sample : _end;
+}
+
+#endif // !ARDUINO
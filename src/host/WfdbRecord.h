@@ -0,0 +1,219 @@
+/**
+ * @file WfdbRecord.h
+ * @brief Lector de registros WFDB (PhysioNet, MIT-BIH) para reprocesado en host
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @details Lee directamente los registros de las bases de datos de PhysioNet:
+ * - Cabecera .hea (registros de un solo segmento)
+ * - Señales en formato 212 (2 muestras de 12 bits en 3 bytes, MIT-BIH) y 16 (int16 LE)
+ * - Anotaciones en formato MIT (.atr, .qrs...)
+ *
+ * Los archivos de señal se proyectan en memoria (MappedFile) y se decodifican por
+ * bloques directamente a float32_t en unidades físicas, el formato de entrada de
+ * processBuffer(). No hay conversión previa a CSV ni copia del registro completo:
+ * el acceso por muestra o por tiempo es aleatorio e inmediato.
+ *
+ * @par Ejemplo
+ * @code
+ * WfdbRecord record;
+ * if (record.open("mitdb/100")) {
+ *     WfdbSource source(record, record.findSignal("MLII"));
+ *     source.seekTime(300.0f);                    // empezar en el minuto 5
+ *     float32_t in[256], out[256];
+ *     processSource(source, firFilter, in, out, 256, sink);
+ *
+ *     record.loadAnnotations("atr");
+ *     for (uint32_t i = 0; i < record.getNumAnnotations(); i++) {
+ *         const WfdbAnnotation& a = record.getAnnotation(i);
+ *         if (WfdbRecord::isBeat(a.code)) { ... }
+ *     }
+ * }
+ * @endcode
+ *
+ * @note Solo host. No se admiten registros multisegmento ni señales con más de una
+ * muestra por trama (sufijo "x" del formato): open() devuelve false.
+ */
+
+#ifndef WFDB_RECORD_H
+#define WFDB_RECORD_H
+
+#if !defined(ARDUINO)
+
+#include <arm_math.h>
+#include "../utils/SignalSource.h"
+#include "MappedFile.h"
+
+/**
+ * @brief Descripción de una señal según la cabecera .hea
+ */
+struct WfdbSignalInfo {
+    char fileName[64];          ///< Archivo de datos (relativo a la cabecera)
+    char description[64];       ///< Descripción (p. ej. "MLII", "V5")
+    char units[16];             ///< Unidades físicas (por defecto "mV")
+    uint16_t format;            ///< 212 o 16
+    float32_t gain;             ///< Unidades ADC por unidad física
+    int32_t baseline;           ///< Valor ADC correspondiente a 0 físico
+    int32_t adcZero;            ///< Valor ADC central del conversor
+    uint8_t adcResolution;      ///< Bits del conversor
+    uint32_t byteOffset;        ///< Bytes a saltar al inicio del archivo
+    uint8_t file;               ///< Índice del archivo de datos
+    uint8_t framePosition;      ///< Posición de la señal dentro de la trama
+    uint8_t frameSignals;       ///< Señales entrelazadas en el mismo archivo
+};
+
+/**
+ * @brief Anotación de un archivo de anotaciones MIT
+ */
+struct WfdbAnnotation {
+    uint32_t sample;            ///< Muestra a la que se refiere
+    uint8_t code;               ///< Código (1 = N, 5 = V... ver annotationSymbol)
+    int8_t subtype;
+    uint8_t channel;
+    int8_t num;
+};
+
+/**
+ * @class WfdbRecord
+ * @brief Registro WFDB abierto con sus señales proyectadas en memoria
+ */
+class WfdbRecord {
+    public:
+        WfdbRecord();
+        ~WfdbRecord();
+
+        /**
+         * @brief Abre un registro
+         * @param recordPath Ruta del registro con o sin ".hea" (p. ej. "mitdb/100")
+         * @return true si la cabecera es válida y todos los archivos de datos existen
+         */
+        bool open(const char* recordPath);
+
+        void close();
+
+        bool isOpen() const { return _numSignals > 0; }
+
+        uint8_t getNumSignals() const { return _numSignals; }
+        float32_t getSampleRate() const { return _fs; }
+
+        /**
+         * @brief Muestras por señal (de la cabecera, limitado al tamaño real del archivo)
+         */
+        uint32_t getNumSamples() const { return _numSamples; }
+
+        const WfdbSignalInfo& getSignalInfo(uint8_t channel) const { return _signals[channel]; }
+
+        /**
+         * @brief Busca una señal por su descripción (sin distinguir mayúsculas)
+         * @return Índice de la señal o -1 si no existe
+         */
+        int8_t findSignal(const char* description) const;
+
+        /**
+         * @brief Convierte un instante en segundos a índice de muestra
+         */
+        uint32_t timeToSample(float32_t seconds) const;
+
+        /**
+         * @brief Decodifica un bloque de una señal a unidades físicas
+         *
+         * @param channel Índice de la señal
+         * @param start Primera muestra
+         * @param output Buffer de salida
+         * @param length Muestras pedidas
+         * @return Muestras escritas (menos que length al llegar al final)
+         *
+         * @note Las muestras marcadas como inválidas en WFDB (-2048 en 212, -32768 en 16)
+         * se entregan como 0.
+         */
+        uint32_t readSamples(uint8_t channel, uint32_t start, float32_t* output, uint32_t length) const;
+
+        /**
+         * @brief Carga un archivo de anotaciones del registro
+         * @param annotator Extensión del anotador ("atr", "qrs"...)
+         * @return true si el archivo existe y se pudo leer
+         */
+        bool loadAnnotations(const char* annotator = "atr");
+
+        uint32_t getNumAnnotations() const { return _numAnnotations; }
+        const WfdbAnnotation& getAnnotation(uint32_t index) const { return _annotations[index]; }
+
+        /**
+         * @brief Índice de la primera anotación en la muestra indicada o posterior
+         * (búsqueda binaria; devuelve getNumAnnotations() si no hay ninguna)
+         */
+        uint32_t findAnnotation(uint32_t sample) const;
+
+        /**
+         * @brief Símbolo de PhysioNet de un código de anotación ('N', 'V', '+'...)
+         */
+        static char annotationSymbol(uint8_t code);
+
+        /**
+         * @brief Indica si el código corresponde a un latido (QRS)
+         */
+        static bool isBeat(uint8_t code);
+
+    private:
+        // No copiable: posee las proyecciones de los archivos
+        WfdbRecord(const WfdbRecord&);
+        WfdbRecord& operator=(const WfdbRecord&);
+
+        bool parseHeader(const char* headerPath);
+        bool parseSignalLine(char* line, WfdbSignalInfo& info);
+        uint32_t parseAnnotations(const uint8_t* data, size_t size, WfdbAnnotation* output) const;
+
+        char _basePath[512];        ///< Ruta del registro sin extensión
+        char _directory[512];       ///< Directorio de la cabecera (con separador final)
+
+        uint8_t _numSignals;
+        uint8_t _numFiles;
+        float32_t _fs;
+        uint32_t _numSamples;
+        WfdbSignalInfo* _signals;
+        MappedFile* _files;
+
+        WfdbAnnotation* _annotations;
+        uint32_t _numAnnotations;
+};
+
+/**
+ * @class WfdbSource
+ * @brief Fuente de señal sobre una señal de un WfdbRecord
+ *
+ * @details Cada fuente tiene su propia posición, así que varias pueden leer
+ * señales distintas (o tramos distintos) del mismo registro a la vez.
+ */
+class WfdbSource : public SignalSource {
+    public:
+        /**
+         * @param record Registro abierto (debe seguir vivo mientras se use la fuente)
+         * @param channel Índice de la señal
+         * @param start Primera muestra
+         * @param count Muestras a entregar (0 = hasta el final del registro)
+         */
+        WfdbSource(const WfdbRecord& record, uint8_t channel, uint32_t start = 0, uint32_t count = 0);
+
+        uint32_t read(float32_t* buffer, uint32_t length);
+        void rewind() { _position = _start; }
+
+        /**
+         * @brief Salta a una muestra o a un instante del registro
+         */
+        void seek(uint32_t sample);
+        void seekTime(float32_t seconds) { seek(_record.timeToSample(seconds)); }
+
+        uint32_t position() const { return _position; }
+
+    private:
+        const WfdbRecord& _record;
+        uint8_t _channel;
+        uint32_t _start;
+        uint32_t _end;
+        uint32_t _position;
+};
+
+#endif // !ARDUINO
+
+#endif // WFDB_RECORD_H
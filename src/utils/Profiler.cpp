@@ -0,0 +1,56 @@
+/**
+ * @file Profiler.cpp
+ * @brief Implementación del histograma de ciclos (solo con BIOFILTERLIB_PROFILE)
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @see Profiler.h para el formato de las cubetas
+ */
+
+#include "Profiler.h"
+#include <string.h>
+
+#if BIOFILTERLIB_PROFILE
+
+void CycleHistogram::reset() {
+    memset(_counts, 0, sizeof(_counts));
+    _count = 0;
+    _min = 0xFFFFFFFFUL;
+    _max = 0;
+    _worstCall = 0;
+    _overruns = 0;
+    _total = 0;
+}
+
+uint32_t CycleHistogram::bucketUpper(uint16_t bucket) {
+    if (bucket < 16) {
+        return bucket;
+    }
+    // Cubeta 16 + 8·(e - 4) + m: valores (8 + m)·2^(e-3) .. (9 + m)·2^(e-3) - 1
+    uint32_t exponent = (bucket - 16) / 8 + 4;
+    uint32_t mantissa = (bucket - 16) % 8;
+    uint32_t width = 1UL << (exponent - 3);
+    return (8 + mantissa) * width + (width - 1);
+}
+
+uint32_t CycleHistogram::getPercentile(float32_t p) const {
+    if (_count == 0) {
+        return 0;
+    }
+    // Rango de la medida buscada (1 .. count)
+    uint32_t rank = (uint32_t)ceilf(p * _count);
+    rank = (rank < 1) ? 1 : (rank > _count ? _count : rank);
+
+    uint32_t seen = 0;
+    for (uint16_t bucket = 0; bucket < NUM_BUCKETS; bucket++) {
+        seen += _counts[bucket];
+        if (seen >= rank) {
+            uint32_t upper = bucketUpper(bucket);
+            return (upper < _max) ? upper : _max;
+        }
+    }
+    return _max;
+}
+
+#endif // BIOFILTERLIB_PROFILE
@@ -0,0 +1,319 @@
+/**
+ * @file Profiler.h
+ * @brief Histograma de ciclos por llamada y monitor de plazo de tiempo real
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @details PerformanceMetrics da el tiempo medio de una pasada completa, pero lo que
+ * hace perder una muestra del ADC es la peor llamada: un processSample() lento dentro
+ * de la ISR de muestreo. Este módulo mide cada llamada en ciclos de CPU:
+ *
+ * - CycleCounter lee el contador de ciclos del Cortex-M3 (DWT->CYCCNT, 84 MHz en el
+ *   Due): una lectura de registro por medida. En PC cuenta nanosegundos.
+ * - CycleHistogram guarda las medidas en un histograma logarítmico de tipo HDR: los
+ *   valores menores que 16 son exactos y por encima cada potencia de 2 se divide en 8
+ *   cubetas (error relativo < 12.5 %). 240 contadores cubren todo uint32_t sin
+ *   memoria dinámica. Además cuenta las llamadas que superan el plazo (1/fs por
+ *   muestra) y guarda la peor llamada y su número de orden.
+ * - Profiled<Filter> envuelve cualquier filtro con la interfaz de etapa de
+ *   FilterChain y mide cada processSample() y processBuffer(). Puede sustituir a la
+ *   etapa dentro de la cadena, así que se mide etapa por etapa.
+ *
+ * Con BIOFILTERLIB_PROFILE a 0 (por defecto, ver BioFilterLibConfig.h) CycleHistogram
+ * no tiene datos, record() está vacío y Profiled<Filter> solo reenvía las llamadas: el
+ * compilador no deja rastro de la instrumentación y el código de la aplicación no
+ * cambia.
+ *
+ * @par Ejemplo
+ * @code
+ * CycleCounter::begin();
+ * Profiled<IIRFilter> notchStage(notch);
+ * Profiled<FIRFilter> lowpassStage(lowpass);
+ * notchStage.getHistogram().setDeadline(960.0f);        // 87500 ciclos por muestra
+ * lowpassStage.getHistogram().setDeadline(960.0f);
+ * FilterChain<Profiled<IIRFilter>, Profiled<FIRFilter> > chain(32, notchStage, lowpassStage);
+ *
+ * void TC3_Handler() {
+ *     CycleHistogram::Scope timer(isrHistogram);        // También a mano, en la ISR
+ *     out = chain.processSample(readADC());
+ * }
+ *
+ * uint32_t p99 = lowpassStage.getHistogram().getPercentile(0.99f);
+ * uint32_t lost = lowpassStage.getHistogram().getOverruns();
+ * @endcode
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <arm_math.h>
+#include "../BioFilterLibConfig.h"
+
+#if !defined(ARDUINO)
+#include <chrono>
+#endif
+
+/**
+ * @class CycleCounter
+ * @brief Contador de ciclos libre de 32 bits (DWT->CYCCNT en el Due, ns en PC)
+ */
+class CycleCounter {
+    public:
+        /**
+         * @brief Activa el contador (una vez, en setup())
+         */
+        static void begin() {
+#if defined(ARDUINO)
+            reg(DEMCR) |= DEMCR_TRCENA;
+            reg(DWT_CYCCNT) = 0;
+            reg(DWT_CTRL) |= DWT_CTRL_CYCCNTENA;
+#endif
+        }
+
+        /**
+         * @brief Valor actual; la diferencia entre dos lecturas es válida aunque desborde
+         */
+        static uint32_t now() {
+#if defined(ARDUINO)
+            return reg(DWT_CYCCNT);
+#else
+            return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+        }
+
+        /**
+         * @brief Cuentas por segundo
+         */
+        static uint32_t frequency() {
+#if defined(ARDUINO)
+            return F_CPU;
+#else
+            return 1000000000UL;
+#endif
+        }
+
+    private:
+#if defined(ARDUINO)
+        // Registros de depuración del Cortex-M3 (ARMv7-M ARM, C1.6 y C1.8)
+        static const uint32_t DEMCR = 0xE000EDFCUL;
+        static const uint32_t DWT_CTRL = 0xE0001000UL;
+        static const uint32_t DWT_CYCCNT = 0xE0001004UL;
+        static const uint32_t DEMCR_TRCENA = 1UL << 24;
+        static const uint32_t DWT_CTRL_CYCCNTENA = 1UL;
+
+        static volatile uint32_t& reg(uint32_t address) {
+            return *(volatile uint32_t*)(uintptr_t)address;
+        }
+#endif
+};
+
+#if BIOFILTERLIB_PROFILE
+
+/**
+ * @class CycleHistogram
+ * @brief Distribución de ciclos por llamada, plazo incumplido y peor llamada
+ */
+class CycleHistogram {
+    public:
+        static const uint16_t NUM_BUCKETS = 240;
+
+        /**
+         * @param deadlineCycles Ciclos disponibles por muestra (0: sin plazo)
+         */
+        explicit CycleHistogram(uint32_t deadlineCycles = 0)
+            : _deadline(deadlineCycles)
+        {
+            reset();
+        }
+
+        /**
+         * @brief Plazo de una muestra: CycleCounter::frequency() / sampleRate
+         */
+        void setDeadline(float32_t sampleRate) {
+            _deadline = (uint32_t)(CycleCounter::frequency() / sampleRate);
+        }
+
+        /**
+         * @brief Añade una medida
+         *
+         * @param cycles Duración de la llamada
+         * @param samples Muestras que procesó (el plazo se multiplica por ellas)
+         */
+        void record(uint32_t cycles, uint32_t samples = 1) {
+            _counts[bucketOf(cycles)]++;
+            if (cycles > _max) {
+                _max = cycles;
+                _worstCall = _count;
+            }
+            if (cycles < _min) {
+                _min = cycles;
+            }
+            if (_deadline != 0 && cycles > _deadline * samples) {
+                _overruns++;
+            }
+            _total += cycles;
+            _count++;
+        }
+
+        /**
+         * @brief Mide el bloque en el que vive y lo registra al salir
+         */
+        class Scope {
+            public:
+                explicit Scope(CycleHistogram& histogram, uint32_t samples = 1)
+                    : _histogram(histogram), _samples(samples), _start(CycleCounter::now()) {}
+                ~Scope() { _histogram.record(CycleCounter::now() - _start, _samples); }
+
+            private:
+                Scope(const Scope&);
+                Scope& operator=(const Scope&);
+
+                CycleHistogram& _histogram;
+                uint32_t _samples;
+                uint32_t _start;
+        };
+
+        /**
+         * @brief Cota superior del percentil p (0 a 1), con la resolución de su cubeta
+         */
+        uint32_t getPercentile(float32_t p) const;
+
+        uint32_t getCount() const { return _count; }
+        uint32_t getMin() const { return _count ? _min : 0; }
+        uint32_t getMax() const { return _max; }
+        float32_t getMean() const { return _count ? (float32_t)((double)_total / _count) : 0.0f; }
+
+        /**
+         * @brief Llamadas que superaron el plazo
+         */
+        uint32_t getOverruns() const { return _overruns; }
+
+        /**
+         * @brief Número de orden (desde 0) de la llamada más lenta
+         */
+        uint32_t getWorstCall() const { return _worstCall; }
+
+        uint32_t getDeadline() const { return _deadline; }
+        uint32_t getBucketCount(uint16_t bucket) const { return _counts[bucket]; }
+
+        void reset();
+
+        uint32_t getMemoryUsage() const { return sizeof(*this); }
+
+        /**
+         * @brief Cubeta de un valor: exacto por debajo de 16, 8 cubetas por octava encima
+         */
+        static uint16_t bucketOf(uint32_t cycles) {
+            if (cycles < 16) {
+                return (uint16_t)cycles;
+            }
+            uint32_t exponent = 31 - __builtin_clz(cycles);
+            return (uint16_t)(16 + (exponent - 4) * 8 + ((cycles >> (exponent - 3)) & 7));
+        }
+
+        /**
+         * @brief Mayor valor que cae en la cubeta
+         */
+        static uint32_t bucketUpper(uint16_t bucket);
+
+    private:
+        uint32_t _counts[NUM_BUCKETS];
+        uint32_t _deadline;
+        uint32_t _count;
+        uint32_t _min;
+        uint32_t _max;
+        uint32_t _worstCall;
+        uint32_t _overruns;
+        uint64_t _total;
+};
+
+#else
+
+/**
+ * @brief Perfilado desactivado: misma interfaz, sin datos ni código
+ */
+class CycleHistogram {
+    public:
+        static const uint16_t NUM_BUCKETS = 0;
+
+        explicit CycleHistogram(uint32_t deadlineCycles = 0) { (void)deadlineCycles; }
+        void setDeadline(float32_t sampleRate) { (void)sampleRate; }
+        void record(uint32_t cycles, uint32_t samples = 1) { (void)cycles; (void)samples; }
+
+        class Scope {
+            public:
+                explicit Scope(CycleHistogram& histogram, uint32_t samples = 1) {
+                    (void)histogram;
+                    (void)samples;
+                }
+        };
+
+        uint32_t getPercentile(float32_t p) const { (void)p; return 0; }
+        uint32_t getCount() const { return 0; }
+        uint32_t getMin() const { return 0; }
+        uint32_t getMax() const { return 0; }
+        float32_t getMean() const { return 0.0f; }
+        uint32_t getOverruns() const { return 0; }
+        uint32_t getWorstCall() const { return 0; }
+        uint32_t getDeadline() const { return 0; }
+        uint32_t getBucketCount(uint16_t bucket) const { (void)bucket; return 0; }
+        void reset() {}
+        uint32_t getMemoryUsage() const { return 0; }
+};
+
+#endif // BIOFILTERLIB_PROFILE
+
+/**
+ * @class Profiled
+ * @brief Etapa que mide cada llamada al filtro que envuelve
+ *
+ * @tparam Filter Cualquier clase con la interfaz de etapa de FilterChain
+ *
+ * @note Guarda el filtro por referencia: debe vivir al menos tanto como el envoltorio.
+ */
+template <typename Filter>
+class Profiled {
+    public:
+        explicit Profiled(Filter& filter, uint32_t deadlineCycles = 0)
+            : _filter(filter), _histogram(deadlineCycles) {}
+
+        float32_t processSample(float32_t input) {
+            CycleHistogram::Scope timer(_histogram);
+            return _filter.processSample(input);
+        }
+
+        void processBuffer(float32_t* input, float32_t* output, uint32_t length) {
+            CycleHistogram::Scope timer(_histogram, length);
+            _filter.processBuffer(input, output, length);
+        }
+
+        float32_t getGroupDelay(float32_t normalizedFrequency = 0.0f) const {
+            return _filter.getGroupDelay(normalizedFrequency);
+        }
+
+        /**
+         * @brief RAM del filtro más la del histograma (0 si el perfilado está desactivado)
+         */
+        uint32_t getMemoryUsage() const {
+            return _filter.getMemoryUsage() + _histogram.getMemoryUsage();
+        }
+
+        /**
+         * @brief Reinicia el estado del filtro (el histograma se conserva)
+         */
+        void reset() {
+            _filter.reset();
+        }
+
+        Filter& getFilter() { return _filter; }
+        CycleHistogram& getHistogram() { return _histogram; }
+        const CycleHistogram& getHistogram() const { return _histogram; }
+
+    private:
+        Filter& _filter;
+        CycleHistogram _histogram;
+};
+
+#endif // PROFILER_H
@@ -0,0 +1,390 @@
+/**
+ * @file SignalGenerator.cpp
+ * @brief Implementación del generador sintético de bioseñales
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @see SignalGenerator.h para documentación de la interfaz pública
+ */
+
+#include "SignalGenerator.h"
+#include <math.h>
+
+// Intervalo de muestras entre actualizaciones lentas (deriva de red, renormalización)
+#define GENERATOR_SLOW_UPDATE 64
+
+// Escala que lleva el ruido rosa de Paul Kellet a RMS unitario (calculada analíticamente)
+#define PINK_NOISE_GAIN 0.33568150f
+
+/**
+ * @brief Ondas del latido: {centro (s), ancho σ (s), amplitud relativa a R}
+ *
+ * @details Valores para RR = 1 s. Los centros y anchos de la onda T se escalan con
+ * sqrt(RR) (fórmula de Bazett), el resto es independiente de la frecuencia cardíaca.
+ */
+static const float32_t ecgWaveTable[5][3] = {
+    {-0.200f, 0.025f,  0.12f},     // P
+    {-0.030f, 0.010f, -0.12f},     // Q
+    { 0.000f, 0.011f,  1.00f},     // R
+    { 0.030f, 0.011f, -0.22f},     // S
+    { 0.280f, 0.055f,  0.28f}      // T (escala con sqrt(RR))
+};
+
+// Centros de las bandas de EEG y su ancho de banda (Hz)
+static const float32_t eegBandTable[5][2] = {
+    { 2.0f,  3.0f},     // delta
+    { 6.0f,  2.0f},     // theta
+    {10.0f,  2.0f},     // alfa
+    {20.0f, 10.0f},     // beta
+    {40.0f, 20.0f}      // gamma
+};
+
+// ====================
+// Fasor y resonador
+// ====================
+
+void BiosignalGenerator::Phasor::setFrequency(float32_t frequency, float32_t fs) {
+    float32_t w = 2.0f * PI * frequency / fs;
+    stepRe = cosf(w);
+    stepIm = sinf(w);
+}
+
+void BiosignalGenerator::Phasor::rotate() {
+    float32_t r = re * stepRe - im * stepIm;
+    im = re * stepIm + im * stepRe;
+    re = r;
+}
+
+void BiosignalGenerator::Phasor::renormalize() {
+    // Corrección de primer orden de |z| = 1 (evita que la amplitud derive en horas)
+    float32_t k = 1.5f - 0.5f * (re * re + im * im);
+    re *= k;
+    im *= k;
+}
+
+void BiosignalGenerator::Resonator::design(float32_t center, float32_t bandwidth, float32_t fs) {
+    // Limitar el centro por debajo de Nyquist para frecuencias de muestreo bajas
+    if (center > 0.4f * fs) {
+        center = 0.4f * fs;
+    }
+
+    float32_t r = expf(-PI * bandwidth / fs);
+    a1 = 2.0f * r * cosf(2.0f * PI * center / fs);
+    a2 = -r * r;
+
+    // Varianza de un AR(2) excitado con ruido blanco unitario
+    float32_t variance = (1.0f - a2) / ((1.0f + a2) * ((1.0f - a2) * (1.0f - a2) - a1 * a1));
+    gain = 1.0f / sqrtf(variance);
+    y1 = 0.0f;
+    y2 = 0.0f;
+}
+
+float32_t BiosignalGenerator::Resonator::process(float32_t x) {
+    float32_t y = a1 * y1 + a2 * y2 + x;
+    y2 = y1;
+    y1 = y;
+    return y * gain;
+}
+
+// ====================
+// Constructor y configuración
+// ====================
+
+BiosignalGenerator::BiosignalGenerator(float32_t fs, uint32_t seed, uint32_t totalSamples)
+    : _fs(fs),
+      _seed(seed ? seed : 1),
+      _total(totalSamples),
+      _sampleIndex(0),
+      _ecgAmplitude(0.0f),
+      _ecgMeanRR(1.0f),
+      _ecgHrv(0.0f),
+      _emgAmplitude(0.0f),
+      _emgPeriod(2.0f),
+      _emgDuration(0.8f),
+      _wanderAmplitude(0.0f),
+      _lineAmplitude(0.0f),
+      _lineFrequency(50.0f),
+      _lineDrift(0.0f),
+      _lineHarmonics(1),
+      _whiteRms(0.0f),
+      _pinkRms(0.0f)
+{
+    for (uint8_t i = 0; i < EEG_BANDS; i++) {
+        _eegAmplitude[i] = 0.0f;
+        _eegBand[i].design(eegBandTable[i][0], eegBandTable[i][1], _fs);
+    }
+    _emgCarrier.design(80.0f, 120.0f, _fs);
+    rewind();
+}
+
+void BiosignalGenerator::setECG(float32_t heartRate, float32_t amplitude, float32_t hrvPercent) {
+    _ecgAmplitude = amplitude;
+    _ecgMeanRR = 60.0f / heartRate;
+    _ecgHrv = hrvPercent / 100.0f;
+    rewind();
+}
+
+void BiosignalGenerator::setEMG(float32_t amplitude, float32_t burstRate, float32_t burstDuration) {
+    _emgAmplitude = amplitude;
+    _emgPeriod = 1.0f / burstRate;
+    _emgDuration = burstDuration;
+    rewind();
+}
+
+void BiosignalGenerator::setEEG(float32_t delta, float32_t theta, float32_t alpha,
+                                float32_t beta, float32_t gamma) {
+    _eegAmplitude[0] = delta;
+    _eegAmplitude[1] = theta;
+    _eegAmplitude[2] = alpha;
+    _eegAmplitude[3] = beta;
+    _eegAmplitude[4] = gamma;
+    rewind();
+}
+
+void BiosignalGenerator::setBaselineWander(float32_t amplitude, float32_t frequency) {
+    _wanderAmplitude = amplitude;
+    _wander[0].setFrequency(frequency, _fs);
+    _wander[1].setFrequency(0.37f * frequency, _fs);
+    rewind();
+}
+
+void BiosignalGenerator::setPowerline(float32_t frequency, float32_t amplitude,
+                                      uint8_t harmonics, float32_t driftHz) {
+    _lineFrequency = frequency;
+    _lineAmplitude = amplitude;
+    _lineHarmonics = harmonics ? harmonics : 1;
+    _lineDrift = driftHz;
+    rewind();
+}
+
+void BiosignalGenerator::setWhiteNoise(float32_t rms) {
+    _whiteRms = rms;
+    rewind();
+}
+
+void BiosignalGenerator::setPinkNoise(float32_t rms) {
+    _pinkRms = rms;
+    rewind();
+}
+
+void BiosignalGenerator::rewind() {
+    _sampleIndex = 0;
+
+    // Un generador independiente por componente, derivado de la semilla
+    _ecgRng = _seed ^ 0x9E3779B9u;
+    _emgRng = _seed ^ 0x85EBCA6Bu;
+    _lineRng = _seed ^ 0x27D4EB2Fu;
+    _noiseRng = _seed ^ 0x165667B1u;
+    _pinkRng = _seed ^ 0xD3A2646Cu;
+
+    _ecgTime = 0.0f;
+    _ecgBeatTime = 0.0f;
+    _ecgRR = _ecgMeanRR;
+    _ecgNextRR = _ecgMeanRR;
+
+    _emgTime = 0.0f;
+    _emgNextBurst = 0.5f * _emgPeriod;
+    _emgCarrier.y1 = 0.0f;
+    _emgCarrier.y2 = 0.0f;
+
+    for (uint8_t i = 0; i < EEG_BANDS; i++) {
+        _eegRng[i] = _seed ^ (0xC2B2AE35u + i * 0x9E3779B9u);
+        _eegBand[i].y1 = 0.0f;
+        _eegBand[i].y2 = 0.0f;
+    }
+
+    _wander[0].resetPhase();
+    _wander[1].resetPhase();
+
+    _lineOffset = 0.0f;
+    _line.setFrequency(_lineFrequency, _fs);
+    _line.resetPhase();
+
+    _pink[0] = 0.0f;
+    _pink[1] = 0.0f;
+    _pink[2] = 0.0f;
+}
+
+// ====================
+// Aleatoriedad
+// ====================
+
+uint32_t BiosignalGenerator::random(uint32_t& state) {
+    // xorshift32: periodo 2^32 - 1, tres desplazamientos por número
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+float32_t BiosignalGenerator::gaussian(uint32_t& state) {
+    // Aproximación de Irwin-Hall: suma de 4 uniformes centrada y escalada a varianza 1.
+    // Suficiente para señales de prueba y mucho más barata que Box-Muller.
+    float32_t sum = 0.0f;
+    for (uint8_t i = 0; i < 4; i++) {
+        sum += (random(state) >> 8) * (1.0f / 16777216.0f);
+    }
+    return (sum - 2.0f) * 1.7320508f;
+}
+
+// ====================
+// ECG
+// ====================
+
+float32_t BiosignalGenerator::ecgWaves(float32_t t, float32_t rr) {
+    float32_t qt = sqrtf(rr);
+    float32_t value = 0.0f;
+
+    for (uint8_t i = 0; i < 5; i++) {
+        float32_t center = ecgWaveTable[i][0];
+        float32_t width = ecgWaveTable[i][1];
+        if (i == 4) {
+            center *= qt;
+            width *= qt;
+        }
+
+        // Evaluar la gaussiana solo dentro de ±4σ
+        float32_t d = t - center;
+        if (d > -4.0f * width && d < 4.0f * width) {
+            value += ecgWaveTable[i][2] * expf(-0.5f * d * d / (width * width));
+        }
+    }
+    return value;
+}
+
+float32_t BiosignalGenerator::nextRR() {
+    // Arritmia sinusal respiratoria + ondas de Mayer + componente aleatoria
+    float32_t t = _ecgBeatTime;
+    float32_t modulation = 0.6f * sinf(2.0f * PI * 0.25f * t)
+                         + 0.4f * sinf(2.0f * PI * 0.1f * t)
+                         + 0.5f * gaussian(_ecgRng);
+    float32_t rr = _ecgMeanRR * (1.0f + _ecgHrv * modulation);
+
+    // Mantener el RR en un rango fisiológico
+    if (rr < 0.3f) rr = 0.3f;
+    if (rr > 2.0f) rr = 2.0f;
+    return rr;
+}
+
+// ====================
+// Generación
+// ====================
+
+float32_t BiosignalGenerator::next() {
+    float32_t dt = 1.0f / _fs;
+    float32_t value = 0.0f;
+    bool slowUpdate = (_sampleIndex % GENERATOR_SLOW_UPDATE) == 0;
+
+    if (_ecgAmplitude != 0.0f) {
+        // Ondas del latido actual (tras la R) y del siguiente (P y Q antes de la R)
+        value += _ecgAmplitude * (ecgWaves(_ecgTime, _ecgRR)
+                                + ecgWaves(_ecgTime - _ecgNextRR, _ecgNextRR));
+
+        _ecgTime += dt;
+        if (_ecgTime >= _ecgNextRR) {
+            _ecgTime -= _ecgNextRR;
+            // Las modulaciones de 0.25 y 0.1 Hz se repiten cada 20 s
+            _ecgBeatTime += _ecgNextRR;
+            if (_ecgBeatTime >= 20.0f) {
+                _ecgBeatTime -= 20.0f;
+            }
+            _ecgRR = _ecgNextRR;
+            _ecgNextRR = nextRR();
+        }
+    }
+
+    if (_emgAmplitude != 0.0f) {
+        float32_t carrier = _emgCarrier.process(gaussian(_emgRng));
+
+        // Envolvente sin^2 dentro de la ráfaga
+        float32_t burst = _emgTime - _emgNextBurst;
+        if (burst >= 0.0f && burst < _emgDuration) {
+            float32_t s = sinf(PI * burst / _emgDuration);
+            value += _emgAmplitude * s * s * carrier;
+        } else if (burst >= _emgDuration) {
+            // Tomar el inicio de la ráfaga como nuevo origen para no perder precisión
+            float32_t jitter = 1.0f + 0.2f * (2.0f * (random(_emgRng) >> 8) * (1.0f / 16777216.0f) - 1.0f);
+            _emgTime -= _emgNextBurst;
+            _emgNextBurst = _emgPeriod * jitter;
+        }
+        _emgTime += dt;
+    }
+
+    for (uint8_t i = 0; i < EEG_BANDS; i++) {
+        if (_eegAmplitude[i] != 0.0f) {
+            value += _eegAmplitude[i] * _eegBand[i].process(gaussian(_eegRng[i]));
+        }
+    }
+
+    if (_wanderAmplitude != 0.0f) {
+        value += _wanderAmplitude * (_wander[0].im + 0.5f * _wander[1].im);
+        _wander[0].rotate();
+        _wander[1].rotate();
+        if (slowUpdate) {
+            _wander[0].renormalize();
+            _wander[1].renormalize();
+        }
+    }
+
+    if (_lineAmplitude != 0.0f) {
+        // Armónicos a partir de potencias del fasor fundamental: sin(kθ) = Im(z^k)
+        float32_t hRe = _line.re;
+        float32_t hIm = _line.im;
+        float32_t line = hIm;
+        for (uint8_t k = 2; k <= _lineHarmonics; k++) {
+            float32_t r = hRe * _line.re - hIm * _line.im;
+            hIm = hRe * _line.im + hIm * _line.re;
+            hRe = r;
+            line += hIm / k;
+        }
+        value += _lineAmplitude * line;
+
+        _line.rotate();
+        if (slowUpdate) {
+            if (_lineDrift != 0.0f) {
+                // Paseo aleatorio con retorno a la media, acotado a ±driftHz
+                _lineOffset = 0.995f * _lineOffset + 0.05f * _lineDrift * gaussian(_lineRng);
+                if (_lineOffset > _lineDrift) _lineOffset = _lineDrift;
+                if (_lineOffset < -_lineDrift) _lineOffset = -_lineDrift;
+                _line.setFrequency(_lineFrequency + _lineOffset, _fs);
+            }
+            _line.renormalize();
+        }
+    }
+
+    if (_whiteRms != 0.0f) {
+        value += _whiteRms * gaussian(_noiseRng);
+    }
+
+    if (_pinkRms != 0.0f) {
+        // Filtro "economy" de Paul Kellet (error < 0.05 dB por encima de fs/1000)
+        float32_t w = gaussian(_pinkRng);
+        _pink[0] = 0.99765f * _pink[0] + w * 0.0990460f;
+        _pink[1] = 0.96300f * _pink[1] + w * 0.2965164f;
+        _pink[2] = 0.57000f * _pink[2] + w * 1.0526913f;
+        value += _pinkRms * PINK_NOISE_GAIN * (_pink[0] + _pink[1] + _pink[2] + w * 0.1848f);
+    }
+
+    _sampleIndex++;
+    return value;
+}
+
+void BiosignalGenerator::generate(float32_t* output, uint32_t length) {
+    for (uint32_t i = 0; i < length; i++) {
+        output[i] = next();
+    }
+}
+
+uint32_t BiosignalGenerator::read(float32_t* buffer, uint32_t length) {
+    if (_total != 0) {
+        if (_sampleIndex >= _total) {
+            return 0;
+        }
+        if (length > _total - _sampleIndex) {
+            length = _total - _sampleIndex;
+        }
+    }
+    generate(buffer, length);
+    return length;
+}
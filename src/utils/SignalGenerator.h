@@ -0,0 +1,218 @@
+/**
+ * @file SignalGenerator.h
+ * @brief Generador sintético y determinista de bioseñales para pruebas de larga duración
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @details BiosignalGenerator sintetiza muestra a muestra, a cualquier frecuencia de
+ * muestreo y sin límite de duración, la suma de los componentes activados:
+ * - ECG con variabilidad de frecuencia cardíaca (ondas P, Q, R, S, T gaussianas)
+ * - Ráfagas de EMG (ruido en banda modulado por una envolvente)
+ * - Bandas de EEG (delta, theta, alfa, beta, gamma como ruido de banda estrecha)
+ * - Deriva de línea base
+ * - Interferencia de red con armónicos y deriva de frecuencia
+ * - Ruido blanco y ruido rosa (1/f)
+ *
+ * Cada componente tiene su propio generador pseudoaleatorio derivado de la semilla,
+ * de modo que la misma semilla produce siempre la misma señal y activar un
+ * componente no altera la secuencia de los demás.
+ *
+ * El coste por muestra es de unas pocas multiplicaciones por componente: los
+ * osciladores son fasores que rotan (sin llamadas a sinf por muestra) y las
+ * gaussianas del ECG solo se evalúan cerca de su centro.
+ *
+ * @par Ejemplo
+ * @code
+ * // Una hora de ECG a 960 Hz con 60 Hz de red y ruido blanco, sin almacenar nada
+ * BiosignalGenerator gen(960.0f, 42, 3600UL * 960);
+ * gen.setECG(72.0f, 1.0f, 5.0f);
+ * gen.setPowerline(60.0f, 0.3f, 3, 0.2f);
+ * gen.setWhiteNoise(0.02f);
+ *
+ * float32_t in[64], out[64];
+ * processSource(gen, firFilter, in, out, 64);
+ * @endcode
+ */
+
+#ifndef SIGNAL_GENERATOR_H
+#define SIGNAL_GENERATOR_H
+
+#include <arm_math.h>
+#include "SignalSource.h"
+
+/**
+ * @class BiosignalGenerator
+ * @brief Generador paramétrico de bioseñales sintéticas
+ *
+ * @note Las amplitudes están en las mismas unidades que la salida (típicamente mV
+ * o valores normalizados). Un componente con amplitud 0 está desactivado y no
+ * consume CPU.
+ */
+class BiosignalGenerator : public SignalSource {
+    public:
+        /**
+         * @param fs Frecuencia de muestreo en Hz
+         * @param seed Semilla del generador pseudoaleatorio (distinta de 0)
+         * @param totalSamples Muestras que entrega read() (0 = sin límite)
+         */
+        BiosignalGenerator(float32_t fs, uint32_t seed = 1, uint32_t totalSamples = 0);
+
+        /**
+         * @brief Activa el ECG
+         * @param heartRate Frecuencia cardíaca media en latidos por minuto
+         * @param amplitude Amplitud de la onda R
+         * @param hrvPercent Variabilidad del intervalo RR (desviación aproximada en %),
+         * con componentes respiratoria (0.25 Hz), de Mayer (0.1 Hz) y aleatoria
+         */
+        void setECG(float32_t heartRate, float32_t amplitude = 1.0f, float32_t hrvPercent = 5.0f);
+
+        /**
+         * @brief Activa ráfagas de EMG
+         * @param amplitude Valor RMS dentro de la ráfaga
+         * @param burstRate Ráfagas por segundo (con ±20 % de variación aleatoria)
+         * @param burstDuration Duración de cada ráfaga en segundos
+         */
+        void setEMG(float32_t amplitude, float32_t burstRate = 0.5f, float32_t burstDuration = 0.8f);
+
+        /**
+         * @brief Activa las bandas de EEG (valor RMS de cada una, 0 = desactivada)
+         * @details Centros: delta 2 Hz, theta 6 Hz, alfa 10 Hz, beta 20 Hz, gamma 40 Hz.
+         */
+        void setEEG(float32_t delta, float32_t theta, float32_t alpha,
+                    float32_t beta, float32_t gamma);
+
+        /**
+         * @brief Activa la deriva de línea base (respiración y movimiento lento)
+         * @param amplitude Amplitud de la componente principal
+         * @param frequency Frecuencia principal en Hz
+         */
+        void setBaselineWander(float32_t amplitude, float32_t frequency = 0.25f);
+
+        /**
+         * @brief Activa la interferencia de red
+         * @param frequency Frecuencia fundamental (50 o 60 Hz)
+         * @param amplitude Amplitud de la fundamental; el armónico k tiene amplitude/k
+         * @param harmonics Número de componentes incluida la fundamental (1 = solo fundamental)
+         * @param driftHz Desviación máxima de frecuencia (paseo aleatorio lento)
+         */
+        void setPowerline(float32_t frequency, float32_t amplitude,
+                          uint8_t harmonics = 1, float32_t driftHz = 0.0f);
+
+        /**
+         * @brief Activa ruido blanco gaussiano con el valor RMS indicado
+         */
+        void setWhiteNoise(float32_t rms);
+
+        /**
+         * @brief Activa ruido rosa (1/f) con el valor RMS indicado
+         */
+        void setPinkNoise(float32_t rms);
+
+        /**
+         * @brief Genera la siguiente muestra (suma de los componentes activos)
+         */
+        float32_t next();
+
+        /**
+         * @brief Genera un bloque de muestras
+         */
+        void generate(float32_t* output, uint32_t length);
+
+        uint32_t read(float32_t* buffer, uint32_t length);
+
+        /**
+         * @brief Reinicia todos los componentes y la semilla: la señal se repite exactamente
+         */
+        void rewind();
+
+        /**
+         * @brief Número de muestras generadas desde el último rewind()
+         */
+        uint32_t sampleIndex() const { return _sampleIndex; }
+
+        float32_t getSampleRate() const { return _fs; }
+
+    private:
+        /**
+         * @brief Oscilador senoidal por rotación de fasor
+         */
+        struct Phasor {
+            float32_t re, im;           ///< Estado (cos, sin) de la fase actual
+            float32_t stepRe, stepIm;   ///< Rotación por muestra
+
+            void setFrequency(float32_t frequency, float32_t fs);
+            void resetPhase() { re = 1.0f; im = 0.0f; }
+            void rotate();
+            void renormalize();
+        };
+
+        /**
+         * @brief Resonador de dos polos excitado con ruido (ruido de banda estrecha)
+         */
+        struct Resonator {
+            float32_t a1, a2;           ///< Coeficientes de realimentación
+            float32_t gain;             ///< Normaliza la salida a RMS unitario
+            float32_t y1, y2;           ///< Estado
+
+            void design(float32_t center, float32_t bandwidth, float32_t fs);
+            float32_t process(float32_t x);
+        };
+
+        uint32_t random(uint32_t& state);
+        float32_t gaussian(uint32_t& state);
+        float32_t ecgWaves(float32_t t, float32_t rr);
+        float32_t nextRR();
+
+        float32_t _fs;
+        uint32_t _seed;
+        uint32_t _total;
+        uint32_t _sampleIndex;
+
+        // ECG
+        float32_t _ecgAmplitude;
+        float32_t _ecgMeanRR;
+        float32_t _ecgHrv;
+        float32_t _ecgTime;         ///< Tiempo desde la última onda R
+        float32_t _ecgRR;           ///< Intervalo RR del latido actual
+        float32_t _ecgNextRR;       ///< Intervalo hasta la próxima R (para P y Q)
+        float32_t _ecgBeatTime;     ///< Tiempo absoluto de la última R (modulación HRV)
+        uint32_t _ecgRng;
+
+        // EMG
+        float32_t _emgAmplitude;
+        float32_t _emgPeriod;
+        float32_t _emgDuration;
+        float32_t _emgTime;
+        float32_t _emgNextBurst;
+        Resonator _emgCarrier;
+        uint32_t _emgRng;
+
+        // EEG
+        static const uint8_t EEG_BANDS = 5;
+        float32_t _eegAmplitude[EEG_BANDS];
+        Resonator _eegBand[EEG_BANDS];
+        uint32_t _eegRng[EEG_BANDS];    ///< Uno por banda: activar una no desplaza las demás
+
+        // Línea base
+        float32_t _wanderAmplitude;
+        Phasor _wander[2];
+
+        // Red eléctrica
+        float32_t _lineAmplitude;
+        float32_t _lineFrequency;
+        float32_t _lineDrift;
+        float32_t _lineOffset;
+        uint8_t _lineHarmonics;
+        Phasor _line;
+        uint32_t _lineRng;
+
+        // Ruido
+        float32_t _whiteRms;
+        float32_t _pinkRms;
+        float32_t _pink[3];
+        uint32_t _noiseRng;
+        uint32_t _pinkRng;
+};
+
+#endif // SIGNAL_GENERATOR_H
@@ -0,0 +1,183 @@
+/**
+ * @file SignalSource.cpp
+ * @brief Implementación de las fuentes de señal en streaming
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @see SignalSource.h para documentación de la interfaz pública
+ */
+
+#include "SignalSource.h"
+
+// ====================
+// TableSource
+// ====================
+
+TableSource::TableSource(const char* tag, uint32_t totalSamples)
+    : _signal(getSignalIndex(tag)),
+      _total(totalSamples ? totalSamples : waveformsNumSamples),
+      _produced(0)
+{
+    if (_signal >= 0) {
+        _decoder.begin((uint8_t)_signal);
+    }
+}
+
+uint32_t TableSource::read(float32_t* buffer, uint32_t length) {
+    if (_signal < 0) {
+        return 0;
+    }
+
+    uint32_t count = 0;
+    while (count < length && _produced < _total) {
+        uint32_t wanted = length - count;
+        if (wanted > _total - _produced) {
+            wanted = _total - _produced;
+        }
+
+        uint32_t got = _decoder.read(buffer + count, wanted);
+        if (got == 0) {
+            // Fin de la tabla: volver al inicio para seguir en bucle
+            _decoder.begin((uint8_t)_signal);
+            continue;
+        }
+
+        count += got;
+        _produced += got;
+    }
+    return count;
+}
+
+void TableSource::rewind() {
+    _produced = 0;
+    if (_signal >= 0) {
+        _decoder.begin((uint8_t)_signal);
+    }
+}
+
+// ====================
+// GeneratorSource
+// ====================
+
+GeneratorSource::GeneratorSource(GeneratorFn fn, void* context, uint32_t totalSamples)
+    : _fn(fn),
+      _context(context),
+      _total(totalSamples),
+      _produced(0)
+{
+}
+
+uint32_t GeneratorSource::read(float32_t* buffer, uint32_t length) {
+    if (_fn == nullptr) {
+        return 0;
+    }
+
+    if (_total != 0 && length > _total - _produced) {
+        length = _total - _produced;
+    }
+
+    for (uint32_t i = 0; i < length; i++) {
+        buffer[i] = _fn(_produced + i, _context);
+    }
+    _produced += length;
+    return length;
+}
+
+// ====================
+// AdcRingSource
+// ====================
+
+AdcRingSource::AdcRingSource(const volatile uint16_t* ring, uint32_t size,
+                             const volatile uint32_t* writeIndex, uint8_t adcBits)
+    : _ring(ring),
+      _size(size),
+      _writeIndex(writeIndex),
+      _readIndex(*writeIndex),
+      _dropped(0),
+      _offset((float32_t)(1u << (adcBits - 1)))
+{
+}
+
+uint32_t AdcRingSource::read(float32_t* buffer, uint32_t length) {
+    // Leer el índice de escritura una sola vez: la ISR puede avanzarlo mientras tanto
+    uint32_t write = *_writeIndex;
+    uint32_t pending = write - _readIndex;
+
+    // Desbordamiento: la ISR ya sobrescribió muestras no leídas
+    if (pending > _size) {
+        _dropped += pending - _size;
+        _readIndex = write - _size;
+        pending = _size;
+    }
+
+    if (length > pending) {
+        length = pending;
+    }
+
+    for (uint32_t i = 0; i < length; i++) {
+        uint16_t raw = _ring[(_readIndex + i) % _size];
+        buffer[i] = ((float32_t)raw - _offset) / _offset;
+    }
+    _readIndex += length;
+    return length;
+}
+
+void AdcRingSource::rewind() {
+    // En una fuente en tiempo real "rebobinar" es descartar lo pendiente
+    _readIndex = *_writeIndex;
+}
+
+#if !defined(ARDUINO)
+// ====================
+// FileSource (host)
+// ====================
+
+FileSource::FileSource(const char* path, Format format, float32_t scale)
+    : _file(fopen(path, "rb")),
+      _format(format),
+      _scale(scale)
+{
+}
+
+FileSource::~FileSource() {
+    if (_file != nullptr) {
+        fclose(_file);
+    }
+}
+
+uint32_t FileSource::read(float32_t* buffer, uint32_t length) {
+    if (_file == nullptr) {
+        return 0;
+    }
+
+    if (_format == FORMAT_FLOAT32) {
+        return (uint32_t)fread(buffer, sizeof(float32_t), length, _file);
+    }
+
+    // int16: convertir en trozos con un buffer fijo en la pila
+    int16_t raw[64];
+    uint32_t count = 0;
+    while (count < length) {
+        uint32_t chunk = length - count;
+        if (chunk > 64) {
+            chunk = 64;
+        }
+        uint32_t got = (uint32_t)fread(raw, sizeof(int16_t), chunk, _file);
+        for (uint32_t i = 0; i < got; i++) {
+            buffer[count + i] = raw[i] * _scale;
+        }
+        count += got;
+        if (got < chunk) {
+            break;
+        }
+    }
+    return count;
+}
+
+void FileSource::rewind() {
+    if (_file != nullptr) {
+        fseek(_file, 0, SEEK_SET);
+    }
+}
+#endif
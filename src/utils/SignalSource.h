@@ -0,0 +1,221 @@
+/**
+ * @file SignalSource.h
+ * @brief Fuentes de señal en streaming para alimentar los filtros por bloques
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @details Una SignalSource produce muestras normalizadas bajo demanda, bloque a
+ * bloque, directamente en el buffer de entrada de processBuffer(). Así los tests y
+ * ejemplos pueden procesar señales de cualquier duración con memoria del tamaño de
+ * un bloque, sin copiar la señal completa a un array intermedio.
+ *
+ * Fuentes incluidas:
+ * - TableSource: señales de Waveforms.h (opcionalmente en bucle)
+ * - GeneratorSource: cualquier función f(n) definida por el usuario
+ * - AdcRingSource: buffer circular de muestras ADC escrito por una ISR
+ * - FileSource: archivo binario float32/int16 (solo host, fuera de Arduino)
+ *
+ * @par Ejemplo
+ * @code
+ * TableSource source("ecg_60hz_noised", 10 * waveformsNumSamples);  // ~29 s en bucle
+ * float32_t in[32], out[32];
+ * uint32_t total = processSource(source, firFilter, in, out, 32);
+ * @endcode
+ *
+ * @note La llamada virtual es por bloque, no por muestra.
+ */
+
+#ifndef SIGNAL_SOURCE_H
+#define SIGNAL_SOURCE_H
+
+#include <arm_math.h>
+#include "Waveforms.h"
+
+#if !defined(ARDUINO)
+#include <stdio.h>
+#endif
+
+/**
+ * @class SignalSource
+ * @brief Interfaz común de las fuentes de señal
+ */
+class SignalSource {
+    public:
+        virtual ~SignalSource() {}
+
+        /**
+         * @brief Produce hasta 'length' muestras en el buffer
+         * @return Muestras escritas. 0 indica fin de la señal (o, en fuentes en
+         * tiempo real como AdcRingSource, que aún no hay datos disponibles).
+         */
+        virtual uint32_t read(float32_t* buffer, uint32_t length) = 0;
+
+        /**
+         * @brief Vuelve al inicio de la señal (si la fuente lo permite)
+         */
+        virtual void rewind() {}
+};
+
+/**
+ * @class TableSource
+ * @brief Reproduce una señal de Waveforms.h a través de WaveformDecoder
+ *
+ * @details Con totalSamples mayor que waveformsNumSamples la señal se repite en
+ * bucle, lo que permite pruebas de larga duración sin memoria adicional.
+ */
+class TableSource : public SignalSource {
+    public:
+        /**
+         * @param tag Etiqueta de la señal (ver getSignalIndex)
+         * @param totalSamples Muestras a producir en total (0 = una pasada de la tabla)
+         */
+        TableSource(const char* tag, uint32_t totalSamples = 0);
+
+        uint32_t read(float32_t* buffer, uint32_t length);
+        void rewind();
+
+        bool isValid() const { return _signal >= 0; }
+
+    private:
+        WaveformDecoder _decoder;
+        int8_t _signal;
+        uint32_t _total;
+        uint32_t _produced;
+};
+
+/**
+ * @class GeneratorSource
+ * @brief Adapta una función generadora muestra a muestra
+ */
+class GeneratorSource : public SignalSource {
+    public:
+        /**
+         * @brief Firma de la función generadora: muestra n-ésima con contexto de usuario
+         */
+        typedef float32_t (*GeneratorFn)(uint32_t n, void* context);
+
+        /**
+         * @param fn Función generadora
+         * @param context Puntero opaco que se pasa a fn
+         * @param totalSamples Muestras a producir (0 = infinitas)
+         */
+        GeneratorSource(GeneratorFn fn, void* context, uint32_t totalSamples = 0);
+
+        uint32_t read(float32_t* buffer, uint32_t length);
+        void rewind() { _produced = 0; }
+
+    private:
+        GeneratorFn _fn;
+        void* _context;
+        uint32_t _total;
+        uint32_t _produced;
+};
+
+/**
+ * @class AdcRingSource
+ * @brief Lee muestras ADC de un buffer circular que llena una ISR
+ *
+ * @details La ISR escribe ring[writeIndex % size] y después incrementa writeIndex
+ * (contador libre de 32 bits). La fuente consume desde su propio índice de
+ * lectura y convierte a [-1, 1) con (raw - offset) / offset. Nunca bloquea:
+ * read() devuelve solo lo que ya está disponible.
+ *
+ * @warning Si la ISR adelanta al consumidor en más de 'size' muestras se pierden
+ * datos; droppedSamples() lo reporta y la lectura salta a los más recientes.
+ */
+class AdcRingSource : public SignalSource {
+    public:
+        /**
+         * @param ring Buffer circular de muestras crudas
+         * @param size Número de elementos de ring
+         * @param writeIndex Contador de muestras escritas por la ISR
+         * @param adcBits Resolución del ADC (12 en Arduino Due)
+         */
+        AdcRingSource(const volatile uint16_t* ring, uint32_t size,
+                      const volatile uint32_t* writeIndex, uint8_t adcBits = 12);
+
+        uint32_t read(float32_t* buffer, uint32_t length);
+        void rewind();
+
+        uint32_t available() const { return *_writeIndex - _readIndex; }
+        uint32_t droppedSamples() const { return _dropped; }
+
+    private:
+        const volatile uint16_t* _ring;
+        uint32_t _size;
+        const volatile uint32_t* _writeIndex;
+        uint32_t _readIndex;
+        uint32_t _dropped;
+        float32_t _offset;
+};
+
+#if !defined(ARDUINO)
+/**
+ * @class FileSource
+ * @brief Lee un archivo binario de muestras (solo en host)
+ *
+ * @details Pensada para reprocesar capturas en el PC con el mismo código que en el
+ * dispositivo. Lee por bloques con un buffer de conversión fijo.
+ */
+class FileSource : public SignalSource {
+    public:
+        enum Format {
+            FORMAT_FLOAT32,     ///< float32 little-endian, ya normalizado
+            FORMAT_INT16        ///< int16 little-endian, se multiplica por 'scale'
+        };
+
+        /**
+         * @param path Ruta del archivo
+         * @param format Formato de las muestras
+         * @param scale Factor de escala para FORMAT_INT16 (por defecto 1/32768)
+         */
+        FileSource(const char* path, Format format, float32_t scale = 1.0f / 32768.0f);
+        ~FileSource();
+
+        uint32_t read(float32_t* buffer, uint32_t length);
+        void rewind();
+
+        bool isOpen() const { return _file != nullptr; }
+
+    private:
+        FILE* _file;
+        Format _format;
+        float32_t _scale;
+};
+#endif
+
+/**
+ * @brief Procesa una fuente completa a través de un filtro, bloque a bloque
+ *
+ * @tparam Filter Cualquier clase con processBuffer(in, out, length) (FIRFilter, IIRFilter...)
+ * @param source Fuente de muestras
+ * @param filter Filtro a aplicar (mantiene su estado entre bloques)
+ * @param inBlock Buffer de entrada de blockSize muestras
+ * @param outBlock Buffer de salida de blockSize muestras
+ * @param blockSize Tamaño de bloque
+ * @param sink Función opcional que recibe cada bloque filtrado
+ * @param context Puntero opaco para sink
+ * @return Número total de muestras procesadas
+ *
+ * @note Para fuentes en tiempo real (AdcRingSource) termina en cuanto no hay datos;
+ * en ese caso conviene llamarla periódicamente desde loop().
+ */
+template <typename Filter>
+uint32_t processSource(SignalSource& source, Filter& filter,
+                       float32_t* inBlock, float32_t* outBlock, uint32_t blockSize,
+                       void (*sink)(const float32_t* block, uint32_t length, void* context) = nullptr,
+                       void* context = nullptr) {
+    uint32_t total = 0;
+    uint32_t count;
+    while ((count = source.read(inBlock, blockSize)) > 0) {
+        filter.processBuffer(inBlock, outBlock, count);
+        if (sink != nullptr) {
+            sink(outBlock, count, context);
+        }
+        total += count;
+    }
+    return total;
+}
+
+#endif // SIGNAL_SOURCE_H
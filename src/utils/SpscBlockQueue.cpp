@@ -0,0 +1,101 @@
+/**
+ * @file SpscBlockQueue.cpp
+ * @brief Implementación de la cola de bloques productor/consumidor sin bloqueos
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @see SpscBlockQueue.h para el protocolo de uso
+ */
+
+#include "SpscBlockQueue.h"
+
+SpscBlockQueue::SpscBlockQueue(uint16_t numBlocks, uint16_t blockSize)
+    : _buffer(nullptr),
+      _blockSize(blockSize ? blockSize : 1),
+      _head(0),
+      _writeBlock(nullptr),
+      _fill(0),
+      _overruns(0),
+      _tail(0)
+{
+    // Potencia de 2: los índices corren libres y el bloque es índice & _mask
+    uint32_t blocks = 2;
+    while (blocks < numBlocks) {
+        blocks <<= 1;
+    }
+    _mask = blocks - 1;
+    _buffer = new float32_t[blocks * _blockSize]();
+}
+
+SpscBlockQueue::~SpscBlockQueue() {
+    delete[] _buffer;
+}
+
+// ====================
+// Productor
+// ====================
+
+float32_t* SpscBlockQueue::beginWrite() {
+    uint32_t tail = __atomic_load_n(&_tail, __ATOMIC_ACQUIRE);
+    if (_head - tail > _mask) {
+        return nullptr;
+    }
+    return _buffer + (_head & _mask) * _blockSize;
+}
+
+void SpscBlockQueue::endWrite() {
+    // Release: el contenido del bloque es visible antes que el nuevo índice
+    __atomic_store_n(&_head, _head + 1, __ATOMIC_RELEASE);
+}
+
+bool SpscBlockQueue::pushSample(float32_t sample) {
+    if (_writeBlock == nullptr) {
+        _writeBlock = beginWrite();
+        if (_writeBlock == nullptr) {
+            __atomic_store_n(&_overruns, _overruns + 1, __ATOMIC_RELAXED);
+            return false;
+        }
+    }
+
+    _writeBlock[_fill++] = sample;
+    if (_fill == _blockSize) {
+        endWrite();
+        _writeBlock = nullptr;
+        _fill = 0;
+    }
+    return true;
+}
+
+// ====================
+// Consumidor
+// ====================
+
+float32_t* SpscBlockQueue::beginRead() {
+    uint32_t head = __atomic_load_n(&_head, __ATOMIC_ACQUIRE);
+    if (head == _tail) {
+        return nullptr;
+    }
+    return _buffer + (_tail & _mask) * _blockSize;
+}
+
+void SpscBlockQueue::endRead() {
+    // Release: el consumidor ha terminado de leer antes de ceder el bloque
+    __atomic_store_n(&_tail, _tail + 1, __ATOMIC_RELEASE);
+}
+
+uint32_t SpscBlockQueue::available() const {
+    return __atomic_load_n(&_head, __ATOMIC_ACQUIRE) - __atomic_load_n(&_tail, __ATOMIC_ACQUIRE);
+}
+
+uint32_t SpscBlockQueue::overruns() const {
+    return __atomic_load_n(&_overruns, __ATOMIC_RELAXED);
+}
+
+void SpscBlockQueue::reset() {
+    _head = 0;
+    _tail = 0;
+    _writeBlock = nullptr;
+    _fill = 0;
+    _overruns = 0;
+}
@@ -0,0 +1,161 @@
+/**
+ * @file SpscBlockQueue.h
+ * @brief Cola de bloques sin bloqueos (un productor, un consumidor) para pasar muestras de una ISR a loop()
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @details En un dispositivo real las muestras llegan desde una ISR de temporizador
+ * y se filtran en loop(). SpscBlockQueue resuelve ese traspaso sin desactivar
+ * interrupciones ni copiar datos:
+ * - La cola es un anillo de numBlocks bloques de blockSize muestras. Con 2 bloques es
+ *   el doble buffer clásico: la ISR llena uno mientras loop() filtra el otro.
+ * - El productor obtiene un bloque libre con beginWrite(), lo rellena en su sitio y
+ *   lo publica con endWrite(). El consumidor obtiene el bloque más antiguo con
+ *   beginRead(), lo procesa en su sitio y lo devuelve con endRead().
+ * - Solo el productor escribe _head y solo el consumidor escribe _tail. Cada índice se
+ *   publica con semántica release y se lee con acquire (builtins __atomic de GCC), así
+ *   que el contenido del bloque es visible antes que el índice que lo publica.
+ * - Los índices están separados BIOFILTERLIB_CACHE_LINE bytes para que productor y
+ *   consumidor no compartan línea de caché en PC.
+ *
+ * El mismo código funciona en el host con un hilo productor en lugar de la ISR, lo
+ * que permite probar el traspaso en Linux (test/host/Test_SpscBlockQueue.cpp).
+ *
+ * @par Ejemplo
+ * @code
+ * SpscBlockQueue queue(4, 32);          // 4 bloques de 32 muestras
+ *
+ * void TC3_Handler() {                  // ISR del temporizador (960 Hz)
+ *     TC_GetStatus(TC1, 0);
+ *     queue.pushSample((analogRead(A0) - 2048) / 2048.0f);
+ * }
+ *
+ * void loop() {
+ *     float32_t out[32];
+ *     while (queue.processBlock(filter, out)) {
+ *         // out contiene el bloque filtrado
+ *     }
+ * }
+ * @endcode
+ *
+ * @note Exactamente un productor y un consumidor. Si la ISR no encuentra bloque libre
+ * la muestra se descarta y se cuenta en overruns(): nunca espera al consumidor.
+ */
+
+#ifndef SPSC_BLOCK_QUEUE_H
+#define SPSC_BLOCK_QUEUE_H
+
+#include <arm_math.h>
+#include "../BioFilterLibConfig.h"
+
+/**
+ * @class SpscBlockQueue
+ * @brief Anillo de bloques de float32_t con traspaso sin copia entre productor y consumidor
+ */
+class SpscBlockQueue {
+    public:
+        /**
+         * @param numBlocks Bloques del anillo (se redondea a potencia de 2, mínimo 2)
+         * @param blockSize Muestras por bloque (el blockSize de los filtros del consumidor)
+         */
+        SpscBlockQueue(uint16_t numBlocks, uint16_t blockSize);
+        ~SpscBlockQueue();
+
+        bool isValid() const { return _buffer != nullptr; }
+
+        // ====================
+        // Productor (ISR o hilo productor)
+        // ====================
+
+        /**
+         * @brief Bloque libre para escribir en su sitio
+         * @return Puntero a blockSize muestras, o nullptr si la cola está llena
+         */
+        float32_t* beginWrite();
+
+        /**
+         * @brief Publica el bloque obtenido con beginWrite()
+         */
+        void endWrite();
+
+        /**
+         * @brief Añade una muestra al bloque en curso y lo publica al completarse
+         * @return false si no había bloque libre (muestra descartada, cuenta en overruns())
+         */
+        bool pushSample(float32_t sample);
+
+        // ====================
+        // Consumidor (loop() o hilo consumidor)
+        // ====================
+
+        /**
+         * @brief Bloque completo más antiguo, para procesarlo en su sitio
+         * @return Puntero a blockSize muestras, o nullptr si no hay bloques completos
+         */
+        float32_t* beginRead();
+
+        /**
+         * @brief Devuelve al productor el bloque obtenido con beginRead()
+         */
+        void endRead();
+
+        /**
+         * @brief Filtra el siguiente bloque completo, si lo hay
+         *
+         * @tparam Filter Cualquier clase con processBuffer(in, out, length)
+         * (FIRFilter, IIRFilter, WaveletFilter, FilterChain...)
+         * @param filter Filtro a aplicar
+         * @param output Destino de blockSize muestras
+         * @return false si no había bloque disponible
+         */
+        template <class Filter>
+        bool processBlock(Filter& filter, float32_t* output) {
+            float32_t* block = beginRead();
+            if (block == nullptr) {
+                return false;
+            }
+            filter.processBuffer(block, output, _blockSize);
+            endRead();
+            return true;
+        }
+
+        /**
+         * @brief Bloques completos pendientes de leer
+         */
+        uint32_t available() const;
+
+        /**
+         * @brief Muestras descartadas por pushSample() con la cola llena
+         */
+        uint32_t overruns() const;
+
+        uint16_t getNumBlocks() const { return (uint16_t)(_mask + 1); }
+        uint16_t getBlockSize() const { return _blockSize; }
+
+        /**
+         * @brief Vacía la cola (solo con productor y consumidor detenidos)
+         */
+        void reset();
+
+    private:
+        // No copiable: posee la memoria de los bloques
+        SpscBlockQueue(const SpscBlockQueue&);
+        SpscBlockQueue& operator=(const SpscBlockQueue&);
+
+        // Solo lectura tras el constructor
+        float32_t* _buffer;
+        uint32_t _mask;
+        uint16_t _blockSize;
+
+        // Escritos solo por el productor
+        alignas(BIOFILTERLIB_CACHE_LINE) uint32_t _head;   ///< Bloques publicados
+        float32_t* _writeBlock;                             ///< Bloque en curso de pushSample()
+        uint16_t _fill;                                     ///< Muestras en _writeBlock
+        uint32_t _overruns;
+
+        // Escrito solo por el consumidor
+        alignas(BIOFILTERLIB_CACHE_LINE) uint32_t _tail;   ///< Bloques liberados
+};
+
+#endif // SPSC_BLOCK_QUEUE_H
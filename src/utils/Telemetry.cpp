@@ -0,0 +1,331 @@
+/**
+ * @file Telemetry.cpp
+ * @brief Implementación del protocolo binario de telemetría
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @see Telemetry.h para el formato de paquete y la interfaz pública
+ */
+
+#include "Telemetry.h"
+#include <string.h>
+
+/**
+ * @brief Tabla de 16 entradas para CRC-16/CCITT por nibbles (32 bytes de flash)
+ */
+static const uint16_t crcNibbleTable[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+uint16_t telemetryCrc16(const uint8_t* data, size_t length, uint16_t crc) {
+    for (size_t i = 0; i < length; i++) {
+        crc = (uint16_t)((crc << 4) ^ crcNibbleTable[(crc >> 12) ^ (data[i] >> 4)]);
+        crc = (uint16_t)((crc << 4) ^ crcNibbleTable[(crc >> 12) ^ (data[i] & 0x0F)]);
+    }
+    return crc;
+}
+
+// ====================
+// COBS
+// ====================
+
+size_t cobsEncode(const uint8_t* input, size_t length, uint8_t* output) {
+    size_t codeIndex = 0;
+    size_t out = 1;
+    uint8_t code = 1;
+
+    for (size_t i = 0; i < length; i++) {
+        if (input[i] == 0) {
+            output[codeIndex] = code;
+            codeIndex = out++;
+            code = 1;
+        } else {
+            output[out++] = input[i];
+            code++;
+            // Bloque de 254 bytes sin ceros: abrir uno nuevo solo si quedan datos
+            if (code == 0xFF && i + 1 < length) {
+                output[codeIndex] = code;
+                codeIndex = out++;
+                code = 1;
+            }
+        }
+    }
+    output[codeIndex] = code;
+    output[out++] = 0x00;
+    return out;
+}
+
+size_t cobsDecode(const uint8_t* input, size_t length, uint8_t* output) {
+    size_t in = 0;
+    size_t out = 0;
+
+    while (in < length) {
+        uint8_t code = input[in++];
+        if (code == 0) {
+            return 0;
+        }
+        for (uint8_t j = 1; j < code; j++) {
+            if (in >= length) {
+                return 0;
+            }
+            output[out++] = input[in++];
+        }
+        if (code < 0xFF && in < length) {
+            output[out++] = 0x00;
+        }
+    }
+    return out;
+}
+
+// ====================
+// TelemetryTx
+// ====================
+
+TelemetryTx::TelemetryTx(uint8_t channels, uint8_t type, float32_t fullScale, uint16_t ringSize)
+    : _channels(channels ? channels : 1),
+      _type(type == TELEMETRY_FLOAT32 ? TELEMETRY_FLOAT32 : TELEMETRY_INT16),
+      _sampleBytes(type == TELEMETRY_FLOAT32 ? 4 : 2),
+      _frames(0),
+      _sequence(0),
+      _size(ringSize),
+      _head(0),
+      _tail(0),
+      _count(0),
+      _dropped(0)
+{
+    // Al menos una trama completa por paquete
+    if (_channels * _sampleBytes > TELEMETRY_MAX_PAYLOAD) {
+        _channels = TELEMETRY_MAX_PAYLOAD / _sampleBytes;
+    }
+    _framesPerPacket = 0;
+    setFramesPerPacket(255);
+
+    if (_type == TELEMETRY_INT16) {
+        _scale = fullScale / 32767.0f;
+        _invScale = 32767.0f / fullScale;
+    } else {
+        _scale = 1.0f;
+        _invScale = 1.0f;
+    }
+
+    _ring = new uint8_t[_size];
+}
+
+TelemetryTx::~TelemetryTx() {
+    delete[] _ring;
+}
+
+void TelemetryTx::setFramesPerPacket(uint8_t frames) {
+    uint32_t maxFrames = TELEMETRY_MAX_PAYLOAD / (_channels * _sampleBytes);
+    if (frames == 0) {
+        frames = 1;
+    }
+    if (frames > maxFrames) {
+        frames = (uint8_t)maxFrames;
+    }
+    // Cerrar el paquete en curso si ya supera el nuevo tamaño
+    if (_frames >= frames) {
+        enqueuePacket();
+    }
+    _framesPerPacket = frames;
+}
+
+bool TelemetryTx::push(const float32_t* values) {
+    uint8_t* p = _packet + TELEMETRY_HEADER_SIZE + (uint32_t)_frames * _channels * _sampleBytes;
+
+    if (_type == TELEMETRY_INT16) {
+        for (uint8_t c = 0; c < _channels; c++) {
+            float32_t scaled = values[c] * _invScale;
+            if (scaled > 32767.0f) scaled = 32767.0f;
+            if (scaled < -32767.0f) scaled = -32767.0f;
+            int16_t v = (int16_t)(scaled >= 0.0f ? scaled + 0.5f : scaled - 0.5f);
+            *p++ = (uint8_t)(v & 0xFF);
+            *p++ = (uint8_t)((v >> 8) & 0xFF);
+        }
+    } else {
+        // float32 en little-endian (orden nativo del Cortex-M3)
+        memcpy(p, values, (size_t)_channels * 4);
+    }
+
+    _frames++;
+    if (_frames >= _framesPerPacket) {
+        return enqueuePacket();
+    }
+    return true;
+}
+
+uint32_t TelemetryTx::pushBlock(const float32_t* const* channels, uint32_t length) {
+    uint32_t dropped = 0;
+    float32_t frame[TELEMETRY_MAX_PAYLOAD / 2];
+    for (uint32_t i = 0; i < length; i++) {
+        for (uint8_t c = 0; c < _channels; c++) {
+            frame[c] = channels[c][i];
+        }
+        if (!push(frame)) {
+            dropped++;
+        }
+    }
+    return dropped;
+}
+
+bool TelemetryTx::flush() {
+    return enqueuePacket();
+}
+
+bool TelemetryTx::enqueuePacket() {
+    if (_frames == 0) {
+        return true;
+    }
+
+    uint32_t payload = (uint32_t)_frames * _channels * _sampleBytes;
+    uint32_t scaleBits;
+    memcpy(&scaleBits, &_scale, 4);
+
+    _packet[0] = _type;
+    _packet[1] = _channels;
+    _packet[2] = _frames;
+    _packet[3] = (uint8_t)(_sequence & 0xFF);
+    _packet[4] = (uint8_t)(_sequence >> 8);
+    _packet[5] = (uint8_t)(scaleBits & 0xFF);
+    _packet[6] = (uint8_t)((scaleBits >> 8) & 0xFF);
+    _packet[7] = (uint8_t)((scaleBits >> 16) & 0xFF);
+    _packet[8] = (uint8_t)(scaleBits >> 24);
+
+    uint32_t length = TELEMETRY_HEADER_SIZE + payload;
+    uint16_t crc = telemetryCrc16(_packet, length);
+    _packet[length++] = (uint8_t)(crc & 0xFF);
+    _packet[length++] = (uint8_t)(crc >> 8);
+
+    _sequence++;
+    _frames = 0;
+
+    uint8_t encoded[TELEMETRY_MAX_ENCODED];
+    uint32_t bytes = (uint32_t)cobsEncode(_packet, length, encoded);
+
+    if (bytes > _size - _count) {
+        _dropped++;
+        return false;
+    }
+
+    // Copia en dos tramos si da la vuelta al buffer circular
+    uint32_t first = _size - _head;
+    if (first > bytes) {
+        first = bytes;
+    }
+    memcpy(_ring + _head, encoded, first);
+    memcpy(_ring, encoded + first, bytes - first);
+    _head = (_head + bytes) % _size;
+    _count += bytes;
+    return true;
+}
+
+void TelemetryTx::consume(uint32_t bytes) {
+    _tail = (_tail + bytes) % _size;
+    _count -= bytes;
+}
+
+// ====================
+// TelemetryPacket / TelemetryDecoder
+// ====================
+
+float32_t TelemetryPacket::sample(uint8_t frame, uint8_t channel) const {
+    uint32_t index = (uint32_t)frame * channels + channel;
+    if (type == TELEMETRY_INT16) {
+        const uint8_t* p = payload + 2 * index;
+        int16_t v = (int16_t)(p[0] | (p[1] << 8));
+        return v * scale;
+    }
+    const uint8_t* p = payload + 4 * index;
+    uint32_t bits = (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+    float32_t value;
+    memcpy(&value, &bits, 4);
+    return value;
+}
+
+TelemetryDecoder::TelemetryDecoder(PacketFn callback, void* context)
+    : _callback(callback),
+      _context(context)
+{
+    reset();
+}
+
+void TelemetryDecoder::reset() {
+    _length = 0;
+    _overflow = false;
+    _synced = false;
+    _expected = 0;
+    _packets = 0;
+    _crcErrors = 0;
+    _framingErrors = 0;
+    _lost = 0;
+}
+
+uint32_t TelemetryDecoder::feed(const uint8_t* data, size_t length) {
+    uint32_t delivered = 0;
+    for (size_t i = 0; i < length; i++) {
+        uint8_t byte = data[i];
+        if (byte != 0x00) {
+            if (_length < sizeof(_buffer)) {
+                _buffer[_length++] = byte;
+            } else {
+                _overflow = true;
+            }
+            continue;
+        }
+
+        // Separador: fin de paquete
+        if (_overflow) {
+            _framingErrors++;
+        } else if (_length > 0 && handleFrame()) {
+            delivered++;
+        }
+        _length = 0;
+        _overflow = false;
+    }
+    return delivered;
+}
+
+bool TelemetryDecoder::handleFrame() {
+    size_t n = cobsDecode(_buffer, _length, _decoded);
+    if (n < TELEMETRY_HEADER_SIZE + TELEMETRY_CRC_SIZE) {
+        _framingErrors++;
+        return false;
+    }
+
+    uint16_t crc = (uint16_t)(_decoded[n - 2] | (_decoded[n - 1] << 8));
+    if (telemetryCrc16(_decoded, n - TELEMETRY_CRC_SIZE) != crc) {
+        _crcErrors++;
+        return false;
+    }
+
+    TelemetryPacket packet;
+    packet.type = _decoded[0];
+    packet.channels = _decoded[1];
+    packet.frames = _decoded[2];
+    packet.sequence = (uint16_t)(_decoded[3] | (_decoded[4] << 8));
+    uint32_t scaleBits = (uint32_t)_decoded[5] | ((uint32_t)_decoded[6] << 8) |
+                         ((uint32_t)_decoded[7] << 16) | ((uint32_t)_decoded[8] << 24);
+    memcpy(&packet.scale, &scaleBits, 4);
+    packet.payload = _decoded + TELEMETRY_HEADER_SIZE;
+
+    size_t sampleBytes = (packet.type == TELEMETRY_FLOAT32) ? 4 : 2;
+    if ((packet.type != TELEMETRY_INT16 && packet.type != TELEMETRY_FLOAT32) ||
+        (size_t)packet.frames * packet.channels * sampleBytes != n - TELEMETRY_HEADER_SIZE - TELEMETRY_CRC_SIZE) {
+        _framingErrors++;
+        return false;
+    }
+
+    if (_synced) {
+        _lost += (uint16_t)(packet.sequence - _expected);
+    }
+    _expected = (uint16_t)(packet.sequence + 1);
+    _synced = true;
+    _packets++;
+
+    if (_callback != nullptr) {
+        _callback(packet, _context);
+    }
+    return true;
+}
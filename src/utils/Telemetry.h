@@ -0,0 +1,247 @@
+/**
+ * @file Telemetry.h
+ * @brief Protocolo binario de telemetría por puerto serie (dispositivo y host)
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @details Sustituye a la salida de texto (`Serial.print(x, 4)` + `delay(5)`), que
+ * limita el envío a unas 200 muestras/s y consume la mayor parte de la CPU en
+ * convertir floats a texto. Cada paquete lleva varias tramas multicanal empaquetadas
+ * en binario:
+ *
+ * | Campo      | Bytes | Contenido                                           |
+ * |------------|-------|-----------------------------------------------------|
+ * | type       | 1     | TELEMETRY_INT16 o TELEMETRY_FLOAT32                 |
+ * | channels   | 1     | Canales por trama                                   |
+ * | frames     | 1     | Tramas (instantes de muestreo) en el paquete        |
+ * | sequence   | 2     | Número de secuencia (LE), detecta paquetes perdidos |
+ * | scale      | 4     | float32 (LE): valor = int16 × scale                 |
+ * | payload    | N     | Muestras entrelazadas: t0c0 t0c1 ... t1c0 ...       |
+ * | crc        | 2     | CRC-16/CCITT-FALSE (LE) de todo lo anterior         |
+ *
+ * El paquete se codifica con COBS (sin bytes 0x00) y se termina con 0x00, de modo
+ * que el receptor se resincroniza en el siguiente separador tras cualquier error.
+ * Los paquetes se limitan a 254 bytes para que COBS añada exactamente 1 byte.
+ *
+ * - TelemetryTx (dispositivo): acumula tramas, codifica paquetes en un buffer
+ *   circular y los vuelca al puerto sin bloquear según availableForWrite().
+ * - TelemetryDecoder (host o dispositivo): recibe bytes en trozos arbitrarios y
+ *   entrega los paquetes válidos con estadísticas de errores y pérdidas.
+ *
+ * A 960 Hz, 2 canales int16 ocupan ~4.2 KB/s con la cabecera: cabe en 115200
+ * baudios con margen y deja la CPU libre para el filtrado.
+ *
+ * @par Ejemplo (dispositivo)
+ * @code
+ * TelemetryTx telemetry(2, TELEMETRY_INT16, 2.0f);   // 2 canales, fondo de escala ±2
+ *
+ * void loop() {
+ *     float32_t frame[2] = {noisy, filtered};
+ *     telemetry.push(frame);                           // no bloquea
+ *     telemetry.pump(Serial);                          // envía lo que quepa
+ * }
+ * @endcode
+ */
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <arm_math.h>
+
+// Tipos de paquete
+#define TELEMETRY_INT16     0x01
+#define TELEMETRY_FLOAT32   0x02
+
+#define TELEMETRY_HEADER_SIZE   9
+#define TELEMETRY_CRC_SIZE      2
+#define TELEMETRY_MAX_PACKET    254     // Sin codificar: COBS añade 1 byte + separador
+#define TELEMETRY_MAX_PAYLOAD   (TELEMETRY_MAX_PACKET - TELEMETRY_HEADER_SIZE - TELEMETRY_CRC_SIZE)
+#define TELEMETRY_MAX_ENCODED   (TELEMETRY_MAX_PACKET + 2)
+
+/**
+ * @brief CRC-16/CCITT-FALSE (polinomio 0x1021, valor inicial 0xFFFF)
+ */
+uint16_t telemetryCrc16(const uint8_t* data, size_t length, uint16_t crc = 0xFFFF);
+
+/**
+ * @brief Codifica un bloque con COBS y añade el separador 0x00
+ * @param input Datos (máx. 254 bytes)
+ * @param length Longitud de los datos
+ * @param output Destino (length + 2 bytes como máximo)
+ * @return Bytes escritos en output, incluido el separador
+ */
+size_t cobsEncode(const uint8_t* input, size_t length, uint8_t* output);
+
+/**
+ * @brief Decodifica un bloque COBS (sin el separador final)
+ * @return Bytes decodificados, o 0 si el bloque está mal formado
+ */
+size_t cobsDecode(const uint8_t* input, size_t length, uint8_t* output);
+
+/**
+ * @class TelemetryTx
+ * @brief Emisor de telemetría con buffer circular no bloqueante
+ *
+ * @details Si el buffer no tiene sitio para un paquete completo, el paquete se
+ * descarta entero (el número de secuencia avanza igualmente, así que el host ve
+ * la pérdida). Nunca se espera al puerto serie.
+ *
+ * @note push(), flush() y pump() deben llamarse desde el mismo contexto (loop()).
+ */
+class TelemetryTx {
+    public:
+        /**
+         * @param channels Canales por trama (1-255)
+         * @param type TELEMETRY_INT16 (2 bytes/muestra) o TELEMETRY_FLOAT32 (4 bytes/muestra)
+         * @param fullScale Fondo de escala para int16: ±fullScale se mapea a ±32767
+         * @param ringSize Bytes del buffer circular de transmisión
+         */
+        TelemetryTx(uint8_t channels, uint8_t type = TELEMETRY_INT16,
+                    float32_t fullScale = 1.0f, uint16_t ringSize = 1024);
+        ~TelemetryTx();
+
+        /**
+         * @brief Limita las tramas por paquete (menos latencia, más cabecera)
+         */
+        void setFramesPerPacket(uint8_t frames);
+
+        uint8_t getFramesPerPacket() const { return _framesPerPacket; }
+
+        /**
+         * @brief Añade una trama (un valor por canal)
+         * @return false si al completarse el paquete no cabía en el buffer (descartado)
+         */
+        bool push(const float32_t* values);
+
+        /**
+         * @brief Añade varias tramas de canales en buffers separados
+         * @param channels Un puntero por canal
+         * @param length Tramas a añadir
+         * @return Paquetes descartados por falta de espacio
+         */
+        uint32_t pushBlock(const float32_t* const* channels, uint32_t length);
+
+        /**
+         * @brief Cierra el paquete en curso aunque no esté lleno
+         */
+        bool flush();
+
+        /**
+         * @brief Vuelca al puerto los bytes pendientes que quepan sin bloquear
+         * @tparam Port Cualquier puerto con availableForWrite() y write(buf, len)
+         * (Serial, SerialUSB, Serial1...)
+         * @return Bytes enviados
+         */
+        template <class Port>
+        uint32_t pump(Port& port) {
+            uint32_t sent = 0;
+            int space = port.availableForWrite();
+            while (space > 0 && _count > 0) {
+                // Tramo contiguo hasta el final del buffer circular
+                uint32_t chunk = _size - _tail;
+                if (chunk > _count) chunk = _count;
+                if (chunk > (uint32_t)space) chunk = (uint32_t)space;
+                port.write(_ring + _tail, chunk);
+                consume(chunk);
+                sent += chunk;
+                space -= chunk;
+            }
+            return sent;
+        }
+
+        uint32_t pendingBytes() const { return _count; }
+        uint32_t droppedPackets() const { return _dropped; }
+        uint16_t sequence() const { return _sequence; }
+
+    private:
+        // No copiable: posee el buffer circular
+        TelemetryTx(const TelemetryTx&);
+        TelemetryTx& operator=(const TelemetryTx&);
+
+        bool enqueuePacket();
+        void consume(uint32_t bytes);
+
+        uint8_t _channels;
+        uint8_t _type;
+        uint8_t _sampleBytes;
+        uint8_t _framesPerPacket;
+        uint8_t _frames;            ///< Tramas en el paquete en curso
+        uint16_t _sequence;
+        float32_t _scale;           ///< Unidades por LSB (int16)
+        float32_t _invScale;
+
+        uint8_t _packet[TELEMETRY_MAX_PACKET];
+
+        uint8_t* _ring;
+        uint32_t _size;
+        uint32_t _head;
+        uint32_t _tail;
+        uint32_t _count;
+        uint32_t _dropped;
+};
+
+/**
+ * @brief Paquete de telemetría decodificado
+ */
+struct TelemetryPacket {
+    uint8_t type;
+    uint8_t channels;
+    uint8_t frames;
+    uint16_t sequence;
+    float32_t scale;
+    const uint8_t* payload;     ///< Válido solo durante la llamada al callback
+
+    /**
+     * @brief Valor de un canal en una trama, ya escalado
+     */
+    float32_t sample(uint8_t frame, uint8_t channel) const;
+};
+
+/**
+ * @class TelemetryDecoder
+ * @brief Receptor de telemetría: separa, decodifica y valida paquetes
+ */
+class TelemetryDecoder {
+    public:
+        typedef void (*PacketFn)(const TelemetryPacket& packet, void* context);
+
+        TelemetryDecoder(PacketFn callback, void* context = nullptr);
+
+        /**
+         * @brief Procesa bytes recibidos (en trozos de cualquier tamaño)
+         * @return Paquetes válidos entregados
+         */
+        uint32_t feed(const uint8_t* data, size_t length);
+
+        void reset();
+
+        uint32_t packets() const { return _packets; }
+        uint32_t crcErrors() const { return _crcErrors; }
+        uint32_t framingErrors() const { return _framingErrors; }
+
+        /**
+         * @brief Paquetes perdidos según los saltos del número de secuencia
+         */
+        uint32_t lostPackets() const { return _lost; }
+
+    private:
+        bool handleFrame();
+
+        PacketFn _callback;
+        void* _context;
+        uint8_t _buffer[TELEMETRY_MAX_ENCODED];
+        uint8_t _decoded[TELEMETRY_MAX_ENCODED];
+        size_t _length;
+        bool _overflow;
+        bool _synced;               ///< Hay un número de secuencia previo
+        uint16_t _expected;
+        uint32_t _packets;
+        uint32_t _crcErrors;
+        uint32_t _framingErrors;
+        uint32_t _lost;
+};
+
+#endif // TELEMETRY_H
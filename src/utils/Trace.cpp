@@ -0,0 +1,89 @@
+/**
+ * @file Trace.cpp
+ * @brief Implementación del anillo de eventos de traza (solo con BIOFILTERLIB_TRACE)
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @see Trace.h para el protocolo de uso
+ */
+
+#include "Trace.h"
+#include <string.h>
+
+#if BIOFILTERLIB_TRACE
+
+TraceBuffer::TraceBuffer(uint32_t capacity)
+    : _events(nullptr),
+      _numTracks(0),
+      _head(0),
+      _open(0),
+      _dropped(0),
+      _tail(0)
+{
+    // Potencia de 2: los índices corren libres y la posición es índice & _mask
+    uint32_t size = 4;
+    while (size < capacity) {
+        size <<= 1;
+    }
+    _mask = size - 1;
+    _events = new TraceEvent[size]();
+    for (uint16_t i = 0; i < TRACE_MAX_TRACKS; i++) {
+        _names[i] = "";
+    }
+}
+
+TraceBuffer::~TraceBuffer() {
+    delete[] _events;
+}
+
+uint16_t TraceBuffer::addTrack(const char* name) {
+    name = (name != nullptr) ? name : "";
+    // Mismo nombre, misma etapa: un pipeline reconstruido reutiliza sus filas
+    for (uint16_t i = 0; i < _numTracks; i++) {
+        if (strcmp(_names[i], name) == 0) {
+            return i;
+        }
+    }
+    if (_numTracks == TRACE_MAX_TRACKS) {
+        return TRACE_MAX_TRACKS - 1;
+    }
+    _names[_numTracks] = name;
+    return _numTracks++;
+}
+
+const char* TraceBuffer::getTrackName(uint16_t track) const {
+    return (track < _numTracks) ? _names[track] : "";
+}
+
+// ====================
+// Consumidor
+// ====================
+
+bool TraceBuffer::pop(TraceEvent& event) {
+    uint32_t head = __atomic_load_n(&_head, __ATOMIC_ACQUIRE);
+    if (head == _tail) {
+        return false;
+    }
+    event = _events[_tail & _mask];
+    // Release: el evento se ha copiado antes de ceder su posición
+    __atomic_store_n(&_tail, _tail + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+uint32_t TraceBuffer::available() const {
+    return __atomic_load_n(&_head, __ATOMIC_ACQUIRE) - __atomic_load_n(&_tail, __ATOMIC_ACQUIRE);
+}
+
+uint32_t TraceBuffer::getDropped() const {
+    return __atomic_load_n(&_dropped, __ATOMIC_RELAXED);
+}
+
+void TraceBuffer::reset() {
+    _head = 0;
+    _tail = 0;
+    _open = 0;
+    _dropped = 0;
+}
+
+#endif // BIOFILTERLIB_TRACE
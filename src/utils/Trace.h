@@ -0,0 +1,299 @@
+/**
+ * @file Trace.h
+ * @brief Trazas de inicio/fin por llamada de filtro en un anillo sin bloqueos
+ * @author Sergio
+ * @version 1.0.0
+ * @date 2025
+ *
+ * @details CycleHistogram (Profiler.h) dice cuánto tarda cada etapa, pero no en qué
+ * orden ni qué bloque concreto hizo perder el plazo. TraceBuffer guarda un evento de
+ * inicio y otro de fin por cada llamada (etapa, longitud del bloque, ciclos de
+ * CycleCounter) para reconstruir la línea de tiempo completa:
+ *
+ * - Los eventos van a un anillo de un productor y un consumidor, con el mismo
+ *   protocolo que SpscBlockQueue: índices publicados con release y leídos con
+ *   acquire (builtins __atomic de GCC). El productor (la ISR o loop()) nunca espera.
+ * - Un inicio solo se anota si queda sitio también para su fin y para los fines de
+ *   las llamadas abiertas, así que los pares inicio/fin nunca quedan cojos. Si no
+ *   cabe, la llamada entera se descarta y se cuenta en getDropped().
+ * - Traced<Filter> envuelve cualquier etapa de FilterChain y anota cada
+ *   processSample() y processBuffer() con el nombre de la etapa.
+ * - En PC, ChromeTraceWriter (src/host/TraceExport.h) vacía el anillo a un JSON de
+ *   Chrome trace que abren chrome://tracing y Perfetto (ui.perfetto.dev).
+ *   extras/trace_replay.cpp traza la reproducción completa de las señales de
+ *   Waveforms.h por un pipeline.
+ *
+ * Con BIOFILTERLIB_TRACE a 0 (por defecto, ver BioFilterLibConfig.h) TraceBuffer no
+ * reserva memoria ni anota nada y Traced<Filter> solo reenvía las llamadas.
+ *
+ * @par Ejemplo
+ * @code
+ * TraceBuffer trace(1024);                              // 12 KB: 1024 eventos
+ * Traced<IIRFilter> notchStage(notch, trace, "notch");
+ * Traced<FIRFilter> lowpassStage(lowpass, trace, "lowpass");
+ * FilterChain<Traced<IIRFilter>, Traced<FIRFilter> > chain(32, notchStage, lowpassStage);
+ *
+ * chain.processBuffer(in, out, 32);                     // 4 eventos
+ * TraceEvent event;
+ * while (trace.pop(event)) { ... }                      // o ChromeTraceWriter en PC
+ * @endcode
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <arm_math.h>
+#include "../BioFilterLibConfig.h"
+#include "Profiler.h"
+
+#define TRACE_MAX_TRACKS 16
+
+/**
+ * @brief Tipo de evento
+ */
+enum TracePhase {
+    TRACE_BEGIN = 0,
+    TRACE_END = 1
+};
+
+/**
+ * @brief Evento de traza (12 bytes)
+ */
+struct TraceEvent {
+    uint32_t timestamp;     ///< CycleCounter::now() (se desborda; ver ChromeTraceWriter)
+    uint16_t track;         ///< Etapa (TraceBuffer::addTrack())
+    uint8_t phase;          ///< TRACE_BEGIN o TRACE_END
+    uint8_t reserved;
+    uint32_t length;        ///< Muestras del bloque (0 en TRACE_END)
+};
+
+#if BIOFILTERLIB_TRACE
+
+/**
+ * @class TraceBuffer
+ * @brief Anillo de eventos de traza (un productor, un consumidor)
+ */
+class TraceBuffer {
+    public:
+        /**
+         * @param capacity Eventos del anillo (se redondea a potencia de 2, mínimo 4)
+         */
+        explicit TraceBuffer(uint32_t capacity);
+        ~TraceBuffer();
+
+        bool isValid() const { return _events != nullptr; }
+
+        /**
+         * @brief Registra una etapa y devuelve su identificador
+         *
+         * @param name Nombre para la exportación (debe seguir vivo: un literal)
+         * @return Identificador (el mismo para el mismo nombre), o el último si se
+         * superan TRACE_MAX_TRACKS
+         */
+        uint16_t addTrack(const char* name);
+
+        const char* getTrackName(uint16_t track) const;
+        uint16_t getNumTracks() const { return _numTracks; }
+
+        // ====================
+        // Productor (ISR, loop() o hilo de procesamiento)
+        // ====================
+
+        /**
+         * @brief Anota el inicio de una llamada
+         * @return false si no había sitio: la llamada no se traza y end() no debe llamarse
+         */
+        bool begin(uint16_t track, uint32_t length) {
+            uint32_t tail = __atomic_load_n(&_tail, __ATOMIC_ACQUIRE);
+            // Sitio para este inicio, su fin y los fines de las llamadas abiertas
+            if (_head - tail + 2 + _open > _mask + 1) {
+                __atomic_store_n(&_dropped, _dropped + 1, __ATOMIC_RELAXED);
+                return false;
+            }
+            _open++;
+            push(track, TRACE_BEGIN, length);
+            return true;
+        }
+
+        /**
+         * @brief Anota el fin de una llamada cuyo begin() devolvió true (siempre cabe)
+         */
+        void end(uint16_t track) {
+            _open--;
+            push(track, TRACE_END, 0);
+        }
+
+        /**
+         * @brief Anota la llamada en la que vive (inicio al construir, fin al salir)
+         */
+        class Scope {
+            public:
+                Scope(TraceBuffer& trace, uint16_t track, uint32_t length)
+                    : _trace(trace), _track(track), _recorded(trace.begin(track, length)) {}
+                ~Scope() {
+                    if (_recorded) {
+                        _trace.end(_track);
+                    }
+                }
+
+            private:
+                Scope(const Scope&);
+                Scope& operator=(const Scope&);
+
+                TraceBuffer& _trace;
+                uint16_t _track;
+                bool _recorded;
+        };
+
+        // ====================
+        // Consumidor
+        // ====================
+
+        /**
+         * @brief Extrae el evento más antiguo
+         * @return false si el anillo está vacío
+         */
+        bool pop(TraceEvent& event);
+
+        /**
+         * @brief Eventos pendientes de leer
+         */
+        uint32_t available() const;
+
+        /**
+         * @brief Llamadas no trazadas por falta de sitio
+         */
+        uint32_t getDropped() const;
+
+        uint32_t getCapacity() const { return _mask + 1; }
+
+        /**
+         * @brief Vacía el anillo (solo con productor y consumidor detenidos)
+         */
+        void reset();
+
+        uint32_t getMemoryUsage() const {
+            return sizeof(*this) + (_events ? (_mask + 1) * sizeof(TraceEvent) : 0);
+        }
+
+    private:
+        // No copiable: posee el anillo
+        TraceBuffer(const TraceBuffer&);
+        TraceBuffer& operator=(const TraceBuffer&);
+
+        void push(uint16_t track, uint8_t phase, uint32_t length) {
+            TraceEvent& event = _events[_head & _mask];
+            event.timestamp = CycleCounter::now();
+            event.track = track;
+            event.phase = phase;
+            event.reserved = 0;
+            event.length = length;
+            // Release: el evento es visible antes que el nuevo índice
+            __atomic_store_n(&_head, _head + 1, __ATOMIC_RELEASE);
+        }
+
+        // Solo lectura tras el constructor (y addTrack() durante la configuración)
+        TraceEvent* _events;
+        uint32_t _mask;
+        const char* _names[TRACE_MAX_TRACKS];
+        uint16_t _numTracks;
+
+        // Escritos solo por el productor
+        alignas(BIOFILTERLIB_CACHE_LINE) uint32_t _head;   ///< Eventos publicados
+        uint32_t _open;                                     ///< Llamadas con inicio y sin fin
+        uint32_t _dropped;
+
+        // Escrito solo por el consumidor
+        alignas(BIOFILTERLIB_CACHE_LINE) uint32_t _tail;   ///< Eventos leídos
+};
+
+#else
+
+/**
+ * @brief Trazas desactivadas: misma interfaz, sin memoria ni eventos
+ */
+class TraceBuffer {
+    public:
+        explicit TraceBuffer(uint32_t capacity) { (void)capacity; }
+
+        bool isValid() const { return true; }
+        uint16_t addTrack(const char* name) { (void)name; return 0; }
+        const char* getTrackName(uint16_t track) const { (void)track; return ""; }
+        uint16_t getNumTracks() const { return 0; }
+
+        bool begin(uint16_t track, uint32_t length) { (void)track; (void)length; return false; }
+        void end(uint16_t track) { (void)track; }
+
+        class Scope {
+            public:
+                Scope(TraceBuffer& trace, uint16_t track, uint32_t length) {
+                    (void)trace;
+                    (void)track;
+                    (void)length;
+                }
+        };
+
+        bool pop(TraceEvent& event) { (void)event; return false; }
+        uint32_t available() const { return 0; }
+        uint32_t getDropped() const { return 0; }
+        uint32_t getCapacity() const { return 0; }
+        void reset() {}
+        uint32_t getMemoryUsage() const { return 0; }
+
+    private:
+        TraceBuffer(const TraceBuffer&);
+        TraceBuffer& operator=(const TraceBuffer&);
+};
+
+#endif // BIOFILTERLIB_TRACE
+
+/**
+ * @class Traced
+ * @brief Etapa que anota en un TraceBuffer cada llamada al filtro que envuelve
+ *
+ * @tparam Filter Cualquier clase con la interfaz de etapa de FilterChain
+ *
+ * @note Guarda el filtro y el TraceBuffer por referencia: deben vivir al menos tanto
+ * como el envoltorio.
+ */
+template <typename Filter>
+class Traced {
+    public:
+        /**
+         * @param name Nombre de la etapa en la traza (un literal)
+         */
+        Traced(Filter& filter, TraceBuffer& trace, const char* name)
+            : _filter(filter), _trace(trace), _track(trace.addTrack(name)) {}
+
+        float32_t processSample(float32_t input) {
+            TraceBuffer::Scope scope(_trace, _track, 1);
+            return _filter.processSample(input);
+        }
+
+        void processBuffer(float32_t* input, float32_t* output, uint32_t length) {
+            TraceBuffer::Scope scope(_trace, _track, length);
+            _filter.processBuffer(input, output, length);
+        }
+
+        float32_t getGroupDelay(float32_t normalizedFrequency = 0.0f) const {
+            return _filter.getGroupDelay(normalizedFrequency);
+        }
+
+        uint32_t getMemoryUsage() const {
+            return _filter.getMemoryUsage();
+        }
+
+        void reset() {
+            _filter.reset();
+        }
+
+        Filter& getFilter() { return _filter; }
+        uint16_t getTrack() const { return _track; }
+
+    private:
+        Filter& _filter;
+        TraceBuffer& _trace;
+        uint16_t _track;
+};
+
+#endif // TRACE_H
@@ -0,0 +1,240 @@
+/**
+ * @file Waveforms.cpp
+ * @brief Acceso a las señales de prueba de BioFilterLib
+ * @author Sergio
+ * @version 2.1.0
+ * @date 2025
+ *
+ * @details Implementa la búsqueda de señales por etiqueta, loadSignal() y el
+ * decodificador en streaming del flujo delta + Rice (formato descrito en
+ * extras/waveforms_rice.py).
+ */
+
+#include "Waveforms.h"
+
+// Parámetros del flujo Rice (deben coincidir con extras/waveforms_rice.py)
+#define WAVEFORMS_RICE_BLOCK      32    // Diferencias por bloque (un k por bloque)
+#define WAVEFORMS_RICE_ESCAPE     16    // Cociente a partir del cual se escapa
+#define WAVEFORMS_RAW_BITS        12    // Bits de la primera muestra
+#define WAVEFORMS_ESCAPE_BITS     13    // Bits del valor zigzag escapado
+
+struct SignalMap {
+    const char* tag;
+    const char* name;
+    int8_t index;
+};
+
+// Tabla de señales
+static const SignalMap signalTable[] = {
+    {"ecg_clean",             "Clean ECG",             0},
+    {"0",                     "Clean ECG",             0},
+    {"ecg_60hz_noised",       "ECG with 60Hz noise",   1},
+    {"1",                     "ECG with 60Hz noise",   1},
+    {"ecg_320hz_noised",      "ECG with 320Hz noise",  2},
+    {"2",                     "ECG with 320Hz noise",  2},
+    {"ecg_white_noise",       "ECG with white noise",  3},
+    {"3",                     "ECG with white noise",  3},
+    {"white_noise",           "White noise",           4},
+    {"4",                     "White noise",           4},
+};
+
+/**
+ * @brief Comparación de cadenas sin distinguir mayúsculas (solo ASCII)
+ */
+static bool tagEquals(const char* a, const char* b) {
+    while (*a && *b) {
+        char ca = (*a >= 'A' && *a <= 'Z') ? (*a + 32) : *a;
+        char cb = (*b >= 'A' && *b <= 'Z') ? (*b + 32) : *b;
+        if (ca != cb) return false;
+        a++;
+        b++;
+    }
+    return *a == *b;
+}
+
+static const SignalMap* findSignal(const char* tag) {
+    if (tag == nullptr) return nullptr;
+
+    for (unsigned int i = 0; i < sizeof(signalTable) / sizeof(signalTable[0]); i++) {
+        if (tagEquals(tag, signalTable[i].tag)) {
+            return &signalTable[i];
+        }
+    }
+    return nullptr;
+}
+
+// ====================
+// WaveformDecoder
+// ====================
+
+WaveformDecoder::WaveformDecoder()
+    : _signal(0xFF),
+      _k(0),
+      _previous(0),
+      _position(waveformsNumSamples),
+      _bitPos(0)
+{
+}
+
+bool WaveformDecoder::begin(uint8_t signalIndex) {
+    if (signalIndex >= waveformsNumSignals) {
+        _signal = 0xFF;
+        _position = waveformsNumSamples;
+        return false;
+    }
+
+    _signal = signalIndex;
+    _position = 0;
+    _previous = 0;
+    _k = 0;
+#if BIOFILTERLIB_WAVEFORMS_RICE
+    _bitPos = waveformsRiceOffset[signalIndex] * 8;
+#endif
+    return true;
+}
+
+uint32_t WaveformDecoder::readBits(uint8_t numBits) {
+#if BIOFILTERLIB_WAVEFORMS_RICE
+    uint32_t value = 0;
+    while (numBits > 0) {
+        // Tomar tantos bits como queden en el byte actual (MSB primero)
+        uint8_t byte = waveformsRiceData[_bitPos >> 3];
+        uint8_t bitInByte = _bitPos & 7;
+        uint8_t available = 8 - bitInByte;
+        uint8_t take = (numBits < available) ? numBits : available;
+
+        uint8_t bits = (byte >> (available - take)) & ((1u << take) - 1);
+        value = (value << take) | bits;
+
+        _bitPos += take;
+        numBits -= take;
+    }
+    return value;
+#else
+    (void)numBits;
+    return 0;
+#endif
+}
+
+uint16_t WaveformDecoder::nextRaw() {
+    if (_position >= waveformsNumSamples) {
+        return 0;
+    }
+
+#if BIOFILTERLIB_WAVEFORMS_RICE
+    if (_position == 0) {
+        _previous = (uint16_t)readBits(WAVEFORMS_RAW_BITS);
+    } else {
+        // Cada bloque de diferencias empieza con su parámetro k
+        if ((_position - 1) % WAVEFORMS_RICE_BLOCK == 0) {
+            _k = (uint8_t)readBits(4);
+        }
+
+        // Cociente en unario (q unos terminados en cero)
+        uint32_t q = 0;
+        while (q < WAVEFORMS_RICE_ESCAPE && readBits(1) == 1) {
+            q++;
+        }
+
+        uint32_t zigzag;
+        if (q >= WAVEFORMS_RICE_ESCAPE) {
+            zigzag = readBits(WAVEFORMS_ESCAPE_BITS);
+        } else {
+            zigzag = (q << _k) | readBits(_k);
+        }
+
+        // Deshacer zigzag: 0, -1, 1, -2, 2, ...
+        int32_t delta = (zigzag & 1) ? -(int32_t)((zigzag + 1) >> 1) : (int32_t)(zigzag >> 1);
+        _previous = (uint16_t)((int32_t)_previous + delta);
+    }
+#else
+    _previous = waveformsTable[_signal][_position];
+#endif
+
+    _position++;
+    return _previous;
+}
+
+uint32_t WaveformDecoder::read(float32_t* buffer, uint32_t length) {
+    if (_signal >= waveformsNumSignals) {
+        return 0;
+    }
+
+    uint32_t count = remaining();
+    if (length < count) {
+        count = length;
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        buffer[i] = ((float32_t)nextRaw() - 2048.0f) / 2048.0f;
+    }
+    return count;
+}
+
+bool WaveformDecoder::seek(uint32_t sample) {
+    if (_signal >= waveformsNumSignals || sample > waveformsNumSamples) {
+        return false;
+    }
+
+#if BIOFILTERLIB_WAVEFORMS_RICE
+    // El flujo es diferencial: hay que decodificar desde el principio
+    if (sample < _position) {
+        begin(_signal);
+    }
+    while (_position < sample) {
+        nextRaw();
+    }
+#else
+    _position = sample;
+#endif
+    return true;
+}
+
+// ====================
+// FUNCIONES
+// ====================
+
+int8_t getSignalIndex(const char* tag) {
+    const SignalMap* entry = findSignal(tag);
+    return entry ? entry->index : -1;
+}
+
+bool loadSignal(float32_t* buffer, const char* tag, uint16_t numSamples) {
+    if (buffer == nullptr || tag == nullptr) {
+        return false;
+    }
+
+    int8_t index = getSignalIndex(tag);
+    if (index < 0) {
+        return false;
+    }
+
+    // Limitar al tamaño máximo disponible
+    if (numSamples > maxSamplesNum) {
+        numSamples = maxSamplesNum;
+    }
+
+    WaveformDecoder decoder;
+    decoder.begin((uint8_t)index);
+
+    // Cargar señal (las muestras tras el final de la tabla se rellenan con 0 crudo)
+    for (uint16_t i = 0; i < numSamples; i++) {
+        buffer[i] = ((float32_t)decoder.nextRaw() - 2048.0f) / 2048.0f;
+    }
+
+    return true;
+}
+
+const char* getSignalName(const char* tag) {
+    const SignalMap* entry = findSignal(tag);
+    return entry ? entry->name : "Desconocida";
+}
+
+void printSignals() {
+    Serial.println("Señales disponibles:");
+    Serial.println("  'ecg_clean'  - Clean ECG");
+    Serial.println("  'ecg_60hz_noised' - ECG with 60Hz noise");
+    Serial.println("  'ecg_320hz_noised' - ECG with 320Hz noise");
+    Serial.println("  'ecg_white_noise' - ECG with white noise");
+    Serial.println("  'white_noise' - White noise");
+}
@@ -2,9 +2,25 @@
  * @file Waveforms.h
  * @brief Señales de prueba para BioFilterLib
  * @author Sergio
- * @version 2.0.0
+ * @version 2.1.0
  * @date 2025
  *
+ * @details Los datos viven en WaveformsData.cpp (una sola definición para todo
+ * el programa). Este header solo declara las tablas y la interfaz de acceso:
+ * - loadSignal(): copia y normaliza una señal en un buffer float32_t
+ * - WaveformDecoder: lectura en streaming, muestra a muestra o por bloques,
+ *   sin importar si la tabla está comprimida (ver BioFilterLibConfig.h)
+ * - TableSource (SignalSource.h): la misma lectura como fuente de bloques
+ *
+ * @par Ejemplo
+ * @code
+ * WaveformDecoder dec;
+ * dec.begin(getSignalIndex("ecg_60hz_noised"));
+ * float32_t block[32];
+ * while (dec.read(block, 32) > 0) {
+ *     filter.processBuffer(block, out, 32);
+ * }
+ * @endcode
  */
 
 #ifndef WAVEFORMS_H
@@ -14,1602 +30,102 @@
 #include <stdint.h>
 #include <string.h>
 #include <arm_math.h>
+#include "BioFilterLibConfig.h"
 
 
-// Tamaño de las señales
+// Tamaño máximo que acepta loadSignal (las muestras tras waveformsNumSamples valen 0)
 const uint16_t maxSamplesNum = 3000;
 
+// Número de señales y de muestras reales por señal (fs = 960 Hz)
+const uint8_t waveformsNumSignals = 5;
+const uint16_t waveformsNumSamples = 2780;
+
 // ====================
-// DATOS DE EJEMPLO
+// DATOS (WaveformsData.cpp)
 // ====================
 
-static const uint16_t waveformsTable[5][maxSamplesNum] = {
-
-    // ECG limpio, fs = 960Hz, duracion = 2.896s, numSamples = 2780
-    {
-        0x2CC, 0x2D0, 0x2D3, 0x2D7, 0x2DA, 0x2DE, 0x2E2, 0x2E6, 0x2EA, 0x2EE,
-        0x2F2, 0x2F6, 0x2FB, 0x2FF, 0x304, 0x309, 0x30E, 0x313, 0x318, 0x31D,
-        0x323, 0x328, 0x32E, 0x334, 0x33A, 0x340, 0x346, 0x34D, 0x354, 0x35A,
-        0x361, 0x369, 0x370, 0x377, 0x37F, 0x387, 0x38F, 0x397, 0x39F, 0x3A8,
-        0x3B0, 0x3B9, 0x3C2, 0x3CB, 0x3D4, 0x3DE, 0x3E7, 0x3F1, 0x3FB, 0x405,
-        0x40F, 0x41A, 0x424, 0x42F, 0x43A, 0x445, 0x450, 0x45B, 0x467, 0x472,
-        0x47E, 0x48A, 0x496, 0x4A2, 0x4AF, 0x4BB, 0x4C8, 0x4D5, 0x4E2, 0x4EF,
-        0x4FC, 0x509, 0x516, 0x524, 0x531, 0x53F, 0x54C, 0x55A, 0x567, 0x575,
-        0x582, 0x590, 0x59D, 0x5AA, 0x5B8, 0x5C5, 0x5D2, 0x5E0, 0x5ED, 0x5FA,
-        0x607, 0x614, 0x620, 0x62D, 0x639, 0x646, 0x652, 0x65E, 0x66A, 0x676,
-        0x681, 0x68D, 0x698, 0x6A3, 0x6AE, 0x6B8, 0x6C3, 0x6CD, 0x6D7, 0x6E1,
-        0x6EA, 0x6F3, 0x6FC, 0x705, 0x70D, 0x716, 0x71E, 0x725, 0x72C, 0x733,
-        0x73A, 0x741, 0x747, 0x74C, 0x752, 0x757, 0x75C, 0x760, 0x764, 0x768,
-        0x76C, 0x76F, 0x771, 0x774, 0x775, 0x777, 0x778, 0x779, 0x779, 0x779,
-        0x779, 0x778, 0x777, 0x775, 0x773, 0x771, 0x76E, 0x76A, 0x766, 0x762,
-        0x75D, 0x758, 0x752, 0x74C, 0x746, 0x73F, 0x738, 0x731, 0x729, 0x721,
-        0x718, 0x70F, 0x706, 0x6FD, 0x6F3, 0x6EA, 0x6E0, 0x6D5, 0x6CB, 0x6C0,
-        0x6B5, 0x6AA, 0x69E, 0x693, 0x687, 0x67B, 0x66F, 0x663, 0x657, 0x64A,
-        0x63E, 0x631, 0x625, 0x618, 0x60B, 0x5FE, 0x5F1, 0x5E4, 0x5D7, 0x5CA,
-        0x5BD, 0x5B0, 0x5A2, 0x595, 0x588, 0x57B, 0x56E, 0x560, 0x553, 0x546,
-        0x539, 0x52C, 0x51F, 0x512, 0x506, 0x4F9, 0x4EC, 0x4DF, 0x4D3, 0x4C7,
-        0x4BA, 0x4AE, 0x4A2, 0x496, 0x48A, 0x47E, 0x472, 0x467, 0x45B, 0x450,
-        0x445, 0x43A, 0x42F, 0x424, 0x419, 0x40F, 0x405, 0x3FB, 0x3F1, 0x3E7,
-        0x3DD, 0x3D4, 0x3CA, 0x3C1, 0x3B8, 0x3AF, 0x3A6, 0x39E, 0x396, 0x38E,
-        0x386, 0x37E, 0x376, 0x36F, 0x367, 0x360, 0x359, 0x353, 0x34C, 0x346,
-        0x33F, 0x339, 0x334, 0x32E, 0x328, 0x323, 0x31E, 0x319, 0x314, 0x30F,
-        0x30B, 0x306, 0x302, 0x2FE, 0x2FA, 0x2F6, 0x2F3, 0x2EF, 0x2EC, 0x2E9,
-        0x2E5, 0x2E2, 0x2E0, 0x2DD, 0x2DA, 0x2D8, 0x2D5, 0x2D3, 0x2D1, 0x2CE,
-        0x2CC, 0x2CA, 0x2C9, 0x2C7, 0x2C5, 0x2C4, 0x2C2, 0x2C1, 0x2BF, 0x2BE,
-        0x2BD, 0x2BC, 0x2BB, 0x2BA, 0x2B9, 0x2B8, 0x2B7, 0x2B6, 0x2B6, 0x2B5,
-        0x2B4, 0x2B4, 0x2B3, 0x2B3, 0x2B2, 0x2B2, 0x2B2, 0x2B2, 0x2B1, 0x2B1,
-        0x2B1, 0x2B1, 0x2B1, 0x2B1, 0x2B1, 0x2B1, 0x2B1, 0x2B1, 0x2B1, 0x2B1,
-        0x2B1, 0x2B1, 0x2B2, 0x2B2, 0x2B2, 0x2B2, 0x2B2, 0x2B3, 0x2B3, 0x2B3,
-        0x2B4, 0x2B4, 0x2B4, 0x2B5, 0x2B5, 0x2B6, 0x2B6, 0x2B6, 0x2B7, 0x2B7,
-        0x2B8, 0x2B8, 0x2B9, 0x2B9, 0x2B9, 0x2BA, 0x2BA, 0x2BB, 0x2BB, 0x2BC,
-        0x2BC, 0x2BD, 0x2BE, 0x2BE, 0x2BF, 0x2BF, 0x2C0, 0x2C0, 0x2C1, 0x2C2,
-        0x2C2, 0x2C3, 0x2C4, 0x2C4, 0x2C5, 0x2C6, 0x2C6, 0x2C7, 0x2C8, 0x2C8,
-        0x2C9, 0x2CA, 0x2CB, 0x2CB, 0x2CC, 0x2CD, 0x2CD, 0x2CE, 0x2CF, 0x2D0,
-        0x2D0, 0x2D1, 0x2D2, 0x2D2, 0x2D3, 0x2D4, 0x2D4, 0x2D5, 0x2D6, 0x2D7,
-        0x2D7, 0x2D8, 0x2D9, 0x2D9, 0x2DA, 0x2DB, 0x2DB, 0x2DC, 0x2DD, 0x2DD,
-        0x2DE, 0x2DF, 0x2DF, 0x2E0, 0x2E1, 0x2E1, 0x2E2, 0x2E3, 0x2E3, 0x2E4,
-        0x2E5, 0x2E5, 0x2E6, 0x2E7, 0x2E7, 0x2E8, 0x2E9, 0x2E9, 0x2EA, 0x2EB,
-        0x2EB, 0x2EC, 0x2ED, 0x2ED, 0x2EE, 0x2EF, 0x2F0, 0x2F0, 0x2F1, 0x2F2,
-        0x2F3, 0x2F4, 0x2F4, 0x2F5, 0x2F6, 0x2F7, 0x2F8, 0x2F9, 0x2FA, 0x2FB,
-        0x2FC, 0x2FD, 0x2FE, 0x2FF, 0x300, 0x301, 0x302, 0x303, 0x304, 0x306,
-        0x307, 0x308, 0x30A, 0x30B, 0x30C, 0x30E, 0x30F, 0x311, 0x313, 0x314,
-        0x316, 0x318, 0x31A, 0x31C, 0x31E, 0x31F, 0x321, 0x323, 0x326, 0x328,
-        0x32A, 0x32C, 0x32F, 0x332, 0x334, 0x337, 0x33A, 0x33E, 0x341, 0x345,
-        0x349, 0x34D, 0x351, 0x356, 0x35A, 0x35F, 0x365, 0x36A, 0x370, 0x376,
-        0x37C, 0x382, 0x389, 0x390, 0x397, 0x39F, 0x3A6, 0x3AE, 0x3B7, 0x3BF,
-        0x3C8, 0x3D1, 0x3DA, 0x3E4, 0x3EE, 0x3F8, 0x402, 0x40D, 0x417, 0x422,
-        0x42D, 0x439, 0x444, 0x450, 0x45C, 0x468, 0x475, 0x481, 0x48E, 0x49A,
-        0x4A7, 0x4B4, 0x4C1, 0x4CE, 0x4DB, 0x4E9, 0x4F6, 0x503, 0x511, 0x51E,
-        0x52B, 0x539, 0x546, 0x553, 0x560, 0x56D, 0x579, 0x586, 0x592, 0x59E,
-        0x5A9, 0x5B5, 0x5BF, 0x5CA, 0x5D4, 0x5DE, 0x5E7, 0x5EF, 0x5F8, 0x5FF,
-        0x607, 0x60D, 0x613, 0x619, 0x61E, 0x622, 0x626, 0x629, 0x62C, 0x62E,
-        0x630, 0x631, 0x631, 0x630, 0x62F, 0x62E, 0x62C, 0x629, 0x625, 0x622,
-        0x61D, 0x618, 0x612, 0x60C, 0x605, 0x5FE, 0x5F6, 0x5EE, 0x5E5, 0x5DC,
-        0x5D2, 0x5C8, 0x5BE, 0x5B3, 0x5A7, 0x59C, 0x590, 0x584, 0x577, 0x56B,
-        0x55E, 0x551, 0x544, 0x536, 0x529, 0x51C, 0x50E, 0x501, 0x4F4, 0x4E6,
-        0x4D9, 0x4CC, 0x4BF, 0x4B2, 0x4A5, 0x498, 0x48B, 0x47F, 0x472, 0x466,
-        0x45A, 0x44F, 0x443, 0x438, 0x42D, 0x422, 0x418, 0x40D, 0x403, 0x3FA,
-        0x3F0, 0x3E7, 0x3DE, 0x3D6, 0x3CE, 0x3C6, 0x3BE, 0x3B7, 0x3B0, 0x3A9,
-        0x3A2, 0x39C, 0x396, 0x391, 0x38B, 0x386, 0x382, 0x37D, 0x379, 0x375,
-        0x371, 0x36D, 0x36A, 0x366, 0x363, 0x360, 0x35D, 0x359, 0x356, 0x353,
-        0x34F, 0x34C, 0x348, 0x344, 0x340, 0x33C, 0x337, 0x332, 0x32D, 0x327,
-        0x321, 0x31A, 0x312, 0x30A, 0x301, 0x2F8, 0x2EE, 0x2E3, 0x2D7, 0x2CA,
-        0x2BC, 0x2AD, 0x29D, 0x28C, 0x279, 0x265, 0x24E, 0x236, 0x21D, 0x204,
-        0x1EB, 0x1D3, 0x1BC, 0x1A7, 0x195, 0x185, 0x179, 0x170, 0x16C, 0x16C,
-        0x171, 0x17B, 0x18A, 0x19F, 0x1BA, 0x1DB, 0x202, 0x22F, 0x263, 0x29D,
-        0x2DE, 0x325, 0x374, 0x3C8, 0x424, 0x485, 0x4ED, 0x55C, 0x5D0, 0x64B,
-        0x6CA, 0x750, 0x7DA, 0x86A, 0x8FE, 0x996, 0xA30, 0xACA, 0xB61, 0xBF5,
-        0xC83, 0xD09, 0xD86, 0xDF8, 0xE5F, 0xEB9, 0xF05, 0xF43, 0xF72, 0xF91,
-        0xF9F, 0xF9E, 0xF8C, 0xF6A, 0xF38, 0xEF6, 0xEA5, 0xE46, 0xDD8, 0xD5E,
-        0xCD9, 0xC4B, 0xBB7, 0xB1C, 0xA7E, 0x9DD, 0x93B, 0x89A, 0x7F9, 0x75B,
-        0x6C1, 0x62B, 0x59A, 0x50F, 0x48A, 0x40D, 0x397, 0x329, 0x2C4, 0x267,
-        0x212, 0x1C6, 0x185, 0x14E, 0x121, 0xFC, 0xDF, 0xCA, 0xBC, 0xB4,
-        0xB1, 0xB4, 0xBC, 0xC7, 0xD6, 0xE9, 0xFE, 0x116, 0x12F, 0x14B,
-        0x167, 0x184, 0x1A2, 0x1C1, 0x1DF, 0x1FD, 0x21B, 0x238, 0x254, 0x26F,
-        0x289, 0x2A2, 0x2BA, 0x2D0, 0x2E5, 0x2F8, 0x309, 0x31A, 0x328, 0x335,
-        0x341, 0x34C, 0x355, 0x35E, 0x365, 0x36C, 0x372, 0x379, 0x37E, 0x384,
-        0x389, 0x38D, 0x392, 0x396, 0x39A, 0x39D, 0x3A1, 0x3A4, 0x3A8, 0x3AB,
-        0x3AE, 0x3B1, 0x3B3, 0x3B6, 0x3B9, 0x3BC, 0x3BE, 0x3C1, 0x3C4, 0x3C7,
-        0x3C9, 0x3CC, 0x3CF, 0x3D3, 0x3D6, 0x3D9, 0x3DD, 0x3E0, 0x3E4, 0x3E8,
-        0x3EC, 0x3F0, 0x3F4, 0x3F9, 0x3FD, 0x402, 0x407, 0x40D, 0x412, 0x418,
-        0x41D, 0x423, 0x429, 0x430, 0x436, 0x43D, 0x444, 0x44B, 0x452, 0x459,
-        0x461, 0x468, 0x470, 0x478, 0x480, 0x488, 0x490, 0x498, 0x4A1, 0x4AA,
-        0x4B3, 0x4BC, 0x4C5, 0x4CE, 0x4D8, 0x4E2, 0x4EB, 0x4F5, 0x500, 0x50A,
-        0x514, 0x51F, 0x52A, 0x535, 0x540, 0x54B, 0x557, 0x562, 0x56E, 0x57A,
-        0x586, 0x592, 0x59E, 0x5AA, 0x5B7, 0x5C3, 0x5D0, 0x5DC, 0x5E9, 0x5F6,
-        0x603, 0x610, 0x61D, 0x62A, 0x637, 0x645, 0x652, 0x65F, 0x66D, 0x67A,
-        0x687, 0x695, 0x6A2, 0x6AF, 0x6BD, 0x6CA, 0x6D7, 0x6E5, 0x6F2, 0x6FF,
-        0x70C, 0x719, 0x726, 0x732, 0x73F, 0x74B, 0x758, 0x764, 0x770, 0x77C,
-        0x787, 0x793, 0x79E, 0x7AA, 0x7B5, 0x7BF, 0x7CA, 0x7D4, 0x7DE, 0x7E8,
-        0x7F2, 0x7FB, 0x804, 0x80D, 0x815, 0x81D, 0x825, 0x82C, 0x833, 0x83A,
-        0x841, 0x847, 0x84D, 0x852, 0x857, 0x85C, 0x860, 0x864, 0x867, 0x86A,
-        0x86D, 0x870, 0x871, 0x873, 0x874, 0x875, 0x875, 0x875, 0x875, 0x874,
-        0x873, 0x871, 0x86F, 0x86D, 0x86A, 0x867, 0x864, 0x860, 0x85B, 0x857,
-        0x852, 0x84C, 0x847, 0x840, 0x83A, 0x833, 0x82C, 0x825, 0x81D, 0x815,
-        0x80C, 0x803, 0x7FA, 0x7F1, 0x7E7, 0x7DE, 0x7D3, 0x7C9, 0x7BE, 0x7B4,
-        0x7A8, 0x79D, 0x792, 0x786, 0x77A, 0x76E, 0x762, 0x755, 0x748, 0x73C,
-        0x72F, 0x722, 0x715, 0x707, 0x6FA, 0x6EC, 0x6DF, 0x6D1, 0x6C4, 0x6B6,
-        0x6A8, 0x69B, 0x68D, 0x67F, 0x671, 0x664, 0x656, 0x648, 0x63A, 0x62D,
-        0x61F, 0x612, 0x604, 0x5F7, 0x5EA, 0x5DC, 0x5CF, 0x5C2, 0x5B5, 0x5A9,
-        0x59C, 0x58F, 0x583, 0x577, 0x56A, 0x55E, 0x552, 0x547, 0x53B, 0x530,
-        0x524, 0x519, 0x50E, 0x503, 0x4F9, 0x4EE, 0x4E4, 0x4DA, 0x4D0, 0x4C6,
-        0x4BC, 0x4B3, 0x4AA, 0x4A1, 0x498, 0x48F, 0x487, 0x47E, 0x476, 0x46E,
-        0x466, 0x45F, 0x457, 0x450, 0x449, 0x442, 0x43C, 0x435, 0x42F, 0x429,
-        0x423, 0x41D, 0x417, 0x412, 0x40D, 0x408, 0x403, 0x3FE, 0x3F9, 0x3F5,
-        0x3F0, 0x3EC, 0x3E8, 0x3E4, 0x3E0, 0x3DD, 0x3D9, 0x3D6, 0x3D2, 0x3CF,
-        0x3CC, 0x3C9, 0x3C6, 0x3C4, 0x3C1, 0x3BF, 0x3BC, 0x3BA, 0x3B8, 0x3B5,
-        0x3B3, 0x3B1, 0x3B0, 0x3AE, 0x3AC, 0x3AB, 0x3A9, 0x3A8, 0x3A6, 0x3A5,
-        0x3A4, 0x3A2, 0x3A1, 0x3A0, 0x39F, 0x39E, 0x39D, 0x39D, 0x39C, 0x39B,
-        0x39A, 0x39A, 0x399, 0x399, 0x398, 0x398, 0x397, 0x397, 0x397, 0x397,
-        0x396, 0x396, 0x396, 0x396, 0x396, 0x396, 0x396, 0x395, 0x395, 0x396,
-        0x396, 0x396, 0x396, 0x396, 0x396, 0x396, 0x396, 0x396, 0x397, 0x397,
-        0x397, 0x397, 0x397, 0x398, 0x398, 0x398, 0x399, 0x399, 0x399, 0x399,
-        0x39A, 0x39A, 0x39A, 0x39B, 0x39B, 0x39C, 0x39C, 0x39C, 0x39D, 0x39D,
-        0x39D, 0x39E, 0x39E, 0x39F, 0x39F, 0x39F, 0x3A0, 0x3A0, 0x3A1, 0x3A1,
-        0x3A2, 0x3A2, 0x3A3, 0x3A3, 0x3A4, 0x3A4, 0x3A5, 0x3A5, 0x3A5, 0x3A6,
-        0x3A6, 0x3A7, 0x3A7, 0x3A8, 0x3A8, 0x3A9, 0x3A9, 0x3AA, 0x3AA, 0x3AB,
-        0x3AB, 0x3AC, 0x3AC, 0x3AD, 0x3AD, 0x3AE, 0x3AE, 0x3AF, 0x3AF, 0x3B0,
-        0x3B0, 0x3B1, 0x3B1, 0x3B2, 0x3B2, 0x3B3, 0x3B3, 0x3B3, 0x3B4, 0x3B4,
-        0x3B5, 0x3B5, 0x3B6, 0x3B6, 0x3B7, 0x3B7, 0x3B8, 0x3B8, 0x3B9, 0x3B9,
-        0x3BA, 0x3BA, 0x3BB, 0x3BB, 0x3BC, 0x3BC, 0x3BD, 0x3BD, 0x3BE, 0x3BE,
-        0x3BF, 0x3BF, 0x3C0, 0x3C0, 0x3C1, 0x3C2, 0x3C2, 0x3C3, 0x3C3, 0x3C4,
-        0x3C5, 0x3C5, 0x3C6, 0x3C7, 0x3C7, 0x3C8, 0x3C9, 0x3C9, 0x3CA, 0x3CB,
-        0x3CC, 0x3CD, 0x3CD, 0x3CE, 0x3CF, 0x3D0, 0x3D1, 0x3D2, 0x3D3, 0x3D4,
-        0x3D5, 0x3D6, 0x3D7, 0x3D8, 0x3D9, 0x3DB, 0x3DC, 0x3DE, 0x3DF, 0x3E1,
-        0x3E3, 0x3E5, 0x3E7, 0x3E9, 0x3EB, 0x3ED, 0x3F0, 0x3F2, 0x3F5, 0x3F8,
-        0x3FB, 0x3FE, 0x401, 0x405, 0x408, 0x40C, 0x410, 0x414, 0x419, 0x41D,
-        0x422, 0x427, 0x42C, 0x432, 0x437, 0x43D, 0x443, 0x449, 0x450, 0x456,
-        0x45D, 0x465, 0x46C, 0x474, 0x47C, 0x484, 0x48C, 0x495, 0x49E, 0x4A7,
-        0x4B1, 0x4BB, 0x4C5, 0x4D0, 0x4DA, 0x4E6, 0x4F1, 0x4FD, 0x509, 0x515,
-        0x522, 0x52E, 0x53B, 0x548, 0x555, 0x563, 0x570, 0x57E, 0x58B, 0x599,
-        0x5A6, 0x5B4, 0x5C1, 0x5CE, 0x5DC, 0x5E9, 0x5F6, 0x603, 0x610, 0x61D,
-        0x629, 0x635, 0x641, 0x64D, 0x659, 0x664, 0x66F, 0x679, 0x683, 0x68D,
-        0x697, 0x6A0, 0x6A9, 0x6B1, 0x6B9, 0x6C0, 0x6C7, 0x6CE, 0x6D3, 0x6D9,
-        0x6DE, 0x6E2, 0x6E6, 0x6E9, 0x6EC, 0x6EE, 0x6EF, 0x6F0, 0x6F0, 0x6F0,
-        0x6EF, 0x6ED, 0x6EA, 0x6E7, 0x6E3, 0x6DF, 0x6D9, 0x6D3, 0x6CC, 0x6C5,
-        0x6BD, 0x6B5, 0x6AC, 0x6A2, 0x698, 0x68E, 0x683, 0x678, 0x66D, 0x661,
-        0x655, 0x649, 0x63C, 0x62F, 0x622, 0x615, 0x608, 0x5FB, 0x5ED, 0x5E0,
-        0x5D2, 0x5C5, 0x5B7, 0x5A9, 0x59C, 0x58E, 0x581, 0x573, 0x566, 0x559,
-        0x54C, 0x53F, 0x532, 0x525, 0x519, 0x50C, 0x500, 0x4F4, 0x4E9, 0x4DD,
-        0x4D2, 0x4C7, 0x4BC, 0x4B2, 0x4A7, 0x49D, 0x493, 0x48A, 0x481, 0x478,
-        0x46F, 0x467, 0x45E, 0x457, 0x44F, 0x448, 0x441, 0x43A, 0x433, 0x42D,
-        0x427, 0x421, 0x41C, 0x417, 0x412, 0x40E, 0x40B, 0x407, 0x405, 0x402,
-        0x3FF, 0x3FD, 0x3FA, 0x3F7, 0x3F4, 0x3F0, 0x3EC, 0x3E8, 0x3E3, 0x3DE,
-        0x3D8, 0x3D1, 0x3CA, 0x3C2, 0x3B9, 0x3B0, 0x3A6, 0x39B, 0x38F, 0x383,
-        0x376, 0x368, 0x359, 0x34A, 0x33A, 0x329, 0x318, 0x306, 0x2F4, 0x2E1,
-        0x2CE, 0x2BB, 0x2A7, 0x293, 0x280, 0x26C, 0x258, 0x243, 0x22D, 0x217,
-        0x203, 0x1F0, 0x1E1, 0x1D6, 0x1CF, 0x1CE, 0x1D2, 0x1DD, 0x1EF, 0x208,
-        0x229, 0x251, 0x281, 0x2BA, 0x2FB, 0x344, 0x396, 0x3EF, 0x450, 0x4B9,
-        0x528, 0x59F, 0x61C, 0x69F, 0x726, 0x7B3, 0x843, 0x8D5, 0x96A, 0xA00,
-        0xA96, 0xB2B, 0xBBD, 0xC4D, 0xCD7, 0xD5B, 0xDD8, 0xE4C, 0xEB5, 0xF11,
-        0xF5F, 0xF9E, 0xFCE, 0xFEF, 0xFFF, 0xFFF, 0xFEE, 0xFCE, 0xF9D, 0xF5D,
-        0xF0E, 0xEB1, 0xE46, 0xDCF, 0xD4D, 0xCC1, 0xC2C, 0xB91, 0xAF1, 0xA4D,
-        0x9A9, 0x906, 0x865, 0x7C7, 0x72C, 0x695, 0x604, 0x578, 0x4F3, 0x474,
-        0x3FD, 0x38E, 0x327, 0x2C8, 0x272, 0x224, 0x1DF, 0x1A3, 0x16F, 0x144,
-        0x120, 0x105, 0xF0, 0xE3, 0xDC, 0xDB, 0xE1, 0xEB, 0xFA, 0x10E,
-        0x125, 0x13F, 0x15C, 0x17B, 0x19B, 0x1BC, 0x1DE, 0x200, 0x222, 0x243,
-        0x264, 0x284, 0x2A3, 0x2C0, 0x2DC, 0x2F7, 0x30F, 0x326, 0x33B, 0x34F,
-        0x360, 0x370, 0x37F, 0x38C, 0x398, 0x3A3, 0x3AC, 0x3B5, 0x3BD, 0x3C4,
-        0x3CB, 0x3D0, 0x3D6, 0x3DA, 0x3DF, 0x3E2, 0x3E6, 0x3E9, 0x3EC, 0x3EE,
-        0x3F1, 0x3F3, 0x3F6, 0x3F8, 0x3FA, 0x3FD, 0x3FF, 0x401, 0x404, 0x406,
-        0x409, 0x40C, 0x40F, 0x412, 0x415, 0x418, 0x41C, 0x41F, 0x423, 0x427,
-        0x42B, 0x42F, 0x433, 0x437, 0x43B, 0x440, 0x444, 0x449, 0x44D, 0x452,
-        0x457, 0x45C, 0x461, 0x467, 0x46C, 0x472, 0x478, 0x47D, 0x483, 0x48A,
-        0x490, 0x496, 0x49D, 0x4A4, 0x4AB, 0x4B2, 0x4B9, 0x4C1, 0x4C8, 0x4D0,
-        0x4D8, 0x4E0, 0x4E8, 0x4F1, 0x4F9, 0x502, 0x50B, 0x514, 0x51D, 0x526,
-        0x530, 0x539, 0x543, 0x54D, 0x557, 0x562, 0x56C, 0x577, 0x582, 0x58D,
-        0x598, 0x5A4, 0x5AF, 0x5BB, 0x5C7, 0x5D3, 0x5E0, 0x5EC, 0x5F9, 0x606,
-        0x612, 0x61F, 0x62C, 0x639, 0x646, 0x653, 0x661, 0x66E, 0x67B, 0x688,
-        0x696, 0x6A3, 0x6B0, 0x6BD, 0x6CB, 0x6D8, 0x6E5, 0x6F2, 0x6FF, 0x70C,
-        0x718, 0x725, 0x732, 0x73E, 0x74B, 0x757, 0x763, 0x76F, 0x77B, 0x787,
-        0x792, 0x79E, 0x7A9, 0x7B4, 0x7BF, 0x7CA, 0x7D4, 0x7DE, 0x7E8, 0x7F2,
-        0x7FC, 0x805, 0x80E, 0x817, 0x820, 0x828, 0x830, 0x838, 0x83F, 0x847,
-        0x84E, 0x854, 0x85B, 0x861, 0x867, 0x86C, 0x871, 0x876, 0x87B, 0x87F,
-        0x883, 0x886, 0x889, 0x88C, 0x88F, 0x891, 0x893, 0x894, 0x895, 0x896,
-        0x896, 0x896, 0x895, 0x894, 0x893, 0x891, 0x88F, 0x88D, 0x88A, 0x887,
-        0x883, 0x87F, 0x87B, 0x876, 0x870, 0x86B, 0x865, 0x85E, 0x857, 0x850,
-        0x848, 0x840, 0x837, 0x82E, 0x825, 0x81C, 0x812, 0x808, 0x7FD, 0x7F3,
-        0x7E8, 0x7DD, 0x7D1, 0x7C6, 0x7BA, 0x7AE, 0x7A2, 0x795, 0x789, 0x77C,
-        0x76F, 0x762, 0x755, 0x747, 0x73A, 0x72C, 0x71F, 0x711, 0x703, 0x6F5,
-        0x6E7, 0x6D9, 0x6CB, 0x6BD, 0x6AF, 0x6A1, 0x692, 0x684, 0x676, 0x668,
-        0x65A, 0x64C, 0x63D, 0x62F, 0x621, 0x613, 0x605, 0x5F8, 0x5EA, 0x5DC,
-        0x5CE, 0x5C1, 0x5B3, 0x5A6, 0x599, 0x58C, 0x57E, 0x572, 0x565, 0x558,
-        0x54B, 0x53F, 0x533, 0x527, 0x51B, 0x50F, 0x503, 0x4F8, 0x4EC, 0x4E1,
-        0x4D6, 0x4CB, 0x4C0, 0x4B6, 0x4AC, 0x4A1, 0x497, 0x48E, 0x484, 0x47B,
-        0x471, 0x468, 0x460, 0x457, 0x44F, 0x446, 0x43E, 0x437, 0x42F, 0x428,
-        0x420, 0x419, 0x413, 0x40C, 0x406, 0x3FF, 0x3F9, 0x3F3, 0x3EE, 0x3E8,
-        0x3E3, 0x3DE, 0x3D9, 0x3D4, 0x3CF, 0x3CB, 0x3C6, 0x3C2, 0x3BE, 0x3BA,
-        0x3B6, 0x3B2, 0x3AF, 0x3AB, 0x3A8, 0x3A5, 0x3A2, 0x39F, 0x39C, 0x399,
-        0x396, 0x394, 0x392, 0x38F, 0x38D, 0x38B, 0x389, 0x387, 0x385, 0x383,
-        0x382, 0x380, 0x37E, 0x37D, 0x37C, 0x37A, 0x379, 0x378, 0x377, 0x376,
-        0x375, 0x374, 0x373, 0x372, 0x371, 0x371, 0x370, 0x36F, 0x36F, 0x36E,
-        0x36E, 0x36D, 0x36D, 0x36C, 0x36C, 0x36C, 0x36B, 0x36B, 0x36B, 0x36B,
-        0x36B, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A,
-        0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A,
-        0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A,
-        0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A,
-        0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A,
-        0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A, 0x36A,
-        0x36A, 0x36A, 0x36B, 0x36B, 0x36B, 0x36B, 0x36B, 0x36B, 0x36B, 0x36B,
-        0x36B, 0x36B, 0x36B, 0x36B, 0x36B, 0x36B, 0x36B, 0x36B, 0x36B, 0x36B,
-        0x36B, 0x36B, 0x36B, 0x36B, 0x36B, 0x36B, 0x36B, 0x36B, 0x36B, 0x36B,
-        0x36B, 0x36B, 0x36B, 0x36B, 0x36B, 0x36B, 0x36B, 0x36B, 0x36B, 0x36B,
-        0x36B, 0x36B, 0x36B, 0x36B, 0x36B, 0x36B, 0x36B, 0x36B, 0x36B, 0x36B,
-        0x36B, 0x36B, 0x36B, 0x36B, 0x36B, 0x36B, 0x36C, 0x36C, 0x36C, 0x36C,
-        0x36C, 0x36D, 0x36D, 0x36D, 0x36E, 0x36E, 0x36E, 0x36F, 0x36F, 0x370,
-        0x370, 0x371, 0x372, 0x372, 0x373, 0x374, 0x375, 0x376, 0x377, 0x377,
-        0x379, 0x37A, 0x37B, 0x37C, 0x37D, 0x37E, 0x380, 0x381, 0x383, 0x384,
-        0x386, 0x388, 0x38A, 0x38C, 0x38E, 0x391, 0x393, 0x396, 0x399, 0x39C,
-        0x39F, 0x3A3, 0x3A6, 0x3AA, 0x3AE, 0x3B3, 0x3B7, 0x3BC, 0x3C1, 0x3C6,
-        0x3CB, 0x3D1, 0x3D7, 0x3DD, 0x3E4, 0x3EA, 0x3F1, 0x3F8, 0x400, 0x407,
-        0x40F, 0x417, 0x420, 0x428, 0x431, 0x43B, 0x444, 0x44E, 0x458, 0x462,
-        0x46C, 0x477, 0x482, 0x48D, 0x498, 0x4A4, 0x4AF, 0x4BB, 0x4C8, 0x4D4,
-        0x4E1, 0x4ED, 0x4FB, 0x508, 0x515, 0x523, 0x530, 0x53E, 0x54C, 0x559,
-        0x567, 0x574, 0x582, 0x58F, 0x59C, 0x5A9, 0x5B6, 0x5C3, 0x5CF, 0x5DB,
-        0x5E6, 0x5F2, 0x5FD, 0x607, 0x612, 0x61C, 0x625, 0x62E, 0x637, 0x63F,
-        0x646, 0x64D, 0x654, 0x65A, 0x660, 0x665, 0x669, 0x66D, 0x670, 0x673,
-        0x675, 0x677, 0x678, 0x678, 0x678, 0x677, 0x676, 0x674, 0x671, 0x66E,
-        0x66A, 0x666, 0x661, 0x65B, 0x655, 0x64F, 0x647, 0x63F, 0x637, 0x62E,
-        0x624, 0x61A, 0x610, 0x605, 0x5FA, 0x5EE, 0x5E2, 0x5D6, 0x5C9, 0x5BC,
-        0x5AF, 0x5A2, 0x594, 0x587, 0x579, 0x56B, 0x55D, 0x54F, 0x541, 0x533,
-        0x525, 0x518, 0x50A, 0x4FC, 0x4EE, 0x4E0, 0x4D3, 0x4C5, 0x4B8, 0x4AB,
-        0x49E, 0x491, 0x485, 0x478, 0x46C, 0x460, 0x455, 0x449, 0x43E, 0x433,
-        0x428, 0x41E, 0x414, 0x40A, 0x400, 0x3F7, 0x3EE, 0x3E5, 0x3DD, 0x3D5,
-        0x3CD, 0x3C5, 0x3BE, 0x3B7, 0x3B1, 0x3AB, 0x3A5, 0x3A0, 0x39B, 0x396,
-        0x392, 0x38E, 0x38A, 0x386, 0x382, 0x37E, 0x37A, 0x376, 0x372, 0x36E,
-        0x369, 0x365, 0x360, 0x35A, 0x354, 0x34E, 0x348, 0x341, 0x339, 0x331,
-        0x329, 0x320, 0x316, 0x30C, 0x301, 0x2F6, 0x2EA, 0x2DE, 0x2D1, 0x2C3,
-        0x2B4, 0x2A5, 0x295, 0x285, 0x274, 0x262, 0x250, 0x23D, 0x229, 0x215,
-        0x200, 0x1EA, 0x1D3, 0x1BC, 0x1A5, 0x18F, 0x17B, 0x16A, 0x15C, 0x152,
-        0x14D, 0x14C, 0x151, 0x15C, 0x16D, 0x184, 0x1A2, 0x1C7, 0x1F4, 0x227,
-        0x262, 0x2A4, 0x2EE, 0x33F, 0x396, 0x3F5, 0x45B, 0x4C7, 0x53A, 0x5B2,
-        0x62F, 0x6B2, 0x739, 0x7C4, 0x852, 0x8E3, 0x976, 0xA0A, 0xA9F, 0xB33,
-        0xBC4, 0xC51, 0xCD6, 0xD53, 0xDC6, 0xE2D, 0xE87, 0xED3, 0xF10, 0xF3E,
-        0xF5B, 0xF67, 0xF63, 0xF4E, 0xF28, 0xEF2, 0xEAC, 0xE58, 0xDF5, 0xD85,
-        0xD0A, 0xC85, 0xBF7, 0xB62, 0xAC8, 0xA2A, 0x989, 0x8E6, 0x843, 0x7A2,
-        0x702, 0x666, 0x5CE, 0x53B, 0x4AE, 0x427, 0x3A7, 0x32F, 0x2BF, 0x256,
-        0x1F7, 0x1A0, 0x152, 0x10C, 0xCF, 0x9A, 0x6E, 0x49, 0x2B, 0x16,
-        0x8, 0x1, 0x0, 0x5, 0xF, 0x1D, 0x2F, 0x45, 0x5D, 0x78,
-        0x94, 0xB2, 0xD2, 0xF2, 0x112, 0x132, 0x153, 0x172, 0x191, 0x1B0,
-        0x1CD, 0x1E8, 0x203, 0x21C, 0x233, 0x249, 0x25D, 0x26F, 0x280, 0x28F,
-        0x29C, 0x2A9, 0x2B4, 0x2BE, 0x2C7, 0x2CF, 0x2D7, 0x2DE, 0x2E4, 0x2E9,
-        0x2EE, 0x2F3, 0x2F7, 0x2FA, 0x2FD, 0x300, 0x303, 0x305, 0x307, 0x309,
-        0x30B, 0x30C, 0x30E, 0x310, 0x311, 0x313, 0x314, 0x316, 0x318, 0x31A,
-        0x31C, 0x31E, 0x321, 0x323, 0x326, 0x329, 0x32C, 0x32F, 0x332, 0x336,
-        0x33A, 0x33E, 0x342, 0x346, 0x34B, 0x34F, 0x354, 0x359, 0x35E, 0x363,
-        0x368, 0x36D, 0x373, 0x378, 0x37D, 0x383, 0x389, 0x38F, 0x395, 0x39B,
-        0x3A2, 0x3A8, 0x3AF, 0x3B6, 0x3BD, 0x3C4, 0x3CC, 0x3D3, 0x3DB, 0x3E3,
-        0x3EB, 0x3F3, 0x3FC, 0x404, 0x40D, 0x416, 0x41F, 0x428, 0x431, 0x43B,
-        0x445, 0x44F, 0x459, 0x463, 0x46D, 0x478, 0x482, 0x48D, 0x498, 0x4A3,
-        0x4AE, 0x4BA, 0x4C5, 0x4D1, 0x4DD, 0x4E8, 0x4F4, 0x501, 0x50D, 0x519,
-        0x525, 0x532, 0x53E, 0x54B, 0x558, 0x565, 0x571, 0x57E, 0x58B, 0x598,
-        0x5A6, 0x5B3, 0x5C0, 0x5CD, 0x5DA, 0x5E7, 0x5F5, 0x602, 0x60F, 0x61C,
-        0x629, 0x636, 0x642, 0x64F, 0x65C, 0x668, 0x675, 0x681, 0x68D, 0x699,
-        0x6A5, 0x6B1, 0x6BC, 0x6C8, 0x6D3, 0x6DE, 0x6E8, 0x6F3, 0x6FD, 0x707,
-        0x711, 0x71B, 0x724, 0x72D, 0x736, 0x73E, 0x747, 0x74F, 0x756, 0x75E,
-        0x765, 0x76C, 0x772, 0x778, 0x77E, 0x784, 0x789, 0x78E, 0x792, 0x797,
-        0x79A, 0x79E, 0x7A1, 0x7A3, 0x7A6, 0x7A8, 0x7A9, 0x7AA, 0x7AB, 0x7AC,
-        0x7AC, 0x7AB, 0x7AA, 0x7A9, 0x7A7, 0x7A5, 0x7A2, 0x79F, 0x79C, 0x798,
-        0x793, 0x78E, 0x789, 0x783, 0x77D, 0x777, 0x770, 0x769, 0x761, 0x759,
-        0x751, 0x749, 0x740, 0x737, 0x72D, 0x724, 0x71A, 0x70F, 0x705, 0x6FA,
-        0x6EF, 0x6E4, 0x6D9, 0x6CD, 0x6C2, 0x6B6, 0x6AA, 0x69D, 0x691, 0x684,
-        0x678, 0x66B, 0x65E, 0x651, 0x644, 0x636, 0x629, 0x61B, 0x60E, 0x600,
-        0x5F3, 0x5E5, 0x5D7, 0x5C9, 0x5BB, 0x5AD, 0x5A0, 0x592, 0x584, 0x576,
-        0x568, 0x55A, 0x54C, 0x53E, 0x530, 0x522, 0x515, 0x507, 0x4F9, 0x4EC,
-        0x4DE, 0x4D1, 0x4C3, 0x4B6, 0x4A9, 0x49C, 0x48E, 0x482, 0x475, 0x468,
-        0x45B, 0x44F, 0x442, 0x436, 0x42A, 0x41E, 0x412, 0x407, 0x3FB, 0x3F0,
-        0x3E4, 0x3D9, 0x3CE, 0x3C4, 0x3B9, 0x3AF, 0x3A4, 0x39A, 0x390, 0x387,
-        0x37D, 0x374, 0x36B, 0x362, 0x359, 0x350, 0x348, 0x340, 0x338, 0x330,
-        0x328, 0x321, 0x31A, 0x313, 0x30C, 0x306, 0x2FF, 0x2F9, 0x2F3, 0x2ED,
-        0x2E7, 0x2E2, 0x2DC, 0x2D7, 0x2D2, 0x2CD, 0x2C8, 0x2C3, 0x2BF, 0x2BA,
-        0x2B6, 0x2B2, 0x2AE, 0x2AA, 0x2A6, 0x2A3, 0x29F, 0x29C, 0x299, 0x296,
-        0x293, 0x290, 0x28D, 0x28A, 0x288, 0x285, 0x283, 0x280, 0x27E, 0x27C,
-        0x27A, 0x278, 0x276, 0x274, 0x273, 0x271, 0x26F, 0x26E, 0x26D, 0x26B
-    },
-
-    // ECG con ruido de 60Hz añadido, fs = 960Hz, duracion = 2.896s, numSamples = 2780
-    {
-        0x33A, 0x3A3, 0x3FD, 0x43A, 0x452, 0x441, 0x40A, 0x3B7, 0x354, 0x2F1,
-        0x29E, 0x268, 0x257, 0x270, 0x2AE, 0x309, 0x374, 0x3DF, 0x43A, 0x479,
-        0x493, 0x483, 0x44E, 0x3FD, 0x39C, 0x33B, 0x2E9, 0x2B5, 0x2A7, 0x2C1,
-        0x301, 0x35F, 0x3CC, 0x439, 0x497, 0x4D8, 0x4F3, 0x4E6, 0x4B3, 0x464,
-        0x405, 0x3A7, 0x358, 0x326, 0x31A, 0x336, 0x379, 0x3D9, 0x448, 0x4B8,
-        0x518, 0x55B, 0x579, 0x56E, 0x53E, 0x4F0, 0x494, 0x438, 0x3EB, 0x3BB,
-        0x3B1, 0x3D0, 0x415, 0x477, 0x4E9, 0x55A, 0x5BC, 0x602, 0x622, 0x619,
-        0x5EB, 0x5A0, 0x545, 0x4EA, 0x49F, 0x471, 0x469, 0x489, 0x4D0, 0x532,
-        0x5A5, 0x618, 0x67A, 0x6C0, 0x6E1, 0x6D8, 0x6AA, 0x65F, 0x604, 0x5A9,
-        0x55E, 0x52F, 0x526, 0x546, 0x58B, 0x5ED, 0x65F, 0x6D0, 0x731, 0x776,
-        0x795, 0x78B, 0x75A, 0x70D, 0x6B1, 0x654, 0x606, 0x5D5, 0x5CA, 0x5E7,
-        0x629, 0x688, 0x6F7, 0x765, 0x7C3, 0x805, 0x820, 0x813, 0x7DF, 0x78E,
-        0x72E, 0x6CD, 0x67C, 0x647, 0x637, 0x650, 0x68F, 0x6E9, 0x754, 0x7BD,
-        0x817, 0x854, 0x86B, 0x859, 0x820, 0x7CB, 0x765, 0x700, 0x6A9, 0x66F,
-        0x65A, 0x66E, 0x6A7, 0x6FC, 0x761, 0x7C5, 0x819, 0x850, 0x861, 0x849,
-        0x80B, 0x7AF, 0x744, 0x6D8, 0x67B, 0x63B, 0x620, 0x62E, 0x661, 0x6B1,
-        0x710, 0x76E, 0x7BD, 0x7EF, 0x7FB, 0x7DD, 0x79A, 0x73A, 0x6CA, 0x65A,
-        0x5FA, 0x5B6, 0x597, 0x5A1, 0x5D1, 0x61D, 0x679, 0x6D4, 0x720, 0x74F,
-        0x759, 0x739, 0x6F4, 0x691, 0x61F, 0x5AD, 0x54B, 0x505, 0x4E5, 0x4EE,
-        0x51C, 0x567, 0x5C2, 0x61D, 0x668, 0x696, 0x69F, 0x67E, 0x639, 0x5D6,
-        0x564, 0x4F2, 0x48F, 0x44A, 0x42A, 0x433, 0x462, 0x4AD, 0x509, 0x564,
-        0x5B0, 0x5DF, 0x5E9, 0x5C9, 0x585, 0x523, 0x4B2, 0x442, 0x3E1, 0x39C,
-        0x37E, 0x389, 0x3B9, 0x406, 0x463, 0x4C0, 0x50E, 0x53F, 0x54A, 0x52D,
-        0x4EB, 0x48B, 0x41C, 0x3AE, 0x34F, 0x30D, 0x2F1, 0x2FD, 0x330, 0x380,
-        0x3DF, 0x43F, 0x48F, 0x4C2, 0x4D0, 0x4B5, 0x475, 0x418, 0x3AC, 0x340,
-        0x2E3, 0x2A4, 0x28A, 0x299, 0x2CF, 0x321, 0x383, 0x3E5, 0x437, 0x46D,
-        0x47D, 0x465, 0x427, 0x3CD, 0x363, 0x2F9, 0x29F, 0x262, 0x24A, 0x25C,
-        0x293, 0x2E7, 0x34B, 0x3AF, 0x403, 0x43B, 0x44D, 0x437, 0x3FB, 0x3A2,
-        0x33A, 0x2D2, 0x279, 0x23D, 0x228, 0x23A, 0x273, 0x2C9, 0x32E, 0x393,
-        0x3E9, 0x422, 0x436, 0x420, 0x3E6, 0x38E, 0x327, 0x2C0, 0x268, 0x22D,
-        0x219, 0x22C, 0x266, 0x2BD, 0x323, 0x389, 0x3DF, 0x419, 0x42D, 0x419,
-        0x3DF, 0x388, 0x321, 0x2BB, 0x264, 0x22A, 0x215, 0x22A, 0x264, 0x2BB,
-        0x322, 0x388, 0x3DF, 0x419, 0x42E, 0x41A, 0x3E0, 0x389, 0x323, 0x2BD,
-        0x266, 0x22D, 0x219, 0x22D, 0x268, 0x2BF, 0x326, 0x38D, 0x3E4, 0x41E,
-        0x433, 0x41F, 0x3E5, 0x38F, 0x329, 0x2C3, 0x26C, 0x233, 0x21F, 0x234,
-        0x26E, 0x2C6, 0x32D, 0x394, 0x3EB, 0x426, 0x43A, 0x427, 0x3ED, 0x397,
-        0x331, 0x2CB, 0x275, 0x23B, 0x227, 0x23C, 0x277, 0x2CF, 0x336, 0x39D,
-        0x3F4, 0x42F, 0x444, 0x430, 0x3F7, 0x3A1, 0x33B, 0x2D5, 0x27F, 0x245,
-        0x231, 0x246, 0x281, 0x2D9, 0x340, 0x3A7, 0x3FE, 0x439, 0x44E, 0x43A,
-        0x401, 0x3AB, 0x345, 0x2DF, 0x289, 0x24F, 0x23B, 0x250, 0x28B, 0x2E2,
-        0x349, 0x3B1, 0x408, 0x443, 0x458, 0x444, 0x40A, 0x3B4, 0x34E, 0x2E8,
-        0x292, 0x259, 0x245, 0x25A, 0x294, 0x2EC, 0x353, 0x3BA, 0x412, 0x44C,
-        0x461, 0x44D, 0x414, 0x3BE, 0x358, 0x2F2, 0x29C, 0x263, 0x24F, 0x264,
-        0x29F, 0x2F6, 0x35D, 0x3C5, 0x41C, 0x457, 0x46C, 0x459, 0x420, 0x3CA,
-        0x364, 0x2FE, 0x2A8, 0x26F, 0x25C, 0x271, 0x2AC, 0x304, 0x36C, 0x3D3,
-        0x42B, 0x467, 0x47C, 0x469, 0x430, 0x3DB, 0x376, 0x311, 0x2BB, 0x283,
-        0x270, 0x286, 0x2C1, 0x31A, 0x382, 0x3EA, 0x443, 0x47F, 0x495, 0x483,
-        0x44B, 0x3F6, 0x392, 0x32E, 0x2D9, 0x2A2, 0x290, 0x2A8, 0x2E5, 0x33F,
-        0x3A9, 0x413, 0x46E, 0x4AC, 0x4C4, 0x4B4, 0x47F, 0x42D, 0x3CC, 0x36A,
-        0x319, 0x2E5, 0x2D6, 0x2F1, 0x331, 0x38F, 0x3FC, 0x46A, 0x4C8, 0x50A,
-        0x526, 0x51A, 0x4E8, 0x49A, 0x43C, 0x3DF, 0x391, 0x360, 0x355, 0x374,
-        0x3B8, 0x419, 0x48A, 0x4FB, 0x55C, 0x5A1, 0x5C0, 0x5B7, 0x588, 0x53D,
-        0x4E2, 0x487, 0x43B, 0x40D, 0x405, 0x425, 0x46B, 0x4CD, 0x540, 0x5B2,
-        0x615, 0x65B, 0x67B, 0x672, 0x644, 0x5F9, 0x59D, 0x542, 0x4F6, 0x4C6,
-        0x4BC, 0x4DB, 0x51E, 0x57F, 0x5EE, 0x65D, 0x6BC, 0x6FE, 0x71A, 0x70C,
-        0x6D9, 0x688, 0x627, 0x5C5, 0x573, 0x53D, 0x52C, 0x543, 0x580, 0x5D8,
-        0x640, 0x6A7, 0x6FE, 0x738, 0x74C, 0x736, 0x6FA, 0x6A0, 0x637, 0x5CD,
-        0x572, 0x533, 0x51A, 0x529, 0x55D, 0x5AD, 0x60D, 0x66C, 0x6BB, 0x6ED,
-        0x6F8, 0x6DB, 0x697, 0x637, 0x5C6, 0x555, 0x4F4, 0x4AF, 0x490, 0x499,
-        0x4C7, 0x513, 0x56D, 0x5C8, 0x613, 0x641, 0x64A, 0x629, 0x5E3, 0x581,
-        0x50E, 0x49C, 0x439, 0x3F3, 0x3D4, 0x3DD, 0x40B, 0x457, 0x4B3, 0x50E,
-        0x55A, 0x58A, 0x594, 0x576, 0x532, 0x4D1, 0x461, 0x3F2, 0x392, 0x34F,
-        0x333, 0x33F, 0x371, 0x3C0, 0x41F, 0x47F, 0x4CF, 0x502, 0x510, 0x4F6,
-        0x4B6, 0x45A, 0x3EE, 0x382, 0x327, 0x2E8, 0x2D0, 0x2E0, 0x316, 0x36A,
-        0x3CD, 0x430, 0x484, 0x4BB, 0x4CC, 0x4B5, 0x478, 0x41E, 0x3B5, 0x34B,
-        0x2F1, 0x2B4, 0x29D, 0x2AE, 0x2E4, 0x337, 0x399, 0x3FB, 0x44D, 0x482,
-        0x491, 0x476, 0x436, 0x3D7, 0x369, 0x2FA, 0x29A, 0x256, 0x237, 0x240,
-        0x26E, 0x2B7, 0x30F, 0x366, 0x3AD, 0x3D5, 0x3D5, 0x3AB, 0x35B, 0x2ED,
-        0x271, 0x1F4, 0x189, 0x13D, 0x118, 0x11E, 0x14D, 0x19D, 0x1FF, 0x266,
-        0x2C1, 0x304, 0x326, 0x324, 0x302, 0x2C8, 0x285, 0x247, 0x21E, 0x218,
-        0x23E, 0x292, 0x312, 0x3B4, 0x46C, 0x52A, 0x5DE, 0x67A, 0x6F7, 0x74F,
-        0x788, 0x7A8, 0x7BD, 0x7D7, 0x804, 0x851, 0x8C6, 0x964, 0xA26, 0xB00,
-        0xBE5, 0xCC3, 0xD8A, 0xE2A, 0xE9A, 0xED6, 0xEE0, 0xEC1, 0xE84, 0xE39,
-        0xDEF, 0xDB4, 0xD90, 0xD86, 0xD93, 0xDAF, 0xDCD, 0xDDE, 0xDD3, 0xDA0,
-        0xD3E, 0xCAB, 0xBED, 0xB0C, 0xA18, 0x922, 0x83B, 0x770, 0x6CD, 0x654,
-        0x604, 0x5D5, 0x5BA, 0x5A5, 0x585, 0x54F, 0x4FB, 0x484, 0x3EF, 0x345,
-        0x293, 0x1E9, 0x158, 0xED, 0xB0, 0xA4, 0xC4, 0x108, 0x162, 0x1C1,
-        0x216, 0x252, 0x26E, 0x264, 0x237, 0x1F1, 0x19D, 0x14C, 0x10C, 0xEA,
-        0xEF, 0x11E, 0x172, 0x1E4, 0x266, 0x2E7, 0x359, 0x3AD, 0x3DA, 0x3DE,
-        0x3BB, 0x37B, 0x329, 0x2D7, 0x292, 0x269, 0x264, 0x287, 0x2CE, 0x331,
-        0x3A2, 0x412, 0x471, 0x4B3, 0x4CE, 0x4C0, 0x48B, 0x43A, 0x3D9, 0x377,
-        0x324, 0x2EF, 0x2DE, 0x2F6, 0x334, 0x38E, 0x3F8, 0x461, 0x4BB, 0x4F8,
-        0x50F, 0x4FD, 0x4C5, 0x471, 0x40D, 0x3A9, 0x354, 0x31D, 0x30B, 0x322,
-        0x35E, 0x3B8, 0x421, 0x48A, 0x4E4, 0x521, 0x539, 0x527, 0x4F1, 0x49D,
-        0x43A, 0x3D8, 0x385, 0x34E, 0x33E, 0x357, 0x396, 0x3F1, 0x45C, 0x4C8,
-        0x524, 0x563, 0x57D, 0x56E, 0x53A, 0x4E9, 0x489, 0x429, 0x3D8, 0x3A5,
-        0x397, 0x3B2, 0x3F3, 0x451, 0x4BE, 0x52C, 0x58A, 0x5CC, 0x5E8, 0x5DB,
-        0x5A9, 0x55A, 0x4FC, 0x49E, 0x450, 0x41E, 0x413, 0x430, 0x473, 0x4D3,
-        0x543, 0x5B3, 0x614, 0x658, 0x676, 0x66C, 0x63C, 0x5EF, 0x593, 0x537,
-        0x4EB, 0x4BC, 0x4B2, 0x4D1, 0x517, 0x579, 0x5EA, 0x65C, 0x6BE, 0x704,
-        0x724, 0x71B, 0x6ED, 0x6A2, 0x647, 0x5EC, 0x5A1, 0x573, 0x56B, 0x58B,
-        0x5D1, 0x634, 0x6A6, 0x719, 0x77B, 0x7C1, 0x7E2, 0x7D9, 0x7AB, 0x75F,
-        0x705, 0x6AA, 0x65E, 0x62F, 0x626, 0x646, 0x68B, 0x6ED, 0x75E, 0x7CF,
-        0x830, 0x875, 0x893, 0x889, 0x859, 0x80B, 0x7AE, 0x751, 0x703, 0x6D2,
-        0x6C6, 0x6E3, 0x725, 0x783, 0x7F1, 0x85F, 0x8BD, 0x8FE, 0x918, 0x90A,
-        0x8D6, 0x884, 0x823, 0x7C1, 0x76F, 0x739, 0x728, 0x740, 0x77D, 0x7D7,
-        0x840, 0x8A9, 0x901, 0x93D, 0x952, 0x93E, 0x905, 0x8AE, 0x847, 0x7E0,
-        0x788, 0x74C, 0x736, 0x749, 0x780, 0x7D4, 0x838, 0x89B, 0x8EE, 0x923,
-        0x933, 0x91A, 0x8DB, 0x87F, 0x812, 0x7A6, 0x748, 0x708, 0x6EC, 0x6FA,
-        0x72C, 0x77B, 0x7DA, 0x838, 0x886, 0x8B7, 0x8C3, 0x8A5, 0x861, 0x801,
-        0x790, 0x720, 0x6BF, 0x67A, 0x65B, 0x665, 0x694, 0x6E0, 0x73B, 0x796,
-        0x7E1, 0x810, 0x818, 0x7F8, 0x7B2, 0x74F, 0x6DC, 0x66A, 0x607, 0x5C1,
-        0x5A0, 0x5A8, 0x5D6, 0x620, 0x67B, 0x6D5, 0x71F, 0x74D, 0x755, 0x735,
-        0x6EF, 0x68C, 0x619, 0x5A7, 0x544, 0x4FE, 0x4DE, 0x4E7, 0x515, 0x561,
-        0x5BC, 0x617, 0x663, 0x692, 0x69C, 0x67D, 0x638, 0x5D6, 0x566, 0x4F5,
-        0x494, 0x450, 0x432, 0x43C, 0x46D, 0x4BB, 0x518, 0x575, 0x5C3, 0x5F5,
-        0x600, 0x5E4, 0x5A1, 0x542, 0x4D4, 0x466, 0x407, 0x3C6, 0x3AA, 0x3B7,
-        0x3EA, 0x43B, 0x49A, 0x4FA, 0x54B, 0x57F, 0x58D, 0x573, 0x534, 0x4D7,
-        0x46B, 0x400, 0x3A4, 0x365, 0x34C, 0x35C, 0x391, 0x3E4, 0x446, 0x4A9,
-        0x4FC, 0x532, 0x543, 0x52B, 0x4ED, 0x493, 0x42A, 0x3C0, 0x366, 0x329,
-        0x312, 0x324, 0x35C, 0x3B0, 0x414, 0x478, 0x4CD, 0x505, 0x518, 0x501,
-        0x4C5, 0x46D, 0x405, 0x39D, 0x344, 0x309, 0x2F3, 0x306, 0x33F, 0x395,
-        0x3FA, 0x45F, 0x4B5, 0x4EE, 0x502, 0x4ED, 0x4B2, 0x45A, 0x3F3, 0x38C,
-        0x334, 0x2FA, 0x2E5, 0x2F9, 0x332, 0x389, 0x3EF, 0x455, 0x4AC, 0x4E6,
-        0x4FA, 0x4E5, 0x4AB, 0x454, 0x3ED, 0x387, 0x330, 0x2F6, 0x2E2, 0x2F6,
-        0x330, 0x387, 0x3EE, 0x454, 0x4AB, 0x4E5, 0x4FA, 0x4E6, 0x4AC, 0x455,
-        0x3EF, 0x388, 0x332, 0x2F8, 0x2E4, 0x2F8, 0x333, 0x38A, 0x3F1, 0x457,
-        0x4AF, 0x4E9, 0x4FE, 0x4EA, 0x4B0, 0x459, 0x3F3, 0x38D, 0x336, 0x2FD,
-        0x2E9, 0x2FD, 0x338, 0x38F, 0x3F6, 0x45D, 0x4B4, 0x4EE, 0x503, 0x4EF,
-        0x4B6, 0x45F, 0x3F9, 0x393, 0x33D, 0x303, 0x2EF, 0x304, 0x33E, 0x396,
-        0x3FC, 0x463, 0x4BB, 0x4F5, 0x50A, 0x4F6, 0x4BC, 0x466, 0x400, 0x39A,
-        0x343, 0x30A, 0x2F6, 0x30B, 0x345, 0x39C, 0x403, 0x46A, 0x4C2, 0x4FC,
-        0x511, 0x4FD, 0x4C3, 0x46D, 0x407, 0x3A1, 0x34A, 0x311, 0x2FD, 0x312,
-        0x34C, 0x3A3, 0x40A, 0x471, 0x4C8, 0x503, 0x518, 0x504, 0x4CA, 0x474,
-        0x40E, 0x3A8, 0x351, 0x318, 0x304, 0x318, 0x353, 0x3AA, 0x411, 0x478,
-        0x4D0, 0x50A, 0x51F, 0x50B, 0x4D2, 0x47B, 0x415, 0x3AF, 0x359, 0x31F,
-        0x30C, 0x321, 0x35B, 0x3B3, 0x41A, 0x481, 0x4D8, 0x513, 0x528, 0x515,
-        0x4DB, 0x485, 0x41F, 0x3BA, 0x363, 0x32A, 0x317, 0x32C, 0x367, 0x3BE,
-        0x426, 0x48D, 0x4E5, 0x520, 0x536, 0x523, 0x4EA, 0x494, 0x42F, 0x3CA,
-        0x375, 0x33C, 0x32A, 0x340, 0x37C, 0x3D5, 0x43E, 0x4A7, 0x500, 0x53C,
-        0x554, 0x542, 0x50B, 0x4B7, 0x454, 0x3F1, 0x39E, 0x367, 0x357, 0x36F,
-        0x3AD, 0x409, 0x474, 0x4DF, 0x53B, 0x57A, 0x594, 0x585, 0x551, 0x500,
-        0x4A0, 0x440, 0x3F0, 0x3BC, 0x3AF, 0x3CB, 0x40C, 0x46B, 0x4DA, 0x548,
-        0x5A8, 0x5EB, 0x608, 0x5FD, 0x5CD, 0x580, 0x524, 0x4C8, 0x47B, 0x44C,
-        0x443, 0x463, 0x4A8, 0x50B, 0x57D, 0x5F0, 0x652, 0x698, 0x6B9, 0x6B1,
-        0x683, 0x638, 0x5DD, 0x583, 0x538, 0x50A, 0x501, 0x521, 0x566, 0x5C9,
-        0x63A, 0x6AC, 0x70D, 0x752, 0x770, 0x766, 0x736, 0x6E8, 0x68B, 0x62D,
-        0x5DF, 0x5AD, 0x5A0, 0x5BC, 0x5FD, 0x65B, 0x6C7, 0x733, 0x790, 0x7CF,
-        0x7E7, 0x7D7, 0x7A0, 0x74C, 0x6E8, 0x683, 0x62E, 0x5F4, 0x5E0, 0x5F4,
-        0x62D, 0x682, 0x6E7, 0x74A, 0x79E, 0x7D4, 0x7E3, 0x7C9, 0x789, 0x72C,
-        0x6BE, 0x650, 0x5F1, 0x5AF, 0x592, 0x59D, 0x5CD, 0x61A, 0x677, 0x6D3,
-        0x71F, 0x74E, 0x757, 0x737, 0x6F2, 0x68F, 0x61D, 0x5AA, 0x547, 0x501,
-        0x4E1, 0x4E9, 0x517, 0x562, 0x5BC, 0x617, 0x661, 0x68F, 0x698, 0x678,
-        0x632, 0x5D0, 0x55E, 0x4EC, 0x48A, 0x445, 0x425, 0x42F, 0x45F, 0x4AB,
-        0x508, 0x564, 0x5B2, 0x5E2, 0x5EE, 0x5D0, 0x58D, 0x52E, 0x4BF, 0x451,
-        0x3F2, 0x3B1, 0x395, 0x3A2, 0x3D6, 0x426, 0x486, 0x4E7, 0x538, 0x56C,
-        0x57B, 0x562, 0x523, 0x4C7, 0x45D, 0x3F3, 0x398, 0x35C, 0x345, 0x357,
-        0x38E, 0x3E3, 0x447, 0x4AB, 0x4FF, 0x536, 0x547, 0x52E, 0x4F0, 0x494,
-        0x429, 0x3BC, 0x35F, 0x31E, 0x302, 0x30E, 0x33F, 0x38C, 0x3E8, 0x443,
-        0x48E, 0x4BC, 0x4C3, 0x4A1, 0x459, 0x3F3, 0x37D, 0x307, 0x2A0, 0x255,
-        0x230, 0x233, 0x25B, 0x2A0, 0x2F5, 0x34A, 0x38F, 0x3B6, 0x3B7, 0x38F,
-        0x343, 0x2DC, 0x268, 0x1F7, 0x19B, 0x15F, 0x14F, 0x16D, 0x1B7, 0x224,
-        0x2A8, 0x332, 0x3B4, 0x421, 0x46F, 0x49C, 0x4AB, 0x4A4, 0x494, 0x48B,
-        0x498, 0x4C8, 0x523, 0x5AC, 0x65F, 0x733, 0x81A, 0x904, 0x9DF, 0xA9F,
-        0xB39, 0xBAA, 0xBF3, 0xC1B, 0xC31, 0xC40, 0xC59, 0xC86, 0xCCF, 0xD36,
-        0xDB6, 0xE45, 0xED7, 0xF5A, 0xFBF, 0xFF9, 0xFFF, 0xFCD, 0xF68, 0xED8,
-        0xE2B, 0xD71, 0xCBB, 0xC17, 0xB8E, 0xB25, 0xADB, 0xAA7, 0xA7F, 0xA53,
-        0xA17, 0x9C0, 0x944, 0x8A3, 0x7DE, 0x701, 0x619, 0x536, 0x468, 0x3BD,
-        0x33E, 0x2EF, 0x2CD, 0x2D0, 0x2E9, 0x30A, 0x324, 0x328, 0x30E, 0x2D3,
-        0x279, 0x209, 0x191, 0x11F, 0xC2, 0x87, 0x77, 0x95, 0xDD, 0x145,
-        0x1C0, 0x23E, 0x2AE, 0x304, 0x335, 0x33E, 0x322, 0x2EA, 0x2A1, 0x259,
-        0x21F, 0x202, 0x209, 0x238, 0x28B, 0x2F9, 0x375, 0x3F0, 0x45A, 0x4A5,
-        0x4CA, 0x4C4, 0x496, 0x44B, 0x3EF, 0x393, 0x344, 0x312, 0x305, 0x320,
-        0x35F, 0x3BB, 0x427, 0x491, 0x4EC, 0x529, 0x541, 0x52F, 0x4F8, 0x4A3,
-        0x43F, 0x3DB, 0x386, 0x34E, 0x33B, 0x352, 0x38E, 0x3E7, 0x450, 0x4B8,
-        0x512, 0x54E, 0x565, 0x554, 0x51C, 0x4C9, 0x465, 0x402, 0x3AE, 0x378,
-        0x367, 0x37F, 0x3BD, 0x417, 0x481, 0x4EC, 0x547, 0x585, 0x59D, 0x58D,
-        0x558, 0x505, 0x4A3, 0x442, 0x3F0, 0x3BB, 0x3AB, 0x3C5, 0x404, 0x461,
-        0x4CD, 0x539, 0x596, 0x5D6, 0x5F1, 0x5E3, 0x5AF, 0x55F, 0x4FF, 0x4A0,
-        0x450, 0x41D, 0x410, 0x42C, 0x46D, 0x4CC, 0x53A, 0x5A9, 0x608, 0x64A,
-        0x667, 0x65C, 0x62A, 0x5DC, 0x57F, 0x522, 0x4D4, 0x4A4, 0x499, 0x4B7,
-        0x4FB, 0x55D, 0x5CD, 0x63F, 0x6A0, 0x6E5, 0x705, 0x6FB, 0x6CC, 0x681,
-        0x626, 0x5CB, 0x580, 0x551, 0x548, 0x569, 0x5AE, 0x611, 0x683, 0x6F6,
-        0x758, 0x79E, 0x7BF, 0x7B6, 0x788, 0x73C, 0x6E2, 0x687, 0x63C, 0x60D,
-        0x604, 0x624, 0x669, 0x6CB, 0x73D, 0x7AE, 0x810, 0x855, 0x874, 0x86A,
-        0x83A, 0x7ED, 0x791, 0x734, 0x6E7, 0x6B7, 0x6AB, 0x6C9, 0x70C, 0x76C,
-        0x7DB, 0x84A, 0x8A9, 0x8EB, 0x907, 0x8FA, 0x8C7, 0x877, 0x817, 0x7B7,
-        0x767, 0x732, 0x724, 0x73E, 0x77D, 0x7D9, 0x844, 0x8AF, 0x909, 0x947,
-        0x95F, 0x94E, 0x917, 0x8C2, 0x85E, 0x7F9, 0x7A4, 0x76B, 0x758, 0x76D,
-        0x7A7, 0x7FE, 0x864, 0x8CA, 0x91F, 0x958, 0x96A, 0x954, 0x917, 0x8BD,
-        0x854, 0x7EA, 0x78F, 0x750, 0x737, 0x746, 0x77B, 0x7CC, 0x82C, 0x88C,
-        0x8DC, 0x90F, 0x91C, 0x8FF, 0x8BD, 0x85E, 0x7EE, 0x77F, 0x71F, 0x6DB,
-        0x6BD, 0x6C8, 0x6F7, 0x744, 0x7A0, 0x7FC, 0x848, 0x877, 0x880, 0x860,
-        0x81A, 0x7B8, 0x745, 0x6D3, 0x670, 0x62A, 0x609, 0x612, 0x63F, 0x68A,
-        0x6E4, 0x73E, 0x788, 0x7B6, 0x7BD, 0x79C, 0x756, 0x6F2, 0x67F, 0x60C,
-        0x5A8, 0x562, 0x541, 0x548, 0x576, 0x5C0, 0x61A, 0x674, 0x6BF, 0x6ED,
-        0x6F5, 0x6D5, 0x68E, 0x62C, 0x5B9, 0x547, 0x4E4, 0x49F, 0x47F, 0x488,
-        0x4B7, 0x503, 0x55E, 0x5BA, 0x606, 0x636, 0x63F, 0x621, 0x5DD, 0x57C,
-        0x50B, 0x49B, 0x43B, 0x3F7, 0x3DA, 0x3E5, 0x416, 0x464, 0x4C2, 0x520,
-        0x56F, 0x5A1, 0x5AE, 0x592, 0x550, 0x4F2, 0x484, 0x417, 0x3B9, 0x378,
-        0x35E, 0x36C, 0x3A0, 0x3F1, 0x451, 0x4B2, 0x504, 0x539, 0x548, 0x52F,
-        0x4F0, 0x494, 0x429, 0x3BE, 0x363, 0x325, 0x30D, 0x31E, 0x354, 0x3A7,
-        0x40A, 0x46E, 0x4C1, 0x4F8, 0x50A, 0x4F2, 0x4B6, 0x45C, 0x3F3, 0x38A,
-        0x331, 0x2F5, 0x2DE, 0x2F0, 0x328, 0x37D, 0x3E2, 0x447, 0x49C, 0x4D4,
-        0x4E7, 0x4D2, 0x496, 0x43E, 0x3D6, 0x36F, 0x317, 0x2DB, 0x2C6, 0x2DA,
-        0x313, 0x369, 0x3CE, 0x434, 0x48A, 0x4C4, 0x4D8, 0x4C3, 0x488, 0x431,
-        0x3CA, 0x363, 0x30C, 0x2D1, 0x2BD, 0x2D1, 0x30A, 0x361, 0x3C7, 0x42E,
-        0x484, 0x4BE, 0x4D2, 0x4BE, 0x484, 0x42D, 0x3C6, 0x360, 0x309, 0x2CF,
-        0x2BA, 0x2CF, 0x309, 0x360, 0x3C6, 0x42D, 0x484, 0x4BE, 0x4D2, 0x4BE,
-        0x484, 0x42D, 0x3C6, 0x360, 0x309, 0x2CF, 0x2BB, 0x2CF, 0x309, 0x360,
-        0x3C7, 0x42D, 0x484, 0x4BE, 0x4D2, 0x4BE, 0x484, 0x42D, 0x3C7, 0x360,
-        0x309, 0x2CF, 0x2BB, 0x2CF, 0x309, 0x360, 0x3C7, 0x42D, 0x484, 0x4BE,
-        0x4D3, 0x4BE, 0x484, 0x42D, 0x3C7, 0x360, 0x309, 0x2CF, 0x2BB, 0x2CF,
-        0x30A, 0x360, 0x3C7, 0x42D, 0x484, 0x4BE, 0x4D3, 0x4BF, 0x485, 0x42E,
-        0x3C7, 0x361, 0x30A, 0x2D0, 0x2BC, 0x2D0, 0x30A, 0x361, 0x3C7, 0x42E,
-        0x485, 0x4BF, 0x4D3, 0x4BF, 0x485, 0x42E, 0x3C7, 0x361, 0x30A, 0x2D0,
-        0x2BB, 0x2D0, 0x30A, 0x361, 0x3C7, 0x42E, 0x485, 0x4BF, 0x4D3, 0x4BF,
-        0x484, 0x42E, 0x3C7, 0x361, 0x30A, 0x2D0, 0x2BB, 0x2D0, 0x30A, 0x361,
-        0x3C7, 0x42E, 0x485, 0x4BF, 0x4D3, 0x4BF, 0x485, 0x42F, 0x3C8, 0x362,
-        0x30B, 0x2D1, 0x2BD, 0x2D2, 0x30C, 0x364, 0x3CA, 0x431, 0x489, 0x4C3,
-        0x4D8, 0x4C4, 0x48B, 0x434, 0x3CF, 0x369, 0x313, 0x2D9, 0x2C6, 0x2DB,
-        0x316, 0x36E, 0x3D5, 0x43D, 0x495, 0x4D0, 0x4E6, 0x4D3, 0x49A, 0x444,
-        0x3E0, 0x37B, 0x326, 0x2ED, 0x2DB, 0x2F2, 0x32E, 0x387, 0x3F0, 0x45A,
-        0x4B3, 0x4F0, 0x508, 0x4F7, 0x4C1, 0x46E, 0x40B, 0x3A9, 0x357, 0x321,
-        0x312, 0x32B, 0x36A, 0x3C7, 0x433, 0x49F, 0x4FC, 0x53D, 0x558, 0x54A,
-        0x517, 0x4C8, 0x469, 0x40A, 0x3BB, 0x389, 0x37D, 0x39A, 0x3DD, 0x43D,
-        0x4AD, 0x51D, 0x57E, 0x5C1, 0x5E0, 0x5D6, 0x5A6, 0x55A, 0x4FF, 0x4A3,
-        0x458, 0x429, 0x420, 0x440, 0x487, 0x4E9, 0x55C, 0x5CF, 0x632, 0x678,
-        0x699, 0x690, 0x662, 0x617, 0x5BD, 0x562, 0x516, 0x4E7, 0x4DE, 0x4FD,
-        0x541, 0x5A2, 0x613, 0x683, 0x6E3, 0x725, 0x742, 0x736, 0x704, 0x6B4,
-        0x654, 0x5F4, 0x5A3, 0x56E, 0x55F, 0x578, 0x5B6, 0x610, 0x67A, 0x6E3,
-        0x73B, 0x777, 0x78C, 0x778, 0x73E, 0x6E6, 0x67F, 0x616, 0x5BD, 0x580,
-        0x569, 0x579, 0x5AF, 0x601, 0x662, 0x6C2, 0x712, 0x745, 0x752, 0x736,
-        0x6F3, 0x693, 0x624, 0x5B3, 0x552, 0x50E, 0x4EF, 0x4F8, 0x527, 0x572,
-        0x5CD, 0x628, 0x673, 0x6A1, 0x6A9, 0x688, 0x642, 0x5DE, 0x56B, 0x4F8,
-        0x495, 0x44F, 0x42E, 0x436, 0x464, 0x4AE, 0x509, 0x563, 0x5AE, 0x5DD,
-        0x5E5, 0x5C6, 0x580, 0x51E, 0x4AD, 0x43C, 0x3DB, 0x396, 0x378, 0x383,
-        0x3B3, 0x401, 0x45E, 0x4BC, 0x50A, 0x53C, 0x548, 0x52C, 0x4EB, 0x48C,
-        0x41F, 0x3B2, 0x354, 0x314, 0x2FA, 0x309, 0x33E, 0x390, 0x3F2, 0x455,
-        0x4A8, 0x4DE, 0x4EF, 0x4D7, 0x499, 0x43F, 0x3D5, 0x36B, 0x311, 0x2D3,
-        0x2BA, 0x2CA, 0x300, 0x352, 0x3B3, 0x414, 0x465, 0x499, 0x4A7, 0x48B,
-        0x44A, 0x3EB, 0x37C, 0x30C, 0x2AC, 0x268, 0x249, 0x252, 0x280, 0x2CB,
-        0x324, 0x37D, 0x3C6, 0x3F2, 0x3F7, 0x3D2, 0x388, 0x320, 0x2A8, 0x22F,
-        0x1C6, 0x178, 0x150, 0x14F, 0x175, 0x1B8, 0x20D, 0x264, 0x2AF, 0x2E0,
-        0x2EF, 0x2DA, 0x2A5, 0x257, 0x200, 0x1AE, 0x172, 0x159, 0x16D, 0x1AF,
-        0x21D, 0x2AF, 0x358, 0x406, 0x4AC, 0x53A, 0x5AA, 0x5F6, 0x622, 0x636,
-        0x640, 0x64E, 0x670, 0x6B2, 0x71C, 0x7B2, 0x86F, 0x94A, 0xA35, 0xB20,
-        0xBF9, 0xCB0, 0xD3C, 0xD97, 0xDC4, 0xDC9, 0xDB3, 0xD90, 0xD70, 0xD5E,
-        0xD63, 0xD83, 0xDB9, 0xDFD, 0xE42, 0xE78, 0xE91, 0xE7F, 0xE3C, 0xDC4,
-        0xD1C, 0xC4E, 0xB69, 0xA7D, 0x99D, 0x8D5, 0x831, 0x7B4, 0x75D, 0x724,
-        0x6FC, 0x6D7, 0x6A6, 0x65D, 0x5F3, 0x567, 0x4BA, 0x3F8, 0x32D, 0x26A,
-        0x1BE, 0x136, 0xDC, 0xB2, 0xB6, 0xDE, 0x11C, 0x162, 0x19E, 0x1C5,
-        0x1CD, 0x1B2, 0x178, 0x125, 0xC7, 0x6E, 0x27, 0x0, 0x1, 0x2E,
-        0x81, 0xF3, 0x175, 0x1F8, 0x26C, 0x2C3, 0x2F4, 0x2FC, 0x2DE, 0x2A2,
-        0x256, 0x208, 0x1C8, 0x1A5, 0x1A5, 0x1CD, 0x219, 0x280, 0x2F5, 0x369,
-        0x3CC, 0x411, 0x430, 0x424, 0x3F2, 0x3A3, 0x343, 0x2E3, 0x291, 0x25C,
-        0x24C, 0x264, 0x2A2, 0x2FC, 0x365, 0x3CE, 0x427, 0x464, 0x47A, 0x467,
-        0x42F, 0x3D9, 0x374, 0x30F, 0x2BA, 0x281, 0x26E, 0x284, 0x2C0, 0x319,
-        0x381, 0x3E9, 0x442, 0x47F, 0x495, 0x484, 0x44C, 0x3F8, 0x395, 0x332,
-        0x2DE, 0x2A8, 0x297, 0x2AF, 0x2ED, 0x348, 0x3B3, 0x41E, 0x479, 0x4B8,
-        0x4D1, 0x4C1, 0x48C, 0x439, 0x3D8, 0x376, 0x325, 0x2F0, 0x2E1, 0x2FB,
-        0x33B, 0x398, 0x404, 0x471, 0x4CE, 0x50E, 0x529, 0x51C, 0x4E9, 0x499,
-        0x43A, 0x3DA, 0x38B, 0x359, 0x34C, 0x368, 0x3AB, 0x40A, 0x479, 0x4E8,
-        0x547, 0x58A, 0x5A7, 0x59C, 0x56B, 0x51E, 0x4C1, 0x464, 0x417, 0x3E7,
-        0x3DC, 0x3FB, 0x43F, 0x4A0, 0x511, 0x582, 0x5E4, 0x629, 0x648, 0x63F,
-        0x610, 0x5C4, 0x569, 0x50D, 0x4C2, 0x493, 0x48A, 0x4AA, 0x4F0, 0x553,
-        0x5C5, 0x637, 0x69A, 0x6DF, 0x700, 0x6F7, 0x6C9, 0x67D, 0x623, 0x5C8,
-        0x57C, 0x54E, 0x545, 0x565, 0x5AA, 0x60C, 0x67E, 0x6EF, 0x751, 0x796,
-        0x7B5, 0x7AB, 0x77B, 0x72E, 0x6D2, 0x675, 0x627, 0x5F7, 0x5EC, 0x609,
-        0x64C, 0x6AB, 0x71A, 0x789, 0x7E8, 0x829, 0x845, 0x838, 0x805, 0x7B4,
-        0x754, 0x6F4, 0x6A3, 0x66E, 0x65F, 0x678, 0x6B7, 0x712, 0x77D, 0x7E7,
-        0x841, 0x87E, 0x895, 0x883, 0x84B, 0x7F6, 0x791, 0x72C, 0x6D5, 0x69C,
-        0x687, 0x69B, 0x6D5, 0x72A, 0x78F, 0x7F4, 0x848, 0x880, 0x891, 0x879,
-        0x83B, 0x7E0, 0x774, 0x709, 0x6AC, 0x66D, 0x652, 0x660, 0x693, 0x6E3,
-        0x742, 0x7A1, 0x7F0, 0x822, 0x82E, 0x811, 0x7CE, 0x76E, 0x6FF, 0x68E,
-        0x62E, 0x5EA, 0x5CB, 0x5D5, 0x605, 0x651, 0x6AD, 0x708, 0x754, 0x783,
-        0x78C, 0x76C, 0x727, 0x6C4, 0x652, 0x5DF, 0x57D, 0x537, 0x516, 0x51E,
-        0x54C, 0x597, 0x5F1, 0x64B, 0x696, 0x6C3, 0x6CB, 0x6AA, 0x664, 0x601,
-        0x58E, 0x51B, 0x4B7, 0x471, 0x450, 0x458, 0x486, 0x4D1, 0x52B, 0x585,
-        0x5D0, 0x5FE, 0x607, 0x5E6, 0x5A0, 0x53E, 0x4CC, 0x45A, 0x3F7, 0x3B2,
-        0x392, 0x39B, 0x3CA, 0x416, 0x472, 0x4CE, 0x51A, 0x54A, 0x554, 0x535,
-        0x4F1, 0x490, 0x420, 0x3B0, 0x350, 0x30C, 0x2EF, 0x2FA, 0x32B, 0x37A,
-        0x3D8, 0x436, 0x484, 0x4B6, 0x4C3, 0x4A7, 0x465, 0x407, 0x39A, 0x32C,
-        0x2CF, 0x28E, 0x273, 0x281, 0x2B5, 0x306, 0x367, 0x3C8, 0x419, 0x44E,
-        0x45D, 0x444, 0x405, 0x3AA, 0x33F, 0x2D4, 0x278, 0x23A, 0x222, 0x232,
-        0x269, 0x2BC, 0x31F, 0x382, 0x3D5, 0x40C, 0x41D, 0x406, 0x3C9, 0x36F,
-        0x306, 0x29D, 0x244, 0x207, 0x1F1, 0x203, 0x23B, 0x28F, 0x2F4, 0x359,
-        0x3AE, 0x3E6, 0x3F9, 0x3E3, 0x3A7, 0x34F, 0x2E7, 0x27F, 0x227, 0x1EC
-    },
-
-    // ECG con ruido de 320Hz añadido, fs = 960Hz, duracion = 2.896s, numSamples = 2780
-    {
-        0x3DC, 0x585, 0x23A, 0x3E4, 0x58D, 0x243, 0x3ED, 0x597, 0x24D, 0x3F7,
-        0x5A0, 0x256, 0x401, 0x5AB, 0x261, 0x40C, 0x5B7, 0x26D, 0x418, 0x5C3,
-        0x27A, 0x425, 0x5D0, 0x288, 0x433, 0x5DE, 0x296, 0x442, 0x5EE, 0x2A6,
-        0x452, 0x5FF, 0x2B7, 0x463, 0x610, 0x2C9, 0x477, 0x624, 0x2DD, 0x48A,
-        0x637, 0x2F1, 0x49F, 0x64D, 0x307, 0x4B5, 0x663, 0x31E, 0x4CC, 0x67B,
-        0x336, 0x4E5, 0x694, 0x34F, 0x4FE, 0x6AE, 0x369, 0x519, 0x6C9, 0x384,
-        0x534, 0x6E5, 0x3A1, 0x551, 0x702, 0x3BE, 0x56F, 0x720, 0x3DD, 0x58E,
-        0x73F, 0x3FC, 0x5AD, 0x75F, 0x41C, 0x5CE, 0x77F, 0x43D, 0x5EE, 0x79F,
-        0x45C, 0x60E, 0x7BF, 0x47C, 0x62E, 0x7DF, 0x49C, 0x64E, 0x7FF, 0x4BC,
-        0x66D, 0x81E, 0x4DA, 0x68B, 0x83B, 0x4F8, 0x6A8, 0x858, 0x515, 0x6C5,
-        0x874, 0x530, 0x6E0, 0x88F, 0x54B, 0x6F9, 0x8A9, 0x563, 0x712, 0x8C1,
-        0x57A, 0x728, 0x8D6, 0x590, 0x73D, 0x8EB, 0x5A4, 0x750, 0x8FC, 0x5B4,
-        0x761, 0x90D, 0x5C4, 0x76F, 0x91A, 0x5D1, 0x77C, 0x925, 0x5DB, 0x785,
-        0x92F, 0x5E4, 0x78C, 0x935, 0x5E9, 0x791, 0x939, 0x5EC, 0x793, 0x939,
-        0x5EC, 0x792, 0x938, 0x5E9, 0x78E, 0x933, 0x5E3, 0x787, 0x92A, 0x5DA,
-        0x77C, 0x91F, 0x5CD, 0x76F, 0x911, 0x5BE, 0x75F, 0x900, 0x5AC, 0x74D,
-        0x8EC, 0x598, 0x737, 0x8D7, 0x582, 0x721, 0x8C0, 0x56A, 0x708, 0x8A6,
-        0x550, 0x6EE, 0x88B, 0x535, 0x6D2, 0x86F, 0x519, 0x6B6, 0x853, 0x4FB,
-        0x698, 0x835, 0x4DE, 0x67A, 0x817, 0x4BF, 0x65B, 0x7F8, 0x4A0, 0x63C,
-        0x7D9, 0x481, 0x61C, 0x7B9, 0x461, 0x5FD, 0x79A, 0x441, 0x5DE, 0x77A,
-        0x422, 0x5BF, 0x75B, 0x403, 0x5A0, 0x73D, 0x3E5, 0x581, 0x71F, 0x3C8,
-        0x564, 0x701, 0x3AA, 0x547, 0x6E5, 0x38E, 0x52B, 0x6C9, 0x372, 0x510,
-        0x6AE, 0x358, 0x4F6, 0x694, 0x33E, 0x4DC, 0x67B, 0x326, 0x4C4, 0x663,
-        0x30E, 0x4AD, 0x64C, 0x2F8, 0x497, 0x637, 0x2E2, 0x482, 0x623, 0x2CF,
-        0x46F, 0x610, 0x2BC, 0x45D, 0x5FD, 0x2AB, 0x44C, 0x5EE, 0x29B, 0x43D,
-        0x5DE, 0x28C, 0x42E, 0x5D0, 0x27E, 0x421, 0x5C3, 0x272, 0x415, 0x5B7,
-        0x267, 0x40A, 0x5AD, 0x25D, 0x400, 0x5A4, 0x254, 0x3F7, 0x59C, 0x24C,
-        0x3EF, 0x594, 0x245, 0x3E9, 0x58D, 0x23E, 0x3E3, 0x588, 0x239, 0x3DD,
-        0x582, 0x233, 0x3D9, 0x57E, 0x22F, 0x3D5, 0x57A, 0x22C, 0x3D1, 0x577,
-        0x229, 0x3CF, 0x575, 0x227, 0x3CC, 0x572, 0x224, 0x3CA, 0x571, 0x223,
-        0x3C9, 0x56F, 0x221, 0x3C8, 0x56E, 0x220, 0x3C7, 0x56E, 0x21F, 0x3C6,
-        0x56D, 0x21F, 0x3C6, 0x56D, 0x21F, 0x3C6, 0x56D, 0x21F, 0x3C6, 0x56D,
-        0x21F, 0x3C6, 0x56E, 0x220, 0x3C7, 0x56E, 0x220, 0x3C8, 0x56E, 0x221,
-        0x3C9, 0x56F, 0x222, 0x3C9, 0x570, 0x223, 0x3CA, 0x571, 0x224, 0x3CB,
-        0x572, 0x225, 0x3CC, 0x573, 0x226, 0x3CD, 0x574, 0x227, 0x3CE, 0x576,
-        0x228, 0x3D0, 0x577, 0x22A, 0x3D1, 0x578, 0x22B, 0x3D2, 0x57A, 0x22D,
-        0x3D4, 0x57B, 0x22F, 0x3D5, 0x57D, 0x230, 0x3D7, 0x57E, 0x232, 0x3D8,
-        0x580, 0x233, 0x3DB, 0x581, 0x235, 0x3DC, 0x583, 0x237, 0x3DE, 0x585,
-        0x238, 0x3E0, 0x587, 0x23A, 0x3E1, 0x589, 0x23B, 0x3E3, 0x58A, 0x23E,
-        0x3E4, 0x58C, 0x23F, 0x3E6, 0x58D, 0x241, 0x3E7, 0x58F, 0x242, 0x3E9,
-        0x591, 0x244, 0x3EB, 0x592, 0x246, 0x3EC, 0x594, 0x247, 0x3EE, 0x595,
-        0x249, 0x3EF, 0x597, 0x24A, 0x3F1, 0x598, 0x24C, 0x3F3, 0x59A, 0x24E,
-        0x3F4, 0x59C, 0x24F, 0x3F6, 0x59D, 0x251, 0x3F8, 0x59F, 0x252, 0x3FA,
-        0x5A1, 0x255, 0x3FB, 0x5A3, 0x256, 0x3FE, 0x5A5, 0x259, 0x400, 0x5A8,
-        0x25B, 0x403, 0x5AA, 0x25D, 0x405, 0x5AC, 0x260, 0x407, 0x5AF, 0x263,
-        0x40A, 0x5B2, 0x266, 0x40E, 0x5B5, 0x269, 0x411, 0x5B9, 0x26D, 0x415,
-        0x5BD, 0x271, 0x41A, 0x5C2, 0x276, 0x41E, 0x5C6, 0x27A, 0x423, 0x5CB,
-        0x280, 0x428, 0x5D1, 0x286, 0x42E, 0x5D7, 0x28C, 0x436, 0x5DF, 0x295,
-        0x43F, 0x5E9, 0x29F, 0x449, 0x5F3, 0x2AA, 0x455, 0x600, 0x2B7, 0x463,
-        0x60E, 0x2C6, 0x472, 0x61E, 0x2D6, 0x483, 0x62F, 0x2E8, 0x496, 0x643,
-        0x2FD, 0x4AB, 0x659, 0x313, 0x4C2, 0x671, 0x32B, 0x4DB, 0x689, 0x345,
-        0x4F4, 0x6A4, 0x360, 0x510, 0x6C0, 0x37C, 0x52D, 0x6DD, 0x39A, 0x54B,
-        0x6FC, 0x3B9, 0x56A, 0x71B, 0x3D8, 0x589, 0x73A, 0x3F7, 0x5A9, 0x75A,
-        0x417, 0x5C9, 0x77A, 0x437, 0x5E8, 0x799, 0x455, 0x606, 0x7B6, 0x473,
-        0x622, 0x7D2, 0x48D, 0x63C, 0x7EB, 0x4A5, 0x653, 0x800, 0x4BA, 0x666,
-        0x813, 0x4CB, 0x676, 0x822, 0x4D8, 0x682, 0x82C, 0x4E1, 0x68A, 0x832,
-        0x4E7, 0x68E, 0x835, 0x4E7, 0x68C, 0x832, 0x4E3, 0x688, 0x82B, 0x4DB,
-        0x67E, 0x821, 0x4CF, 0x671, 0x812, 0x4BF, 0x65F, 0x7FF, 0x4AB, 0x64B,
-        0x7E9, 0x494, 0x633, 0x7D1, 0x47A, 0x618, 0x7B5, 0x45E, 0x5FA, 0x797,
-        0x440, 0x5DC, 0x778, 0x420, 0x5BC, 0x759, 0x400, 0x59C, 0x739, 0x3E0,
-        0x57D, 0x719, 0x3C1, 0x55E, 0x6FA, 0x3A2, 0x53F, 0x6DC, 0x384, 0x521,
-        0x6BE, 0x368, 0x506, 0x6A3, 0x34D, 0x4EB, 0x68A, 0x334, 0x4D3, 0x672,
-        0x31D, 0x4BC, 0x65C, 0x308, 0x4A9, 0x649, 0x2F5, 0x496, 0x637, 0x2E5,
-        0x486, 0x628, 0x2D5, 0x478, 0x61A, 0x2C9, 0x46C, 0x60F, 0x2BE, 0x462,
-        0x605, 0x2B5, 0x459, 0x5FD, 0x2AD, 0x451, 0x5F5, 0x2A5, 0x449, 0x5EE,
-        0x29D, 0x441, 0x5E5, 0x294, 0x438, 0x5DB, 0x28A, 0x42D, 0x5CF, 0x27D,
-        0x41F, 0x5C0, 0x26D, 0x40D, 0x5AC, 0x258, 0x3F7, 0x595, 0x23E, 0x3DA,
-        0x576, 0x21C, 0x3B6, 0x54F, 0x1F3, 0x38A, 0x51E, 0x1BE, 0x351, 0x4E3,
-        0x182, 0x316, 0x4AA, 0x14C, 0x2E4, 0x47E, 0x128, 0x2C7, 0x46B, 0x11D,
-        0x2C8, 0x476, 0x135, 0x2EC, 0x4A9, 0x175, 0x33B, 0x505, 0x1E1, 0x3B6,
-        0x591, 0x27C, 0x461, 0x64A, 0x346, 0x53A, 0x733, 0x43E, 0x641, 0x849,
-        0x561, 0x772, 0x986, 0x6AB, 0x8C8, 0xAE7, 0x814, 0xA35, 0xC54, 0x97C,
-        0xB94, 0xDA5, 0xABB, 0xCBC, 0xEB4, 0xBAF, 0xD92, 0xF6A, 0xC42, 0xE01,
-        0xFB3, 0xC65, 0xDFD, 0xF89, 0xC14, 0xD86, 0xEEC, 0xB53, 0xCA3, 0xDE8,
-        0xA31, 0xB67, 0xC98, 0x8D0, 0x9F9, 0xB20, 0x752, 0x878, 0x99F, 0x5D4,
-        0x700, 0x830, 0x46F, 0x5A8, 0x6E5, 0x334, 0x47D, 0x5CC, 0x22F, 0x38B,
-        0x4EE, 0x165, 0x2D8, 0x453, 0xE2, 0x26B, 0x3FB, 0x9D, 0x238, 0x3D8,
-        0x89, 0x232, 0x3DF, 0x9A, 0x24D, 0x402, 0xC6, 0x280, 0x43A, 0x103,
-        0x2C0, 0x47E, 0x148, 0x307, 0x4C6, 0x190, 0x34F, 0x50D, 0x1D6, 0x392,
-        0x54D, 0x214, 0x3CD, 0x585, 0x249, 0x3FF, 0x5B3, 0x273, 0x425, 0x5D6,
-        0x292, 0x441, 0x5EF, 0x2A9, 0x455, 0x601, 0x2B9, 0x465, 0x610, 0x2C7,
-        0x472, 0x61C, 0x2D2, 0x47C, 0x626, 0x2DB, 0x485, 0x62E, 0x2E4, 0x48D,
-        0x636, 0x2EB, 0x493, 0x63C, 0x2F1, 0x49A, 0x643, 0x2F8, 0x4A1, 0x64A,
-        0x2FE, 0x4A7, 0x650, 0x306, 0x4AF, 0x658, 0x30E, 0x4B7, 0x661, 0x317,
-        0x4C0, 0x66A, 0x320, 0x4CB, 0x675, 0x32B, 0x4D6, 0x681, 0x338, 0x4E3,
-        0x68E, 0x345, 0x4F1, 0x69D, 0x355, 0x501, 0x6AD, 0x365, 0x511, 0x6BE,
-        0x377, 0x523, 0x6D0, 0x389, 0x536, 0x6E3, 0x39C, 0x549, 0x6F7, 0x3B1,
-        0x55F, 0x70C, 0x3C6, 0x574, 0x723, 0x3DD, 0x58B, 0x73A, 0x3F5, 0x5A4,
-        0x752, 0x40E, 0x5BD, 0x76C, 0x428, 0x5D7, 0x787, 0x443, 0x5F3, 0x7A3,
-        0x460, 0x610, 0x7C0, 0x47C, 0x62D, 0x7DD, 0x49A, 0x64B, 0x7FB, 0x4B8,
-        0x669, 0x81A, 0x4D7, 0x688, 0x839, 0x4F7, 0x6A8, 0x859, 0x517, 0x6C8,
-        0x879, 0x537, 0x6E8, 0x899, 0x557, 0x708, 0x8B9, 0x576, 0x727, 0x8D8,
-        0x595, 0x746, 0x8F7, 0x5B4, 0x765, 0x915, 0x5D2, 0x782, 0x932, 0x5EE,
-        0x79E, 0x94E, 0x609, 0x7BA, 0x969, 0x624, 0x7D3, 0x982, 0x63C, 0x7EB,
-        0x999, 0x653, 0x801, 0x9AF, 0x668, 0x815, 0x9C2, 0x67A, 0x826, 0x9D3,
-        0x68B, 0x836, 0x9E2, 0x698, 0x843, 0x9EE, 0x6A4, 0x84D, 0x9F6, 0x6AB,
-        0x855, 0x9FE, 0x6B1, 0x859, 0xA01, 0x6B4, 0x85B, 0xA02, 0x6B4, 0x85A,
-        0xA00, 0x6B1, 0x856, 0x9FB, 0x6AB, 0x850, 0x9F4, 0x6A4, 0x846, 0x9EA,
-        0x698, 0x83A, 0x9DD, 0x68A, 0x82C, 0x9CD, 0x67A, 0x81B, 0x9BC, 0x668,
-        0x807, 0x9A7, 0x652, 0x7F2, 0x991, 0x63C, 0x7DA, 0x979, 0x623, 0x7C2,
-        0x95F, 0x609, 0x7A7, 0x944, 0x5ED, 0x78A, 0x927, 0x5CF, 0x76C, 0x909,
-        0x5B1, 0x74E, 0x8EA, 0x591, 0x72E, 0x8C9, 0x572, 0x70D, 0x8A9, 0x551,
-        0x6ED, 0x889, 0x530, 0x6CC, 0x868, 0x510, 0x6AB, 0x847, 0x4EF, 0x68B,
-        0x826, 0x4CF, 0x66A, 0x807, 0x4AF, 0x64B, 0x7E7, 0x48F, 0x62C, 0x7C9,
-        0x471, 0x60D, 0x7AA, 0x454, 0x5F0, 0x78D, 0x436, 0x5D4, 0x771, 0x41B,
-        0x5B8, 0x756, 0x400, 0x59E, 0x73D, 0x3E7, 0x585, 0x724, 0x3CF, 0x56E,
-        0x70C, 0x3B8, 0x557, 0x6F7, 0x3A2, 0x542, 0x6E2, 0x38E, 0x52E, 0x6CE,
-        0x37B, 0x51C, 0x6BC, 0x369, 0x50A, 0x6AB, 0x359, 0x4FA, 0x69C, 0x34A,
-        0x4EC, 0x68E, 0x33C, 0x4DF, 0x681, 0x330, 0x4D3, 0x675, 0x324, 0x4C8,
-        0x66A, 0x31A, 0x4BD, 0x661, 0x310, 0x4B4, 0x658, 0x308, 0x4AC, 0x650,
-        0x300, 0x4A5, 0x649, 0x2FA, 0x49E, 0x643, 0x2F4, 0x499, 0x63E, 0x2EE,
-        0x493, 0x638, 0x2EA, 0x48F, 0x634, 0x2E6, 0x48B, 0x631, 0x2E2, 0x488,
-        0x62E, 0x2DF, 0x485, 0x62B, 0x2DD, 0x482, 0x628, 0x2DB, 0x481, 0x627,
-        0x2D9, 0x47F, 0x625, 0x2D8, 0x47E, 0x624, 0x2D6, 0x47D, 0x624, 0x2D6,
-        0x47C, 0x623, 0x2D5, 0x47C, 0x623, 0x2D5, 0x47C, 0x622, 0x2D5, 0x47C,
-        0x623, 0x2D5, 0x47C, 0x623, 0x2D5, 0x47C, 0x623, 0x2D5, 0x47D, 0x624,
-        0x2D6, 0x47D, 0x624, 0x2D7, 0x47E, 0x624, 0x2D8, 0x47E, 0x625, 0x2D8,
-        0x47F, 0x626, 0x2D9, 0x480, 0x627, 0x2DA, 0x481, 0x628, 0x2DB, 0x482,
-        0x628, 0x2DC, 0x482, 0x62A, 0x2DD, 0x483, 0x62B, 0x2DD, 0x485, 0x62B,
-        0x2DF, 0x486, 0x62D, 0x2E0, 0x487, 0x62E, 0x2E1, 0x488, 0x62F, 0x2E2,
-        0x489, 0x630, 0x2E3, 0x48A, 0x631, 0x2E5, 0x48B, 0x633, 0x2E5, 0x48D,
-        0x633, 0x2E7, 0x48E, 0x635, 0x2E8, 0x48F, 0x636, 0x2E9, 0x490, 0x637,
-        0x2EA, 0x492, 0x638, 0x2EC, 0x492, 0x63A, 0x2EC, 0x493, 0x63B, 0x2ED,
-        0x495, 0x63B, 0x2EF, 0x496, 0x63D, 0x2F0, 0x497, 0x63E, 0x2F1, 0x498,
-        0x63F, 0x2F2, 0x499, 0x640, 0x2F4, 0x49A, 0x642, 0x2F4, 0x49C, 0x643,
-        0x2F6, 0x49D, 0x644, 0x2F7, 0x49E, 0x646, 0x2F8, 0x4A0, 0x646, 0x2FA,
-        0x4A1, 0x648, 0x2FC, 0x4A3, 0x64A, 0x2FD, 0x4A5, 0x64B, 0x2FF, 0x4A6,
-        0x64E, 0x301, 0x4A8, 0x64F, 0x303, 0x4AA, 0x652, 0x305, 0x4AD, 0x654,
-        0x307, 0x4AF, 0x656, 0x30A, 0x4B1, 0x65A, 0x30D, 0x4B5, 0x65D, 0x311,
-        0x4B9, 0x662, 0x316, 0x4BE, 0x666, 0x31B, 0x4C4, 0x66C, 0x321, 0x4CA,
-        0x673, 0x328, 0x4D1, 0x67B, 0x330, 0x4DA, 0x684, 0x33A, 0x4E4, 0x68E,
-        0x345, 0x4EF, 0x69A, 0x351, 0x4FC, 0x6A7, 0x35F, 0x50A, 0x6B7, 0x36E,
-        0x51A, 0x6C7, 0x37F, 0x52C, 0x6D9, 0x393, 0x540, 0x6ED, 0x3A7, 0x555,
-        0x704, 0x3BE, 0x56D, 0x71C, 0x3D7, 0x587, 0x736, 0x3F3, 0x5A3, 0x753,
-        0x410, 0x5C0, 0x771, 0x42E, 0x5DF, 0x791, 0x44E, 0x600, 0x7B1, 0x46F,
-        0x620, 0x7D1, 0x48E, 0x63F, 0x7F1, 0x4AE, 0x65F, 0x810, 0x4CD, 0x67E,
-        0x82E, 0x4EB, 0x69B, 0x84B, 0x507, 0x6B7, 0x866, 0x521, 0x6CF, 0x87E,
-        0x538, 0x6E6, 0x894, 0x54D, 0x6FA, 0x8A6, 0x55F, 0x70B, 0x8B5, 0x56D,
-        0x717, 0x8C1, 0x577, 0x720, 0x8C9, 0x57E, 0x725, 0x8CC, 0x57F, 0x726,
-        0x8CC, 0x57D, 0x721, 0x8C5, 0x575, 0x718, 0x8BA, 0x568, 0x709, 0x8AA,
-        0x557, 0x6F7, 0x896, 0x541, 0x6E0, 0x87F, 0x529, 0x6C6, 0x864, 0x50E,
-        0x6AB, 0x848, 0x4F0, 0x68C, 0x829, 0x4D1, 0x66D, 0x80A, 0x4B1, 0x64E,
-        0x7E9, 0x492, 0x62D, 0x7C9, 0x471, 0x60D, 0x7A9, 0x450, 0x5ED, 0x789,
-        0x431, 0x5CE, 0x76A, 0x412, 0x5B0, 0x74C, 0x3F5, 0x592, 0x730, 0x3D9,
-        0x577, 0x715, 0x3BF, 0x55E, 0x6FC, 0x3A6, 0x545, 0x6E5, 0x390, 0x530,
-        0x6CF, 0x37B, 0x51B, 0x6BC, 0x368, 0x50A, 0x6AB, 0x358, 0x4F9, 0x69B,
-        0x349, 0x4EB, 0x68D, 0x33C, 0x4DF, 0x682, 0x332, 0x4D6, 0x67B, 0x32B,
-        0x4D0, 0x675, 0x325, 0x4C9, 0x66D, 0x31D, 0x4C0, 0x664, 0x313, 0x4B5,
-        0x657, 0x304, 0x4A5, 0x646, 0x2F1, 0x491, 0x62F, 0x2D9, 0x477, 0x614,
-        0x2BC, 0x458, 0x5F2, 0x299, 0x433, 0x5CC, 0x271, 0x40A, 0x5A2, 0x246,
-        0x3DD, 0x575, 0x218, 0x3AE, 0x546, 0x1E9, 0x37F, 0x515, 0x1B7, 0x34C,
-        0x4E3, 0x186, 0x321, 0x4BF, 0x16C, 0x312, 0x4BC, 0x177, 0x32C, 0x4E7,
-        0x1B3, 0x37A, 0x547, 0x227, 0x401, 0x5E2, 0x2D5, 0x4C3, 0x6B7, 0x3BD,
-        0x5BB, 0x7C1, 0x4D7, 0x6E5, 0x8F7, 0x61A, 0x833, 0xA4E, 0x777, 0x995,
-        0xBB3, 0x8DC, 0xAF6, 0xD0F, 0xA30, 0xC3F, 0xE49, 0xB58, 0xD52, 0xF42,
-        0xC33, 0xE0B, 0xFD8, 0xCA5, 0xE58, 0xFFF, 0xCA4, 0xE31, 0xFB1, 0xC31,
-        0xD99, 0xEF6, 0xB53, 0xC9B, 0xDDB, 0xA1E, 0xB4E, 0xC7A, 0x8AE, 0x9D2,
-        0xAF6, 0x727, 0x84E, 0x977, 0x5AF, 0x6DD, 0x811, 0x454, 0x591, 0x6D3,
-        0x327, 0x476, 0x5CB, 0x232, 0x394, 0x4FD, 0x179, 0x2F0, 0x46D, 0xFD,
-        0x288, 0x419, 0xBB, 0x257, 0x3F8, 0xAA, 0x255, 0x404, 0xC3, 0x279,
-        0x432, 0xF9, 0x2B7, 0x476, 0x143, 0x303, 0x4C5, 0x193, 0x355, 0x515,
-        0x1E2, 0x3A2, 0x562, 0x22B, 0x3E8, 0x5A4, 0x26A, 0x423, 0x5DA, 0x29D,
-        0x451, 0x605, 0x2C3, 0x474, 0x624, 0x2E0, 0x48E, 0x63B, 0x2F4, 0x4A1,
-        0x64D, 0x304, 0x4AF, 0x659, 0x30F, 0x4B8, 0x662, 0x317, 0x4C0, 0x669,
-        0x31E, 0x4C6, 0x66F, 0x323, 0x4CC, 0x675, 0x329, 0x4D1, 0x67A, 0x32E,
-        0x4D7, 0x680, 0x336, 0x4DF, 0x688, 0x33D, 0x4E7, 0x690, 0x345, 0x4EF,
-        0x699, 0x34F, 0x4F9, 0x6A3, 0x359, 0x503, 0x6AD, 0x364, 0x50D, 0x6B8,
-        0x36F, 0x519, 0x6C4, 0x37B, 0x526, 0x6D2, 0x389, 0x534, 0x6DF, 0x397,
-        0x543, 0x6EE, 0x3A6, 0x553, 0x6FF, 0x3B7, 0x563, 0x710, 0x3C9, 0x576,
-        0x723, 0x3DC, 0x589, 0x736, 0x3EF, 0x59D, 0x74B, 0x405, 0x5B3, 0x761,
-        0x41B, 0x5C9, 0x778, 0x432, 0x5E1, 0x790, 0x44B, 0x5FA, 0x7AA, 0x465,
-        0x614, 0x7C5, 0x480, 0x630, 0x7E0, 0x49D, 0x64E, 0x7FE, 0x4BB, 0x66C,
-        0x81C, 0x4D9, 0x68A, 0x83B, 0x4F8, 0x6A9, 0x85B, 0x518, 0x6C9, 0x87A,
-        0x538, 0x6E9, 0x89A, 0x557, 0x708, 0x8B9, 0x576, 0x727, 0x8D8, 0x595,
-        0x746, 0x8F7, 0x5B4, 0x764, 0x915, 0x5D1, 0x781, 0x931, 0x5EE, 0x79E,
-        0x94D, 0x609, 0x7B9, 0x968, 0x624, 0x7D3, 0x982, 0x63C, 0x7EB, 0x999,
-        0x654, 0x802, 0x9B0, 0x66A, 0x817, 0x9C4, 0x67D, 0x82A, 0x9D7, 0x690,
-        0x83C, 0x9E7, 0x6A0, 0x84B, 0x9F6, 0x6AD, 0x858, 0xA02, 0x6B9, 0x863,
-        0xA0D, 0x6C2, 0x86B, 0xA14, 0x6C9, 0x871, 0xA19, 0x6CD, 0x874, 0xA1C,
-        0x6CE, 0x875, 0xA1B, 0x6CD, 0x873, 0xA18, 0x6C9, 0x86E, 0xA12, 0x6C3,
-        0x866, 0xA09, 0x6B9, 0x85C, 0x9FE, 0x6AC, 0x84E, 0x9EF, 0x69C, 0x83D,
-        0x9DE, 0x68A, 0x82A, 0x9C9, 0x675, 0x814, 0x9B3, 0x65E, 0x7FC, 0x99A,
-        0x644, 0x7E2, 0x97F, 0x629, 0x7C6, 0x963, 0x60D, 0x7A9, 0x946, 0x5EE,
-        0x78B, 0x927, 0x5CF, 0x76B, 0x907, 0x5AF, 0x74B, 0x8E7, 0x58E, 0x72A,
-        0x8C5, 0x56D, 0x708, 0x8A4, 0x54B, 0x6E7, 0x882, 0x529, 0x6C5, 0x860,
-        0x508, 0x6A3, 0x83E, 0x4E6, 0x681, 0x81D, 0x4C4, 0x661, 0x7FC, 0x4A4,
-        0x63F, 0x7DC, 0x483, 0x620, 0x7BC, 0x464, 0x600, 0x79D, 0x445, 0x5E2,
-        0x77E, 0x427, 0x5C4, 0x761, 0x40A, 0x5A8, 0x745, 0x3EF, 0x58C, 0x72A,
-        0x3D4, 0x572, 0x710, 0x3BA, 0x559, 0x6F7, 0x3A2, 0x541, 0x6E0, 0x38B,
-        0x52A, 0x6CA, 0x376, 0x515, 0x6B6, 0x361, 0x502, 0x6A3, 0x34F, 0x4F0,
-        0x690, 0x33E, 0x4DF, 0x680, 0x32E, 0x4D0, 0x671, 0x31F, 0x4C2, 0x664,
-        0x313, 0x4B5, 0x658, 0x307, 0x4A9, 0x64D, 0x2FC, 0x49F, 0x643, 0x2F2,
-        0x496, 0x639, 0x2E9, 0x48D, 0x631, 0x2E1, 0x486, 0x62A, 0x2DA, 0x47E,
-        0x623, 0x2D4, 0x479, 0x61D, 0x2CE, 0x473, 0x618, 0x2C9, 0x46F, 0x614,
-        0x2C6, 0x46B, 0x610, 0x2C2, 0x467, 0x60C, 0x2BE, 0x464, 0x60A, 0x2BC,
-        0x462, 0x608, 0x2BA, 0x45F, 0x605, 0x2B8, 0x45E, 0x604, 0x2B6, 0x45C,
-        0x603, 0x2B5, 0x45C, 0x601, 0x2B4, 0x45B, 0x601, 0x2B3, 0x45A, 0x601,
-        0x2B3, 0x459, 0x600, 0x2B2, 0x459, 0x600, 0x2B2, 0x459, 0x600, 0x2B2,
-        0x459, 0x600, 0x2B2, 0x459, 0x600, 0x2B2, 0x459, 0x600, 0x2B2, 0x459,
-        0x600, 0x2B2, 0x459, 0x600, 0x2B2, 0x459, 0x600, 0x2B2, 0x459, 0x600,
-        0x2B2, 0x459, 0x600, 0x2B2, 0x459, 0x600, 0x2B2, 0x459, 0x600, 0x2B2,
-        0x459, 0x600, 0x2B2, 0x459, 0x600, 0x2B2, 0x459, 0x600, 0x2B2, 0x459,
-        0x600, 0x2B2, 0x459, 0x600, 0x2B2, 0x459, 0x600, 0x2B2, 0x459, 0x600,
-        0x2B2, 0x459, 0x601, 0x2B3, 0x45A, 0x601, 0x2B3, 0x45A, 0x601, 0x2B3,
-        0x45A, 0x601, 0x2B3, 0x45A, 0x601, 0x2B3, 0x45A, 0x601, 0x2B3, 0x45A,
-        0x601, 0x2B3, 0x45A, 0x601, 0x2B3, 0x45A, 0x601, 0x2B3, 0x45A, 0x601,
-        0x2B3, 0x45A, 0x601, 0x2B3, 0x45A, 0x601, 0x2B3, 0x45A, 0x601, 0x2B3,
-        0x45A, 0x601, 0x2B3, 0x45A, 0x601, 0x2B3, 0x45A, 0x601, 0x2B3, 0x45A,
-        0x601, 0x2B3, 0x45A, 0x601, 0x2B3, 0x45A, 0x601, 0x2B4, 0x45B, 0x601,
-        0x2B4, 0x45C, 0x602, 0x2B5, 0x45C, 0x603, 0x2B6, 0x45D, 0x604, 0x2B7,
-        0x45E, 0x605, 0x2B9, 0x45F, 0x607, 0x2BA, 0x462, 0x609, 0x2BD, 0x463,
-        0x60C, 0x2BF, 0x467, 0x60E, 0x2C2, 0x469, 0x611, 0x2C5, 0x46D, 0x614,
-        0x2C9, 0x471, 0x619, 0x2CD, 0x476, 0x61F, 0x2D3, 0x47C, 0x625, 0x2DA,
-        0x483, 0x62D, 0x2E2, 0x48C, 0x636, 0x2EC, 0x496, 0x641, 0x2F8, 0x4A2,
-        0x64D, 0x304, 0x4B0, 0x65B, 0x313, 0x4BF, 0x66B, 0x323, 0x4D0, 0x67D,
-        0x336, 0x4E3, 0x690, 0x349, 0x4F7, 0x6A6, 0x360, 0x50E, 0x6BD, 0x378,
-        0x526, 0x6D6, 0x391, 0x540, 0x6F0, 0x3AC, 0x55B, 0x70C, 0x3C9, 0x579,
-        0x72A, 0x3E6, 0x598, 0x749, 0x406, 0x5B8, 0x769, 0x426, 0x5D8, 0x789,
-        0x447, 0x5F8, 0x7AA, 0x467, 0x618, 0x7C9, 0x486, 0x637, 0x7E7, 0x4A3,
-        0x652, 0x803, 0x4BE, 0x66D, 0x81C, 0x4D7, 0x685, 0x832, 0x4EC, 0x699,
-        0x845, 0x4FE, 0x6AA, 0x855, 0x50D, 0x6B7, 0x861, 0x517, 0x6C0, 0x869,
-        0x51D, 0x6C6, 0x86D, 0x520, 0x6C6, 0x86C, 0x51E, 0x6C3, 0x868, 0x518,
-        0x6BB, 0x85F, 0x50E, 0x6AF, 0x851, 0x4FF, 0x6A0, 0x840, 0x4EC, 0x68C,
-        0x82A, 0x4D5, 0x674, 0x812, 0x4BC, 0x659, 0x7F6, 0x49F, 0x63B, 0x7D8,
-        0x480, 0x61C, 0x7B8, 0x460, 0x5FC, 0x797, 0x43F, 0x5DA, 0x776, 0x41E,
-        0x5B9, 0x755, 0x3FD, 0x599, 0x734, 0x3DC, 0x578, 0x713, 0x3BC, 0x558,
-        0x6F4, 0x39D, 0x53A, 0x6D6, 0x37F, 0x51D, 0x6BA, 0x364, 0x502, 0x69F,
-        0x349, 0x4E8, 0x687, 0x332, 0x4D0, 0x670, 0x31B, 0x4BB, 0x65B, 0x307,
-        0x4A8, 0x648, 0x2F5, 0x496, 0x638, 0x2E6, 0x488, 0x62B, 0x2D9, 0x47C,
-        0x620, 0x2CF, 0x473, 0x616, 0x2C6, 0x469, 0x60C, 0x2BC, 0x45F, 0x603,
-        0x2B2, 0x455, 0x5F8, 0x2A6, 0x448, 0x5EA, 0x297, 0x439, 0x5D9, 0x285,
-        0x425, 0x5C5, 0x270, 0x40E, 0x5AC, 0x256, 0x3F3, 0x591, 0x239, 0x3D4,
-        0x56F, 0x216, 0x3B0, 0x54A, 0x1EF, 0x387, 0x520, 0x1C3, 0x35A, 0x4F1,
-        0x193, 0x328, 0x4BC, 0x15D, 0x2F1, 0x486, 0x129, 0x2C2, 0x45E, 0x109,
-        0x2AB, 0x451, 0x108, 0x2B7, 0x46B, 0x130, 0x2EF, 0x4B3, 0x189, 0x358,
-        0x52E, 0x215, 0x3F7, 0x5DE, 0x2D5, 0x4C8, 0x6BF, 0x3C8, 0x5CA, 0x7D0,
-        0x4E6, 0x6F5, 0x906, 0x628, 0x83F, 0xA59, 0x780, 0x99D, 0xBBA, 0x8E2,
-        0xAFC, 0xD13, 0xA2F, 0xC39, 0xE3B, 0xB3F, 0xD2E, 0xF11, 0xBF4, 0xDBF,
-        0xF7D, 0xC39, 0xDDC, 0xF72, 0xC07, 0xD83, 0xEF2, 0xB62, 0xCBA, 0xE07,
-        0xA58, 0xB95, 0xCCB, 0x907, 0xA34, 0xB5D, 0x790, 0x8B5, 0x9DA, 0x60D,
-        0x734, 0x85F, 0x499, 0x5CB, 0x701, 0x349, 0x48A, 0x5D1, 0x22B, 0x37E,
-        0x4D9, 0x147, 0x2AF, 0x41E, 0xA0, 0x21D, 0x3A1, 0x36, 0x1C5, 0x35B,
-        0x2, 0x1A3, 0x349, 0x0, 0x1AF, 0x360, 0x21, 0x1DA, 0x393, 0x5B,
-        0x218, 0x3D7, 0xA3, 0x263, 0x423, 0xEF, 0x2B0, 0x46F, 0x13B, 0x2FA,
-        0x4B8, 0x180, 0x33C, 0x4F6, 0x1BB, 0x373, 0x52A, 0x1EB, 0x39F, 0x552,
-        0x20F, 0x3C0, 0x56F, 0x22A, 0x3D8, 0x585, 0x23E, 0x3EA, 0x595, 0x24C,
-        0x3F7, 0x5A1, 0x257, 0x400, 0x5A9, 0x25E, 0x407, 0x5B0, 0x264, 0x40C,
-        0x5B4, 0x268, 0x410, 0x5B8, 0x26C, 0x414, 0x5BB, 0x270, 0x418, 0x5C0,
-        0x274, 0x41D, 0x5C6, 0x27A, 0x423, 0x5CC, 0x281, 0x42A, 0x5D3, 0x289,
-        0x433, 0x5DD, 0x293, 0x43D, 0x5E7, 0x29D, 0x448, 0x5F2, 0x2A9, 0x454,
-        0x5FE, 0x2B5, 0x460, 0x60B, 0x2C2, 0x46D, 0x618, 0x2D0, 0x47B, 0x627,
-        0x2DF, 0x48A, 0x637, 0x2EF, 0x49B, 0x647, 0x300, 0x4AD, 0x65A, 0x313,
-        0x4C0, 0x66D, 0x326, 0x4D3, 0x681, 0x33B, 0x4E9, 0x697, 0x351, 0x4FF,
-        0x6AE, 0x368, 0x517, 0x6C6, 0x380, 0x530, 0x6DE, 0x39A, 0x549, 0x6F8,
-        0x3B4, 0x564, 0x713, 0x3D0, 0x580, 0x72F, 0x3EC, 0x59C, 0x74D, 0x409,
-        0x5B9, 0x76A, 0x426, 0x5D7, 0x788, 0x445, 0x5F5, 0x7A6, 0x463, 0x614,
-        0x7C6, 0x483, 0x634, 0x7E5, 0x4A2, 0x653, 0x805, 0x4C2, 0x673, 0x824,
-        0x4E1, 0x692, 0x842, 0x4FF, 0x6B0, 0x860, 0x51D, 0x6CE, 0x87E, 0x53A,
-        0x6EA, 0x89A, 0x556, 0x706, 0x8B5, 0x571, 0x71F, 0x8CF, 0x589, 0x738,
-        0x8E7, 0x5A1, 0x74F, 0x8FD, 0x5B7, 0x764, 0x912, 0x5CB, 0x777, 0x924,
-        0x5DC, 0x788, 0x934, 0x5EB, 0x797, 0x942, 0x5F9, 0x7A3, 0x94D, 0x604,
-        0x7AD, 0x957, 0x60C, 0x7B4, 0x95D, 0x611, 0x7B9, 0x960, 0x614, 0x7BB,
-        0x962, 0x614, 0x7BA, 0x95F, 0x611, 0x7B6, 0x95A, 0x60A, 0x7AE, 0x952,
-        0x601, 0x7A3, 0x946, 0x5F4, 0x796, 0x938, 0x5E5, 0x786, 0x926, 0x5D3,
-        0x773, 0x913, 0x5BF, 0x75E, 0x8FD, 0x5A8, 0x747, 0x8E5, 0x590, 0x72E,
-        0x8CC, 0x576, 0x714, 0x8B1, 0x55B, 0x6F8, 0x895, 0x53D, 0x6DA, 0x877,
-        0x520, 0x6BC, 0x858, 0x501, 0x69D, 0x839, 0x4E1, 0x67D, 0x819, 0x4C0,
-        0x65D, 0x7F8, 0x4A0, 0x63B, 0x7D7, 0x47E, 0x61B, 0x7B6, 0x45E, 0x5F9,
-        0x795, 0x43D, 0x5D8, 0x774, 0x41B, 0x5B7, 0x753, 0x3FB, 0x596, 0x732,
-        0x3DA, 0x576, 0x712, 0x3BA, 0x557, 0x6F3, 0x39A, 0x538, 0x6D4, 0x37C,
-        0x519, 0x6B6, 0x35E, 0x4FB, 0x698, 0x341, 0x4DF, 0x67D, 0x326, 0x4C4,
-        0x661, 0x30B, 0x4A9, 0x647, 0x2F1, 0x490, 0x62E, 0x2D9, 0x477, 0x617,
-        0x2C2, 0x461, 0x601, 0x2AC, 0x44C, 0x5EB, 0x297, 0x438, 0x5D8, 0x284,
-        0x425, 0x5C6, 0x273, 0x414, 0x5B5, 0x263, 0x404, 0x5A6, 0x254, 0x3F6,
-        0x598, 0x246, 0x3E8, 0x58B, 0x23A, 0x3DC, 0x57F, 0x22E, 0x3D1, 0x574,
-        0x223, 0x3C7, 0x56A, 0x21A, 0x3BD, 0x562, 0x211, 0x3B5, 0x55A, 0x20A,
-        0x3AE, 0x553, 0x203, 0x3A7, 0x54C, 0x1FD, 0x3A2, 0x546, 0x1F7, 0x39C,
-        0x541, 0x1F2, 0x397, 0x53C, 0x1EE, 0x393, 0x538, 0x1EA, 0x390, 0x535
-    },
+#if BIOFILTERLIB_WAVEFORMS_RICE
+extern const uint32_t waveformsRiceOffset[waveformsNumSignals];
+extern const uint8_t waveformsRiceData[];
+#else
+extern const uint16_t waveformsTable[waveformsNumSignals][waveformsNumSamples];
+#endif
 
-    //ECG con ruido gausiano añadido usando np.random.randn()
-    {
-        0xBC, 0xBE, 0xC0, 0xC3, 0xC5, 0x680, 0x58A, 0x6C1, 0x81A, 0x56C,
-        0x56F, 0x838, 0x6FD, 0x51B, 0x6AB, 0x524, 0x526, 0x63E, 0x2F5, 0x342,
-        0x50D, 0x460, 0x66C, 0x491, 0x3CF, 0x83B, 0x5A8, 0x61F, 0x3DB, 0x537,
-        0x63D, 0x453, 0x6AE, 0x534, 0x5B2, 0x53E, 0x905, 0x62E, 0x49A, 0x781,
-        0x465, 0x69B, 0x34F, 0x44C, 0x6A8, 0x782, 0x6AA, 0x640, 0x5FE, 0x436,
-        0x566, 0x5D3, 0x82C, 0x71B, 0x3E9, 0x722, 0x613, 0x5A7, 0x7A8, 0x854,
-        0x834, 0x586, 0x65D, 0x760, 0x865, 0x632, 0x6AE, 0x54D, 0x532, 0x84E,
-        0x92B, 0x704, 0x8B1, 0x7BF, 0x63C, 0x7D0, 0x9A5, 0x745, 0x9C1, 0x362,
-        0x8AF, 0x798, 0x709, 0x7AA, 0x484, 0x742, 0x82C, 0x9EC, 0x6E6, 0x67D,
-        0x6FD, 0x931, 0x853, 0x70A, 0x8AB, 0x810, 0x96D, 0x6E6, 0x781, 0x76F,
-        0x5D2, 0x88B, 0x885, 0x827, 0x7D0, 0x608, 0x795, 0x7BA, 0x70C, 0x80E,
-        0x8F1, 0xB3C, 0x8A3, 0x8C9, 0x84C, 0x57F, 0x869, 0x890, 0xC42, 0x836,
-        0x8FC, 0x87D, 0x6C4, 0xA51, 0x9BC, 0x9CE, 0x737, 0xAC4, 0x67B, 0x989,
-        0xC00, 0x723, 0x7CB, 0x8D2, 0x7E6, 0x64D, 0x8C8, 0x70E, 0x968, 0x746,
-        0xB0D, 0x77A, 0x82E, 0x9EA, 0x6C8, 0x902, 0xAA7, 0x62E, 0x8EA, 0x905,
-        0x9CE, 0x6B4, 0x690, 0x95E, 0x902, 0x8EB, 0x90C, 0x775, 0x8D6, 0x8E9,
-        0x758, 0xB46, 0x91E, 0x68C, 0x95A, 0x6D5, 0x981, 0xA0B, 0x6FD, 0x9B1,
-        0x8D3, 0x96C, 0xB0A, 0x7BB, 0x6EC, 0x6AF, 0x6C4, 0x7DE, 0x87B, 0x859,
-        0x929, 0x7E2, 0xA0F, 0x765, 0xBEE, 0x8B1, 0x664, 0x608, 0x860, 0x743,
-        0x8AA, 0x844, 0x765, 0x62D, 0x51F, 0x6BA, 0x8B0, 0x7AB, 0x567, 0x78B,
-        0x7D5, 0x5DC, 0x76A, 0x73C, 0x55E, 0x7A2, 0x7E9, 0x8AD, 0x89A, 0x4DA,
-        0x57E, 0x7B0, 0x7A7, 0x7A0, 0xCB5, 0x7A7, 0x87D, 0x82E, 0x7B0, 0x62E,
-        0x7CC, 0x56D, 0x638, 0x5CF, 0x6A7, 0xA0B, 0x39E, 0x780, 0x3F5, 0x5AE,
-        0x80B, 0x674, 0x4AE, 0x536, 0x753, 0x525, 0x692, 0x64A, 0x534, 0x976,
-        0x721, 0x30A, 0x668, 0x517, 0x763, 0x4DA, 0x5DF, 0x6CE, 0x757, 0x42A,
-        0x578, 0x53E, 0x4F5, 0x8A5, 0x68C, 0x3FC, 0x74E, 0x923, 0x775, 0x389,
-        0x51D, 0x7C8, 0x4BF, 0x680, 0x6FF, 0x462, 0x5B4, 0xD2, 0x435, 0x562,
-        0x3D9, 0x840, 0x38E, 0x511, 0x5EE, 0x7EF, 0x385, 0x77F, 0x5B9, 0x433,
-        0x667, 0x5FF, 0x4C5, 0x5CA, 0x517, 0x5DA, 0x6AF, 0x819, 0x3C5, 0x8ED,
-        0x2AC, 0x56D, 0x68E, 0x615, 0x4B2, 0x554, 0x4E4, 0x4BD, 0x6F1, 0x62F,
-        0x493, 0x703, 0x61B, 0x6E1, 0x698, 0x45D, 0x4C6, 0x6C6, 0x690, 0x599,
-        0x5CF, 0x796, 0x4B9, 0x677, 0x552, 0x54C, 0x750, 0x6E4, 0x6E0, 0x7A1,
-        0x5A9, 0x6AC, 0x528, 0x621, 0x56F, 0x5C8, 0x68B, 0x462, 0x8D6, 0x418,
-        0x3C7, 0x769, 0x6D9, 0x698, 0x69A, 0x59F, 0x445, 0x5C2, 0x49B, 0x723,
-        0x56C, 0x462, 0x528, 0x648, 0x4C9, 0x464, 0x606, 0x607, 0x4E1, 0x4EF,
-        0x603, 0x371, 0x382, 0x490, 0x556, 0x624, 0x7ED, 0x6FB, 0x56D, 0x5A4,
-        0x423, 0x5A5, 0x53C, 0x62C, 0x46A, 0x67A, 0x807, 0x584, 0x64D, 0x6BE,
-        0x513, 0x609, 0x5B7, 0x5D8, 0x483, 0x5BC, 0x676, 0x7EC, 0x72C, 0x901,
-        0x488, 0x70B, 0x5FE, 0x910, 0x47A, 0x46E, 0x4CC, 0x278, 0x4EB, 0x490,
-        0x5F4, 0x640, 0x89A, 0x72F, 0x4D9, 0x45C, 0x67D, 0x3B7, 0x88B, 0x78B,
-        0x506, 0x31F, 0x7D1, 0x592, 0x7A5, 0x34F, 0x4D5, 0x5C3, 0x5D3, 0x511,
-        0x6B6, 0x420, 0x58B, 0x5F3, 0x68D, 0x6DB, 0x40C, 0x36B, 0x7BA, 0x648,
-        0x4A1, 0x827, 0x5F5, 0x795, 0x5E2, 0x8F0, 0x879, 0x568, 0x747, 0x6C7,
-        0x7E3, 0x452, 0x6D9, 0x76B, 0x31C, 0x3FE, 0x2AF, 0x565, 0x6E9, 0x81D,
-        0x5EE, 0x850, 0x3B5, 0x337, 0x5BE, 0x66B, 0x5C8, 0x2AB, 0x5B3, 0x3D8,
-        0x6DE, 0x668, 0x469, 0x511, 0x43C, 0x5C4, 0x753, 0x45C, 0x6A5, 0x510,
-        0x4AB, 0x5B9, 0x44E, 0x50C, 0x411, 0x8E9, 0x5F6, 0x4D7, 0x63F, 0x5C1,
-        0x598, 0x6E0, 0x71A, 0x523, 0x513, 0x58B, 0x272, 0x3A9, 0x815, 0x884,
-        0x5A0, 0x6E6, 0x681, 0xAC1, 0x7C4, 0x5DE, 0x49D, 0x3A1, 0x66B, 0x4F6,
-        0x3F5, 0x529, 0x483, 0x8C4, 0x78D, 0x636, 0x881, 0x661, 0x4F7, 0x8A2,
-        0x726, 0x4C2, 0x614, 0x50E, 0x44D, 0x7DD, 0x964, 0x45B, 0x762, 0x58D,
-        0x5D5, 0x5B3, 0x54F, 0x6BD, 0x56C, 0x723, 0x6AE, 0x66B, 0x56E, 0x5F7,
-        0x809, 0x7AE, 0x573, 0x721, 0x829, 0x47D, 0x7E9, 0x618, 0x805, 0x602,
-        0x472, 0x4C1, 0x75A, 0x7B5, 0x5F5, 0x85A, 0x4DC, 0x756, 0x59D, 0x67F,
-        0x798, 0x63C, 0x6FD, 0x925, 0x6BF, 0x8EF, 0x5F3, 0x882, 0x9ED, 0x3F4,
-        0x68A, 0x8A8, 0x77A, 0x85F, 0x6E4, 0x7F5, 0x799, 0x9A1, 0x83D, 0x85F,
-        0x73B, 0x71E, 0x733, 0x877, 0x736, 0x84C, 0xB07, 0x92D, 0x755, 0x9AA,
-        0x730, 0x4AE, 0x63E, 0x4E8, 0x737, 0x7C3, 0xA48, 0x832, 0x756, 0x8EB,
-        0x43D, 0x7F6, 0x8C1, 0x549, 0x945, 0x802, 0x6D3, 0x866, 0xAE0, 0x7A6,
-        0x7B7, 0x69A, 0x5F8, 0x882, 0x5E5, 0x748, 0x668, 0x7D6, 0x795, 0x8A0,
-        0x639, 0x68F, 0x571, 0x63A, 0x774, 0x800, 0x566, 0x81D, 0x8D3, 0x75A,
-        0x990, 0x57A, 0x4BA, 0x3E1, 0x8DE, 0x78D, 0x670, 0x6ED, 0x4C0, 0xA31,
-        0x69F, 0x692, 0x77D, 0x718, 0x6AF, 0x51C, 0x705, 0x92A, 0x853, 0x8B0,
-        0x572, 0x4B3, 0x602, 0x646, 0x7D9, 0x392, 0x87E, 0x5E5, 0x579, 0x491,
-        0x393, 0x75C, 0x634, 0x41B, 0x417, 0x58D, 0x89D, 0x5A6, 0x3BD, 0x5A8,
-        0x59B, 0x1E3, 0x5EC, 0x5A4, 0x70D, 0x8CE, 0x7B0, 0x58A, 0x43E, 0x9DD,
-        0x600, 0x5E9, 0x5D5, 0x627, 0x59B, 0x4ED, 0x4F2, 0x5B4, 0x4E4, 0x49A,
-        0x5D2, 0x53A, 0x7E2, 0x17A, 0x729, 0x759, 0x235, 0x4CC, 0x4B1, 0x30B,
-        0x3F2, 0x360, 0x7B3, 0x666, 0x6DE, 0x5FC, 0x31F, 0x407, 0x591, 0x2F3,
-        0x5EC, 0x47D, 0x452, 0x609, 0x5B1, 0x48B, 0x6F8, 0x3A6, 0x661, 0x67D,
-        0x544, 0x66B, 0x433, 0x7BD, 0x645, 0x5FF, 0x8A9, 0x641, 0x577, 0x58B,
-        0x92C, 0x69E, 0xB9C, 0x618, 0xC3F, 0xA5A, 0xA43, 0x9F6, 0xBC8, 0xB7C,
-        0xD95, 0xC67, 0xCC5, 0xC44, 0xCFE, 0xDC7, 0xAE0, 0xB96, 0xEE7, 0xE1B,
-        0xD99, 0xDE7, 0xE5D, 0xCEC, 0xC6E, 0xDC2, 0xBC2, 0xDA5, 0xA23, 0xE04,
-        0xCD5, 0xC26, 0xCE4, 0xD8D, 0xC29, 0x763, 0x7D8, 0x871, 0x90A, 0x966,
-        0x71C, 0x822, 0x654, 0x634, 0x4A7, 0x515, 0x422, 0x46F, 0x74A, 0x3FE,
-        0x943, 0x5CC, 0x52A, 0x36E, 0x5B4, 0x3A9, 0x4A7, 0x856, 0x43C, 0x61F,
-        0x347, 0x44F, 0x717, 0x373, 0x738, 0x593, 0x3AF, 0x593, 0x628, 0x5B0,
-        0x267, 0x3C4, 0x493, 0x4EB, 0x60E, 0x574, 0x336, 0x5E9, 0x655, 0x652,
-        0x72F, 0x6DE, 0x65B, 0x599, 0x337, 0x677, 0x62B, 0x64E, 0x3F9, 0x44E,
-        0x79A, 0x5F4, 0x715, 0x61A, 0x61F, 0x788, 0x552, 0x646, 0x56F, 0x57D,
-        0x5B2, 0x684, 0x575, 0x81F, 0x4D7, 0x5EE, 0x58E, 0x873, 0x68C, 0x7D5,
-        0x3FC, 0x6AD, 0x7A2, 0x668, 0x7EB, 0x581, 0x875, 0x9D4, 0x5C2, 0x5A4,
-        0x88D, 0x8C1, 0x58B, 0x5B5, 0x5ED, 0x44F, 0x4F8, 0x4D9, 0x538, 0x65A,
-        0x6C6, 0x8CC, 0x4E8, 0x7F4, 0x621, 0x665, 0x784, 0x4C7, 0x718, 0x6C7,
-        0x74A, 0x6FE, 0xA53, 0x59B, 0x5C9, 0x5A9, 0x5C8, 0x5AD, 0x87D, 0x8DC,
-        0x5D5, 0x573, 0x777, 0x5EB, 0x7C0, 0x71D, 0x481, 0x936, 0x99D, 0x5F3,
-        0x651, 0x75F, 0x777, 0x7FC, 0xA14, 0x6C2, 0x5D4, 0x4F6, 0x5FC, 0x713,
-        0x9E6, 0x663, 0x78D, 0x735, 0x915, 0xB28, 0x682, 0x699, 0x8F9, 0x873,
-        0xA43, 0x85C, 0x6F2, 0x86E, 0x941, 0x8D8, 0x866, 0x948, 0x979, 0x9D5,
-        0x8BE, 0x786, 0x809, 0x9B1, 0x6A0, 0x87A, 0x758, 0x805, 0x9F8, 0x856,
-        0x826, 0x608, 0x949, 0x92A, 0xB86, 0x7C6, 0x89C, 0x8B1, 0xAC2, 0x83B,
-        0x8D6, 0x95F, 0x8C2, 0x7D2, 0x8D5, 0xA35, 0x707, 0x8D5, 0x796, 0xA84,
-        0x662, 0x7E3, 0x959, 0xB33, 0x8BA, 0x801, 0xBC3, 0x6B1, 0x591, 0x9A1,
-        0x836, 0x771, 0xA1C, 0x96C, 0x834, 0x721, 0xA72, 0xA1F, 0x8FE, 0xBFD,
-        0x78A, 0x6DB, 0x826, 0x927, 0x99B, 0x8E0, 0x9CB, 0x759, 0xB7C, 0x928,
-        0xB00, 0x9D2, 0x9FF, 0xA2D, 0x9FE, 0xA4B, 0xB58, 0x99C, 0xA65, 0x92B,
-        0xB82, 0x843, 0xC0D, 0x93A, 0x717, 0x978, 0x839, 0xA8B, 0x83E, 0x88D,
-        0x654, 0x883, 0x57B, 0x6C0, 0xA53, 0xA59, 0x9C7, 0x7A1, 0x904, 0x910,
-        0x746, 0xB53, 0xA58, 0x8A4, 0x8FF, 0x940, 0x5C7, 0x880, 0x7CF, 0x74B,
-        0x85E, 0xB85, 0x9B9, 0x7D6, 0x98F, 0xACB, 0xA0A, 0x8AE, 0x791, 0x999,
-        0x919, 0x9D5, 0x967, 0xA01, 0x78B, 0xA58, 0x899, 0xB70, 0x72C, 0xADA,
-        0x876, 0x721, 0x75A, 0x791, 0x8AC, 0x8CA, 0x713, 0x7E2, 0xB2A, 0xA7F,
-        0x87C, 0x7D8, 0x7EF, 0x8A8, 0x61F, 0x742, 0x510, 0x832, 0x88B, 0x6C9,
-        0x9E6, 0x595, 0x530, 0x7BE, 0x8F8, 0x9EA, 0x69B, 0x8EE, 0x731, 0x6F5,
-        0x88B, 0x82A, 0x4B9, 0x95F, 0x932, 0x619, 0x7A3, 0x7C3, 0x762, 0x61D,
-        0x5E7, 0x6DF, 0x8AF, 0x7B2, 0x646, 0x800, 0x270, 0x889, 0x418, 0x62F,
-        0x501, 0x4B8, 0x875, 0x5F2, 0x72D, 0x68E, 0x758, 0x6B7, 0x49E, 0x817,
-        0x5CC, 0x427, 0x5DE, 0x8CE, 0x7CC, 0x5F3, 0x5F0, 0x5F7, 0x9A0, 0x705,
-        0x715, 0x7FE, 0x6C5, 0x5FF, 0x615, 0x644, 0x64F, 0x779, 0x66E, 0x777,
-        0x636, 0x672, 0x343, 0x7B8, 0x6D6, 0x7D4, 0x1DC, 0x97D, 0x612, 0x7F9,
-        0x4AE, 0x734, 0x4A7, 0x54E, 0x92F, 0x5F6, 0x694, 0x794, 0x700, 0x678,
-        0x6CB, 0x9E9, 0x624, 0x688, 0x7D5, 0x7E9, 0x809, 0x732, 0x477, 0x8B6,
-        0x474, 0x6AC, 0x50D, 0x61C, 0x6B5, 0x6B2, 0x6D9, 0x8AC, 0x6E5, 0x5D4,
-        0x7AD, 0x805, 0x452, 0x71D, 0x746, 0x5BE, 0x84E, 0x5F8, 0x664, 0x5EF,
-        0x639, 0x485, 0x3FF, 0x8A4, 0x4E7, 0x4AF, 0x2E7, 0x539, 0x42D, 0x8B7,
-        0x7BF, 0x526, 0x9A6, 0x7B5, 0x5B5, 0x261, 0x9B7, 0x414, 0x3B0, 0x7C6,
-        0x9F2, 0x854, 0x713, 0x71F, 0x785, 0x760, 0x6A5, 0x660, 0x61F, 0x510,
-        0x5CA, 0x3A1, 0x612, 0x4B5, 0x488, 0x67F, 0x85B, 0x7A1, 0x3D3, 0x4B6,
-        0x7AB, 0x4BA, 0x5E3, 0x713, 0x4C1, 0x665, 0x432, 0x551, 0x6BA, 0x3CD,
-        0x6EA, 0x636, 0x716, 0x696, 0x855, 0x670, 0x597, 0x670, 0x715, 0x654,
-        0x650, 0x52E, 0x53D, 0x41C, 0x8EF, 0x45B, 0x533, 0x529, 0x7A2, 0x5D0,
-        0x82D, 0x53C, 0x6B2, 0x4FE, 0x98E, 0x474, 0x6BF, 0x73E, 0x6E8, 0x5FE,
-        0x614, 0x658, 0x60E, 0x7C1, 0x9AA, 0x56E, 0x430, 0x626, 0xA3C, 0x50E,
-        0x8CC, 0x8DC, 0x572, 0x72A, 0x8CA, 0x5B7, 0x5FC, 0x568, 0x4BF, 0x54E,
-        0x46E, 0x65B, 0x520, 0x6AA, 0x3ED, 0x6D1, 0x796, 0x342, 0x6E2, 0x832,
-        0x477, 0x8E1, 0x6F6, 0x53E, 0x63C, 0x72E, 0x671, 0x727, 0x4EB, 0x697,
-        0x42B, 0x62B, 0x4F4, 0x537, 0x83C, 0x804, 0x747, 0x4AD, 0x5DE, 0x836,
-        0x693, 0x9E9, 0x6F7, 0x6A8, 0x5E5, 0x693, 0x624, 0x777, 0x7D9, 0x52F,
-        0x45A, 0x396, 0x72E, 0x4B8, 0x31E, 0x703, 0xA3E, 0x66B, 0x7B8, 0x692,
-        0x64D, 0x7DE, 0x606, 0x6E3, 0x6FA, 0x579, 0x806, 0x63F, 0x55E, 0x75B,
-        0x52C, 0x69B, 0x68F, 0x840, 0x754, 0x694, 0x7E2, 0x8C6, 0x784, 0x6B2,
-        0x4B0, 0x516, 0x644, 0x5D2, 0x67D, 0x6E1, 0x7A0, 0x6BA, 0x79A, 0x6FB,
-        0x3E1, 0x57E, 0x6BC, 0x521, 0x7ED, 0x961, 0x8EE, 0x6C4, 0x968, 0x762,
-        0x6AC, 0x647, 0x6C9, 0x6B0, 0x793, 0x798, 0x763, 0x816, 0x945, 0x8F0,
-        0x53E, 0x3A4, 0x903, 0x586, 0x74E, 0x5E4, 0x4F5, 0x894, 0x8F1, 0x6EE,
-        0x3E0, 0x709, 0x880, 0x5AB, 0x83E, 0x7F7, 0x8E7, 0x839, 0x694, 0x9EC,
-        0x7E0, 0x819, 0x6BB, 0x781, 0x6D9, 0x7F4, 0xADB, 0x627, 0x5CC, 0xA88,
-        0x7F9, 0x747, 0x9E8, 0x765, 0xB20, 0x95F, 0x797, 0xBA4, 0x769, 0x979,
-        0x8CB, 0xA53, 0xAB7, 0x85D, 0x727, 0x900, 0x73E, 0xB59, 0x875, 0x7AC,
-        0x87E, 0x621, 0x6AE, 0x9FB, 0x71D, 0x67E, 0x8E3, 0x9DB, 0x91D, 0x982,
-        0x6CB, 0x5BF, 0xA30, 0x75D, 0x771, 0x9D3, 0x89C, 0x86D, 0xB02, 0x6AD,
-        0x90C, 0x7AE, 0x7F8, 0x9DD, 0x845, 0x848, 0x911, 0x6D4, 0x612, 0x5B9,
-        0x448, 0xA68, 0x58A, 0x6DB, 0x6BE, 0x79A, 0x85A, 0x864, 0x627, 0x6C2,
-        0x76B, 0x694, 0x965, 0x7A9, 0x801, 0x7DF, 0x8A0, 0x716, 0x4CD, 0x760,
-        0x5BE, 0x5E9, 0x799, 0x894, 0x6B1, 0x71E, 0x93B, 0x6FA, 0xA93, 0x771,
-        0x3DE, 0x7B3, 0x71E, 0x87F, 0x78A, 0x649, 0x49E, 0x629, 0x52D, 0x594,
-        0x75D, 0x903, 0x70E, 0x49C, 0x71D, 0x841, 0x57B, 0x633, 0x66A, 0x52D,
-        0x75B, 0x629, 0x6F9, 0x4F3, 0x59E, 0x75F, 0x5AB, 0x8DB, 0x592, 0x67F,
-        0x78C, 0x3EA, 0x35A, 0x3AD, 0x7E7, 0x515, 0x9CD, 0x4FA, 0x614, 0x81C,
-        0x8C6, 0x8CF, 0x774, 0x71F, 0x66A, 0x6A6, 0x490, 0x41A, 0x54B, 0x4FC,
-        0x480, 0x637, 0x693, 0x538, 0x754, 0x351, 0x4C7, 0x401, 0x24A, 0x515,
-        0x51A, 0x7B5, 0x67A, 0x415, 0x8A7, 0x7DD, 0x717, 0x613, 0x532, 0x65B,
-        0x8DE, 0xA62, 0xA2C, 0x763, 0x6C2, 0x90A, 0x67A, 0xA0B, 0x9B1, 0x994,
-        0x839, 0xBD3, 0xA96, 0x9F8, 0x7B5, 0xC64, 0xF75, 0xF94, 0xC98, 0xC9A,
-        0xE70, 0xC59, 0xE75, 0xF40, 0xFFF, 0xDF7, 0xDC3, 0xCA7, 0xC9C, 0xD5E,
-        0xE14, 0xEAF, 0xBCA, 0xF02, 0xBFC, 0xC04, 0xA89, 0x795, 0xC3F, 0xB9D,
-        0x9A5, 0x9C5, 0xA0F, 0x67B, 0x7AD, 0x954, 0x5D4, 0x7DA, 0x4FE, 0x778,
-        0x667, 0x3B5, 0x7B5, 0x490, 0x43B, 0x596, 0x6DD, 0x367, 0x4EC, 0x560,
-        0x5B1, 0x4D5, 0x3F3, 0x336, 0x497, 0x2D1, 0x0, 0x52A, 0x5EB, 0xF8,
-        0x319, 0x5A8, 0x7EE, 0x4E3, 0x3D2, 0x4BD, 0x735, 0x433, 0x40D, 0x49E,
-        0x3FA, 0x5B4, 0x815, 0x629, 0x55A, 0x55B, 0x378, 0x746, 0x5DB, 0x5BF,
-        0xAF4, 0x690, 0x4FE, 0x586, 0x7F6, 0x668, 0x40D, 0x7AF, 0x546, 0x92F,
-        0x7FC, 0x5A9, 0x852, 0x679, 0x7B0, 0x722, 0x51A, 0x56C, 0x7FE, 0x5E8,
-        0x5CF, 0x4F8, 0x716, 0x99A, 0x4D1, 0x67E, 0x8A0, 0x658, 0x72B, 0x4DA,
-        0x724, 0x635, 0x803, 0x854, 0xA7B, 0x769, 0x708, 0x6D7, 0x603, 0x714,
-        0x61E, 0x6D7, 0x89C, 0x50F, 0x85B, 0x8A4, 0x674, 0x366, 0x5BA, 0x8A7,
-        0x6A5, 0x52A, 0x5EF, 0x802, 0x792, 0x662, 0x634, 0x62D, 0x561, 0x948,
-        0x654, 0x8B3, 0x92F, 0x867, 0x63B, 0x787, 0x6E3, 0x590, 0x775, 0x52D,
-        0x8D2, 0x650, 0x75A, 0x780, 0x6B0, 0x801, 0x667, 0x87C, 0x51D, 0x764,
-        0xA31, 0x5B6, 0x63B, 0x815, 0x798, 0x7E2, 0x81F, 0x85F, 0x920, 0x815,
-        0x71C, 0x88A, 0xA72, 0x75D, 0x61B, 0x953, 0x77A, 0x45D, 0x905, 0x6EF,
-        0x7A5, 0x853, 0x824, 0x8F8, 0x73F, 0x8BB, 0x796, 0x925, 0x8FD, 0x6A6,
-        0x9C7, 0x753, 0x96A, 0x8C6, 0xB0F, 0x7F0, 0x7C7, 0x850, 0x7E9, 0x9A2,
-        0x5F7, 0x6DB, 0x6DE, 0x9FD, 0xB2F, 0x86F, 0x85E, 0x8C3, 0xA77, 0x74B,
-        0x91B, 0xA44, 0x991, 0x91E, 0xA63, 0x4BE, 0x9F2, 0x7EE, 0x627, 0x9C3,
-        0xB1C, 0x8D1, 0xA82, 0xB8B, 0xB1C, 0xBA0, 0xA46, 0x945, 0x6B8, 0x8D1,
-        0x7EB, 0xC8C, 0x8F9, 0x972, 0xA1E, 0x95A, 0xBE4, 0x85B, 0x99F, 0x832,
-        0x752, 0x86A, 0x94D, 0x8B5, 0x850, 0x739, 0x941, 0x715, 0xA8D, 0x984,
-        0x729, 0x8EB, 0x83C, 0x9E0, 0xB6F, 0x682, 0x98C, 0x91F, 0xA63, 0x9AE,
-        0x831, 0x8D8, 0x81B, 0xAF5, 0x954, 0xC31, 0x92D, 0x82A, 0x6EA, 0x674,
-        0x6C5, 0x996, 0x9EF, 0x6B6, 0xA7A, 0x859, 0x949, 0xB81, 0xA62, 0x893,
-        0x797, 0x5A2, 0x7CC, 0x88C, 0x755, 0x89C, 0x8E6, 0x868, 0x7B9, 0x8F2,
-        0x955, 0x6F4, 0xAC0, 0x867, 0x88D, 0x992, 0x8D0, 0x9E1, 0x8D3, 0x76A,
-        0x8DE, 0x688, 0x869, 0x829, 0x7DB, 0x7F2, 0x539, 0x73B, 0x82D, 0x83E,
-        0x664, 0x9DE, 0x691, 0x957, 0x87A, 0x6CC, 0xA78, 0x5E4, 0x918, 0x92F,
-        0x697, 0x9B7, 0x72A, 0x7F5, 0x7E2, 0x73F, 0x8A8, 0x89A, 0x4AD, 0x951,
-        0x4BE, 0x8D7, 0x8F4, 0x587, 0x68A, 0x572, 0x6C8, 0x69C, 0x83F, 0x908,
-        0x922, 0x61C, 0x69F, 0x457, 0x5A9, 0x858, 0x950, 0x4EE, 0x5E3, 0x6BB,
-        0x72D, 0x57C, 0x75A, 0x5F5, 0x6A3, 0x779, 0x6A1, 0x5EF, 0x66A, 0x66E,
-        0x5FA, 0x621, 0x8F5, 0x75A, 0x607, 0x787, 0x5EF, 0x83A, 0x6FC, 0x63D,
-        0x714, 0x3F9, 0x4A4, 0x487, 0x68F, 0x8FC, 0x9BC, 0x749, 0x711, 0x388,
-        0x573, 0x510, 0x550, 0x5FF, 0x586, 0x335, 0x760, 0x494, 0x695, 0x962,
-        0x4CB, 0x252, 0x5C0, 0x7DE, 0x92D, 0x44A, 0x6ED, 0x573, 0x5FF, 0xA33,
-        0x3D9, 0x688, 0x6DB, 0x7CD, 0x649, 0x69A, 0x587, 0x689, 0x599, 0x712,
-        0x58D, 0x6B1, 0x611, 0x7D5, 0x607, 0x365, 0x809, 0x4B7, 0x51A, 0x530,
-        0x834, 0x2D4, 0xAE7, 0x7B6, 0x670, 0x603, 0x688, 0x6E4, 0x715, 0x6F1,
-        0x63B, 0x5CA, 0x5DC, 0x5CB, 0x7D3, 0x700, 0x197, 0x718, 0x663, 0x610,
-        0x57F, 0x7D0, 0x78A, 0x4E8, 0x6B7, 0x49A, 0x3FA, 0x521, 0x769, 0x78D,
-        0x6E0, 0x733, 0x6E1, 0x51C, 0x6C0, 0x751, 0x73F, 0x7E9, 0x72D, 0x6A1,
-        0x7BA, 0x60D, 0x4BD, 0x5D7, 0x4F3, 0x50E, 0x5DE, 0x4E0, 0x59E, 0x331,
-        0x66B, 0x617, 0x4D7, 0x719, 0x786, 0x3A1, 0x4EC, 0x4EA, 0x4A7, 0x75C,
-        0x5CB, 0x5AF, 0x306, 0x710, 0x431, 0x62F, 0x684, 0x82C, 0x416, 0x178,
-        0x65F, 0x8D9, 0x7FD, 0x66A, 0x557, 0x754, 0x49A, 0x6D2, 0x6DE, 0x7B7,
-        0xA51, 0x6B1, 0x550, 0x60E, 0x362, 0x507, 0x577, 0x54A, 0x653, 0x4D5,
-        0x7CF, 0x618, 0x614, 0x597, 0x654, 0x75B, 0x4C4, 0x516, 0x5A1, 0x408,
-        0x4D7, 0x55D, 0x76E, 0x67F, 0x664, 0x765, 0x5E2, 0x6B1, 0x5EF, 0x680,
-        0x533, 0x25C, 0x5E3, 0x845, 0x783, 0x792, 0x7FC, 0x63A, 0x665, 0x526,
-        0x59C, 0x709, 0x7EF, 0x5E1, 0x567, 0x618, 0x704, 0x3E2, 0x294, 0x541,
-        0x43A, 0x552, 0x5DF, 0x567, 0x853, 0x69A, 0x68F, 0x70E, 0x45C, 0x7B2,
-        0x5FD, 0x722, 0x478, 0x3BB, 0x75D, 0x6B1, 0x4BD, 0x4CA, 0x7D8, 0x44D,
-        0x8A4, 0x4C0, 0x71C, 0x5A2, 0x710, 0x54F, 0x5E5, 0x636, 0x49E, 0x74A,
-        0x560, 0x5D1, 0x4A6, 0x240, 0x5E3, 0x9E1, 0x765, 0x62C, 0x5CE, 0x640,
-        0x70F, 0x46D, 0x7F2, 0x758, 0x75C, 0x6F1, 0x650, 0x753, 0x736, 0x5C7,
-        0x574, 0x681, 0x8BC, 0x47B, 0x426, 0x6A9, 0x681, 0x6B6, 0x6D6, 0x624,
-        0x8C8, 0x412, 0x546, 0x668, 0x412, 0x657, 0x92D, 0x6B1, 0x709, 0x4C7,
-        0x5CA, 0x630, 0x64D, 0x8C7, 0x7B2, 0x52C, 0x747, 0x7B1, 0x8B5, 0x969,
-        0x578, 0x5D0, 0x52A, 0x6C3, 0x7DE, 0x8B3, 0x71B, 0x6C4, 0x786, 0x60C,
-        0xA8F, 0x4EE, 0x7B5, 0xA8E, 0x780, 0x73B, 0x702, 0x750, 0x9B8, 0x443,
-        0xA06, 0x586, 0x753, 0x71A, 0x8B0, 0x55D, 0x88A, 0xAF4, 0x5CA, 0x830,
-        0x6E7, 0x895, 0x7FA, 0x6FB, 0x8BA, 0xAC1, 0x7B6, 0x91D, 0x60A, 0x690,
-        0x8C1, 0xA4F, 0x895, 0x78F, 0x80A, 0x61F, 0x8F6, 0x961, 0x754, 0x74B,
-        0x869, 0x753, 0x7E1, 0xB2E, 0x793, 0x763, 0x6ED, 0x909, 0x799, 0x6DC,
-        0x9DA, 0x9FA, 0x6DC, 0x4E5, 0x944, 0x6A6, 0x8E0, 0x49E, 0x8F8, 0x5B7,
-        0x8A8, 0x787, 0x603, 0x6D1, 0x874, 0x788, 0x83A, 0xA53, 0x4DE, 0x9B4,
-        0x75B, 0x5C9, 0x517, 0x6CD, 0x878, 0x6D4, 0x94E, 0x4BC, 0x6E7, 0x4F9,
-        0x76A, 0x82F, 0x627, 0x2C7, 0x70A, 0x75F, 0x74B, 0x88A, 0x4FB, 0x7A2,
-        0x864, 0x3D1, 0x701, 0x5B8, 0x657, 0x6F9, 0x5AC, 0x55D, 0x66E, 0x4B1,
-        0x4AD, 0x75B, 0x48A, 0x74D, 0x6FA, 0x39C, 0x533, 0x80D, 0x4B6, 0x57D,
-        0x6E6, 0x761, 0x5C9, 0x53F, 0x854, 0x8CD, 0x7A1, 0x640, 0x4DF, 0x4D4,
-        0x6E3, 0x6B8, 0x836, 0x70C, 0x3BC, 0x7A1, 0x47A, 0x566, 0x65A, 0x901,
-        0xAB0, 0x6D6, 0x59A, 0x6AD, 0x730, 0x54F, 0x885, 0x618, 0x678, 0x6B1,
-        0x648, 0x6E2, 0x49D, 0x4AA, 0x3CB, 0x61B, 0x694, 0x60A, 0x7DA, 0x53B,
-        0x636, 0x376, 0x47C, 0x615, 0x643, 0x475, 0x4BF, 0x27D, 0x43B, 0x61E,
-        0x59F, 0x581, 0x4D4, 0x4CA, 0x3CF, 0x5F3, 0x599, 0x5CD, 0x45A, 0x1FD,
-        0x71D, 0x4DD, 0x476, 0x70B, 0x599, 0x80F, 0x7A3, 0x802, 0x528, 0x967,
-        0x842, 0x79E, 0x8BD, 0x626, 0x9D9, 0x801, 0x7E1, 0x7FC, 0xC64, 0xA18,
-        0xDC4, 0xAF3, 0x97D, 0xAB4, 0xE97, 0xCB8, 0xC57, 0xD9D, 0xE4A, 0xF59,
-        0xFED, 0xD30, 0xBB3, 0xD0B, 0xDFB, 0xBF9, 0xBCF, 0xD97, 0xCBE, 0xC96,
-        0xB12, 0xB8C, 0xA21, 0xC8A, 0xC60, 0x792, 0x893, 0x74C, 0x830, 0x8A7,
-        0x62A, 0x695, 0x614, 0x791, 0x701, 0x575, 0x683, 0x51B, 0x53F, 0x7F7,
-        0x738, 0x2F5, 0x606, 0x5D2, 0x2AB, 0x58D, 0x68A, 0x260, 0x29D, 0x586,
-        0x459, 0x4C2, 0x46F, 0x486, 0x1EB, 0x596, 0x5D2, 0x3BB, 0x414, 0x1DE,
-        0x511, 0x53B, 0x457, 0x63C, 0x415, 0x58A, 0x332, 0x4CC, 0x4A5, 0x555,
-        0x47F, 0x4ED, 0x676, 0x497, 0x2DB, 0x80C, 0x789, 0x37C, 0x690, 0x4C6,
-        0x5FB, 0x60F, 0x547, 0x476, 0x4A0, 0x44D, 0x473, 0x5A3, 0x4A9, 0x6D0,
-        0x80F, 0x4E8, 0x62B, 0x693, 0x68A, 0x5F1, 0x6F8, 0x694, 0x3F3, 0x72E,
-        0x736, 0x4B0, 0x5EB, 0x6E9, 0x58C, 0x784, 0x97F, 0x4AD, 0x3C5, 0x65B,
-        0x700, 0x58C, 0x822, 0x3DD, 0x6FB, 0x500, 0x891, 0x8FE, 0x4C7, 0x51E,
-        0x749, 0x563, 0x5EC, 0x60A, 0x313, 0x600, 0x4FB, 0x54B, 0x845, 0x426,
-        0x754, 0x5AC, 0x5AF, 0x756, 0x6A8, 0x707, 0x7A6, 0x5AD, 0x543, 0x48D,
-        0x4F7, 0xAC2, 0x82B, 0x436, 0x446, 0x70D, 0x72C, 0x731, 0x5FB, 0x633,
-        0x6EA, 0x690, 0x30E, 0x61F, 0x531, 0x6C9, 0xB1C, 0x720, 0x61B, 0x806,
-        0x760, 0x74E, 0x79D, 0x9DC, 0x501, 0x77D, 0x55F, 0x7AA, 0x570, 0x63B,
-        0x672, 0x86C, 0x85C, 0x514, 0x719, 0x5F5, 0x525, 0x6C6, 0x6A9, 0xAE1,
-        0x7DB, 0x51E, 0x664, 0x8DA, 0xA85, 0x4ED, 0x481, 0xA48, 0x80B, 0x627,
-        0x856, 0x383, 0x796, 0x81D, 0x90F, 0x620, 0x7D8, 0x654, 0x82B, 0x670,
-        0x738, 0x65A, 0x8E7, 0x940, 0x79C, 0x80F, 0x5D0, 0x79A, 0x804, 0xC22,
-        0x673, 0xA6C, 0x9BC, 0x8AB, 0xAF5, 0x8DD, 0x8EA, 0x844, 0xA3E, 0xA13,
-        0x776, 0x66D, 0x828, 0x744, 0x86A, 0xA6D, 0x7DB, 0x882, 0x8AE, 0x9E9,
-        0x531, 0x7B8, 0x8FC, 0xA84, 0x7F0, 0x5D6, 0x9AB, 0x7C2, 0x6EC, 0x7CC,
-        0x87B, 0x7D9, 0x567, 0xA28, 0xABE, 0x9CB, 0x70F, 0x87E, 0x8CB, 0x9B9,
-        0x9D4, 0x7AE, 0x8ED, 0x980, 0xB06, 0x9DE, 0x9FD, 0x8E7, 0xAED, 0x962,
-        0x76D, 0xAE1, 0x9CA, 0x807, 0x7F5, 0x921, 0x95E, 0x8F1, 0x919, 0xB34,
-        0xA38, 0x8DA, 0x9FA, 0x6EF, 0x919, 0xB3D, 0x81C, 0x71E, 0x764, 0x6B2,
-        0x722, 0x7BE, 0x621, 0x846, 0x99B, 0x6CE, 0xA7D, 0x8EA, 0x9AE, 0x710,
-        0x959, 0x656, 0x956, 0x834, 0x8C2, 0x613, 0x679, 0x8B9, 0x653, 0x873,
-        0x59D, 0x8F9, 0x5C0, 0x873, 0x887, 0x677, 0x864, 0x7DD, 0x69B, 0x5DA,
-        0x45B, 0x7DD, 0x4E5, 0x767, 0x6D1, 0x83A, 0x6B1, 0x69D, 0x834, 0x791,
-        0x780, 0x7B4, 0x499, 0x813, 0x7D3, 0x54C, 0x672, 0x6BA, 0x68D, 0x73C,
-        0x8E2, 0x851, 0x49F, 0x78D, 0x89A, 0x721, 0x82E, 0x990, 0x805, 0x6CE,
-        0x7FE, 0x697, 0x660, 0x5C7, 0x8AE, 0x502, 0x895, 0x6FA, 0x40B, 0x6BA,
-        0x2EC, 0x713, 0x773, 0x52A, 0x63D, 0x904, 0x53B, 0x45D, 0x83C, 0x8F3,
-        0x5EE, 0x775, 0x7F2, 0x4BD, 0x51D, 0x7BA, 0x867, 0x6AC, 0x472, 0x8D2,
-        0x4F3, 0x53D, 0x643, 0x81A, 0x705, 0x655, 0x665, 0x5BE, 0x685, 0x1C7,
-        0x530, 0x600, 0x3DC, 0x634, 0x54A, 0x848, 0x7FE, 0x4DD, 0x557, 0x573,
-        0x4DD, 0x5D8, 0x461, 0x3CD, 0x67B, 0x67C, 0x448, 0x6E1, 0x489, 0x5E2,
-        0x6BF, 0x56F, 0x62E, 0x4B0, 0x52C, 0x527, 0x452, 0x531, 0x317, 0x4B4
-    },
-
-    // Ruido gausiano generado con np.random.randn()
-    {
-        0x5B9, 0x4C0, 0x5F4, 0x74B, 0x49B, 0x49B, 0x761, 0x623, 0x43E, 0x5CB,
-        0x441, 0x440, 0x555, 0x208, 0x252, 0x41A, 0x369, 0x571, 0x392, 0x2CD,
-        0x735, 0x49E, 0x511, 0x2C8, 0x421, 0x522, 0x333, 0x58A, 0x40B, 0x484,
-        0x40A, 0x7CC, 0x4F1, 0x358, 0x639, 0x318, 0x548, 0x1F6, 0x2EE, 0x543,
-        0x618, 0x539, 0x4C9, 0x480, 0x2B3, 0x3DC, 0x442, 0x695, 0x57D, 0x243,
-        0x575, 0x45F, 0x3ED, 0x5E6, 0x68A, 0x663, 0x3AD, 0x47D, 0x578, 0x675,
-        0x43B, 0x4AE, 0x345, 0x321, 0x635, 0x70A, 0x4DA, 0x680, 0x584, 0x3F9,
-        0x584, 0x751, 0x4E8, 0x75C, 0xF4, 0x638, 0x518, 0x481, 0x51A, 0x1EB,
-        0x4A0, 0x582, 0x73A, 0x42B, 0x3B9, 0x432, 0x65D, 0x577, 0x427, 0x5BF,
-        0x51C, 0x672, 0x3E3, 0x476, 0x45D, 0x2B9, 0x56A, 0x55D, 0x4F8, 0x49A,
-        0x2CC, 0x451, 0x470, 0x3BC, 0x4B7, 0x595, 0x7DA, 0x53B, 0x55B, 0x4D9,
-        0x206, 0x4EC, 0x50E, 0x8BC, 0x4AB, 0x56C, 0x4E9, 0x32C, 0x6B6, 0x61D,
-        0x62C, 0x392, 0x71C, 0x2D1, 0x5DC, 0x851, 0x372, 0x418, 0x51D, 0x431,
-        0x297, 0x511, 0x356, 0x5B0, 0x38E, 0x756, 0x3C3, 0x478, 0x635, 0x314,
-        0x54F, 0x6F7, 0x280, 0x53F, 0x55C, 0x629, 0x312, 0x2F1, 0x5C3, 0x56B,
-        0x558, 0x57E, 0x3EC, 0x551, 0x569, 0x3DE, 0x7D2, 0x5B0, 0x323, 0x5F8,
-        0x378, 0x62B, 0x6BC, 0x3B5, 0x670, 0x598, 0x638, 0x7DE, 0x496, 0x3CF,
-        0x39A, 0x3B7, 0x4D8, 0x57C, 0x563, 0x63A, 0x4FB, 0x730, 0x48F, 0x920,
-        0x5EC, 0x3A6, 0x353, 0x5B3, 0x49F, 0x60E, 0x5B0, 0x4DA, 0x3AA, 0x2A5,
-        0x447, 0x646, 0x54A, 0x30E, 0x53A, 0x58D, 0x39C, 0x533, 0x50D, 0x336,
-        0x583, 0x5D2, 0x69F, 0x693, 0x2DA, 0x387, 0x5C0, 0x5C0, 0x5C0, 0xADC,
-        0x5D6, 0x6B3, 0x66C, 0x5F6, 0x47B, 0x620, 0x3C7, 0x499, 0x438, 0x516,
-        0x881, 0x21A, 0x603, 0x27E, 0x43D, 0x6A1, 0x50F, 0x350, 0x3DE, 0x601,
-        0x3D8, 0x54B, 0x508, 0x3F7, 0x83F, 0x5EF, 0x1DD, 0x53F, 0x3F3, 0x644,
-        0x3C0, 0x4C9, 0x5BC, 0x64A, 0x320, 0x473, 0x43C, 0x3F6, 0x7AA, 0x595,
-        0x308, 0x65E, 0x836, 0x68B, 0x2A3, 0x439, 0x6E7, 0x3E1, 0x5A4, 0x626,
-        0x38B, 0x4DF, 0x0, 0x365, 0x493, 0x30D, 0x776, 0x2C6, 0x44A, 0x52A,
-        0x72B, 0x2C4, 0x6BE, 0x4FA, 0x376, 0x5AB, 0x544, 0x40B, 0x512, 0x45F,
-        0x523, 0x5FA, 0x764, 0x311, 0x83A, 0x1F9, 0x4BB, 0x5DD, 0x564, 0x402,
-        0x4A5, 0x435, 0x40F, 0x643, 0x582, 0x3E7, 0x657, 0x56F, 0x635, 0x5ED,
-        0x3B1, 0x41B, 0x61B, 0x5E6, 0x4EE, 0x524, 0x6EB, 0x40E, 0x5CD, 0x4A7,
-        0x4A1, 0x6A5, 0x63A, 0x635, 0x6F6, 0x4FF, 0x602, 0x47D, 0x575, 0x4C3,
-        0x51C, 0x5E0, 0x3B6, 0x82A, 0x36C, 0x31A, 0x6BC, 0x62D, 0x5EB, 0x5ED,
-        0x4F2, 0x397, 0x514, 0x3ED, 0x674, 0x4BD, 0x3B3, 0x478, 0x598, 0x419,
-        0x3B4, 0x556, 0x556, 0x430, 0x43E, 0x551, 0x2BF, 0x2CF, 0x3DD, 0x4A3,
-        0x570, 0x739, 0x646, 0x4B8, 0x4EF, 0x36D, 0x4EF, 0x485, 0x575, 0x3B2,
-        0x5C2, 0x74F, 0x4CC, 0x594, 0x605, 0x459, 0x54E, 0x4FB, 0x51D, 0x3C7,
-        0x500, 0x5B9, 0x72F, 0x66E, 0x842, 0x3CA, 0x64C, 0x53E, 0x851, 0x3BA,
-        0x3AD, 0x40B, 0x1B6, 0x428, 0x3CD, 0x531, 0x57C, 0x7D6, 0x66B, 0x414,
-        0x396, 0x5B7, 0x2F1, 0x7C4, 0x6C5, 0x43E, 0x257, 0x709, 0x4C9, 0x6DB,
-        0x285, 0x40B, 0x4F8, 0x509, 0x446, 0x5EA, 0x354, 0x4BF, 0x525, 0x5C0,
-        0x60D, 0x33E, 0x29D, 0x6EB, 0x579, 0x3D1, 0x756, 0x524, 0x6C4, 0x511,
-        0x81E, 0x7A6, 0x495, 0x673, 0x5F3, 0x70F, 0x37C, 0x603, 0x695, 0x245,
-        0x327, 0x1D7, 0x48D, 0x610, 0x743, 0x513, 0x775, 0x2D9, 0x25B, 0x4E1,
-        0x58D, 0x4E9, 0x1CC, 0x4D3, 0x2F7, 0x5FD, 0x586, 0x386, 0x42D, 0x357,
-        0x4DE, 0x66D, 0x374, 0x5BC, 0x426, 0x3C0, 0x4CC, 0x361, 0x41D, 0x321,
-        0x7F8, 0x504, 0x3E4, 0x54A, 0x4CA, 0x4A0, 0x5E7, 0x61F, 0x426, 0x415,
-        0x48B, 0x170, 0x2A4, 0x70E, 0x77B, 0x495, 0x5D8, 0x570, 0x9AD, 0x6AD,
-        0x4C4, 0x380, 0x281, 0x546, 0x3CE, 0x2C9, 0x3F9, 0x34E, 0x78C, 0x650,
-        0x4F3, 0x73A, 0x515, 0x3A5, 0x74B, 0x5CA, 0x360, 0x4AC, 0x39F, 0x2D8,
-        0x661, 0x7E3, 0x2D2, 0x5D3, 0x3F7, 0x437, 0x40E, 0x3A4, 0x509, 0x3B1,
-        0x560, 0x4E3, 0x499, 0x393, 0x414, 0x61E, 0x5BB, 0x377, 0x51D, 0x61D,
-        0x268, 0x5CB, 0x3F3, 0x5D6, 0x3CB, 0x233, 0x278, 0x509, 0x55C, 0x394,
-        0x5F1, 0x26B, 0x4DC, 0x31C, 0x3F7, 0x509, 0x3A5, 0x460, 0x681, 0x414,
-        0x63E, 0x33C, 0x5C6, 0x72B, 0x12E, 0x3BE, 0x5D8, 0x4A7, 0x588, 0x40A,
-        0x518, 0x4B9, 0x6C0, 0x55A, 0x57B, 0x455, 0x437, 0x44D, 0x591, 0x451,
-        0x568, 0x824, 0x64C, 0x477, 0x6CD, 0x456, 0x1D8, 0x36B, 0x219, 0x46D,
-        0x4FE, 0x787, 0x576, 0x4A0, 0x63B, 0x194, 0x553, 0x624, 0x2B3, 0x6B7,
-        0x57B, 0x454, 0x5EE, 0x870, 0x53E, 0x558, 0x442, 0x3A9, 0x63C, 0x3A7,
-        0x512, 0x43B, 0x5B2, 0x579, 0x68D, 0x42E, 0x48D, 0x377, 0x448, 0x58A,
-        0x61F, 0x38D, 0x64B, 0x70A, 0x598, 0x7D6, 0x3C7, 0x30F, 0x23D, 0x741,
-        0x5F7, 0x4E1, 0x564, 0x33D, 0x8B5, 0x529, 0x521, 0x613, 0x5B3, 0x54E,
-        0x3C1, 0x5AF, 0x7D8, 0x706, 0x767, 0x42E, 0x372, 0x4C5, 0x50C, 0x6A3,
-        0x25F, 0x74E, 0x4B8, 0x44F, 0x36A, 0x26E, 0x639, 0x513, 0x2FD, 0x2FB,
-        0x473, 0x784, 0x491, 0x2A9, 0x496, 0x48B, 0xD5, 0x4E1, 0x49C, 0x607,
-        0x7CB, 0x6B0, 0x48D, 0x345, 0x8E7, 0x50E, 0x4FC, 0x4ED, 0x544, 0x4BE,
-        0x415, 0x420, 0x4E9, 0x421, 0x3DF, 0x520, 0x492, 0x744, 0xE7, 0x6A2,
-        0x6DF, 0x1CA, 0x470, 0x465, 0x2CF, 0x3C5, 0x343, 0x7A5, 0x665, 0x6E9,
-        0x611, 0x33C, 0x429, 0x5B6, 0x317, 0x60E, 0x498, 0x463, 0x60D, 0x5A4,
-        0x469, 0x6BD, 0x34F, 0x5E8, 0x5DF, 0x47D, 0x576, 0x30C, 0x660, 0x4AE,
-        0x429, 0x691, 0x3E2, 0x2CE, 0x294, 0x5E4, 0x300, 0x7A6, 0x1C6, 0x78F,
-        0x549, 0x4D0, 0x421, 0x593, 0x4E8, 0x6A7, 0x523, 0x531, 0x468, 0x4E0,
-        0x56F, 0x258, 0x2E6, 0x61A, 0x539, 0x4AE, 0x4FE, 0x57F, 0x423, 0x3C5,
-        0x543, 0x377, 0x596, 0x25B, 0x68A, 0x5B0, 0x55B, 0x677, 0x783, 0x684,
-        0x225, 0x301, 0x401, 0x501, 0x5C1, 0x3DA, 0x540, 0x3CE, 0x407, 0x2CF,
-        0x38C, 0x2E5, 0x378, 0x693, 0x382, 0x8FE, 0x5B8, 0x53F, 0x3A6, 0x609,
-        0x415, 0x526, 0x8E2, 0x4D1, 0x6B9, 0x3E3, 0x4E9, 0x7AC, 0x401, 0x7BD,
-        0x60C, 0x41A, 0x5EE, 0x673, 0x5EA, 0x28F, 0x3D9, 0x495, 0x4D9, 0x5EA,
-        0x53C, 0x2EB, 0x58B, 0x5E6, 0x5D2, 0x69E, 0x63D, 0x5AA, 0x4DB, 0x26B,
-        0x59F, 0x548, 0x561, 0x302, 0x34F, 0x693, 0x4E7, 0x601, 0x501, 0x502,
-        0x666, 0x42C, 0x51C, 0x441, 0x44C, 0x47D, 0x54D, 0x43B, 0x6E2, 0x398,
-        0x4AD, 0x44A, 0x72D, 0x543, 0x68B, 0x2B0, 0x55F, 0x653, 0x517, 0x698,
-        0x42C, 0x71F, 0x87B, 0x468, 0x448, 0x730, 0x761, 0x429, 0x452, 0x488,
-        0x2E7, 0x38E, 0x36D, 0x3C9, 0x4E9, 0x552, 0x756, 0x36F, 0x678, 0x4A2,
-        0x4E3, 0x5FF, 0x33E, 0x58C, 0x538, 0x5B7, 0x568, 0x8B9, 0x3FC, 0x426,
-        0x402, 0x41D, 0x3FD, 0x6C8, 0x723, 0x417, 0x3B0, 0x5AF, 0x41E, 0x5EE,
-        0x546, 0x2A4, 0x755, 0x7B6, 0x406, 0x45E, 0x566, 0x579, 0x5F8, 0x80A,
-        0x4B1, 0x3BD, 0x2DA, 0x3D8, 0x4E9, 0x7B6, 0x42B, 0x54E, 0x4F0, 0x6C8,
-        0x8D5, 0x426, 0x436, 0x690, 0x602, 0x7CA, 0x5DB, 0x469, 0x5DE, 0x6A9,
-        0x638, 0x5BD, 0x698, 0x6C1, 0x714, 0x5F5, 0x4B5, 0x530, 0x6CF, 0x3B6,
-        0x587, 0x45C, 0x502, 0x6EB, 0x541, 0x509, 0x2E1, 0x61B, 0x5F3, 0x846,
-        0x47E, 0x54C, 0x558, 0x761, 0x4D1, 0x564, 0x5E5, 0x53F, 0x447, 0x542,
-        0x69B, 0x364, 0x52A, 0x3E4, 0x6CB, 0x2A1, 0x41B, 0x58A, 0x75C, 0x4DD,
-        0x41D, 0x7D8, 0x2BF, 0x199, 0x5A3, 0x432, 0x366, 0x60C, 0x556, 0x419,
-        0x301, 0x64C, 0x5F5, 0x4CF, 0x7CA, 0x353, 0x2A0, 0x3E7, 0x4E4, 0x556,
-        0x498, 0x580, 0x30C, 0x72C, 0x4D6, 0x6AC, 0x57D, 0x5A9, 0x5D6, 0x5A6,
-        0x5F2, 0x6FF, 0x543, 0x60C, 0x4D3, 0x72B, 0x3ED, 0x7B8, 0x4E7, 0x2C6,
-        0x529, 0x3EB, 0x640, 0x3F7, 0x447, 0x212, 0x445, 0x140, 0x28A, 0x620,
-        0x62A, 0x59D, 0x37B, 0x4E4, 0x4F5, 0x330, 0x744, 0x64E, 0x4A0, 0x501,
-        0x548, 0x1D6, 0x495, 0x3EB, 0x36E, 0x488, 0x7B7, 0x5F1, 0x416, 0x5D7,
-        0x71B, 0x661, 0x50E, 0x3F9, 0x608, 0x591, 0x655, 0x5EF, 0x692, 0x425,
-        0x6FB, 0x544, 0x824, 0x3E8, 0x79F, 0x544, 0x3F7, 0x439, 0x479, 0x59D,
-        0x5C3, 0x415, 0x4ED, 0x83E, 0x79B, 0x5A1, 0x505, 0x525, 0x5E7, 0x365,
-        0x491, 0x268, 0x593, 0x5F4, 0x439, 0x75F, 0x316, 0x2B8, 0x54E, 0x691,
-        0x78A, 0x442, 0x69D, 0x4E7, 0x4B3, 0x651, 0x5F6, 0x28C, 0x739, 0x713,
-        0x401, 0x591, 0x5B8, 0x55C, 0x41F, 0x3EF, 0x4EC, 0x6C2, 0x5CB, 0x465,
-        0x625, 0x9A, 0x6B9, 0x24C, 0x468, 0x33F, 0x2FB, 0x6BD, 0x43F, 0x57E,
-        0x4E4, 0x5B1, 0x514, 0x2FF, 0x67D, 0x435, 0x294, 0x44F, 0x742, 0x644,
-        0x46E, 0x46D, 0x478, 0x824, 0x58C, 0x59F, 0x68A, 0x554, 0x491, 0x4A9,
-        0x4DA, 0x4E8, 0x613, 0x50B, 0x615, 0x4D7, 0x515, 0x1E7, 0x65D, 0x57E,
-        0x67D, 0x87, 0x829, 0x4C0, 0x6A9, 0x35F, 0x5E6, 0x359, 0x402, 0x7E4,
-        0x4AC, 0x54C, 0x64B, 0x5B9, 0x531, 0x585, 0x8A4, 0x4E0, 0x545, 0x692,
-        0x6A8, 0x6C8, 0x5F1, 0x336, 0x776, 0x335, 0x56D, 0x3CF, 0x4DD, 0x577,
-        0x574, 0x59C, 0x76F, 0x5A8, 0x497, 0x670, 0x6C8, 0x315, 0x5E0, 0x609,
-        0x482, 0x711, 0x4BB, 0x528, 0x4B2, 0x4FC, 0x349, 0x2C2, 0x767, 0x3AA,
-        0x372, 0x1AA, 0x3FC, 0x2F0, 0x77A, 0x682, 0x3E9, 0x869, 0x677, 0x477,
-        0x123, 0x878, 0x2D6, 0x271, 0x687, 0x8B2, 0x715, 0x5D3, 0x5DF, 0x645,
-        0x620, 0x565, 0x51F, 0x4DE, 0x3CF, 0x488, 0x25F, 0x4D0, 0x373, 0x346,
-        0x53D, 0x718, 0x65E, 0x28F, 0x372, 0x667, 0x375, 0x49E, 0x5CE, 0x37B,
-        0x520, 0x2EB, 0x40B, 0x574, 0x286, 0x5A3, 0x4EF, 0x5CF, 0x54E, 0x70D,
-        0x527, 0x44E, 0x526, 0x5CB, 0x509, 0x506, 0x3E3, 0x3F3, 0x2D1, 0x7A4,
-        0x30F, 0x3E7, 0x3DD, 0x655, 0x483, 0x6DF, 0x3EE, 0x564, 0x3AF, 0x83F,
-        0x325, 0x570, 0x5EF, 0x598, 0x4AE, 0x4C3, 0x507, 0x4BD, 0x670, 0x859,
-        0x41C, 0x2DD, 0x4D4, 0x8E9, 0x3BB, 0x779, 0x788, 0x41D, 0x5D5, 0x775,
-        0x462, 0x4A7, 0x412, 0x369, 0x3F8, 0x317, 0x504, 0x3C9, 0x552, 0x295,
-        0x578, 0x63D, 0x1E9, 0x589, 0x6D7, 0x31C, 0x786, 0x59B, 0x3E2, 0x4E0,
-        0x5D1, 0x514, 0x5C9, 0x38D, 0x539, 0x2CC, 0x4CB, 0x394, 0x3D6, 0x6DB,
-        0x6A2, 0x5E5, 0x34A, 0x47A, 0x6D2, 0x52E, 0x883, 0x590, 0x542, 0x47D,
-        0x52B, 0x4BB, 0x60C, 0x66D, 0x3C2, 0x2ED, 0x227, 0x5BD, 0x346, 0x1AB,
-        0x58F, 0x8C7, 0x4F4, 0x63F, 0x516, 0x4D0, 0x65F, 0x485, 0x55F, 0x574,
-        0x3F0, 0x67B, 0x4B2, 0x3CE, 0x5C9, 0x396, 0x501, 0x4F3, 0x6A0, 0x5B0,
-        0x4EC, 0x637, 0x717, 0x5D1, 0x4FA, 0x2F4, 0x355, 0x47F, 0x407, 0x4AD,
-        0x50D, 0x5C6, 0x4DB, 0x5B5, 0x510, 0x1F0, 0x386, 0x4BE, 0x31C, 0x5E1,
-        0x74E, 0x6D4, 0x4A3, 0x73F, 0x531, 0x472, 0x406, 0x480, 0x45E, 0x539,
-        0x535, 0x4F8, 0x5A2, 0x6C9, 0x66A, 0x2B0, 0x10D, 0x664, 0x2DF, 0x49E,
-        0x32C, 0x234, 0x5CB, 0x620, 0x414, 0xFF, 0x420, 0x590, 0x2B3, 0x53E,
-        0x4F0, 0x5D9, 0x525, 0x379, 0x6CB, 0x4B8, 0x4EC, 0x389, 0x449, 0x39C,
-        0x4B3, 0x795, 0x2DD, 0x27E, 0x737, 0x4A4, 0x3F0, 0x68E, 0x409, 0x7C2,
-        0x600, 0x437, 0x844, 0x409, 0x619, 0x56C, 0x6F4, 0x75A, 0x503, 0x3CF,
-        0x5AB, 0x3ED, 0x80B, 0x52C, 0x467, 0x53F, 0x2E6, 0x37A, 0x6CD, 0x3F5,
-        0x35C, 0x5C9, 0x6C7, 0x610, 0x67D, 0x3CE, 0x2C9, 0x743, 0x478, 0x494,
-        0x6FF, 0x5D0, 0x5A9, 0x847, 0x3FA, 0x662, 0x50D, 0x560, 0x74D, 0x5BD,
-        0x5C9, 0x69B, 0x467, 0x3AD, 0x35D, 0x1F4, 0x81C, 0x346, 0x4A0, 0x48A,
-        0x56F, 0x636, 0x648, 0x412, 0x4B5, 0x565, 0x495, 0x76C, 0x5B7, 0x616,
-        0x5FA, 0x6C2, 0x53D, 0x2FA, 0x593, 0x3F7, 0x427, 0x5DC, 0x6DC, 0x4FF,
-        0x56F, 0x791, 0x555, 0x8F2, 0x5D4, 0x244, 0x61E, 0x58C, 0x6F0, 0x5FE,
-        0x4C0, 0x316, 0x4A4, 0x3A9, 0x413, 0x5DD, 0x785, 0x591, 0x322, 0x5A5,
-        0x6CB, 0x407, 0x4C2, 0x4FC, 0x3C3, 0x5F4, 0x4C7, 0x59B, 0x39A, 0x44B,
-        0x611, 0x464, 0x79B, 0x45A, 0x54E, 0x664, 0x2CA, 0x244, 0x2A0, 0x6E5,
-        0x41E, 0x8E1, 0x419, 0x53F, 0x753, 0x809, 0x81E, 0x6D0, 0x688, 0x5DF,
-        0x627, 0x41E, 0x3B6, 0x4F5, 0x4B4, 0x445, 0x607, 0x66D, 0x519, 0x739,
-        0x337, 0x4AA, 0x3DD, 0x21B, 0x4D6, 0x4C7, 0x747, 0x5EE, 0x365, 0x7CD,
-        0x6D5, 0x5DA, 0x49E, 0x37E, 0x464, 0x6A1, 0x7D9, 0x753, 0x437, 0x340,
-        0x52E, 0x241, 0x575, 0x4BC, 0x440, 0x285, 0x5C0, 0x426, 0x32C, 0x91,
-        0x4EC, 0x7AD, 0x781, 0x443, 0x40A, 0x5AE, 0x36F, 0x56D, 0x623, 0x6D7,
-        0x4CF, 0x4A6, 0x39E, 0x3B2, 0x49E, 0x586, 0x65C, 0x3BC, 0x73F, 0x48C,
-        0x4EE, 0x3D1, 0x140, 0x651, 0x617, 0x488, 0x511, 0x5C1, 0x292, 0x427,
-        0x62E, 0x30B, 0x569, 0x2E3, 0x5AD, 0x4E8, 0x27D, 0x6BF, 0x3D6, 0x3B9,
-        0x545, 0x6B8, 0x368, 0x50E, 0x59E, 0x606, 0x53B, 0x466, 0x3B2, 0x518,
-        0x352, 0x7D, 0x5A1, 0x659, 0x158, 0x36B, 0x5E9, 0x81D, 0x4FE, 0x3D9,
-        0x4AF, 0x711, 0x3F9, 0x3BD, 0x439, 0x381, 0x526, 0x773, 0x575, 0x493,
-        0x484, 0x292, 0x650, 0x4D8, 0x4B0, 0x9DA, 0x56B, 0x3D0, 0x44F, 0x6B8,
-        0x523, 0x2C3, 0x65F, 0x3F0, 0x7D4, 0x69E, 0x447, 0x6EC, 0x511, 0x645,
-        0x5B4, 0x3AB, 0x3FA, 0x68A, 0x473, 0x458, 0x380, 0x59C, 0x81F, 0x354,
-        0x500, 0x720, 0x4D7, 0x5A8, 0x356, 0x59E, 0x4AD, 0x679, 0x6C8, 0x8ED,
-        0x5D9, 0x576, 0x542, 0x46C, 0x57B, 0x483, 0x538, 0x6FB, 0x36C, 0x6B5,
-        0x6FB, 0x4C8, 0x1B7, 0x408, 0x6F3, 0x4ED, 0x36F, 0x430, 0x640, 0x5CD,
-        0x499, 0x467, 0x45D, 0x38D, 0x76F, 0x478, 0x6D3, 0x74B, 0x67E, 0x44D,
-        0x595, 0x4ED, 0x394, 0x575, 0x328, 0x6C8, 0x440, 0x545, 0x565, 0x491,
-        0x5DC, 0x43C, 0x64C, 0x2E7, 0x528, 0x7EE, 0x36E, 0x3ED, 0x5C0, 0x53D,
-        0x580, 0x5B6, 0x5EF, 0x6A9, 0x597, 0x498, 0x5FE, 0x7DF, 0x4C2, 0x378,
-        0x6A8, 0x4C7, 0x1A3, 0x642, 0x425, 0x4D3, 0x578, 0x541, 0x60C, 0x44C,
-        0x5BF, 0x491, 0x618, 0x5E7, 0x388, 0x6A0, 0x424, 0x633, 0x586, 0x7C7,
-        0x49F, 0x46D, 0x4EF, 0x47F, 0x630, 0x27D, 0x359, 0x354, 0x66B, 0x795,
-        0x4CD, 0x4B4, 0x512, 0x6BE, 0x38B, 0x554, 0x675, 0x5BB, 0x541, 0x67F,
-        0xD3, 0x600, 0x3F6, 0x229, 0x5BF, 0x711, 0x4C0, 0x66C, 0x76E, 0x6FA,
-        0x779, 0x619, 0x514, 0x282, 0x496, 0x3AC, 0x849, 0x4B1, 0x527, 0x5CE,
-        0x507, 0x78F, 0x402, 0x543, 0x3D3, 0x2F1, 0x407, 0x4E8, 0x44E, 0x3E7,
-        0x2CF, 0x4D6, 0x2A9, 0x620, 0x517, 0x2BB, 0x47D, 0x3D0, 0x573, 0x704,
-        0x217, 0x523, 0x4B8, 0x5FD, 0x54A, 0x3D0, 0x479, 0x3BE, 0x69C, 0x4FF,
-        0x7DF, 0x4DF, 0x3E1, 0x2A5, 0x234, 0x289, 0x55F, 0x5BE, 0x28B, 0x655,
-        0x439, 0x530, 0x76E, 0x656, 0x48D, 0x399, 0x1AB, 0x3DC, 0x4A4, 0x373,
-        0x4C3, 0x514, 0x49E, 0x3F8, 0x538, 0x5A4, 0x34B, 0x71F, 0x4D0, 0x4FE,
-        0x60C, 0x552, 0x66C, 0x567, 0x406, 0x584, 0x336, 0x521, 0x4E9, 0x4A5,
-        0x4C4, 0x215, 0x41F, 0x51B, 0x535, 0x364, 0x6E6, 0x3A3, 0x672, 0x59E,
-        0x3F9, 0x7AE, 0x323, 0x65F, 0x67E, 0x3EF, 0x718, 0x494, 0x567, 0x55C,
-        0x4C2, 0x634, 0x62D, 0x249, 0x6F5, 0x26B, 0x68B, 0x6B0, 0x34B, 0x455,
-        0x345, 0x4A2, 0x47E, 0x628, 0x6F8, 0x719, 0x41A, 0x4A4, 0x263, 0x3BA,
-        0x670, 0x76F, 0x313, 0x40E, 0x4EC, 0x564, 0x3B9, 0x59D, 0x43D, 0x4F1,
-        0x5CC, 0x4F9, 0x44B, 0x4CB, 0x4D4, 0x465, 0x491, 0x769, 0x5D2, 0x483,
-        0x607, 0x473, 0x6C2, 0x587, 0x4CC, 0x5A6, 0x28F, 0x33D, 0x322, 0x52E,
-        0x79D, 0x861, 0x5F0, 0x5BB, 0x234, 0x422, 0x3C2, 0x403, 0x4B4, 0x43D,
-        0x1EF, 0x61B, 0x352, 0x554, 0x823, 0x38E, 0x117, 0x486, 0x6A6, 0x7F6,
-        0x314, 0x5B9, 0x440, 0x4CD, 0x903, 0x2A9, 0x55A, 0x5AE, 0x6A0, 0x51D,
-        0x56F, 0x45D, 0x560, 0x470, 0x5EA, 0x465, 0x58A, 0x4EB, 0x6B0, 0x4E2,
-        0x23F, 0x6E5, 0x393, 0x3F6, 0x40D, 0x711, 0x1B1, 0x9C4, 0x694, 0x54E,
-        0x4E1, 0x566, 0x5C3, 0x5F3, 0x5D0, 0x519, 0x4A9, 0x4BB, 0x4AA, 0x6B3,
-        0x5DF, 0x76, 0x5F7, 0x543, 0x4EF, 0x45E, 0x6AF, 0x66A, 0x3C7, 0x596,
-        0x379, 0x2DA, 0x401, 0x648, 0x66C, 0x5BF, 0x612, 0x5C1, 0x3FB, 0x5A0,
-        0x630, 0x61E, 0x6C8, 0x60C, 0x580, 0x69A, 0x4EC, 0x39D, 0x4B6, 0x3D2,
-        0x3EE, 0x4BE, 0x3C0, 0x47E, 0x210, 0x54A, 0x4F7, 0x3B6, 0x5F9, 0x666,
-        0x280, 0x3CB, 0x3C9, 0x386, 0x63B, 0x4AA, 0x48F, 0x1E5, 0x5EF, 0x311,
-        0x50E, 0x563, 0x70C, 0x2F5, 0x57, 0x53E, 0x7B8, 0x6DC, 0x548, 0x436,
-        0x633, 0x379, 0x5B1, 0x5BC, 0x696, 0x930, 0x590, 0x42F, 0x4EC, 0x241,
-        0x3E6, 0x456, 0x429, 0x532, 0x3B4, 0x6AE, 0x4F6, 0x4F3, 0x476, 0x533,
-        0x63A, 0x3A2, 0x3F4, 0x47F, 0x2E7, 0x3B5, 0x43C, 0x64D, 0x55D, 0x542,
-        0x644, 0x4C0, 0x58F, 0x4CE, 0x55E, 0x412, 0x13A, 0x4C2, 0x724, 0x661,
-        0x671, 0x6DB, 0x519, 0x544, 0x404, 0x47A, 0x5E8, 0x6CE, 0x4C0, 0x446,
-        0x4F7, 0x5E2, 0x2C0, 0x172, 0x41F, 0x318, 0x42F, 0x4BC, 0x445, 0x730,
-        0x576, 0x56C, 0x5EA, 0x338, 0x68E, 0x4D9, 0x5FD, 0x352, 0x295, 0x637,
-        0x58A, 0x395, 0x3A1, 0x6AF, 0x324, 0x77A, 0x395, 0x5F1, 0x476, 0x5E3,
-        0x421, 0x4B7, 0x506, 0x36E, 0x619, 0x42D, 0x49D, 0x371, 0x10A, 0x4AB,
-        0x8A8, 0x62A, 0x4EF, 0x48F, 0x4FF, 0x5CD, 0x328, 0x6AB, 0x60F, 0x610,
-        0x5A2, 0x4FE, 0x5FE, 0x5DE, 0x46C, 0x416, 0x51E, 0x755, 0x311, 0x2B7,
-        0x537, 0x50A, 0x53A, 0x556, 0x49F, 0x73E, 0x283, 0x3B2, 0x4CE, 0x272,
-        0x4B1, 0x781, 0x4FE, 0x551, 0x308, 0x405, 0x463, 0x47A, 0x6ED, 0x5D1,
-        0x343, 0x557, 0x5BA, 0x6B5, 0x762, 0x368, 0x3B9, 0x309, 0x49B, 0x5AD,
-        0x679, 0x4D9, 0x479, 0x532, 0x3AF, 0x829, 0x280, 0x53F, 0x80F, 0x4F9,
-        0x4AC, 0x46A, 0x4B0, 0x710, 0x193, 0x74F, 0x2C8, 0x48E, 0x44E, 0x5DD,
-        0x284, 0x5AB, 0x810, 0x2E0, 0x541, 0x3F3, 0x59D, 0x4FE, 0x3FB, 0x5B6,
-        0x7B9, 0x4AB, 0x610, 0x2FB, 0x37F, 0x5AF, 0x73C, 0x582, 0x47C, 0x4F6,
-        0x30C, 0x5E3, 0x650, 0x445, 0x43E, 0x55F, 0x44B, 0x4DC, 0x82D, 0x495,
-        0x46A, 0x3F9, 0x61A, 0x4AF, 0x3F8, 0x6FC, 0x723, 0x40B, 0x21B, 0x681,
-        0x3EA, 0x62C, 0x1F2, 0x654, 0x31C, 0x615, 0x4FC, 0x380, 0x457, 0x603,
-        0x520, 0x5DB, 0x7FD, 0x291, 0x770, 0x51F, 0x396, 0x2ED, 0x4AC, 0x660,
-        0x4C4, 0x747, 0x2BE, 0x4F2, 0x30B, 0x585, 0x652, 0x451, 0xFA, 0x544,
-        0x5A1, 0x595, 0x6DB, 0x353, 0x601, 0x6CA, 0x23D, 0x574, 0x431, 0x4D6,
-        0x57F, 0x437, 0x3ED, 0x504, 0x34C, 0x34D, 0x601, 0x334, 0x5FB, 0x5AC,
-        0x252, 0x3ED, 0x6CA, 0x376, 0x440, 0x5AB, 0x629, 0x494, 0x40C, 0x724,
-        0x7A0, 0x676, 0x518, 0x3BA, 0x3B1, 0x5C3, 0x59A, 0x71C, 0x5F5, 0x2A9,
-        0x693, 0x36F, 0x460, 0x558, 0x804, 0x9B9, 0x5E4, 0x4AF, 0x5C8, 0x652,
-        0x479, 0x7B6, 0x550, 0x5B9, 0x5FB, 0x59C, 0x63F, 0x404, 0x41B, 0x347,
-        0x5A3, 0x628, 0x5AA, 0x787, 0x4F4, 0x5FC, 0x34A, 0x45F, 0x607, 0x643,
-        0x483, 0x4DA, 0x2A3, 0x46A, 0x653, 0x5D8, 0x5BB, 0x50A, 0x4F9, 0x3F4,
-        0x608, 0x59B, 0x5B7, 0x428, 0x1AA, 0x6A4, 0x43B, 0x3A4, 0x606, 0x45D,
-        0x696, 0x5E8, 0x602, 0x2DF, 0x6D1, 0x55D, 0x466, 0x52F, 0x23E, 0x596,
-        0x363, 0x2E4, 0x2A2, 0x6AA, 0x400, 0x74F, 0x424, 0x259, 0x341, 0x6DB,
-        0x4B9, 0x41F, 0x535, 0x5BB, 0x6AC, 0x72E, 0x469, 0x2EF, 0x454, 0x55C,
-        0x37D, 0x37F, 0x57D, 0x4E3, 0x503, 0x3CD, 0x49C, 0x38C, 0x653, 0x68C,
-        0x223, 0x38A, 0x2AC, 0x3F8, 0x4D6, 0x2BE, 0x38D, 0x36D, 0x548, 0x511,
-        0x3DB, 0x53C, 0x420, 0x48C, 0x786, 0x704, 0x2F9, 0x63B, 0x634, 0x334,
-        0x637, 0x751, 0x33E, 0x38F, 0x685, 0x561, 0x5CE, 0x57C, 0x58F, 0x2EE,
-        0x691, 0x6C1, 0x49C, 0x4E5, 0x29E, 0x5C0, 0x5D7, 0x4DE, 0x6AF, 0x473,
-        0x5D4, 0x367, 0x4ED, 0x4B2, 0x54F, 0x465, 0x4C3, 0x63A, 0x44B, 0x281,
-        0x7A4, 0x714, 0x2FC, 0x605, 0x431, 0x55E, 0x56A, 0x49A, 0x3C3, 0x3E8,
-        0x38F, 0x3B0, 0x4DC, 0x3DE, 0x602, 0x73D, 0x413, 0x554, 0x5BA, 0x5AF,
-        0x514, 0x619, 0x5B3, 0x311, 0x64B, 0x652, 0x3CB, 0x505, 0x602, 0x4A4,
-        0x69B, 0x895, 0x3C2, 0x2D9, 0x56D, 0x611, 0x49C, 0x730, 0x2EA, 0x606,
-        0x409, 0x798, 0x803, 0x3CA, 0x41F, 0x647, 0x45F, 0x4E5, 0x500, 0x206,
-        0x4F1, 0x3E8, 0x435, 0x72C, 0x30A, 0x635, 0x489, 0x489, 0x62C, 0x57C,
-        0x5D6, 0x672, 0x474, 0x406, 0x34D, 0x3B3, 0x97A, 0x6DE, 0x2E5, 0x2F0,
-        0x5B3, 0x5CD, 0x5CD, 0x492, 0x4C5, 0x577, 0x518, 0x191, 0x49C, 0x3A9,
-        0x53B, 0x988, 0x586, 0x47B, 0x660, 0x5B3, 0x59B, 0x5E4, 0x81C, 0x33B,
-        0x5B0, 0x38B, 0x5D0, 0x38E, 0x453, 0x483, 0x675, 0x65E, 0x30E, 0x50C,
-        0x3E0, 0x309, 0x4A1, 0x47D, 0x8AD, 0x5A0, 0x2DA, 0x419, 0x687, 0x829,
-        0x289, 0x216, 0x7D4, 0x58F, 0x3A2, 0x5C8, 0xED, 0x4F8, 0x577, 0x661,
-        0x369, 0x518, 0x38C, 0x55A, 0x397, 0x456, 0x370, 0x5F5, 0x647, 0x49A,
-        0x505, 0x2BF, 0x481, 0x4E3, 0x8F9, 0x343, 0x734, 0x67D, 0x564, 0x7A8,
-        0x588, 0x58F, 0x4E1, 0x6D6, 0x6A4, 0x401, 0x2F1, 0x4A7, 0x3BD, 0x4DD,
-        0x6DB, 0x443, 0x4E6, 0x50D, 0x643, 0x186, 0x409, 0x549, 0x6CD, 0x436,
-        0x217, 0x5E9, 0x3FD, 0x324, 0x402, 0x4AE, 0x409, 0x196, 0x656, 0x6EA,
-        0x5F6, 0x338, 0x4A7, 0x4F4, 0x5E1, 0x5FC, 0x3D7, 0x516, 0x5AA, 0x731,
-        0x60A, 0x62C, 0x517, 0x71F, 0x597, 0x3A5, 0x71C, 0x608, 0x449, 0x43A,
-        0x56B, 0x5AC, 0x544, 0x570, 0x791, 0x69A, 0x541, 0x667, 0x362, 0x592,
-        0x7BB, 0x4A1, 0x3AA, 0x3F7, 0x34B, 0x3C3, 0x465, 0x2CF, 0x4FC, 0x658,
-        0x393, 0x74A, 0x5BE, 0x68A, 0x3F4, 0x645, 0x34A, 0x653, 0x53A, 0x5CF,
-        0x32A, 0x398, 0x5E0, 0x383, 0x5AC, 0x2DF, 0x643, 0x313, 0x5CF, 0x5EC,
-        0x3E5, 0x5DA, 0x55C, 0x423, 0x36B, 0x1F5, 0x57F, 0x291, 0x51C, 0x48F,
-        0x600, 0x480, 0x475, 0x615, 0x57A, 0x572, 0x5AE, 0x29C, 0x61F, 0x5E6,
-        0x368, 0x497, 0x4E7, 0x4C2, 0x579, 0x727, 0x69E, 0x2F4, 0x5EA, 0x6FF,
-        0x58E, 0x6A2, 0x80B, 0x688, 0x558, 0x690, 0x52F, 0x500, 0x46D, 0x75B,
-        0x3B6, 0x74F, 0x5BA, 0x2D2, 0x586, 0x1BF, 0x5EB, 0x651, 0x40E, 0x527,
-        0x7F4, 0x430, 0x357, 0x73B, 0x7F7, 0x4F8, 0x683, 0x704, 0x3D3, 0x438,
-        0x6D9, 0x78B, 0x5D3, 0x39D, 0x801, 0x426, 0x473, 0x57C, 0x757, 0x645,
-        0x599, 0x5AC, 0x507, 0x5D1, 0x117, 0x482, 0x555, 0x333, 0x58E, 0x4A6,
-        0x7A6, 0x75F, 0x440, 0x4BB, 0x4D9, 0x445, 0x543, 0x3CD, 0x33B, 0x5EA,
-        0x5ED, 0x3BB, 0x655, 0x3FF, 0x55A, 0x638, 0x4E9, 0x5A9, 0x42C, 0x4A9,
-        0x4A6, 0x3D2, 0x4B1, 0x297, 0x436, 0x487, 0x492, 0x498, 0x4DE, 0x5B2
-    },
-  
+/**
+ * @class WaveformDecoder
+ * @brief Lector secuencial de las señales de prueba
+ *
+ * @details Con la tabla sin comprimir es un simple índice; con el flujo Rice
+ * decodifica una diferencia por muestra (unas pocas operaciones de bits), sin
+ * buffers intermedios. El estado ocupa 16 bytes, por lo que puede haber tantos
+ * decodificadores como señales se quieran reproducir a la vez.
+ *
+ * @note Las muestras crudas son valores ADC de 12 bits; read() las normaliza a
+ * [-1, 1) con (raw - 2048) / 2048, igual que loadSignal().
+ */
+class WaveformDecoder {
+    public:
+        WaveformDecoder();
+
+        /**
+         * @brief Posiciona el decodificador al inicio de una señal
+         * @param signalIndex Índice de la señal (0 .. waveformsNumSignals-1)
+         * @return false si el índice no es válido
+         */
+        bool begin(uint8_t signalIndex);
+
+        /**
+         * @brief Devuelve la siguiente muestra cruda (12 bits)
+         * @note Tras el final de la señal devuelve 0, igual que el relleno de la tabla original.
+         */
+        uint16_t nextRaw();
+
+        /**
+         * @brief Decodifica hasta 'length' muestras normalizadas
+         * @return Número de muestras escritas (0 al llegar al final de la señal)
+         */
+        uint32_t read(float32_t* buffer, uint32_t length);
+
+        /**
+         * @brief Salta a una muestra concreta
+         * @details Con Rice la búsqueda reinicia y decodifica hasta la posición (O(n)).
+         */
+        bool seek(uint32_t sample);
+
+        uint32_t position() const { return _position; }
+        uint32_t remaining() const { return waveformsNumSamples - _position; }
+
+    private:
+        uint32_t readBits(uint8_t numBits);
+
+        uint8_t _signal;        ///< Señal activa (0xFF = ninguna)
+        uint8_t _k;             ///< Parámetro Rice del bloque actual
+        uint16_t _previous;     ///< Última muestra decodificada
+        uint32_t _position;     ///< Índice de la próxima muestra
+        uint32_t _bitPos;       ///< Posición en bits dentro de waveformsRiceData
 };
 
 // ====================
 // FUNCIONES
 // ====================
 
-// /**
-//  * @brief Obtiene el tipo de señal a partir de una etiqueta de texto.
-//  *
-//  * @param tag Etiqueta de la señal (ej. "ecg_clean").
-//  * @return El tipo de señal correspondiente o UNKNOWN_SIGNAL si no se encuentra.
-//  */
-// inline SignalType getSignalType(const char* tag) {
-//     if (!tag) return UNKNOWN_SIGNAL;
-
-//     for (unsigned int i = 0; i < sizeof(signalTable) / sizeof(signalTable[0]); i++) {
-//         if (strcasecmp(tag, signalTable[i].tag) == 0) {
-//             return signalTable[i].type;
-//         }
-//     }
-//     return UNKNOWN_SIGNAL;
-// }
-
-// /**
-//  * @brief Carga una señal de prueba en un buffer y la normaliza.
-//  *
-//  * @param tag Etiqueta de la señal a cargar.
-//  * @param buffer Puntero al buffer de flotantes donde se guardará la señal.
-//  * @param numSamples Número de muestras a cargar.
-//  * @return `true` si la señal se cargó correctamente, `false` en caso contrario.
-//  */
-// inline bool loadSignal(const char* tag, float32_t* buffer, uint16_t numSamples) {
-//     SignalType signal = getSignalType(tag);
-
-//     if (signal == UNKNOWN_SIGNAL) {
-//         // Si la etiqueta no es válida, no hacer nada y devolver false
-//         return false;
-//     }
-
-//     // Asegurarse de no leer más allá del tamaño del buffer
-//     if (numSamples > maxSamplesNum) {
-//         numSamples = maxSamplesNum;
-//     }
-
-//     // Copia y normaliza los datos de la señal seleccionada
-//     for (uint16_t i = 0; i < numSamples; i++) {
-//         uint16_t rawValue = waveformsTable[signal][i];
-//         buffer[i] = ((float32_t)rawValue - 2048.0f) / 2048.0f;
-
-//         // Pequeña pausa cada 100 muestras para estabilidad
-//         if (i % 100 == 0 && i > 0) {
-//             delay(1);
-//         }
-//     }
-
-//     return true;
-// }
-
-// /**
-//  * @brief Carga TODAS las muestras de una señal en un buffer y la normaliza.
-//  *
-//  * @param tag Etiqueta de la señal a cargar.
-//  * @param buffer Puntero al buffer de flotantes donde se guardará la señal.
-//  * @return `true` si la señal se cargó correctamente, `false` en caso contrario.
-//  */
-// inline bool loadSignal(const char* tag, float32_t* buffer) {
-//     // Simplemente llama a la otra versión de la función, pidiendo todas las muestras.
-//     return loadSignal(tag, buffer, maxSamplesNum);
-// }
-
-
-
-
-////////////////////////////////////////////////////////////////////////////////////////////////
-////////////////////////////////////////////////////////////////////////////////////////////////
-////////////////////////////////////////////////////////////////////////////////////////////////
-////////////////////////////////////////////////////////////////////////////////////////////////
-
-inline bool loadSignal(float32_t* buffer, const char* tag, uint16_t numSamples = 1500) {
-    if (buffer == nullptr || tag == nullptr) {
-        return false;
-    }
-    
-    // Limitar al tamaño máximo disponible
-    if (numSamples > maxSamplesNum) {
-        numSamples = maxSamplesNum;
-    }
-    
-    // Determinar índice - comparación simple sin strcasecmp
-    int index = -1;
-    
-    // Comparar directamente (case sensitive para índices numéricos)
-    if (strcmp(tag, "0") == 0) index = 0;
-    else if (strcmp(tag, "1") == 0) index = 1;
-    else if (strcmp(tag, "2") == 0) index = 2;
-    else if (strcmp(tag, "3") == 0) index = 3;
-    else if (strcmp(tag, "4") == 0) index = 4;
-    
-    // Tags de texto (case insensitive manual)
-    else {
-        // Convertir primer caracter a lowercase para comparación
-        char firstChar = tag[0];
-        if (firstChar >= 'A' && firstChar <= 'Z') {
-            firstChar = firstChar + 32;
-        }
-        
-        // Comparación por primer caracter + longitud (rápido y seguro)
-        if (firstChar == 'e' && strlen(tag) == 9) {
-            // "ecg_clean"
-            index = 0;
-        } else if (firstChar == 'e' && strlen(tag) == 15 && tag[4] == '6') {
-            // "ecg_60hz_noised"
-            index = 1;
-        } else if (firstChar == 'e' && strlen(tag) == 16 && tag[4] == '3') {
-            // "ecg_320hz_noised"
-            index = 2;
-        } else if (firstChar == 'e' && strlen(tag) == 15 && tag[4] == 'w') {
-            // "ecg_white_noise"
-            index = 3;
-        } else if (firstChar == 'w' && strlen(tag) == 11 && tag[4] == 'e') {
-            // "white_noise"
-            index = 4;
-        }
-    
-        if (index < 0) {
-            return false;
-        }
-        
-        // Cargar señal
-        for (uint16_t i = 0; i < numSamples; i++) {
-            uint16_t rawValue = waveformsTable[index][i];
-            buffer[i] = ((float32_t)rawValue - 2048.0f) / 2048.0f;
-            
-            // Pequeña pausa cada 100 muestras para estabilidad
-            if (i % 100 == 0 && i > 0) {
-                delay(1);
-            }
-        }
-        
-        return true;
-    }
-}
-
 /**
- * @brief Obtiene el nombre descriptivo de una señal
- * 
- * @param tag Etiqueta de la señal
- * @return Nombre descriptivo
+ * @brief Obtiene el índice de una señal a partir de su etiqueta
+ * @param tag "ecg_clean", "ecg_60hz_noised", "ecg_320hz_noised", "ecg_white_noise",
+ * "white_noise" o su índice como texto ("0" .. "4"). No distingue mayúsculas.
+ * @return Índice de la señal o -1 si no existe
  */
+int8_t getSignalIndex(const char* tag);
 
-struct SignalMap {
-    const char* tag;
-    const char* name;
-};
-
-// Tabla de señales
-static const SignalMap signalTable[] = {
-    {"ecg_clean",             "Clean ECG"},
-    {"0",                     "Clean ECG"},
-    {"ecg_60hz_noised",       "ECG with 60Hz noise"},
-    {"1",                     "ECG with 60Hz noise"},
-    {"ecg_320hz_noised",      "ECG with 320Hz noise"},
-    {"2",                     "ECG with 320Hz noise"},
-    {"ecg_white_noise",       "ECG with white noise"},
-    {"3",                     "ECG with white noise"},
-    {"white_noise",           "White noise"},
-    {"4",                     "White noise"},
-};
-
-////////////////////////////////////////////////////////////////////////////////////////////////
-////////////////////////////////////////////////////////////////////////////////////////////////
-////////////////////////////////////////////////////////////////////////////////////////////////
-////////////////////////////////////////////////////////////////////////////////////////////////
-
-
+/**
+ * @brief Carga una señal de prueba en un buffer y la normaliza
+ *
+ * @param buffer Buffer de salida (al menos numSamples elementos)
+ * @param tag Etiqueta de la señal (ver getSignalIndex)
+ * @param numSamples Muestras a cargar (máximo maxSamplesNum)
+ * @return true si la señal se cargó correctamente
+ */
+bool loadSignal(float32_t* buffer, const char* tag, uint16_t numSamples = 1500);
 
 /**
  * @brief Obtiene el nombre descriptivo de una señal.
@@ -1617,27 +133,11 @@ static const SignalMap signalTable[] = {
  * @param tag Etiqueta de la señal.
  * @return Nombre descriptivo
  */
-inline const char* getSignalName(const char* tag) {
-    if (!tag) return "Desconocida";
-
-    for (unsigned int i = 0; i < sizeof(signalTable) / sizeof(signalTable[0]); i++) {
-        if (strcasecmp(tag, signalTable[i].tag) == 0) {
-            return signalTable[i].name;
-        }
-    }
-    
-    return "Desconocida";
-}
+const char* getSignalName(const char* tag);
 
 /**
  * @brief Muestra lista de señales disponibles
  */
-inline void printSignals() {
-    Serial.println("Señales disponibles:");
-    Serial.println("  'ecg_clean'  - Clean ECG");
-    Serial.println("  'ecg_60hz_noised' - ECG with 60Hz noise");
-    Serial.println("  'ecg_320hz_noised' - ECG with 320Hz noise");
-    Serial.println("  'ecg_white_noise' - ECG with white noise");
-}
+void printSignals();
 
-#endif // WAVEFORMS_H
\ No newline at end of file
+#endif // WAVEFORMS_H
@@ -107,3 +107,28 @@ float32_t calculateCorrelation(const float32_t* signal1, const float32_t* signal
     float32_t denominator = sqrtf(denom1 * denom2);
     return (denominator > 1e-10f) ? (numerator / denominator) : 0.0f;
 }
+
+/**
+ * @brief Calcula el retardo de grupo de un polinomio en z⁻¹.
+ * 
+ * Derivada de la fase: con P(ω) = Σ p[k]·e^(-jωk) y Q(ω) = Σ k·p[k]·e^(-jωk),
+ * el retardo es Re{Q/P} = (Qr·Pr + Qi·Pi) / |P|².
+ */
+float32_t calculateGroupDelay(const float32_t* coeffs, uint32_t length, float32_t normalizedFrequency) {
+    float32_t w = 2.0f * PI * normalizedFrequency;
+    float32_t pRe = 0.0f, pIm = 0.0f;
+    float32_t qRe = 0.0f, qIm = 0.0f;
+
+    for (uint32_t k = 0; k < length; k++) {
+        float32_t c = cosf(w * k);
+        float32_t s = -sinf(w * k);
+        pRe += coeffs[k] * c;
+        pIm += coeffs[k] * s;
+        qRe += k * coeffs[k] * c;
+        qIm += k * coeffs[k] * s;
+    }
+
+    // En un cero de transmisión la fase no está definida
+    float32_t magnitude = pRe * pRe + pIm * pIm;
+    return (magnitude > 1e-12f) ? (qRe * pRe + qIm * pIm) / magnitude : 0.0f;
+}
@@ -55,6 +55,19 @@ float32_t calculateStdDev(const float32_t* signal, uint32_t length);
  */
 float32_t calculateCorrelation(const float32_t* signal1, const float32_t* signal2, uint32_t length);
 
+/**
+ * @brief Calcula el retardo de grupo de un polinomio P(z) = p[0] + p[1]·z⁻¹ + ... + p[n-1]·z⁻⁽ⁿ⁻¹⁾.
+ * 
+ * Se evalúa como Re{ Σ k·p[k]·e^(-jωk) / Σ p[k]·e^(-jωk) }. El retardo de grupo
+ * de B(z)/A(z) es la diferencia entre el del numerador y el del denominador.
+ * 
+ * @param coeffs              Coeficientes del polinomio en orden natural (p[0] primero).
+ * @param length              Número de coeficientes.
+ * @param normalizedFrequency Frecuencia normalizada f/Fs (0.0 a 0.5).
+ * @return Retardo de grupo en muestras (0 si el polinomio se anula en esa frecuencia).
+ */
+float32_t calculateGroupDelay(const float32_t* coeffs, uint32_t length, float32_t normalizedFrequency);
+
 #ifdef __cplusplus
 }
 #endif
@@ -21,6 +21,25 @@ void printTestHeader(const char* testName) {
     printSeparator();
 }
 
+static uint32_t checkFailures = 0;
+
+void printCheck(bool condition, const char* name) {
+    Serial.print("  ");
+    Serial.print(name);
+    Serial.println(condition ? ": OK" : ": FALLO");
+    if (!condition) {
+        checkFailures++;
+    }
+}
+
+uint32_t getCheckFailures() {
+    return checkFailures;
+}
+
+void printTestResult() {
+    Serial.println(checkFailures == 0 ? "TEST SUPERADO" : "TEST FALLIDO");
+}
+
 PerformanceMetrics testFilterSpeed_Sample(FIRFilter& filter, 
                                           float32_t* testSignal, 
                                           uint32_t signalLength,
@@ -215,6 +234,44 @@ void printQualityMetrics(const QualityMetrics& metrics) {
     }
 }
 
+void printCycleHistogram(const CycleHistogram& histogram, const char* name) {
+    Serial.print("\n--- CICLOS POR LLAMADA: ");
+    Serial.print(name);
+    Serial.println(" ---");
+#if BIOFILTERLIB_PROFILE
+    Serial.print("  Llamadas: ");
+    Serial.println(histogram.getCount());
+
+    Serial.print("  Min / media / max: ");
+    Serial.print(histogram.getMin());
+    Serial.print(" / ");
+    Serial.print(histogram.getMean(), 1);
+    Serial.print(" / ");
+    Serial.println(histogram.getMax());
+
+    Serial.print("  p50 / p99 / p99.9: ");
+    Serial.print(histogram.getPercentile(0.5f));
+    Serial.print(" / ");
+    Serial.print(histogram.getPercentile(0.99f));
+    Serial.print(" / ");
+    Serial.println(histogram.getPercentile(0.999f));
+
+    Serial.print("  Peor llamada: #");
+    Serial.println(histogram.getWorstCall());
+
+    if (histogram.getDeadline() != 0) {
+        Serial.print("  Plazo por muestra: ");
+        Serial.print(histogram.getDeadline());
+        Serial.print(" ciclos, incumplido ");
+        Serial.print(histogram.getOverruns());
+        Serial.println(" veces");
+    }
+#else
+    (void)histogram;
+    Serial.println("  Perfilado desactivado (BIOFILTERLIB_PROFILE = 0)");
+#endif
+}
+
 void testMemoryUsage(uint16_t numTaps, uint16_t blockSize) {
     Serial.println("\n--- ANALISIS DE MEMORIA ---");
     
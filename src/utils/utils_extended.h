@@ -4,6 +4,7 @@
 #include <Arduino.h>
 #include <arm_math.h>
 #include "filters/FIRFilter.h"
+#include "Profiler.h"
 
 /**
  * @brief Estructura para almacenar resultados de pruebas de rendimiento
@@ -36,6 +37,22 @@ void printTestHeader(const char* testName);
  */
 void printSeparator();
 
+/**
+ * @brief Imprime el resultado de una comprobación de test ("  nombre: OK/FALLO")
+ * y cuenta los fallos
+ */
+void printCheck(bool condition, const char* name);
+
+/**
+ * @brief Comprobaciones fallidas desde el inicio del sketch
+ */
+uint32_t getCheckFailures();
+
+/**
+ * @brief Imprime "TEST SUPERADO" o "TEST FALLIDO" según las comprobaciones
+ */
+void printTestResult();
+
 /**
  * @brief Obtiene la RAM libre disponible en el Arduino Due
  */
@@ -78,6 +95,12 @@ void printPerformanceMetrics(const PerformanceMetrics& metrics);
  */
 void printQualityMetrics(const QualityMetrics& metrics);
 
+/**
+ * @brief Imprime la distribución de ciclos por llamada: percentiles, peor llamada y plazo
+ * @param name Nombre de la etapa o del filtro medido
+ */
+void printCycleHistogram(const CycleHistogram& histogram, const char* name);
+
 /**
  * @brief Prueba de consumo de memoria: reporta uso de RAM antes y después
  */
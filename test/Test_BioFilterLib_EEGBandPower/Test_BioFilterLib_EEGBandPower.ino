@@ -0,0 +1,244 @@
+/**
+ * @file Test_BioFilterLib_EEGBandPower.ino
+ * @brief Test de HalfBandDecimator y EEGBandPower
+ * @author Test Suite
+ * @version 1.0.0
+ * @date 2025
+ *
+ * Este test evalúa:
+ * - Que HalfBandDecimator coincide con el FIR completo de 4K-1 coeficientes diezmado a
+ *   mano, multiplicando solo los K no nulos
+ * - Nivel de la cascada elegido para cada banda a 250 Hz
+ * - Un canal por banda con un seno dentro: potencia ~ A²/2 y dominante en su banda
+ * - Que coincide con los mismos pasa-banda a plena frecuencia y es más rápido
+ * - Que bloques de tamaños irregulares dan la misma potencia
+ */
+
+#include <BioFilterLib.h>
+
+// ============================================================================
+// CONFIGURACIÓN DEL TEST
+// ============================================================================
+
+#define SAMPLE_RATE  250
+#define NUM_CHANNELS EEG_NUM_BANDS   // Un seno por banda
+#define NUM_SAMPLES  2500            // 10 s
+#define BLOCK_SIZE   32
+#define AMPLITUDE    20.0f           // µV
+
+const float32_t toneFrequencies[NUM_CHANNELS] = {2.0f, 6.0f, 10.0f, 20.0f, 38.0f};
+
+float32_t eeg[NUM_CHANNELS][NUM_SAMPLES];
+float32_t block[NUM_CHANNELS][BLOCK_SIZE];
+float32_t fullRate[BLOCK_SIZE];
+float32_t decimated[BLOCK_SIZE];
+
+uint32_t seed = 12345;
+
+float32_t noise() {
+    seed = seed * 1664525UL + 1013904223UL;
+    return (int32_t)seed / 2147483648.0f;
+}
+
+void generateEeg() {
+    for (uint8_t c = 0; c < NUM_CHANNELS; c++) {
+        for (uint32_t n = 0; n < NUM_SAMPLES; n++) {
+            float32_t t = (float32_t)n / SAMPLE_RATE;
+            eeg[c][n] = AMPLITUDE * sinf(2.0f * PI * toneFrequencies[c] * t + c) + 2.0f * noise();
+        }
+    }
+}
+
+/**
+ * @brief Procesa todo el registro con bloques de BLOCK_SIZE (el último, incompleto)
+ */
+void runBlocks(EEGBandPower& bands) {
+    float32_t* channels[NUM_CHANNELS];
+    for (uint32_t start = 0; start < NUM_SAMPLES; start += BLOCK_SIZE) {
+        uint32_t n = (NUM_SAMPLES - start < BLOCK_SIZE) ? NUM_SAMPLES - start : BLOCK_SIZE;
+        for (uint8_t c = 0; c < NUM_CHANNELS; c++) {
+            memcpy(block[c], eeg[c] + start, n * sizeof(float32_t));
+            channels[c] = block[c];
+        }
+        bands.processBuffer(channels, n);
+    }
+}
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+void testHalfBand() {
+    printSeparator();
+    Serial.println("  HalfBandDecimator frente al FIR completo diezmado");
+    printSeparator();
+
+    const uint8_t K = 8;
+    float32_t coeffs[K];
+    HalfBandDecimator::design(coeffs, K);
+    HalfBandDecimator halfBand(coeffs, K);
+
+    // FIR completo: ceros en las posiciones pares (salvo el centro) y simétrico
+    float32_t full[4 * K - 1];
+    memset(full, 0, sizeof(full));
+    full[2 * K - 1] = 0.5f;
+    for (uint8_t j = 0; j < K; j++) {
+        full[2 * j] = coeffs[j];
+        full[4 * K - 2 - 2 * j] = coeffs[j];
+    }
+    FIRFilter fir(full, 4 * K - 1, BLOCK_SIZE);
+
+    float32_t error = 0.0f, dcGain = 0.0f;
+    uint32_t produced = 0;
+    for (uint32_t start = 0; start + BLOCK_SIZE <= NUM_SAMPLES; start += BLOCK_SIZE) {
+        memcpy(fullRate, eeg[2] + start, sizeof(fullRate));
+        uint32_t n = halfBand.processBuffer(fullRate, BLOCK_SIZE, decimated);
+        fir.processBuffer(fullRate, fullRate, BLOCK_SIZE);
+        for (uint32_t i = 0; i < n; i++) {
+            error = fmaxf(error, fabsf(decimated[i] - fullRate[2 * i + 1]));
+        }
+        produced += n;
+    }
+    for (uint8_t i = 0; i < 4 * K - 1; i++) {
+        dcGain += full[i];
+    }
+
+    printCheck(produced == (NUM_SAMPLES / BLOCK_SIZE) * BLOCK_SIZE / 2, "Una salida cada 2 muestras");
+    printCheck(error < 1e-4f, "Salida == FIR completo diezmado");
+    printCheck(fabsf(dcGain - 1.0f) < 1e-5f, "Ganancia 1 en continua");
+    printCheck(halfBand.getNumTaps() == 31 && halfBand.getGroupDelay() == 15.0f, "31 coeficientes, retardo 15");
+
+    Serial.println();
+    Serial.print("  MACs por salida, media banda / FIR: "); Serial.print(K);
+    Serial.print(" / "); Serial.println(4 * K - 1);
+    Serial.print("  Error maximo:                   "); Serial.println(error, 7);
+    Serial.print("  Banda util (fraccion de Fs/2):  "); Serial.println(2.0f * HalfBandDecimator::getUsableBandwidth(K), 3);
+}
+
+void testBandPower() {
+    printSeparator();
+    Serial.println("  EEGBandPower: un seno por banda en cada canal");
+    printSeparator();
+
+    EEGBandPower bands(NUM_CHANNELS, SAMPLE_RATE);
+    printCheck(bands.getNumLevels() == 4 &&
+               bands.getLevel(EEG_DELTA) == 4 && bands.getLevel(EEG_THETA) == 3 &&
+               bands.getLevel(EEG_ALPHA) == 2 && bands.getLevel(EEG_BETA) == 1 && bands.getLevel(EEG_GAMMA) == 1,
+               "Niveles: delta 15.6 Hz, theta 31 Hz, alfa 62 Hz, beta y gamma 125 Hz");
+
+    runBlocks(bands);
+
+    float32_t expected = 0.5f * AMPLITUDE * AMPLITUDE;
+    bool levels = true, dominant = true;
+    for (uint8_t c = 0; c < NUM_CHANNELS; c++) {
+        levels = levels && fabsf(bands.getPower(c, c) / expected - 1.0f) < 0.15f;
+        dominant = dominant && bands.getRelativePower(c, c) > 0.8f;
+    }
+    printCheck(levels, "Potencia de la banda del seno ~ A²/2 (+-15 %)");
+    printCheck(dominant, "La banda del seno tiene > 80 % de la potencia");
+
+    // Referencia: los mismos pasa-banda y el mismo suavizado a plena frecuencia
+    float32_t coeffs[EEG_NUM_BANDS][10];
+    IIRFilter* reference[EEG_NUM_BANDS];
+    for (uint8_t b = 0; b < EEG_NUM_BANDS; b++) {
+        EEGBandPower::designBandpass(coeffs[b], bands.getBand(b).low, bands.getBand(b).high, SAMPLE_RATE);
+        reference[b] = new IIRFilter(coeffs[b], 2, BLOCK_SIZE);
+    }
+    float32_t alpha = 1.0f - expf(-1.0f / SAMPLE_RATE);
+    float32_t referencePower[NUM_CHANNELS][EEG_NUM_BANDS];
+    memset(referencePower, 0, sizeof(referencePower));
+
+    uint32_t start = micros();
+    for (uint8_t c = 0; c < NUM_CHANNELS; c++) {
+        for (uint8_t b = 0; b < EEG_NUM_BANDS; b++) {
+            reference[b]->reset();
+            for (uint32_t s = 0; s + BLOCK_SIZE <= NUM_SAMPLES; s += BLOCK_SIZE) {
+                reference[b]->processBuffer(eeg[c] + s, fullRate, BLOCK_SIZE);
+                float32_t p = referencePower[c][b];
+                for (uint32_t i = 0; i < BLOCK_SIZE; i++) {
+                    p += alpha * (fullRate[i] * fullRate[i] - p);
+                }
+                referencePower[c][b] = p;
+            }
+        }
+    }
+    uint32_t fullTime = micros() - start;
+
+    bands.reset();
+    start = micros();
+    runBlocks(bands);
+    uint32_t cascadeTime = micros() - start;
+
+    float32_t worst = 0.0f;
+    for (uint8_t c = 0; c < NUM_CHANNELS; c++) {
+        worst = fmaxf(worst, fabsf(bands.getPower(c, c) / referencePower[c][c] - 1.0f));
+    }
+    printCheck(worst < 0.1f, "Igual que los pasa-banda a plena frecuencia (+-10 %)");
+    printCheck(cascadeTime < fullTime, "Cascada mas rapida que plena frecuencia");
+
+    Serial.println();
+    Serial.print("  Potencia esperada (uV^2):       "); Serial.println(expected, 1);
+    for (uint8_t c = 0; c < NUM_CHANNELS; c++) {
+        Serial.print("  Canal "); Serial.print(c);
+        Serial.print(" cascada / referencia:  "); Serial.print(bands.getPower(c, c), 1);
+        Serial.print(" / "); Serial.println(referencePower[c][c], 1);
+    }
+    Serial.print("  Tiempo cascada / plena:         "); Serial.print(cascadeTime);
+    Serial.print(" / "); Serial.println(fullTime);
+    Serial.print("  RAM (bytes):                    "); Serial.println(bands.getMemoryUsage());
+    Serial.print("  Retardo delta (muestras):       "); Serial.println(bands.getGroupDelay(EEG_DELTA), 0);
+
+    for (uint8_t b = 0; b < EEG_NUM_BANDS; b++) {
+        delete reference[b];
+    }
+}
+
+void testChunks() {
+    printSeparator();
+    Serial.println("  Bloques irregulares");
+    printSeparator();
+
+    EEGBandPower whole(1, SAMPLE_RATE);
+    EEGBandPower chunked(1, SAMPLE_RATE);
+    whole.processChannel(0, eeg[2], NUM_SAMPLES);
+
+    const uint32_t sizes[] = {1, 7, 32, 13, 64, 3, 100};
+    uint32_t consumed = 0, k = 0;
+    while (consumed < NUM_SAMPLES) {
+        uint32_t n = sizes[k++ % 7];
+        if (n > NUM_SAMPLES - consumed) {
+            n = NUM_SAMPLES - consumed;
+        }
+        chunked.processChannel(0, eeg[2] + consumed, n);
+        consumed += n;
+    }
+
+    bool same = true;
+    for (uint8_t b = 0; b < EEG_NUM_BANDS; b++) {
+        same = same && whole.getPower(0, b) == chunked.getPower(0, b);
+    }
+    printCheck(same, "Bloques irregulares == un solo bloque");
+}
+
+// ============================================================================
+// SETUP Y LOOP
+// ============================================================================
+
+void setup() {
+    Serial.begin(115200);
+    while (!Serial && millis() < 5000);
+
+    printTestHeader("TEST EEGBandPower - BioFilterLib");
+
+    generateEeg();
+    testHalfBand();
+    testBandPower();
+    testChunks();
+
+    Serial.println();
+    printTestResult();
+}
+
+void loop() {
+    delay(1000);
+}
@@ -0,0 +1,208 @@
+/**
+ * @file Test_BioFilterLib_EMG.ino
+ * @brief Test de EMGEnvelope: envolvente y RMS a 100 Hz a partir de EMG a 1 kHz
+ * @author Test Suite
+ * @version 1.0.0
+ * @date 2025
+ *
+ * Este test evalúa:
+ * - Que la envolvente coincide con rectificar toda la señal, filtrarla con FIRFilter y
+ *   quedarse con una muestra de cada 10 (la versión "a mano" a plena frecuencia)
+ * - Que la RMS coincide con la RMS directa de las últimas 100 muestras
+ * - Que bloques de tamaños irregulares dan la misma salida
+ * - Que la envolvente sigue la amplitud de las contracciones
+ * - Tiempo y memoria frente a la versión a plena frecuencia
+ */
+
+#include <BioFilterLib.h>
+
+// ============================================================================
+// CONFIGURACIÓN DEL TEST
+// ============================================================================
+
+#define SAMPLE_RATE  1000
+#define OUTPUT_RATE  100
+#define DECIMATION   (SAMPLE_RATE / OUTPUT_RATE)
+#define NUM_SAMPLES  6000          // 6 s: reposo, contracción débil y fuerte
+#define NUM_OUTPUTS  (NUM_SAMPLES / DECIMATION)
+#define BLOCK_SIZE   32
+
+float32_t emg[NUM_SAMPLES];
+float32_t rectified[NUM_SAMPLES];
+
+float32_t envelope[NUM_OUTPUTS + 1];
+float32_t rms[NUM_OUTPUTS + 1];
+float32_t chunkEnvelope[NUM_OUTPUTS + 1];
+float32_t chunkRms[NUM_OUTPUTS + 1];
+
+uint32_t seed = 12345;
+
+float32_t noise() {
+    seed = seed * 1664525UL + 1013904223UL;
+    return (int32_t)seed / 2147483648.0f;
+}
+
+/**
+ * @brief EMG sintético: ruido de media cero modulado por la fuerza de la contracción
+ */
+void generateEmg() {
+    for (uint32_t n = 0; n < NUM_SAMPLES; n++) {
+        float32_t t = (float32_t)n / SAMPLE_RATE;
+        float32_t a = 0.02f;
+        if (t >= 1.0f && t < 2.5f) {
+            a = 0.2f;
+        } else if (t >= 3.5f && t < 5.0f) {
+            a = 0.8f;
+        }
+        // Suma de 4 uniformes: aproximadamente gaussiano, varianza 4/3
+        emg[n] = a * (noise() + noise() + noise() + noise()) * 0.866f;
+    }
+}
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+void testReference() {
+    printSeparator();
+    Serial.println("  EMGEnvelope frente a rectificar + FIRFilter + diezmar");
+    printSeparator();
+
+    EMGEnvelope emgEnvelope(SAMPLE_RATE, OUTPUT_RATE);
+    uint32_t start = micros();
+    uint32_t produced = emgEnvelope.processBuffer(emg, NUM_SAMPLES, envelope, rms);
+    uint32_t fusedTime = micros() - start;
+    printCheck(produced == NUM_OUTPUTS, "Una salida cada 10 muestras");
+    printCheck(emgEnvelope.getDecimation() == DECIMATION && emgEnvelope.getRmsWindow() == 100,
+               "Diezmado 10 y ventana RMS de 100 muestras");
+
+    // Versión a plena frecuencia: rectificado en un buffer, FIR entero y diezmado a mano
+    uint16_t taps = emgEnvelope.getNumTaps();
+    float32_t* coeffs = new float32_t[taps];
+    memcpy(coeffs, emgEnvelope.getCoefficients(), taps * sizeof(float32_t));
+    FIRFilter fir(coeffs, taps, BLOCK_SIZE);
+    start = micros();
+    for (uint32_t n = 0; n < NUM_SAMPLES; n++) {
+        rectified[n] = fabsf(emg[n]);
+    }
+    for (uint32_t b = 0; b + BLOCK_SIZE <= NUM_SAMPLES; b += BLOCK_SIZE) {
+        fir.processBuffer(rectified + b, rectified + b, BLOCK_SIZE);
+    }
+    uint32_t fullTime = micros() - start;
+
+    float32_t envelopeError = 0.0f;
+    for (uint32_t k = 0; k < NUM_OUTPUTS && DECIMATION * k + DECIMATION <= NUM_SAMPLES / BLOCK_SIZE * BLOCK_SIZE; k++) {
+        envelopeError = fmaxf(envelopeError, fabsf(envelope[k] - rectified[DECIMATION * k + DECIMATION - 1]));
+    }
+    printCheck(envelopeError < 1e-5f, "Envolvente == version a plena frecuencia");
+
+    // RMS directa de las últimas 100 muestras en cada instante de salida
+    float32_t rmsError = 0.0f;
+    for (uint32_t k = 10; k < NUM_OUTPUTS; k++) {
+        uint32_t last = DECIMATION * k + DECIMATION - 1;
+        float32_t sum = 0.0f;
+        for (uint32_t i = 0; i < 100; i++) {
+            sum += emg[last - i] * emg[last - i];
+        }
+        float32_t reference = sqrtf(sum / 100.0f);
+        rmsError = fmaxf(rmsError, fabsf(rms[k] - reference) / (reference + 1e-3f));
+    }
+    printCheck(rmsError < 1e-3f, "RMS == RMS directa de 100 muestras (error relativo)");
+    printCheck(fusedTime < fullTime, "Mas rapida que la version a plena frecuencia");
+
+    uint32_t fullMemory = fir.getMemoryUsage() + NUM_SAMPLES * sizeof(float32_t);
+    printCheck(emgEnvelope.getMemoryUsage() < fullMemory, "Menos RAM que la version a plena frecuencia");
+
+    Serial.println();
+    Serial.print("  Coeficientes del pasa-bajas:    "); Serial.println(taps);
+    Serial.print("  MACs por muestra de entrada:    "); Serial.println((float32_t)taps / DECIMATION, 1);
+    Serial.print("  Error envolvente / RMS:         "); Serial.print(envelopeError, 8);
+    Serial.print(" / "); Serial.println(rmsError, 6);
+    Serial.print("  Tiempo fusionado / completo:    "); Serial.print(fusedTime);
+    Serial.print(" / "); Serial.println(fullTime);
+    Serial.print("  RAM fusionado / completo (B):   "); Serial.print(emgEnvelope.getMemoryUsage());
+    Serial.print(" / "); Serial.println(fullMemory);
+
+    delete[] coeffs;
+}
+
+void testChunks() {
+    printSeparator();
+    Serial.println("  Bloques irregulares y salidas opcionales");
+    printSeparator();
+
+    EMGEnvelope chunked(SAMPLE_RATE, OUTPUT_RATE);
+    const uint32_t sizes[] = {1, 7, 32, 13, 64, 3, 100};
+    uint32_t consumed = 0, total = 0, k = 0;
+    bool bounded = true;
+    while (consumed < NUM_SAMPLES) {
+        uint32_t n = sizes[k++ % 7];
+        if (n > NUM_SAMPLES - consumed) {
+            n = NUM_SAMPLES - consumed;
+        }
+        uint32_t produced = chunked.processBuffer(emg + consumed, n, chunkEnvelope + total, chunkRms + total);
+        bounded = bounded && produced <= chunked.getMaxOutputLength(n);
+        total += produced;
+        consumed += n;
+    }
+    printCheck(bounded, "getMaxOutputLength() es cota superior");
+    printCheck(total == NUM_OUTPUTS &&
+               memcmp(chunkEnvelope, envelope, NUM_OUTPUTS * sizeof(float32_t)) == 0 &&
+               memcmp(chunkRms, rms, NUM_OUTPUTS * sizeof(float32_t)) == 0,
+               "Bloques irregulares == un solo bloque");
+
+    // Solo RMS: no hace falta destino para la envolvente
+    EMGEnvelope rmsOnly(SAMPLE_RATE, OUTPUT_RATE);
+    uint32_t produced = rmsOnly.processBuffer(emg, NUM_SAMPLES, nullptr, chunkRms);
+    printCheck(produced == NUM_OUTPUTS && memcmp(chunkRms, rms, NUM_OUTPUTS * sizeof(float32_t)) == 0,
+               "Envolvente nullptr: misma RMS");
+}
+
+void testTracking() {
+    printSeparator();
+    Serial.println("  Seguimiento de la contraccion");
+    printSeparator();
+
+    // Media en la parte estable de cada tramo (medio segundo tras el cambio)
+    float32_t rest = 0.0f, weak = 0.0f, strong = 0.0f, strongRms = 0.0f;
+    for (uint32_t k = 50; k < 100; k++) rest += envelope[k] / 50;
+    for (uint32_t k = 175; k < 250; k++) weak += envelope[k] / 75;
+    for (uint32_t k = 400; k < 500; k++) {
+        strong += envelope[k] / 100;
+        strongRms += rms[k] / 100;
+    }
+
+    printCheck(fabsf(strong / weak - 4.0f) < 0.4f, "Envolvente proporcional a la amplitud (x4)");
+    printCheck(weak > 5.0f * rest, "Contraccion debil distinguible del reposo");
+    // Ruido gaussiano: media de |x| = sigma·sqrt(2/pi), RMS = sigma
+    printCheck(fabsf(strongRms - 0.8f) < 0.08f, "RMS de la contraccion fuerte ~ 0.8");
+
+    Serial.println();
+    Serial.print("  Envolvente reposo/debil/fuerte: "); Serial.print(rest, 4);
+    Serial.print(" / "); Serial.print(weak, 4);
+    Serial.print(" / "); Serial.println(strong, 4);
+    Serial.print("  RMS fuerte:                     "); Serial.println(strongRms, 4);
+}
+
+// ============================================================================
+// SETUP Y LOOP
+// ============================================================================
+
+void setup() {
+    Serial.begin(115200);
+    while (!Serial && millis() < 5000);
+
+    printTestHeader("TEST EMGEnvelope - BioFilterLib");
+
+    generateEmg();
+    testReference();
+    testChunks();
+    testTracking();
+
+    Serial.println();
+    printTestResult();
+}
+
+void loop() {
+    delay(1000);
+}
@@ -24,6 +24,8 @@
 #define SAMPLE_RATE 960           // Frecuencia de muestreo (Hz)
 #define TEST_SAMPLES 1000         // Número de muestras a procesar
 #define BLOCK_SIZE 1              // Tamaño de bloque (1 para procesamiento muestra por muestra)
+#define STREAM_BLOCK 32           // Tamaño de bloque del test en streaming
+#define STREAM_SAMPLES (10UL * waveformsNumSamples)  // ~29 s de señal en bucle
 
 // Coeficientes del filtro paso-bajo (fc=40Hz @ fs=960Hz)
 // Diseñado con ventana de Hamming para atenuar ruido de 60Hz
@@ -220,6 +222,75 @@ TestPerformanceMetrics processSignalBuffer(FIRFilter& filter) {
     return metrics;
 }
 
+/**
+ * @brief Estado del sink del test en streaming
+ */
+struct StreamCheck {
+    uint32_t position;      // Muestras recibidas hasta ahora
+    float32_t maxError;     // Máxima diferencia con la salida por buffer
+};
+
+/**
+ * @brief Compara cada bloque en streaming con la salida de processBuffer()
+ */
+void streamSink(const float32_t* block, uint32_t length, void* context) {
+    StreamCheck* check = (StreamCheck*)context;
+    for (uint32_t i = 0; i < length; i++) {
+        uint32_t n = check->position + i;
+        if (n < TEST_SAMPLES) {
+            float32_t diff = fabsf(block[i] - filteredSignal[n]);
+            if (diff > check->maxError) check->maxError = diff;
+        }
+    }
+    check->position += length;
+}
+
+/**
+ * @brief Procesa una señal larga en streaming desde TableSource (memoria de un bloque)
+ *
+ * @details Debe ejecutarse justo después de processSignalBuffer() con un filtro
+ * recién creado: las primeras TEST_SAMPLES muestras deben coincidir con filteredSignal.
+ */
+TestPerformanceMetrics processSignalStreaming(FIRFilter& filter, float32_t* maxError) {
+    TestPerformanceMetrics metrics;
+    float32_t inBlock[STREAM_BLOCK];
+    float32_t outBlock[STREAM_BLOCK];
+    StreamCheck check = {0, 0.0f};
+
+    Serial.println("\n>> Procesando señal en streaming (TableSource)...");
+
+    TableSource source("ecg_60hz_noised", STREAM_SAMPLES);
+
+    metrics.freeRAMBefore = getFreeRAM();
+    uint32_t startTime = micros();
+
+    uint32_t total = processSource(source, filter, inBlock, outBlock, STREAM_BLOCK,
+                                   streamSink, &check);
+
+    uint32_t endTime = micros();
+    metrics.freeRAMAfter = getFreeRAM();
+
+    // El tiempo incluye la decodificación de la tabla, como en una adquisición real
+    metrics.processingTimeMicros = endTime - startTime;
+    float32_t timeInSeconds = metrics.processingTimeMicros / 1000000.0f;
+    metrics.sampleRate = (uint32_t)(total / timeInSeconds);
+    float32_t realTimeRequired = total / (float32_t)SAMPLE_RATE;
+    metrics.cpuUsagePercent = (timeInSeconds / realTimeRequired) * 100.0f;
+
+    *maxError = check.maxError;
+
+    Serial.print("   - Muestras procesadas: ");
+    Serial.println(total);
+    Serial.print("   - Memoria de señal: ");
+    Serial.print(2 * STREAM_BLOCK * sizeof(float32_t));
+    Serial.println(" bytes (dos bloques)");
+    Serial.print("   - Diferencia máxima vs processBuffer: ");
+    Serial.println(check.maxError, 8);
+    Serial.println("   OK: Señal procesada");
+
+    return metrics;
+}
+
 /**
  * @brief Evalúa la calidad del filtrado
  */
@@ -510,6 +581,34 @@ void setup() {
     Serial.println("\n");
     printQualityResults(qualMetrics2);
     
+    // ========================================================================
+    // TEST 3: Procesamiento en streaming
+    // ========================================================================
+    Serial.println("\n");
+    printHeader("TEST 3: PROCESAMIENTO EN STREAMING");
+
+    delete filter;
+    filter = createFilter();
+
+    float32_t streamError = 0.0f;
+    TestPerformanceMetrics perfMetrics3 = processSignalStreaming(*filter, &streamError);
+
+    Serial.print("\n--- Método: Streaming (TableSource + processSource) ---");
+    Serial.print("\n  Tasa alcanzada: ");
+    Serial.print(perfMetrics3.sampleRate);
+    Serial.println(" muestras/s");
+    Serial.print("  CPU (@ ");
+    Serial.print(SAMPLE_RATE);
+    Serial.print(" Hz): ");
+    Serial.print(perfMetrics3.cpuUsagePercent, 2);
+    Serial.println(" %");
+
+    if (streamError < 1e-6f) {
+        Serial.println("  >> OK: La salida en streaming coincide con processBuffer()");
+    } else {
+        Serial.println("  >> ERROR: La salida en streaming difiere de processBuffer()");
+    }
+
     // ========================================================================
     // COMPARACIÓN Y RESUMEN FINAL
     // ========================================================================
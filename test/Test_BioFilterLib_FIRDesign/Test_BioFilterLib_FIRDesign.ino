@@ -0,0 +1,293 @@
+/**
+ * @file Test_BioFilterLib_FIRDesign.ino
+ * @brief Test del diseño de FIR en compilación y en ejecución
+ * @author Test Suite
+ * @version 1.0.0
+ * @date 2025
+ *
+ * Este test evalúa:
+ * - Que la tabla constexpr reproduce los coeficientes pegados en el test de FIRFilter
+ * - Que design() en ejecución da exactamente la misma tabla
+ * - Resintonizar un FIRFilter reescribiendo sus coeficientes
+ * - Pasa-altas, pasa-banda, banda eliminada, media banda, diferenciador y Hilbert
+ * - Kaiser (beta y número de coeficientes) y equirrizado de Parks-McClellan
+ * - Conversión a fase mínima (misma magnitud, menos retardo) e informe de latencia
+ * - Parámetros no válidos
+ */
+
+#include <BioFilterLib.h>
+
+// ============================================================================
+// CONFIGURACIÓN DEL TEST
+// ============================================================================
+
+#define SAMPLE_RATE  960
+#define NUM_TAPS     51
+#define BLOCK_SIZE   32
+#define NUM_SAMPLES  960
+
+// Pasa-bajas de 50 Hz con Hamming, generado al compilar
+static constexpr FIRTable<NUM_TAPS> LOWPASS =
+    FIRDesign::table<NUM_TAPS>(FIRDesign::lowpassSpec(50.0 / SAMPLE_RATE));
+static constexpr FIRTable<31> HALFBAND = FIRDesign::table<31>(FIRDesign::halfbandSpec());
+static constexpr FIRTable<31> HILBERT = FIRDesign::table<31>(FIRDesign::hilbertSpec(FIRDesign::WINDOW_BLACKMAN));
+static constexpr FIRTable<31> DIFFERENTIATOR = FIRDesign::table<31>(FIRDesign::differentiatorSpec());
+static_assert(LOWPASS.size() == NUM_TAPS, "FIRTable::size()");
+static_assert(FIRDesign::kaiserTaps(60.0, 0.05) == 75, "kaiserTaps(60 dB, 0.05)");
+
+// Los mismos coeficientes que Test_BioFilterLib_FIR (calculados fuera con Hamming)
+const float32_t reference[NUM_TAPS] = {
+    +0.00096226f, +0.00110652f, +0.00123488f, +0.00128605f, +0.00115012f, +0.00068979f, -0.00022373f, -0.00166613f,
+    -0.00361514f, -0.00591523f, -0.00826092f, -0.01020548f, -0.01119776f, -0.01064514f, -0.00799553f, -0.00282748f,
+    +0.00506537f, +0.01560960f, +0.02841897f, +0.04280137f, +0.05780805f, +0.07232126f, +0.08517038f, +0.09526185f,
+    +0.10170564f, +0.10392083f, +0.10170564f, +0.09526185f, +0.08517038f, +0.07232126f, +0.05780805f, +0.04280137f,
+    +0.02841897f, +0.01560960f, +0.00506537f, -0.00282748f, -0.00799553f, -0.01064514f, -0.01119776f, -0.01020548f,
+    -0.00826092f, -0.00591523f, -0.00361514f, -0.00166613f, -0.00022373f, +0.00068979f, +0.00115012f, +0.00128605f,
+    +0.00123488f, +0.00110652f, +0.00096226f
+};
+
+float32_t coeffs[NUM_TAPS];
+float32_t minimum[NUM_TAPS];
+float32_t signal[NUM_SAMPLES];
+float32_t output[NUM_SAMPLES];
+
+float32_t magnitudeAt(const float32_t* c, uint16_t numTaps, float32_t hz) {
+    return FIRDesign::getMagnitude(c, numTaps, hz / SAMPLE_RATE);
+}
+
+/**
+ * @brief Amplitud de salida de un FIRFilter ante un seno de amplitud 1 (segundo tramo)
+ */
+float32_t filterAmplitude(FIRFilter& filter, float32_t hz) {
+    for (uint32_t n = 0; n < NUM_SAMPLES; n++) {
+        signal[n] = sinf(2.0f * PI * hz * n / SAMPLE_RATE);
+    }
+    filter.reset();
+    for (uint32_t n = 0; n < NUM_SAMPLES; n += BLOCK_SIZE) {
+        filter.processBuffer(signal + n, output + n, BLOCK_SIZE);
+    }
+    float32_t peak = 0.0f;
+    for (uint32_t n = NUM_SAMPLES / 2; n < NUM_SAMPLES; n++) {
+        peak = fmaxf(peak, fabsf(output[n]));
+    }
+    return peak;
+}
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+void testCompileTime() {
+    printSeparator();
+    Serial.println("  Tabla constexpr y diseño en ejecución");
+    printSeparator();
+
+    float32_t error = 0.0f;
+    for (uint16_t i = 0; i < NUM_TAPS; i++) {
+        error = fmaxf(error, fabsf(LOWPASS.coeffs[i] - reference[i]));
+    }
+    printCheck(error < 1e-7f, "table<51>(lowpassSpec(50/960)) == coeficientes de Python");
+
+    printCheck(FIRDesign::design(coeffs, NUM_TAPS, FIRDesign::lowpassSpec(50.0 / SAMPLE_RATE)), "design() en ejecución");
+    printCheck(memcmp(coeffs, LOWPASS.coeffs, sizeof(coeffs)) == 0, "Misma FIRSpec: ejecución == compilación bit a bit");
+
+    FIRFilter filter(LOWPASS.coeffs, NUM_TAPS, BLOCK_SIZE);
+    float32_t pass = filterAmplitude(filter, 10.0f);
+    float32_t stop = filterAmplitude(filter, 150.0f);
+    printCheck(fabsf(pass - 1.0f) < 0.01f && stop < 0.01f, "FIRFilter con la tabla en flash: pasa 10 Hz, corta 150 Hz");
+
+    Serial.println();
+    Serial.print("  Error frente a la tabla pegada: "); Serial.println(error, 9);
+    Serial.print("  10 Hz / 150 Hz:                 "); Serial.print(pass, 4);
+    Serial.print(" / "); Serial.println(stop, 5);
+}
+
+void testRetune() {
+    printSeparator();
+    Serial.println("  Resintonizar en caliente");
+    printSeparator();
+
+    FIRDesign::lowpass(coeffs, NUM_TAPS, 100.0f / SAMPLE_RATE);
+    FIRFilter filter(coeffs, NUM_TAPS, BLOCK_SIZE);
+    float32_t before = filterAmplitude(filter, 60.0f);
+    FIRDesign::lowpass(coeffs, NUM_TAPS, 25.0f / SAMPLE_RATE);
+    float32_t after = filterAmplitude(filter, 60.0f);
+    printCheck(before > 0.95f && after < 0.02f, "Corte de 100 a 25 Hz: 60 Hz pasa y luego se atenúa");
+
+    FIRDesign::highpass(coeffs, NUM_TAPS, 40.0f / SAMPLE_RATE, FIRDesign::WINDOW_BLACKMAN);
+    printCheck(magnitudeAt(coeffs, NUM_TAPS, 0.0f) < 1e-3f && fabsf(magnitudeAt(coeffs, NUM_TAPS, 200.0f) - 1.0f) < 0.01f,
+               "Pasa-altas 40 Hz: 0 en DC, 1 en 200 Hz");
+
+    FIRDesign::bandpass(coeffs, NUM_TAPS, 80.0f / SAMPLE_RATE, 200.0f / SAMPLE_RATE);
+    printCheck(magnitudeAt(coeffs, NUM_TAPS, 140.0f) > 0.98f && magnitudeAt(coeffs, NUM_TAPS, 0.0f) < 0.01f &&
+               magnitudeAt(coeffs, NUM_TAPS, 350.0f) < 0.01f, "Pasa-banda 80-200 Hz");
+
+    FIRDesign::bandstop(coeffs, NUM_TAPS, 20.0f / SAMPLE_RATE, 100.0f / SAMPLE_RATE, FIRDesign::WINDOW_KAISER, 5.0f);
+    printCheck(magnitudeAt(coeffs, NUM_TAPS, 60.0f) < 0.01f && fabsf(magnitudeAt(coeffs, NUM_TAPS, 0.0f) - 1.0f) < 0.01f &&
+               fabsf(magnitudeAt(coeffs, NUM_TAPS, 300.0f) - 1.0f) < 0.01f, "Banda eliminada 20-100 Hz (Kaiser)");
+
+    Serial.println();
+    Serial.print("  60 Hz antes / despues:          "); Serial.print(before, 4);
+    Serial.print(" / "); Serial.println(after, 5);
+}
+
+void testSpecialTypes() {
+    printSeparator();
+    Serial.println("  Media banda, diferenciador y Hilbert");
+    printSeparator();
+
+    bool zeros = true;
+    for (uint16_t i = 0; i < 31; i++) {
+        int16_t t = (int16_t)i - 15;
+        if (t != 0 && t % 2 == 0) {
+            zeros = zeros && HALFBAND.coeffs[i] == 0.0f;
+        }
+    }
+    printCheck(zeros && HALFBAND.coeffs[15] == 0.5f, "Media banda: central 0.5 y pares a cero");
+    printCheck(fabsf(FIRDesign::getMagnitude(HALFBAND.coeffs, 31, 0.0f) - 1.0f) < 1e-5f &&
+               fabsf(FIRDesign::getMagnitude(HALFBAND.coeffs, 31, 0.25f) - 0.5f) < 1e-3f, "Media banda: 1 en DC, 0.5 en Fs/4");
+
+    bool antisymmetric = HILBERT.coeffs[15] == 0.0f;
+    for (uint16_t i = 0; i < 31; i++) {
+        antisymmetric = antisymmetric && fabsf(HILBERT.coeffs[i] + HILBERT.coeffs[30 - i]) < 1e-7f;
+    }
+    printCheck(antisymmetric, "Hilbert: antisimétrico con central nulo");
+    printCheck(fabsf(FIRDesign::getMagnitude(HILBERT.coeffs, 31, 0.25f) - 1.0f) < 0.01f, "Hilbert: ganancia 1 en Fs/4");
+
+    // Derivada de un seno: ω·cos(ωn), con el retardo de 15 muestras (la ventana aleja la
+    // ganancia de ω en las frecuencias muy bajas, así que se prueba en 0.0625·Fs)
+    FIRFilter differentiator(DIFFERENTIATOR.coeffs, 31, BLOCK_SIZE);
+    float32_t w = 2.0f * PI * 0.0625f;
+    for (uint32_t n = 0; n < NUM_SAMPLES; n++) {
+        signal[n] = sinf(w * n);
+    }
+    for (uint32_t n = 0; n < NUM_SAMPLES; n += BLOCK_SIZE) {
+        differentiator.processBuffer(signal + n, output + n, BLOCK_SIZE);
+    }
+    float32_t error = 0.0f;
+    for (uint32_t n = 100; n < NUM_SAMPLES; n++) {
+        error = fmaxf(error, fabsf(output[n] - w * cosf(w * (n - 15.0f))));
+    }
+    printCheck(error < 0.01f * w, "Diferenciador: d/dn sin(wn) == w·cos(wn)");
+
+    Serial.println();
+    Serial.print("  Error del diferenciador:        "); Serial.println(error, 6);
+}
+
+void testKaiserAndRemez() {
+    printSeparator();
+    Serial.println("  Kaiser y Parks-McClellan");
+    printSeparator();
+
+    printCheck(fabsf(FIRDesign::kaiserBeta(60.0) - 5.65326) < 1e-4 && fabsf(FIRDesign::kaiserBeta(30.0) - 2.11662) < 1e-4 &&
+               FIRDesign::kaiserBeta(20.0) == 0.0, "kaiserBeta(): 60, 30 y 20 dB");
+
+    // Pasa-bajas 0..40 Hz, rechazo 80..480 Hz, mismo número de coeficientes que Hamming
+    const float32_t bands[] = {0.0f, 40.0f / SAMPLE_RATE, 80.0f / SAMPLE_RATE, 0.5f};
+    const float32_t desired[] = {1.0f, 0.0f};
+    const float32_t weights[] = {1.0f, 10.0f};
+    float32_t ripple = 0.0f;
+    bool ok = FIRDesign::remez(coeffs, NUM_TAPS, bands, desired, weights, 2, &ripple);
+    printCheck(ok && ripple > 0.0f, "remez() converge");
+
+    float32_t stopRemez = 0.0f, stopHamming = 0.0f, passRemez = 0.0f;
+    for (float32_t hz = 80.0f; hz <= 480.0f; hz += 1.0f) {
+        stopRemez = fmaxf(stopRemez, magnitudeAt(coeffs, NUM_TAPS, hz));
+        stopHamming = fmaxf(stopHamming, magnitudeAt(LOWPASS.coeffs, NUM_TAPS, hz));
+    }
+    for (float32_t hz = 0.0f; hz <= 40.0f; hz += 1.0f) {
+        passRemez = fmaxf(passRemez, fabsf(magnitudeAt(coeffs, NUM_TAPS, hz) - 1.0f));
+    }
+    printCheck(fabsf(stopRemez - ripple / 10.0f) < 1e-4f && fabsf(passRemez - ripple) < 1e-4f,
+               "Rizado en la rejilla == delta / peso");
+    printCheck(stopRemez < stopHamming, "Equirrizado: más rechazo que Hamming con 51 coeficientes");
+
+    bool symmetric = true;
+    for (uint16_t i = 0; i < NUM_TAPS; i++) {
+        symmetric = symmetric && fabsf(coeffs[i] - coeffs[NUM_TAPS - 1 - i]) < 1e-6f;
+    }
+    printCheck(symmetric, "remez(): coeficientes simétricos (fase lineal)");
+
+    Serial.println();
+    Serial.print("  Rechazo Remez / Hamming (dB):   "); Serial.print(20.0f * log10f(stopRemez), 2);
+    Serial.print(" / "); Serial.println(20.0f * log10f(stopHamming), 2);
+    Serial.print("  Rizado en la banda de paso:     "); Serial.println(passRemez, 5);
+}
+
+void testMinimumPhase() {
+    printSeparator();
+    Serial.println("  Fase mínima y latencia");
+    printSeparator();
+
+    printCheck(FIRDesign::minimumPhase(minimum, NUM_TAPS, LOWPASS.coeffs, NUM_TAPS), "minimumPhase() de 51 coeficientes");
+    float32_t error = 0.0f;
+    for (float32_t hz = 0.0f; hz <= 480.0f; hz += 2.0f) {
+        error = fmaxf(error, fabsf(magnitudeAt(minimum, NUM_TAPS, hz) - magnitudeAt(LOWPASS.coeffs, NUM_TAPS, hz)));
+    }
+    printCheck(error < 1e-3f, "Misma magnitud que la fase lineal");
+
+    FIRLatency linear = FIRDesign::getLatency(LOWPASS.coeffs, NUM_TAPS, 40.0f / SAMPLE_RATE);
+    FIRLatency fast = FIRDesign::getLatency(minimum, NUM_TAPS, 40.0f / SAMPLE_RATE);
+    printCheck(fabsf(linear.groupDelay - 25.0f) < 0.01f && fabsf(linear.maxGroupDelay - 25.0f) < 0.01f &&
+               linear.peakDelay == 25, "Fase lineal: 25 muestras en toda la banda de paso");
+    printCheck(fast.groupDelay < 0.5f * linear.groupDelay && fast.peakDelay < linear.peakDelay,
+               "Fase mínima: menos de la mitad de retardo");
+
+    FIRFilter filter(minimum, NUM_TAPS, BLOCK_SIZE);
+    printCheck(fabsf(filter.getGroupDelay() - fast.groupDelay) < 1e-3f, "FIRFilter::getGroupDelay() == informe");
+
+    // Truncada a 31 coeficientes: la cola descartada apenas cambia el rechazo
+    float32_t truncated[31];
+    FIRDesign::minimumPhase(truncated, 31, LOWPASS.coeffs, NUM_TAPS);
+    float32_t stop = 0.0f;
+    for (float32_t hz = 80.0f; hz <= 480.0f; hz += 2.0f) {
+        stop = fmaxf(stop, magnitudeAt(truncated, 31, hz));
+    }
+    FIRLatency shortLatency = FIRDesign::getLatency(truncated, 31, 40.0f / SAMPLE_RATE);
+    printCheck(stop < 0.02f && shortLatency.groupDelay < fast.groupDelay + 1.0f, "31 coeficientes: rechazo > 34 dB desde 80 Hz");
+    printCheck(!FIRDesign::minimumPhase(truncated, 60, LOWPASS.coeffs, NUM_TAPS), "No alarga el filtro");
+
+    Serial.println();
+    Serial.print("  Retardo lineal / minimo (DC):   "); Serial.print(linear.groupDelay, 2);
+    Serial.print(" / "); Serial.println(fast.groupDelay, 2);
+    Serial.print("  Retardo maximo en 0-40 Hz:      "); Serial.println(fast.maxGroupDelay, 2);
+    Serial.print("  Rechazo con 31 taps (dB):       "); Serial.println(20.0f * log10f(stop), 2);
+}
+
+void testInvalid() {
+    printSeparator();
+    Serial.println("  Parámetros no válidos");
+    printSeparator();
+
+    const float32_t bands[] = {0.0f, 0.2f, 0.1f, 0.5f};
+    const float32_t desired[] = {1.0f, 0.0f};
+    printCheck(!FIRDesign::highpass(coeffs, 50, 0.1f), "Pasa-altas con número par de coeficientes");
+    printCheck(!FIRDesign::design(coeffs, 0, FIRDesign::lowpassSpec(0.1)), "Cero coeficientes");
+    printCheck(!FIRDesign::remez(coeffs, 50, bands, desired, nullptr, 2), "remez() con número par");
+    printCheck(!FIRDesign::remez(coeffs, 51, bands, desired, nullptr, 2), "remez() con bandas solapadas");
+}
+
+// ============================================================================
+// SETUP Y LOOP
+// ============================================================================
+
+void setup() {
+    Serial.begin(115200);
+    while (!Serial && millis() < 5000);
+
+    printTestHeader("TEST FIRDesign - BioFilterLib");
+
+    testCompileTime();
+    testRetune();
+    testSpecialTypes();
+    testKaiserAndRemez();
+    testMinimumPhase();
+    testInvalid();
+
+    Serial.println();
+    printTestResult();
+}
+
+void loop() {
+    delay(1000);
+}
@@ -0,0 +1,175 @@
+/**
+ * @file Test_BioFilterLib_FilterChain.ino
+ * @brief Test de FilterChain: notch IIR → pasa-bajas FIR → suavizado wavelet
+ * @author Test Suite
+ * @version 1.0.0
+ * @date 2025
+ *
+ * Este test evalúa:
+ * - Que la cadena por bloques produce la misma salida que aplicar cada filtro
+ *   sobre la señal completa con arrays intermedios
+ * - Que processSample() de la cadena coincide con processBuffer()
+ * - Retardo de grupo total (FIR de fase lineal = (N-1)/2 muestras)
+ * - Memoria de la cadena frente a los arrays intermedios de la versión manual
+ * - Tiempo de procesamiento de ambas versiones
+ *
+ * Usa la señal ECG con ruido de 60 Hz de Waveforms.h (960 Hz)
+ */
+
+#include <BioFilterLib.h>
+
+// ============================================================================
+// CONFIGURACIÓN DEL TEST
+// ============================================================================
+
+#define SAMPLE_RATE 960           // Frecuencia de muestreo (Hz)
+#define NUM_SAMPLES 2000          // Muestras a procesar
+#define BLOCK_SIZE 32             // Bloque de la cadena y de los filtros
+#define FILTERTAPS 51
+
+// Notch 60 Hz, Q = 30 (scipy.signal.iirnotch), a1/a2 negados para CMSIS-DSP
+float32_t notchCoeffs[5] = {
+    0.99349748f, -1.83574398f,  0.99349748f,
+    1.83574398f, -0.98699496f
+};
+
+// Pasa-bajas fc = 40 Hz, ventana de Hamming (el mismo de Test_BioFilterLib_FIR)
+float32_t lowpassCoeffs[FILTERTAPS] = {
+    +0.00096226f, +0.00110652f, +0.00123488f, +0.00128605f, +0.00115012f, +0.00068979f, -0.00022373f, -0.00166613f,
+    -0.00361514f, -0.00591523f, -0.00826092f, -0.01020548f, -0.01119776f, -0.01064514f, -0.00799553f, -0.00282748f,
+    +0.00506537f, +0.01560960f, +0.02841897f, +0.04280137f, +0.05780805f, +0.07232126f, +0.08517038f, +0.09526185f,
+    +0.10170564f, +0.10392083f, +0.10170564f, +0.09526185f, +0.08517038f, +0.07232126f, +0.05780805f, +0.04280137f,
+    +0.02841897f, +0.01560960f, +0.00506537f, -0.00282748f, -0.00799553f, -0.01064514f, -0.01119776f, -0.01020548f,
+    -0.00826092f, -0.00591523f, -0.00361514f, -0.00166613f, -0.00022373f, +0.00068979f, +0.00115012f, +0.00128605f,
+    +0.00123488f, +0.00110652f, +0.00096226f
+};
+
+// ============================================================================
+// VARIABLES GLOBALES
+// ============================================================================
+
+float32_t cleanSignal[NUM_SAMPLES];
+float32_t noisySignal[NUM_SAMPLES];
+float32_t chainOutput[NUM_SAMPLES];
+float32_t manualOutput[NUM_SAMPLES];
+
+float32_t maxDifference(const float32_t* a, const float32_t* b, uint32_t length) {
+    float32_t maxDiff = 0.0f;
+    for (uint32_t i = 0; i < length; i++) {
+        float32_t diff = fabsf(a[i] - b[i]);
+        if (diff > maxDiff) {
+            maxDiff = diff;
+        }
+    }
+    return maxDiff;
+}
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+/**
+ * @brief Versión manual: cada etapa recorre la señal completa
+ * @return Tiempo en microsegundos
+ */
+uint32_t runManual() {
+    IIRFilter notch(notchCoeffs, 1, BLOCK_SIZE);
+    FIRFilter lowpass(lowpassCoeffs, FILTERTAPS, BLOCK_SIZE);
+    WaveletFilter wavelet(BLOCK_SIZE);
+
+    // Dos arrays intermedios del tamaño de la señal
+    float32_t* stage1 = new float32_t[NUM_SAMPLES];
+    float32_t* stage2 = new float32_t[NUM_SAMPLES];
+
+    uint32_t start = micros();
+    notch.processBuffer(noisySignal, stage1, NUM_SAMPLES);
+    lowpass.processBuffer(stage1, stage2, NUM_SAMPLES);
+    wavelet.processBuffer(stage2, manualOutput, NUM_SAMPLES);
+    uint32_t elapsed = micros() - start;
+
+    delete[] stage1;
+    delete[] stage2;
+    return elapsed;
+}
+
+void testChain() {
+    printSeparator();
+    Serial.println("  FilterChain: IIR notch -> FIR pasa-bajas -> Wavelet");
+    printSeparator();
+
+    IIRFilter notch(notchCoeffs, 1, BLOCK_SIZE);
+    FIRFilter lowpass(lowpassCoeffs, FILTERTAPS, BLOCK_SIZE);
+    WaveletFilter wavelet(BLOCK_SIZE);
+    FilterChain<IIRFilter, FIRFilter, WaveletFilter> chain(BLOCK_SIZE, notch, lowpass, wavelet);
+
+    uint32_t start = micros();
+    chain.processBuffer(noisySignal, chainOutput, NUM_SAMPLES);
+    uint32_t chainTime = micros() - start;
+    uint32_t manualTime = runManual();
+
+    float32_t diff = maxDifference(chainOutput, manualOutput, NUM_SAMPLES);
+    Serial.print("  Diferencia maxima con la version manual: ");
+    Serial.println(diff, 8);
+    printCheck(diff < 1e-6f, "Cadena por bloques == etapas sobre la señal completa");
+
+    // Muestra a muestra con una cadena nueva (estado limpio)
+    IIRFilter notch2(notchCoeffs, 1, 1);
+    FIRFilter lowpass2(lowpassCoeffs, FILTERTAPS, 1);
+    WaveletFilter wavelet2(1);
+    FilterChain<IIRFilter, FIRFilter, WaveletFilter> chain2(1, notch2, lowpass2, wavelet2);
+    float32_t sampleDiff = 0.0f;
+    for (uint32_t i = 0; i < NUM_SAMPLES; i++) {
+        sampleDiff = fmaxf(sampleDiff, fabsf(chain2.processSample(noisySignal[i]) - chainOutput[i]));
+    }
+    printCheck(sampleDiff < 1e-6f, "processSample() == processBuffer()");
+
+    // Retardo de grupo: el FIR simétrico aporta exactamente (N-1)/2 muestras
+    float32_t f10 = 10.0f / SAMPLE_RATE;
+    printCheck(fabsf(lowpass.getGroupDelay(f10) - (FILTERTAPS - 1) / 2.0f) < 1e-2f, "Retardo FIR de fase lineal");
+    printCheck(fabsf(chain.getGroupDelay(f10) - (notch.getGroupDelay(f10) + lowpass.getGroupDelay(f10) +
+                                                 wavelet.getGroupDelay(f10))) < 1e-4f, "Retardo total = suma de etapas");
+
+    // Calidad frente a la señal limpia, compensando el retardo total
+    uint32_t delay = (uint32_t)(chain.getGroupDelay(f10) + 0.5f);
+    float32_t snrIn = calculateSNR(cleanSignal, noisySignal, NUM_SAMPLES - delay);
+    float32_t snrOut = calculateSNR(cleanSignal, chainOutput + delay, NUM_SAMPLES - delay);
+
+    uint32_t intermediateBytes = 2u * NUM_SAMPLES * sizeof(float32_t);
+    printCheck(chain.getMemoryUsage() < intermediateBytes, "Memoria de la cadena < arrays intermedios");
+
+    Serial.println();
+    Serial.print("  Etapas:                         "); Serial.println(chain.getNumStages());
+    Serial.print("  Retardo a 10 Hz (muestras):     "); Serial.println(chain.getGroupDelay(f10), 2);
+    Serial.print("  Retardo a 10 Hz (ms):           "); Serial.println(chain.getGroupDelay(f10) * 1000.0f / SAMPLE_RATE, 2);
+    Serial.print("  SNR entrada / salida (dB):      "); Serial.print(snrIn, 2); Serial.print(" / "); Serial.println(snrOut, 2);
+    Serial.print("  RAM cadena completa (bytes):    "); Serial.println(chain.getMemoryUsage());
+    Serial.print("  RAM arrays intermedios manual:  "); Serial.println(intermediateBytes);
+    Serial.print("  Tiempo cadena (us):             "); Serial.println(chainTime);
+    Serial.print("  Tiempo manual (us):             "); Serial.println(manualTime);
+}
+
+// ============================================================================
+// SETUP Y LOOP
+// ============================================================================
+
+void setup() {
+    Serial.begin(115200);
+    while (!Serial && millis() < 5000);
+
+    printTestHeader("TEST FilterChain - BioFilterLib");
+
+    if (!loadSignal(cleanSignal, "ecg_clean", NUM_SAMPLES) ||
+        !loadSignal(noisySignal, "ecg_60hz_noised", NUM_SAMPLES)) {
+        Serial.println("ERROR: No se pudieron cargar las señales");
+        return;
+    }
+
+    testChain();
+
+    Serial.println();
+    printTestResult();
+}
+
+void loop() {
+    delay(1000);
+}
@@ -0,0 +1,178 @@
+/**
+ * @file Test_BioFilterLib_Hilbert.ino
+ * @brief Test del Hilbert FIR plegado (señal analítica, envolvente y fase)
+ * @author Test Suite
+ * @version 1.0.0
+ * @date 2025
+ *
+ * Este test evalúa:
+ * - Que la cuadratura coincide con un FIRFilter con el Hilbert completo (N coeficientes)
+ *   usando solo (N + 1)/4 MACs por muestra
+ * - cos -> sin con el mismo retardo en las dos salidas
+ * - Envolvente de una señal modulada en amplitud (respiración en el ECG), exacta y rápida
+ * - Fase instantánea: pendiente 2πf
+ * - Error de fastMagnitude() y fastAtan2()
+ */
+
+#include <BioFilterLib.h>
+
+// ============================================================================
+// CONFIGURACIÓN DEL TEST
+// ============================================================================
+
+#define SAMPLE_RATE  250
+#define NUM_TAPS     63
+#define BLOCK_SIZE   32
+#define NUM_SAMPLES  2048
+#define CARRIER      20.0f         // Hz
+#define MODULATION   0.25f         // Hz (15 respiraciones por minuto)
+
+float32_t input[NUM_SAMPLES];
+float32_t inPhase[NUM_SAMPLES];
+float32_t quadrature[NUM_SAMPLES];
+float32_t reference[NUM_SAMPLES];
+float32_t magnitude[NUM_SAMPLES];
+float32_t phase[NUM_SAMPLES];
+float32_t fullCoeffs[NUM_TAPS];
+
+float32_t envelopeAt(float32_t n) {
+    return 1.0f + 0.5f * cosf(2.0f * PI * MODULATION * n / SAMPLE_RATE);
+}
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+void testQuadrature() {
+    printSeparator();
+    Serial.println("  Cuadratura plegada frente a FIRFilter");
+    printSeparator();
+
+    for (uint32_t n = 0; n < NUM_SAMPLES; n++) {
+        input[n] = cosf(2.0f * PI * CARRIER * n / SAMPLE_RATE);
+    }
+
+    HilbertFilter hilbert(NUM_TAPS);
+    printCheck(hilbert.isValid() && hilbert.getNumCoefficients() == (NUM_TAPS + 1) / 4, "63 taps: 16 MACs por muestra");
+
+    FIRDesign::design(fullCoeffs, NUM_TAPS, FIRDesign::hilbertSpec(FIRDesign::WINDOW_BLACKMAN));
+    FIRFilter fir(fullCoeffs, NUM_TAPS, BLOCK_SIZE);
+
+    uint32_t foldedTime = 0, firTime = 0;
+    for (uint32_t n = 0; n < NUM_SAMPLES; n += BLOCK_SIZE) {
+        uint32_t start = micros();
+        hilbert.processBuffer(input + n, inPhase + n, quadrature + n, BLOCK_SIZE);
+        foldedTime += micros() - start;
+
+        start = micros();
+        fir.processBuffer(input + n, reference + n, BLOCK_SIZE);
+        firTime += micros() - start;
+    }
+
+    float32_t firError = 0.0f, sinError = 0.0f, delayError = 0.0f;
+    uint16_t delay = (uint16_t)hilbert.getGroupDelay();
+    for (uint32_t n = NUM_TAPS; n < NUM_SAMPLES; n++) {
+        firError = fmaxf(firError, fabsf(quadrature[n] - reference[n]));
+        sinError = fmaxf(sinError, fabsf(quadrature[n] - sinf(2.0f * PI * CARRIER * (n - delay) / SAMPLE_RATE)));
+        delayError = fmaxf(delayError, fabsf(inPhase[n] - input[n - delay]));
+    }
+    printCheck(firError < 1e-5f, "Misma cuadratura que el FIR completo");
+    printCheck(sinError < 0.01f, "H{cos} == sin (error < 1 %)");
+    printCheck(delay == 31 && delayError == 0.0f, "En fase: la entrada retrasada 31 muestras");
+
+    Serial.println();
+    Serial.print("  Error frente a sin:             "); Serial.println(sinError, 5);
+    Serial.print("  Plegado / FIR (us por muestra): ");
+    Serial.print((float32_t)foldedTime / NUM_SAMPLES, 3);
+    Serial.print(" / "); Serial.println((float32_t)firTime / NUM_SAMPLES, 3);
+    Serial.print("  RAM (bytes):                    "); Serial.println(hilbert.getMemoryUsage());
+}
+
+void testEnvelopeAndPhase() {
+    printSeparator();
+    Serial.println("  Envolvente y fase instantánea");
+    printSeparator();
+
+    for (uint32_t n = 0; n < NUM_SAMPLES; n++) {
+        input[n] = envelopeAt(n) * cosf(2.0f * PI * CARRIER * n / SAMPLE_RATE);
+    }
+
+    HilbertFilter exact(NUM_TAPS);
+    exact.processPolar(input, magnitude, phase, NUM_SAMPLES, false);
+    float32_t envelopeError = 0.0f, slopeError = 0.0f;
+    for (uint32_t n = NUM_TAPS; n < NUM_SAMPLES; n++) {
+        envelopeError = fmaxf(envelopeError, fabsf(magnitude[n] - envelopeAt(n - 31.0f)) / envelopeAt(n - 31.0f));
+        float32_t step = phase[n] - phase[n - 1];
+        if (step < -PI) {
+            step += 2.0f * PI;
+        }
+        slopeError = fmaxf(slopeError, fabsf(step - 2.0f * PI * CARRIER / SAMPLE_RATE));
+    }
+    printCheck(envelopeError < 0.02f, "Envolvente exacta: error < 2 %");
+    printCheck(slopeError < 0.01f, "Fase: avanza 2π·f/Fs por muestra");
+
+    HilbertFilter fast(NUM_TAPS);
+    float32_t exactPhase[BLOCK_SIZE];
+    memcpy(exactPhase, phase + NUM_SAMPLES - BLOCK_SIZE, sizeof(exactPhase));
+    fast.processPolar(input, magnitude, phase, NUM_SAMPLES);
+    float32_t fastError = 0.0f, phaseError = 0.0f;
+    for (uint32_t n = NUM_TAPS; n < NUM_SAMPLES; n++) {
+        fastError = fmaxf(fastError, fabsf(magnitude[n] - envelopeAt(n - 31.0f)) / envelopeAt(n - 31.0f));
+    }
+    for (uint32_t i = 0; i < BLOCK_SIZE; i++) {
+        phaseError = fmaxf(phaseError, fabsf(phase[NUM_SAMPLES - BLOCK_SIZE + i] - exactPhase[i]));
+    }
+    printCheck(fastError < 0.06f, "Envolvente rápida: error < 6 % (4 % de alfa·max + beta·min)");
+    printCheck(phaseError < 1e-4f, "Fase rápida == atan2f");
+
+    Serial.println();
+    Serial.print("  Error envolvente exacta/rapida: "); Serial.print(envelopeError, 4);
+    Serial.print(" / "); Serial.println(fastError, 4);
+}
+
+void testApproximations() {
+    printSeparator();
+    Serial.println("  fastMagnitude() y fastAtan2()");
+    printSeparator();
+
+    float32_t magnitudeError = 0.0f, angleError = 0.0f;
+    for (uint16_t k = 0; k < 3600; k++) {
+        float32_t angle = -PI + 2.0f * PI * (k + 0.5f) / 3600.0f;
+        float32_t re = 2.5f * cosf(angle), im = 2.5f * sinf(angle);
+        magnitudeError = fmaxf(magnitudeError, fabsf(HilbertFilter::fastMagnitude(re, im) - 2.5f) / 2.5f);
+        angleError = fmaxf(angleError, fabsf(HilbertFilter::fastAtan2(im, re) - atan2f(im, re)));
+    }
+    printCheck(magnitudeError < 0.0397f, "fastMagnitude(): error < 3.97 %");
+    printCheck(angleError < 2e-5f, "fastAtan2(): error < 2e-5 rad");
+    printCheck(HilbertFilter::fastAtan2(0.0f, 0.0f) == 0.0f && fabsf(HilbertFilter::fastAtan2(0.0f, -1.0f) - PI) < 1e-6f,
+               "fastAtan2(): origen y eje negativo");
+
+    HilbertFilter even(32);
+    printCheck(!even.isValid(), "Número par de coeficientes: isValid() == false");
+
+    Serial.println();
+    Serial.print("  Error magnitud / angulo:        "); Serial.print(magnitudeError, 4);
+    Serial.print(" / "); Serial.println(angleError, 7);
+}
+
+// ============================================================================
+// SETUP Y LOOP
+// ============================================================================
+
+void setup() {
+    Serial.begin(115200);
+    while (!Serial && millis() < 5000);
+
+    printTestHeader("TEST HILBERT - BioFilterLib");
+
+    testQuadrature();
+    testEnvelopeAndPhase();
+    testApproximations();
+
+    Serial.println();
+    printTestResult();
+}
+
+void loop() {
+    delay(1000);
+}
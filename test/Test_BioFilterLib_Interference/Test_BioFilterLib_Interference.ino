@@ -0,0 +1,208 @@
+/**
+ * @file Test_BioFilterLib_Interference.ino
+ * @brief Test de InterferenceDetector, NotchBank y AutoNotchFilter
+ * @author Test Suite
+ * @version 1.0.0
+ * @date 2025
+ *
+ * Este test evalúa:
+ * - Estimación de amplitud de Goertzel con ventana de Hann (red a 50 Hz)
+ * - ECG limpio: ninguna línea detectada, ningún notch activo, salida = entrada
+ * - Red de 50 Hz con tercer armónico: se activan justo los notch de 50 y 150 Hz y la
+ *   interferencia cae más de 30 dB
+ * - Cambio a red de 60 Hz: los notch se resintonizan; al desaparecer, se desactivan
+ * - Tiempo frente a un IIRFilter con los 6 notch siempre activos
+ */
+
+#include <BioFilterLib.h>
+
+// ============================================================================
+// CONFIGURACIÓN DEL TEST
+// ============================================================================
+
+#define SAMPLE_RATE  960
+#define BLOCK_SIZE   32
+#define SECONDS      4             // Duración de cada escenario
+
+float32_t input[BLOCK_SIZE];
+float32_t output[BLOCK_SIZE];
+float32_t overprovisionedCoeffs[30];
+
+uint32_t seed = 12345;
+uint32_t sampleIndex = 0;
+
+float32_t noise() {
+    seed = seed * 1664525UL + 1013904223UL;
+    return (int32_t)seed / 2147483648.0f;
+}
+
+float32_t gaussian(float32_t t, float32_t center, float32_t sigma) {
+    float32_t x = (t - center) / sigma;
+    return expf(-0.5f * x * x);
+}
+
+float32_t ecg(float32_t t) {
+    float32_t phase = fmodf(t, 60.0f / 72.0f);
+    return 0.15f * gaussian(phase, 0.20f, 0.025f)
+         + 1.00f * gaussian(phase, 0.35f, 0.010f)
+         - 0.20f * gaussian(phase, 0.37f, 0.008f)
+         + 0.30f * gaussian(phase, 0.60f, 0.040f)
+         + 0.01f * noise();
+}
+
+/**
+ * @brief Bloque de ECG con interferencia de red de frecuencia base mains
+ * (0 = sin interferencia): fundamental 0.3 y tercer armónico 0.05
+ */
+void nextBlock(float32_t mains) {
+    for (uint32_t i = 0; i < BLOCK_SIZE; i++) {
+        float32_t t = (float32_t)(sampleIndex++) / SAMPLE_RATE;
+        input[i] = ecg(t);
+        if (mains > 0.0f) {
+            input[i] += 0.3f * sinf(2.0f * PI * mains * t) + 0.05f * sinf(2.0f * PI * 3.0f * mains * t + 0.5f);
+        }
+    }
+}
+
+/**
+ * @brief Procesa SECONDS segundos con el notch automático y mide la salida del último
+ */
+void runScenario(AutoNotchFilter& notch, InterferenceDetector& residual, float32_t mains, bool& transparent) {
+    transparent = true;
+    uint32_t blocks = SECONDS * SAMPLE_RATE / BLOCK_SIZE;
+    for (uint32_t b = 0; b < blocks; b++) {
+        nextBlock(mains);
+        notch.processBuffer(input, output, BLOCK_SIZE);
+        if (b >= blocks - SAMPLE_RATE / BLOCK_SIZE) {
+            residual.processBuffer(output, BLOCK_SIZE);
+        }
+        transparent = transparent && memcmp(input, output, sizeof(input)) == 0;
+    }
+}
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+void testGoertzel() {
+    printSeparator();
+    Serial.println("  InterferenceDetector: amplitud de Goertzel con ventana de Hann");
+    printSeparator();
+
+    const float32_t frequencies[] = {50.0f, 60.0f};
+    InterferenceDetector detector(SAMPLE_RATE, frequencies, 2);
+    for (uint32_t b = 0; b < SAMPLE_RATE / BLOCK_SIZE; b++) {
+        for (uint32_t i = 0; i < BLOCK_SIZE; i++) {
+            float32_t t = (float32_t)(b * BLOCK_SIZE + i) / SAMPLE_RATE;
+            input[i] = 0.2f * sinf(2.0f * PI * 50.0f * t + 1.0f) + 0.05f * noise();
+        }
+        detector.processBuffer(input, BLOCK_SIZE);
+    }
+
+    printCheck(detector.getWindowCount() == 1, "Una ventana de 1 s");
+    printCheck(fabsf(detector.getAmplitude(0) - 0.2f) < 0.01f, "Amplitud a 50 Hz ~ 0.2 (+-5 %)");
+    printCheck(detector.isDetected(0) && !detector.isDetected(1), "Detecta 50 Hz y no 60 Hz");
+
+    Serial.println();
+    Serial.print("  Amplitud 50 / 60 Hz:            "); Serial.print(detector.getAmplitude(0), 4);
+    Serial.print(" / "); Serial.println(detector.getAmplitude(1), 4);
+    Serial.print("  Relacion linea/fondo (dB):      "); Serial.print(detector.getRatio(0), 1);
+    Serial.print(" / "); Serial.println(detector.getRatio(1), 1);
+}
+
+void testAutoNotch() {
+    printSeparator();
+    Serial.println("  AutoNotchFilter: limpio -> 50 Hz -> 60 Hz -> limpio");
+    printSeparator();
+
+    AutoNotchFilter notch(SAMPLE_RATE);
+    const float32_t watch[] = {50.0f, 60.0f, 150.0f, 180.0f};
+    bool transparent;
+
+    // 1. ECG limpio
+    InterferenceDetector clean(SAMPLE_RATE, watch, 4);
+    runScenario(notch, clean, 0.0f, transparent);
+    printCheck(notch.getNotchBank().getActiveStages() == 0, "Limpio: ningun notch activo");
+    printCheck(transparent, "Limpio: salida == entrada");
+
+    // 2. Red de 50 Hz con tercer armónico
+    InterferenceDetector at50(SAMPLE_RATE, watch, 4);
+    runScenario(notch, at50, 50.0f, transparent);
+    NotchBank& bank = notch.getNotchBank();
+    printCheck(bank.getActiveStages() == 2 && bank.findStage(50.0f) >= 0 && bank.findStage(150.0f) >= 0,
+               "50 Hz: notch activos en 50 y 150 Hz");
+    float32_t attenuation50 = 20.0f * log10f(at50.getAmplitude(0) / 0.3f);
+    float32_t attenuation150 = 20.0f * log10f(at50.getAmplitude(2) / 0.05f);
+    printCheck(attenuation50 < -30.0f && attenuation150 < -30.0f, "50 Hz: interferencia atenuada > 30 dB");
+
+    // 3. Cambio a red de 60 Hz
+    InterferenceDetector at60(SAMPLE_RATE, watch, 4);
+    runScenario(notch, at60, 60.0f, transparent);
+    printCheck(bank.getActiveStages() == 2 && bank.findStage(60.0f) >= 0 && bank.findStage(180.0f) >= 0,
+               "60 Hz: notch resintonizados a 60 y 180 Hz");
+    float32_t attenuation60 = 20.0f * log10f(at60.getAmplitude(1) / 0.3f);
+    printCheck(attenuation60 < -30.0f, "60 Hz: interferencia atenuada > 30 dB");
+
+    // 4. Desaparece la interferencia
+    InterferenceDetector after(SAMPLE_RATE, watch, 4);
+    runScenario(notch, after, 0.0f, transparent);
+    printCheck(bank.getActiveStages() == 0 && notch.getGroupDelay(0.01f) == 0.0f, "Limpio otra vez: notch desactivados");
+
+    Serial.println();
+    Serial.print("  Atenuacion 50 / 150 / 60 Hz:    "); Serial.print(attenuation50, 1);
+    Serial.print(" / "); Serial.print(attenuation150, 1);
+    Serial.print(" / "); Serial.print(attenuation60, 1); Serial.println(" dB");
+    Serial.print("  RAM AutoNotchFilter (bytes):    "); Serial.println(notch.getMemoryUsage());
+}
+
+void testCost() {
+    printSeparator();
+    Serial.println("  Coste frente a 6 notch siempre activos");
+    printSeparator();
+
+    const float32_t mains[] = {50.0f, 60.0f, 100.0f, 120.0f, 150.0f, 180.0f};
+    for (uint8_t s = 0; s < 6; s++) {
+        NotchBank::designNotch(overprovisionedCoeffs + 5 * s, mains[s], SAMPLE_RATE, 30.0f);
+    }
+    IIRFilter overprovisioned(overprovisionedCoeffs, 6, BLOCK_SIZE);
+    AutoNotchFilter notch(SAMPLE_RATE);
+
+    uint32_t blocks = 10 * SAMPLE_RATE / BLOCK_SIZE;
+    uint32_t fixedTime = 0, autoTime = 0;
+    for (uint32_t b = 0; b < blocks; b++) {
+        nextBlock(50.0f);
+        uint32_t start = micros();
+        overprovisioned.processBuffer(input, output, BLOCK_SIZE);
+        fixedTime += micros() - start;
+        start = micros();
+        notch.processBuffer(input, output, BLOCK_SIZE);
+        autoTime += micros() - start;
+    }
+    printCheck(autoTime < fixedTime, "Detector + 2 notch mas barato que 6 notch fijos");
+
+    Serial.println();
+    Serial.print("  Tiempo 10 s, 6 fijos / auto:    "); Serial.print(fixedTime);
+    Serial.print(" / "); Serial.println(autoTime);
+}
+
+// ============================================================================
+// SETUP Y LOOP
+// ============================================================================
+
+void setup() {
+    Serial.begin(115200);
+    while (!Serial && millis() < 5000);
+
+    printTestHeader("TEST InterferenceDetector - BioFilterLib");
+
+    testGoertzel();
+    testAutoNotch();
+    testCost();
+
+    Serial.println();
+    printTestResult();
+}
+
+void loop() {
+    delay(1000);
+}
@@ -25,7 +25,10 @@ const float INTERFERENCE_AMP = 0.3f;
 float32_t lmsCoeffs[NUM_TAPS];
 LMSFilter* adaptiveFilter;
 
-float timeCounter = 0.0f;
+// Generadores deterministas: la misma semilla reproduce exactamente la prueba
+BiosignalGenerator ecgGen(SAMPLE_RATE, 1);
+BiosignalGenerator noiseGen(SAMPLE_RATE, 2);
+BiosignalGenerator refGen(SAMPLE_RATE, 3);
 
 // ========= MÉTRICAS =========
 uint32_t sampleCount = 0;
@@ -49,41 +52,6 @@ double sum_clean2 = 0;
 double sum_filt2 = 0;
 double sum_clean_filt = 0;
 
-// =============================
-// Generación de señales
-// =============================
-float generateECG(float t) {
-float hrHz = ECG_HR / 60.0f;
-float phase = fmod(2.0f * PI * hrHz * t, 2.0f * PI);
-float e = 0;
-
-if (phase > 0.3 && phase < 0.8)
-    e += 0.15f * sin((phase - 0.3f) * 2 * PI / 0.5f);
-
-if (phase > 1.0 && phase < 1.6) {
-    if (phase < 1.2)
-        e -= 0.1f * sin((phase - 1.0f) * 2 * PI / 0.2f);
-    else if (phase < 1.4)
-        e += 1.0f * sin((phase - 1.2f) * 2 * PI / 0.2f);
-    else
-        e -= 0.2f * sin((phase - 1.4f) * 2 * PI / 0.2f);
-}
-
-if (phase > 2.0 && phase < 2.8)
-    e += 0.25f * sin((phase - 2.0f) * 2 * PI / 0.8f);
-
-return e;
-
-}
-
-float generateInterference(float t) {
-return INTERFERENCE_AMP * sin(2 * PI * POWERLINE_FREQ * t);
-}
-
-float generateReference(float t) {
-return sin(2 * PI * POWERLINE_FREQ * t);
-}
-
 // =============================
 // SETUP
 // =============================
@@ -100,6 +68,11 @@ Serial.println();
 
 for (int i = 0; i < NUM_TAPS; i++) lmsCoeffs[i] = 0.0f;
 
+// ECG limpio, interferencia de red y referencia en fase con la interferencia
+ecgGen.setECG(ECG_HR, 1.0f, 0.0f);
+noiseGen.setPowerline(POWERLINE_FREQ, INTERFERENCE_AMP);
+refGen.setPowerline(POWERLINE_FREQ, 1.0f);
+
 adaptiveFilter = new LMSFilter(lmsCoeffs, NUM_TAPS, MU, BLOCK_SIZE);
 
 Serial.println("Procesando ~5 segundos...");
@@ -116,9 +89,9 @@ printResults();
 while (1);
 }
 
-float clean = generateECG(timeCounter);
-float noise = generateInterference(timeCounter);
-float ref   = generateReference(timeCounter);
+float clean = ecgGen.next();
+float noise = noiseGen.next();
+float ref   = refGen.next();
 float contaminated = clean + noise;
 
 float y = 0, err = 0;
@@ -150,8 +123,6 @@ sum_clean2      += clean   * clean;
 sum_filt2       += cleaned * cleaned;
 sum_clean_filt  += clean * cleaned;
 
-timeCounter += 1.0f / SAMPLE_RATE;
-
 }
 
 // =============================
@@ -0,0 +1,212 @@
+/**
+ * @file Test_BioFilterLib_Latency.ino
+ * @brief Test del retardo de grupo de cada filtro y del presupuesto de latencia
+ * @author Test Suite
+ * @version 1.0.0
+ * @date 2025
+ *
+ * Este test evalúa:
+ * - getGroupDelay() en DC frente al retardo medido (desplazamiento del centroide
+ *   de un pulso gaussiano) en FIR, IIR, Wavelet y FilterChain
+ * - Retardo estimado del LMS tras identificar un retardo puro de 5 muestras
+ * - PipelineLatency: espera de bloque, cálculo medido, alineación y plazo
+ */
+
+#include <BioFilterLib.h>
+
+// ============================================================================
+// CONFIGURACIÓN DEL TEST
+// ============================================================================
+
+#define SAMPLE_RATE  960
+#define BLOCK_SIZE   32
+#define FILTERTAPS   51
+#define NUM_SAMPLES  640
+#define LMS_TAPS     16
+#define LMS_DELAY    5
+
+// Butterworth pasa-bajas de 2º orden, fc = 40 Hz (a1/a2 negados para CMSIS-DSP)
+float32_t lowpassIIR[5] = {
+    0.01440144f, 0.02880288f, 0.01440144f,
+    1.63299316f, -0.69059892f
+};
+
+// Pasa-bajas fc = 40 Hz (el mismo de Test_BioFilterLib_FIR)
+float32_t lowpassFIR[FILTERTAPS] = {
+    +0.00096226f, +0.00110652f, +0.00123488f, +0.00128605f, +0.00115012f, +0.00068979f, -0.00022373f, -0.00166613f,
+    -0.00361514f, -0.00591523f, -0.00826092f, -0.01020548f, -0.01119776f, -0.01064514f, -0.00799553f, -0.00282748f,
+    +0.00506537f, +0.01560960f, +0.02841897f, +0.04280137f, +0.05780805f, +0.07232126f, +0.08517038f, +0.09526185f,
+    +0.10170564f, +0.10392083f, +0.10170564f, +0.09526185f, +0.08517038f, +0.07232126f, +0.05780805f, +0.04280137f,
+    +0.02841897f, +0.01560960f, +0.00506537f, -0.00282748f, -0.00799553f, -0.01064514f, -0.01119776f, -0.01020548f,
+    -0.00826092f, -0.00591523f, -0.00361514f, -0.00166613f, -0.00022373f, +0.00068979f, +0.00115012f, +0.00128605f,
+    +0.00123488f, +0.00110652f, +0.00096226f
+};
+
+float32_t pulse[NUM_SAMPLES];
+float32_t output[NUM_SAMPLES];
+float32_t lmsCoeffs[LMS_TAPS];
+
+uint32_t seed = 12345;
+
+float32_t noise() {
+    seed = seed * 1664525UL + 1013904223UL;
+    return (int32_t)seed / 2147483648.0f;
+}
+
+/**
+ * @brief Centroide Σ n·x[n] / Σ x[n]: su desplazamiento es el retardo de grupo en DC
+ */
+float32_t centroid(const float32_t* x, uint32_t length) {
+    float32_t moment = 0.0f, area = 0.0f;
+    for (uint32_t n = 0; n < length; n++) {
+        moment += n * x[n];
+        area += x[n];
+    }
+    return moment / area;
+}
+
+template <typename Filter>
+float32_t measureDelay(Filter& filter) {
+    filter.processBuffer(pulse, output, NUM_SAMPLES);
+    return centroid(output, NUM_SAMPLES) - centroid(pulse, NUM_SAMPLES);
+}
+
+void printDelay(const char* name, float32_t reported, float32_t measured) {
+    Serial.print("  ");
+    Serial.print(name);
+    Serial.print(reported, 3);
+    Serial.print(" / ");
+    Serial.println(measured, 3);
+}
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+void testFilters() {
+    printSeparator();
+    Serial.println("  Retardo informado frente a retardo medido (DC)");
+    printSeparator();
+
+    // Pulso gaussiano ancho (σ = 24 muestras): casi toda su energía por debajo de 20 Hz
+    for (uint32_t n = 0; n < NUM_SAMPLES; n++) {
+        float32_t t = ((float32_t)n - 200.0f) / 24.0f;
+        pulse[n] = expf(-0.5f * t * t);
+    }
+
+    FIRFilter fir(lowpassFIR, FILTERTAPS, BLOCK_SIZE);
+    IIRFilter iir(lowpassIIR, 1, BLOCK_SIZE);
+    WaveletFilter wavelet(BLOCK_SIZE);
+
+    float32_t firDelay = measureDelay(fir);
+    float32_t iirDelay = measureDelay(iir);
+    float32_t waveletDelay = measureDelay(wavelet);
+    fir.reset();
+    iir.reset();
+    wavelet.reset();
+
+    FilterChain<IIRFilter, FIRFilter, WaveletFilter> chain(BLOCK_SIZE, iir, fir, wavelet);
+    float32_t chainDelay = measureDelay(chain);
+
+    printCheck(fabsf(fir.getGroupDelay() - firDelay) < 0.05f, "FIR: (N - 1)/2 muestras");
+    printCheck(fabsf(iir.getGroupDelay() - iirDelay) < 0.05f, "IIR: retardo del biquad en DC");
+    printCheck(fabsf(wavelet.getGroupDelay() - waveletDelay) < 0.05f, "Wavelet: análisis + síntesis");
+    printCheck(fabsf(chain.getGroupDelay() - chainDelay) < 0.1f, "FilterChain: suma de etapas");
+
+    Serial.println();
+    Serial.println("  Informado / medido (muestras):");
+    printDelay("  FIR:         ", fir.getGroupDelay(), firDelay);
+    printDelay("  IIR:         ", iir.getGroupDelay(), iirDelay);
+    printDelay("  Wavelet:     ", wavelet.getGroupDelay(), waveletDelay);
+    printDelay("  FilterChain: ", chain.getGroupDelay(), chainDelay);
+}
+
+void testLMS() {
+    printSeparator();
+    Serial.println("  LMS: identificación de un retardo puro");
+    printSeparator();
+
+    for (uint16_t i = 0; i < LMS_TAPS; i++) {
+        lmsCoeffs[i] = 0.0f;
+    }
+    LMSFilter lms(lmsCoeffs, LMS_TAPS, 0.1f, 1);
+    printCheck(lms.getGroupDelay() == 0.0f, "Pesos a cero: retardo 0");
+
+    // d[n] = x[n - 5]: los pesos convergen a un impulso en la posición 5
+    float32_t history[LMS_DELAY + 1] = {0.0f};
+    for (uint32_t n = 0; n < 4000; n++) {
+        for (uint16_t k = LMS_DELAY; k > 0; k--) {
+            history[k] = history[k - 1];
+        }
+        history[0] = noise();
+        float32_t y, e;
+        lms.processSample(history[0], history[LMS_DELAY], &y, &e);
+    }
+    float32_t estimated = lms.getGroupDelay();
+    printCheck(fabsf(estimated - LMS_DELAY) < 0.05f, "Retardo estimado tras converger: 5 muestras");
+
+    Serial.println();
+    Serial.print("  Retardo LMS (muestras):         "); Serial.println(estimated, 4);
+}
+
+void testBudget() {
+    printSeparator();
+    Serial.println("  Presupuesto de latencia del pipeline");
+    printSeparator();
+
+    IIRFilter iir(lowpassIIR, 1, BLOCK_SIZE);
+    FIRFilter fir(lowpassFIR, FILTERTAPS, BLOCK_SIZE);
+    WaveletFilter wavelet(BLOCK_SIZE);
+    FilterPipeline<IIRFilter, FIRFilter, WaveletFilter> pipeline(BLOCK_SIZE, iir, fir, wavelet);
+
+    for (uint32_t n = 0; n < NUM_SAMPLES; n++) {
+        pulse[n] = noise();
+    }
+    uint32_t worst = 0;
+    for (uint32_t n = 0; n < NUM_SAMPLES; n += BLOCK_SIZE) {
+        uint32_t start = micros();
+        pipeline.processBuffer(pulse + n, output + n, BLOCK_SIZE);
+        uint32_t elapsed = micros() - start;
+        worst = (elapsed > worst) ? elapsed : worst;
+    }
+
+    PipelineLatency latency = pipeline.getLatency(SAMPLE_RATE, worst);
+    float32_t expected = 1000.0f * (pipeline.getGroupDelay() + BLOCK_SIZE - 1) / SAMPLE_RATE + worst / 1000.0f;
+    printCheck(latency.bufferDelay == BLOCK_SIZE - 1, "Espera de bloque: blockSize - 1 muestras");
+    printCheck(fabsf(latency.totalMs - expected) < 1e-3f, "Total = retardo + bloque + cálculo");
+    printCheck(latency.getAlignment() == (uint32_t)(pipeline.getGroupDelay() + 0.5f), "Alineación entera");
+    printCheck(latency.meets(100.0f), "Plazo de 100 ms cumplido");
+    printCheck(!latency.meets(latency.totalMs - 0.5f), "Plazo menor que el total: incumplido");
+
+    PipelineLatency overloaded = pipeline.getLatency(SAMPLE_RATE, 40000);
+    printCheck(!overloaded.meets(1000.0f), "Cálculo mayor que el periodo de bloque: incumplido");
+
+    Serial.println();
+    Serial.print("  Retardo de grupo (ms):          "); Serial.println(1000.0f * latency.groupDelay / SAMPLE_RATE, 3);
+    Serial.print("  Espera de bloque (ms):          "); Serial.println(1000.0f * latency.bufferDelay / SAMPLE_RATE, 3);
+    Serial.print("  Cálculo por bloque (ms):        "); Serial.println(latency.processingMs, 3);
+    Serial.print("  Periodo de bloque (ms):         "); Serial.println(latency.blockPeriodMs, 3);
+    Serial.print("  Latencia total (ms):            "); Serial.println(latency.totalMs, 3);
+}
+
+// ============================================================================
+// SETUP Y LOOP
+// ============================================================================
+
+void setup() {
+    Serial.begin(115200);
+    while (!Serial && millis() < 5000);
+
+    printTestHeader("TEST LATENCIA - BioFilterLib");
+
+    testFilters();
+    testLMS();
+    testBudget();
+
+    Serial.println();
+    printTestResult();
+}
+
+void loop() {
+    delay(1000);
+}
@@ -0,0 +1,307 @@
+/**
+ * @file Test_BioFilterLib_Median.ino
+ * @brief Test de MedianFilter y BaselineFilter (medianas 200/600 ms)
+ * @author Test Suite
+ * @version 1.0.0
+ * @date 2025
+ *
+ * Este test evalúa:
+ * - Que la mediana móvil coincide con la mediana exacta de la ventana (selección
+ *   directa) para ventanas impares y pares, en float e int16
+ * - Eliminación de impulsos de 1-2 muestras con una mediana de 5
+ * - Eliminación de la deriva de línea base de un ECG sintético a 960 Hz con medianas
+ *   de 200 y 600 ms, conservando el QRS
+ * - Composición con FilterChain y tiempo por muestra frente a la selección directa
+ */
+
+#include <BioFilterLib.h>
+
+// ============================================================================
+// CONFIGURACIÓN DEL TEST
+// ============================================================================
+
+#define SAMPLE_RATE  960
+#define NUM_SAMPLES  3000
+#define ECG_SECONDS  20
+#define BLOCK_SIZE   32
+
+// Notch 60 Hz, Q = 30 (scipy.signal.iirnotch), a1/a2 negados para CMSIS-DSP
+float32_t notchCoeffs[5] = {
+    0.99349748f, -1.83574398f,  0.99349748f,
+    1.83574398f, -0.98699496f
+};
+
+float32_t input[NUM_SAMPLES];
+float32_t output[NUM_SAMPLES];
+float32_t window[1024];
+int16_t input16[NUM_SAMPLES];
+int16_t output16[NUM_SAMPLES];
+int16_t window16[1024];
+
+uint32_t seed = 12345;
+
+float32_t noise() {
+    seed = seed * 1664525UL + 1013904223UL;
+    return (int32_t)seed / 2147483648.0f;
+}
+
+/**
+ * @brief Elemento k de la ventana ordenada (quickselect sobre una copia)
+ */
+template <typename T>
+T select(T* values, int32_t length, int32_t k) {
+    int32_t left = 0, right = length - 1;
+    while (left < right) {
+        T pivot = values[(left + right) / 2];
+        int32_t i = left, j = right;
+        while (i <= j) {
+            while (values[i] < pivot) i++;
+            while (pivot < values[j]) j--;
+            if (i <= j) {
+                T t = values[i]; values[i] = values[j]; values[j] = t;
+                i++; j--;
+            }
+        }
+        if (k <= j) {
+            right = j;
+        } else if (k >= i) {
+            left = i;
+        } else {
+            break;
+        }
+    }
+    return values[k];
+}
+
+/**
+ * @brief Mediana de referencia en la muestra n (ventana con ceros antes del inicio)
+ */
+template <typename T>
+T referenceMedian(const T* signal, T* scratch, uint32_t n, uint16_t length) {
+    for (uint16_t k = 0; k < length; k++) {
+        scratch[k] = (n >= k) ? signal[n - k] : 0;
+    }
+    return select(scratch, length, length / 2);
+}
+
+float32_t gaussian(float32_t t, float32_t center, float32_t sigma) {
+    float32_t x = (t - center) / sigma;
+    return expf(-0.5f * x * x);
+}
+
+/**
+ * @brief ECG sin deriva: P, QRS y T gaussianas a 72 lpm
+ */
+float32_t cleanEcg(float32_t t) {
+    float32_t phase = fmodf(t, 60.0f / 72.0f);
+    return 0.15f * gaussian(phase, 0.20f, 0.025f)
+         - 0.10f * gaussian(phase, 0.33f, 0.008f)
+         + 1.00f * gaussian(phase, 0.35f, 0.010f)
+         - 0.20f * gaussian(phase, 0.37f, 0.008f)
+         + 0.30f * gaussian(phase, 0.60f, 0.040f);
+}
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+void testExact() {
+    printSeparator();
+    Serial.println("  MedianFilter: mediana exacta de la ventana");
+    printSeparator();
+
+    for (uint32_t n = 0; n < NUM_SAMPLES; n++) {
+        input[n] = noise() + ((n % 97 == 0) ? 5.0f : 0.0f);
+        // Muchos valores repetidos: el caso delicado para el montículo
+        input16[n] = (int16_t)(noise() * 50.0f);
+    }
+
+    const uint16_t lengths[] = {1, 2, 5, 72, 193, 577};
+    bool floatExact = true, intExact = true;
+    for (uint8_t w = 0; w < 6; w++) {
+        uint16_t length = lengths[w];
+        MedianFilter median(length);
+        MedianFilterInt16 median16(length);
+        median.processBuffer(input, output, NUM_SAMPLES);
+        median16.processBuffer(input16, output16, NUM_SAMPLES);
+
+        // Con la ventana de 577 basta con comprobar una de cada 7 muestras
+        uint32_t step = (length > 200) ? 7 : 1;
+        for (uint32_t n = 0; n < NUM_SAMPLES; n += step) {
+            if (output[n] != referenceMedian(input, window, n, length)) {
+                floatExact = false;
+            }
+            if (output16[n] != referenceMedian(input16, window16, n, length)) {
+                intExact = false;
+            }
+        }
+    }
+    printCheck(floatExact, "float: ventanas 1, 2, 5, 72, 193, 577");
+    printCheck(intExact, "int16 con valores repetidos: mismas ventanas");
+
+    // Copia a mitad de la señal: continúa igual (FilterPipeline)
+    MedianFilter original(193);
+    original.processBuffer(input, output, NUM_SAMPLES / 2);
+    MedianFilter copy(original);
+    original.processBuffer(input + NUM_SAMPLES / 2, output, NUM_SAMPLES / 2);
+    copy.processBuffer(input + NUM_SAMPLES / 2, output + NUM_SAMPLES / 2, NUM_SAMPLES / 2);
+    printCheck(memcmp(output, output + NUM_SAMPLES / 2, NUM_SAMPLES / 2 * sizeof(float32_t)) == 0,
+               "La copia continua igual que el original");
+
+    // Tiempo por muestra con 577 frente a la selección directa
+    MedianFilter timed(577);
+    uint32_t start = micros();
+    timed.processBuffer(input, output, NUM_SAMPLES);
+    uint32_t heapTime = micros() - start;
+    start = micros();
+    volatile float32_t sink = 0.0f;
+    for (uint32_t n = 0; n < 300; n++) {
+        sink = sink + referenceMedian(input, window, n + 1000, 577);
+    }
+    uint32_t selectTime = (micros() - start) * (NUM_SAMPLES / 300);
+    printCheck(heapTime < selectTime, "Mas rapida que la seleccion directa (N = 577)");
+
+    Serial.println();
+    Serial.print("  Tiempo 577, monticulo (us):     "); Serial.println(heapTime);
+    Serial.print("  Tiempo 577, seleccion (us):     "); Serial.println(selectTime);
+    Serial.print("  RAM N = 577 float / int16 (B):  "); Serial.print(timed.getMemoryUsage());
+    Serial.print(" / "); Serial.println(MedianFilterInt16(577).getMemoryUsage());
+}
+
+void testImpulses() {
+    printSeparator();
+    Serial.println("  MedianFilter(5): ruido impulsivo");
+    printSeparator();
+
+    for (uint32_t n = 0; n < NUM_SAMPLES; n++) {
+        input[n] = sinf(2.0f * PI * 2.0f * n / SAMPLE_RATE);
+        if (n % 50 == 0) {
+            input[n] += 10.0f;
+            input[n + 1] -= 8.0f * (n % 100 == 0);
+        }
+    }
+    MedianFilter despike(5);
+    despike.processBuffer(input, output, NUM_SAMPLES);
+
+    float32_t maxError = 0.0f;
+    for (uint32_t n = 10; n < NUM_SAMPLES; n++) {
+        float32_t ideal = sinf(2.0f * PI * 2.0f * (n - despike.getGroupDelay()) / SAMPLE_RATE);
+        maxError = fmaxf(maxError, fabsf(output[n] - ideal));
+    }
+    printCheck(maxError < 0.05f, "Impulsos de 1-2 muestras eliminados");
+
+    Serial.println();
+    Serial.print("  Error maximo tras la mediana:   "); Serial.println(maxError, 4);
+}
+
+void testBaseline() {
+    printSeparator();
+    Serial.println("  BaselineFilter: medianas de 200 y 600 ms a 960 Hz");
+    printSeparator();
+
+    BaselineFilter baseline(SAMPLE_RATE);
+    printCheck(baseline.getShortWindow() == 193 && baseline.getLongWindow() == 577, "Ventanas impares 193 / 577");
+    printCheck(baseline.getGroupDelay() == 96 + 288, "Retardo (N1-1)/2 + (N2-1)/2");
+
+    uint32_t delay = (uint32_t)baseline.getGroupDelay();
+    float32_t block[BLOCK_SIZE];
+    float32_t wanderSum = 0.0f, errorSum = 0.0f, maxRError = 0.0f;
+    uint32_t count = 0;
+    uint32_t total = ECG_SECONDS * SAMPLE_RATE;
+
+    uint32_t start = micros();
+    for (uint32_t b = 0; b < total; b += BLOCK_SIZE) {
+        for (uint32_t i = 0; i < BLOCK_SIZE; i++) {
+            float32_t t = (float32_t)(b + i) / SAMPLE_RATE;
+            block[i] = cleanEcg(t) + 0.8f * sinf(2.0f * PI * 0.3f * t) + 0.4f * sinf(2.0f * PI * 0.1f * t + 1.0f);
+        }
+        baseline.processBuffer(block, block, BLOCK_SIZE);
+
+        for (uint32_t i = 0; i < BLOCK_SIZE; i++) {
+            uint32_t n = b + i;
+            if (n < 3 * SAMPLE_RATE) {
+                continue;
+            }
+            float32_t t = (float32_t)(n - delay) / SAMPLE_RATE;
+            float32_t wander = 0.8f * sinf(2.0f * PI * 0.3f * t) + 0.4f * sinf(2.0f * PI * 0.1f * t + 1.0f);
+            float32_t error = block[i] - cleanEcg(t);
+            wanderSum += wander * wander;
+            errorSum += error * error;
+            count++;
+            // Pico R: amplitud conservada
+            if (fabsf(fmodf(t, 60.0f / 72.0f) - 0.35f) < 0.5f / SAMPLE_RATE) {
+                maxRError = fmaxf(maxRError, fabsf(error));
+            }
+        }
+    }
+    uint32_t elapsed = micros() - start;
+
+    float32_t wanderRms = sqrtf(wanderSum / count);
+    float32_t residualRms = sqrtf(errorSum / count);
+    printCheck(residualRms < 0.15f * wanderRms, "Deriva reducida mas de 16 dB");
+    printCheck(maxRError < 0.05f, "Amplitud del pico R conservada");
+
+    // En una cadena: mismo resultado que por separado
+    for (uint32_t n = 0; n < NUM_SAMPLES; n++) {
+        input[n] = cleanEcg((float32_t)n / SAMPLE_RATE) + 0.5f * sinf(2.0f * PI * 60.0f * n / SAMPLE_RATE);
+    }
+    IIRFilter notch(notchCoeffs, 1, BLOCK_SIZE);
+    BaselineFilter chainedBaseline(SAMPLE_RATE);
+    FilterChain<IIRFilter, BaselineFilter> chain(BLOCK_SIZE, notch, chainedBaseline);
+    for (uint32_t b = 0; b + BLOCK_SIZE <= NUM_SAMPLES; b += BLOCK_SIZE) {
+        chain.processBuffer(input + b, output + b, BLOCK_SIZE);
+    }
+    IIRFilter manualNotch(notchCoeffs, 1, BLOCK_SIZE);
+    BaselineFilter manualBaseline(SAMPLE_RATE);
+    bool same = true;
+    for (uint32_t b = 0; b + BLOCK_SIZE <= NUM_SAMPLES; b += BLOCK_SIZE) {
+        manualNotch.processBuffer(input + b, block, BLOCK_SIZE);
+        manualBaseline.processBuffer(block, block, BLOCK_SIZE);
+        same = same && memcmp(block, output + b, sizeof(block)) == 0;
+    }
+    printCheck(same, "FilterChain<IIRFilter, BaselineFilter> == etapas por separado");
+
+    // Versión int16 sobre cuentas de ADC
+    BaselineFilterInt16 baseline16(SAMPLE_RATE);
+    int32_t maxWander16 = 0;
+    for (uint32_t n = 0; n < NUM_SAMPLES; n++) {
+        input16[n] = (int16_t)(2048 + n / 20);     // Continua y rampa lenta
+    }
+    baseline16.processBuffer(input16, output16, NUM_SAMPLES);
+    for (uint32_t n = 1500; n < NUM_SAMPLES; n++) {
+        if (abs(output16[n]) > maxWander16) {
+            maxWander16 = abs(output16[n]);
+        }
+    }
+    printCheck(maxWander16 <= 1, "int16: continua y rampa eliminadas");
+
+    Serial.println();
+    Serial.print("  RMS deriva / residuo:           "); Serial.print(wanderRms, 4);
+    Serial.print(" / "); Serial.println(residualRms, 4);
+    Serial.print("  Error en los picos R:           "); Serial.println(maxRError, 4);
+    Serial.print("  Tiempo por muestra (us):        "); Serial.println((float32_t)elapsed / total, 3);
+    Serial.print("  RAM float / int16 (bytes):      "); Serial.print(baseline.getMemoryUsage());
+    Serial.print(" / "); Serial.println(baseline16.getMemoryUsage());
+}
+
+// ============================================================================
+// SETUP Y LOOP
+// ============================================================================
+
+void setup() {
+    Serial.begin(115200);
+    while (!Serial && millis() < 5000);
+
+    printTestHeader("TEST MedianFilter - BioFilterLib");
+
+    testExact();
+    testImpulses();
+    testBaseline();
+
+    Serial.println();
+    printTestResult();
+}
+
+void loop() {
+    delay(1000);
+}
@@ -0,0 +1,339 @@
+/**
+ * @file Test_BioFilterLib_MovingAverage.ino
+ * @brief Test de MovingAverageFilter, MovingAverageInt16, CICFilter y CICFilterInt16
+ * @author Test Suite
+ * @version 1.0.0
+ * @date 2025
+ *
+ * Este test evalúa:
+ * - Que la media móvil de 144 muestras coincide con un FIRFilter boxcar de 144 taps,
+ *   también tras muchas vueltas del buffer (el redondeo de la suma no se acumula)
+ * - Tiempo por muestra frente al FIR y frente a la longitud de ventana (O(1))
+ * - La variante int16: media exacta con redondeo y salida diezmada
+ * - Que la media móvil funciona como etapa de FilterChain
+ * - CIC float de 3 etapas, R = 4: cascada de boxcars diezmada y nulo en Fs / 4
+ * - CIC int16 de 4 etapas, R = 16: salida sin normalizar exacta pese al desbordamiento
+ *   de los integradores, y coincidencia con el CIC float
+ */
+
+#include <BioFilterLib.h>
+
+// ============================================================================
+// CONFIGURACIÓN DEL TEST
+// ============================================================================
+
+#define SAMPLE_RATE  960
+#define WINDOW       144           // 150 ms a 960 Hz
+#define BLOCK_SIZE   32
+#define NUM_SAMPLES  4096
+#define LONG_RUN     200           // Bloques de NUM_SAMPLES en la prueba de deriva
+
+#define CIC_STAGES   3
+#define CIC_R        4
+#define INT_STAGES   4
+#define INT_R        16
+
+float32_t boxcarCoeffs[WINDOW];
+float32_t input[NUM_SAMPLES];
+float32_t firOutput[NUM_SAMPLES];
+float32_t maOutput[NUM_SAMPLES];
+
+int16_t adcInput[NUM_SAMPLES];
+int16_t adcOutput[NUM_SAMPLES];
+
+uint32_t seed = 12345;
+
+/**
+ * @brief Ruido uniforme en [-1, 1) (generador congruencial, reproducible)
+ */
+float32_t noise() {
+    seed = seed * 1664525UL + 1013904223UL;
+    return (int32_t)seed / 2147483648.0f;
+}
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+void testBoxcar() {
+    printSeparator();
+    Serial.println("  MovingAverageFilter frente a FIRFilter boxcar (144 taps)");
+    printSeparator();
+
+    for (uint16_t i = 0; i < WINDOW; i++) {
+        boxcarCoeffs[i] = 1.0f / WINDOW;
+    }
+    FIRFilter fir(boxcarCoeffs, WINDOW, BLOCK_SIZE);
+    MovingAverageFilter average(WINDOW);
+
+    // Señal con continua grande: el caso en que una suma acumulada pierde precisión
+    float32_t maxError = 0.0f;
+    uint32_t firTime = 0, maTime = 0;
+    for (uint32_t run = 0; run < LONG_RUN; run++) {
+        for (uint32_t n = 0; n < NUM_SAMPLES; n++) {
+            input[n] = 100.0f + sinf(2.0f * PI * 1.3f * (run * NUM_SAMPLES + n) / SAMPLE_RATE) + 0.2f * noise();
+        }
+        uint32_t start = micros();
+        for (uint32_t b = 0; b < NUM_SAMPLES; b += BLOCK_SIZE) {
+            fir.processBuffer(input + b, firOutput + b, BLOCK_SIZE);
+        }
+        firTime += micros() - start;
+
+        start = micros();
+        average.processBuffer(input, maOutput, NUM_SAMPLES);
+        maTime += micros() - start;
+
+        uint32_t first = (run == 0) ? WINDOW : 0;
+        for (uint32_t n = first; n < NUM_SAMPLES; n++) {
+            maxError = fmaxf(maxError, fabsf(maOutput[n] - firOutput[n]));
+        }
+    }
+
+    printCheck(maxError < 1e-3f, "Igual al boxcar FIR (error < 1e-3 sobre 100)");
+    printCheck(fabsf(average.getGroupDelay() - fir.getGroupDelay(0.01f)) < 0.01f, "Mismo retardo de grupo que el FIR");
+    printCheck(maTime < firTime, "Mas rapida que el FIR");
+    printCheck(average.getMemoryUsage() < fir.getMemoryUsage(), "Menos RAM que el FIR");
+
+    // Coste independiente de la ventana
+    MovingAverageFilter shortWindow(8);
+    MovingAverageFilter longWindow(4096);
+    uint32_t start = micros();
+    shortWindow.processBuffer(input, maOutput, NUM_SAMPLES);
+    uint32_t shortTime = micros() - start;
+    start = micros();
+    longWindow.processBuffer(input, maOutput, NUM_SAMPLES);
+    uint32_t longTime = micros() - start;
+
+    Serial.println();
+    Serial.print("  Error maximo:                   "); Serial.println(maxError, 6);
+    Serial.print("  Muestras procesadas:            "); Serial.println((uint32_t)LONG_RUN * NUM_SAMPLES);
+    Serial.print("  Tiempo FIR / media (us):        "); Serial.print(firTime);
+    Serial.print(" / "); Serial.println(maTime);
+    Serial.print("  Ventana 8 / 4096 (us):          "); Serial.print(shortTime);
+    Serial.print(" / "); Serial.println(longTime);
+    Serial.print("  RAM FIR / media (bytes):        "); Serial.print(fir.getMemoryUsage());
+    Serial.print(" / "); Serial.println(average.getMemoryUsage());
+}
+
+void testInt16() {
+    printSeparator();
+    Serial.println("  MovingAverageInt16: cuentas de ADC de 12 bits");
+    printSeparator();
+
+    for (uint32_t n = 0; n < NUM_SAMPLES; n++) {
+        adcInput[n] = (int16_t)(2048 + 1500 * sinf(2.0f * PI * 3.0f * n / SAMPLE_RATE) + 200 * noise());
+    }
+
+    // Ventana impar para probar el redondeo con signo
+    const uint16_t window = 15;
+    MovingAverageInt16 average(window);
+    average.processBuffer(adcInput, adcOutput, NUM_SAMPLES);
+
+    bool exact = true;
+    for (uint32_t n = window; n < NUM_SAMPLES && exact; n++) {
+        int32_t sum = 0;
+        for (uint16_t k = 0; k < window; k++) {
+            sum += adcInput[n - k];
+        }
+        exact = (adcOutput[n] == (int16_t)((sum + window / 2) / window));
+    }
+    printCheck(exact, "Media entera exacta con redondeo");
+
+    // Valores negativos: redondeo simétrico
+    MovingAverageInt16 negative(4);
+    int16_t values[4] = {-3, -3, -3, -1};
+    int16_t last = 0;
+    for (uint8_t i = 0; i < 4; i++) {
+        last = negative.processSample(values[i]);
+    }
+    printCheck(last == -3, "Redondeo de medias negativas (-2.5 -> -3)");
+
+    // Diezmado: una salida de cada 16, igual que la salida completa en esos instantes
+    MovingAverageInt16 decimated(16, 16);
+    int16_t reduced[NUM_SAMPLES / 16 + 1];
+    MovingAverageInt16 full(16);
+    full.processBuffer(adcInput, adcOutput, NUM_SAMPLES);
+    uint32_t produced = decimated.decimate(adcInput, 100, reduced);
+    produced += decimated.decimate(adcInput + 100, NUM_SAMPLES - 100, reduced + produced);
+    bool match = (produced == NUM_SAMPLES / 16);
+    for (uint32_t k = 0; k < produced && match; k++) {
+        match = (reduced[k] == adcOutput[16 * k + 15]);
+    }
+    printCheck(match, "decimate(): 1 de cada 16, en bloques irregulares");
+
+    Serial.println();
+    Serial.print("  RAM (bytes):                    "); Serial.println(average.getMemoryUsage());
+}
+
+void testChain() {
+    printSeparator();
+    Serial.println("  FilterChain<MovingAverageFilter, FIRFilter>");
+    printSeparator();
+
+    for (uint32_t n = 0; n < NUM_SAMPLES; n++) {
+        input[n] = sinf(2.0f * PI * 5.0f * n / SAMPLE_RATE) + 0.3f * noise();
+    }
+
+    MovingAverageFilter chained(WINDOW);
+    FIRFilter chainedFir(boxcarCoeffs, WINDOW, BLOCK_SIZE);
+    FilterChain<MovingAverageFilter, FIRFilter> chain(BLOCK_SIZE, chained, chainedFir);
+    for (uint32_t b = 0; b < NUM_SAMPLES; b += BLOCK_SIZE) {
+        chain.processBuffer(input + b, maOutput + b, BLOCK_SIZE);
+    }
+
+    MovingAverageFilter manual(WINDOW);
+    FIRFilter manualFir(boxcarCoeffs, WINDOW, BLOCK_SIZE);
+    manual.processBuffer(input, firOutput, NUM_SAMPLES);
+    for (uint32_t b = 0; b < NUM_SAMPLES; b += BLOCK_SIZE) {
+        manualFir.processBuffer(firOutput + b, firOutput + b, BLOCK_SIZE);
+    }
+
+    printCheck(memcmp(maOutput, firOutput, sizeof(firOutput)) == 0, "Cadena == etapas por separado");
+    printCheck(fabsf(chain.getGroupDelay(0.01f) - (WINDOW - 1)) < 0.02f, "Retardo de la cadena = 2 x (N-1)/2");
+}
+
+void testCic() {
+    printSeparator();
+    Serial.println("  CICFilter: 3 etapas, R = 4 (960 Hz -> 240 Hz)");
+    printSeparator();
+
+    for (uint32_t n = 0; n < NUM_SAMPLES; n++) {
+        input[n] = sinf(2.0f * PI * 7.0f * n / SAMPLE_RATE) + 0.3f * noise();
+    }
+
+    // Referencia: tres boxcar FIR de 4 taps y una muestra de cada 4
+    float32_t boxcar4[CIC_R];
+    for (uint16_t i = 0; i < CIC_R; i++) {
+        boxcar4[i] = 1.0f / CIC_R;
+    }
+    FIRFilter stage1(boxcar4, CIC_R, BLOCK_SIZE);
+    FIRFilter stage2(boxcar4, CIC_R, BLOCK_SIZE);
+    FIRFilter stage3(boxcar4, CIC_R, BLOCK_SIZE);
+    for (uint32_t b = 0; b < NUM_SAMPLES; b += BLOCK_SIZE) {
+        stage1.processBuffer(input + b, firOutput + b, BLOCK_SIZE);
+        stage2.processBuffer(firOutput + b, firOutput + b, BLOCK_SIZE);
+        stage3.processBuffer(firOutput + b, firOutput + b, BLOCK_SIZE);
+    }
+
+    CICFilter cic(CIC_STAGES, CIC_R);
+    uint32_t produced = cic.processBuffer(input, 1000, maOutput);
+    produced += cic.processBuffer(input + 1000, NUM_SAMPLES - 1000, maOutput + produced);
+    float32_t maxError = 0.0f;
+    for (uint32_t k = 0; k < produced; k++) {
+        maxError = fmaxf(maxError, fabsf(maOutput[k] - firOutput[CIC_R * k + CIC_R - 1]));
+    }
+    printCheck(produced == NUM_SAMPLES / CIC_R, "Salidas = entradas / R");
+    printCheck(maxError < 1e-5f, "Igual a 3 boxcar FIR diezmados");
+    printCheck(cic.getGroupDelay() == CIC_STAGES * (CIC_R - 1) * 0.5f, "Retardo N(R-1)/2");
+
+    // Nulo en Fs / R = 240 Hz: la banda que se plegaría sobre continua
+    CICFilter nullTest(CIC_STAGES, CIC_R);
+    for (uint32_t n = 0; n < NUM_SAMPLES; n++) {
+        input[n] = sinf(2.0f * PI * 240.0f * n / SAMPLE_RATE + 0.3f);
+    }
+    produced = nullTest.processBuffer(input, NUM_SAMPLES, maOutput);
+    float32_t nullRms = calculateRMS(maOutput + 8, produced - 8);
+    printCheck(nullRms < 1e-4f, "240 Hz anulado");
+    printCheck(fabsf(cic.getMagnitude(0.0f) - 1.0f) < 1e-6f && cic.getMagnitude(0.25f) < 1e-6f,
+               "getMagnitude(): 1 en continua, 0 en Fs / R");
+
+    Serial.println();
+    Serial.print("  Error frente a los FIR:         "); Serial.println(maxError, 8);
+    Serial.print("  RMS a 240 Hz:                   "); Serial.println(nullRms, 8);
+    Serial.print("  Ganancia a 40 Hz (dB):          "); Serial.println(20.0f * log10f(cic.getMagnitude(40.0f / SAMPLE_RATE)), 2);
+    Serial.print("  RAM (bytes):                    "); Serial.println(cic.getMemoryUsage());
+}
+
+void testCicInt16() {
+    printSeparator();
+    Serial.println("  CICFilterInt16: 4 etapas, R = 16 (16 bits de crecimiento)");
+    printSeparator();
+
+    for (uint32_t n = 0; n < NUM_SAMPLES; n++) {
+        adcInput[n] = (int16_t)(20000 * sinf(2.0f * PI * 11.0f * n / 16000.0f) + 8000 * noise());
+    }
+
+    CICFilterInt16 cic(INT_STAGES, INT_R);
+    printCheck(cic.isValid() && cic.getGain() == 65536UL, "Ganancia (R·M)^N = 2^16");
+    printCheck(!CICFilterInt16(5, INT_R).isValid(), "5 etapas con R = 16 no caben en 32 bits");
+
+    // Referencia: cascada de sumas de 16 muestras en 64 bits
+    static int64_t stage[2][NUM_SAMPLES];
+    for (uint32_t n = 0; n < NUM_SAMPLES; n++) {
+        stage[0][n] = adcInput[n];
+    }
+    for (uint8_t s = 0; s < INT_STAGES; s++) {
+        int64_t* in = stage[s & 1];
+        int64_t* out = stage[(s + 1) & 1];
+        for (uint32_t n = 0; n < NUM_SAMPLES; n++) {
+            int64_t sum = 0;
+            for (uint16_t k = 0; k < INT_R && k <= n; k++) {
+                sum += in[n - k];
+            }
+            out[n] = sum;
+        }
+    }
+
+    static int32_t raw[NUM_SAMPLES / INT_R + 1];
+    uint32_t produced = cic.processBufferRaw(adcInput, NUM_SAMPLES, raw);
+    bool exact = (produced == NUM_SAMPLES / INT_R);
+    for (uint32_t k = 0; k < produced && exact; k++) {
+        exact = (raw[k] == stage[INT_STAGES & 1][INT_R * k + INT_R - 1]);
+    }
+    printCheck(exact, "Salida sin normalizar exacta (integradores desbordados)");
+
+    // Normalizada frente al CIC float
+    CICFilterInt16 normalized(INT_STAGES, INT_R);
+    CICFilter reference(INT_STAGES, INT_R);
+    for (uint32_t n = 0; n < NUM_SAMPLES; n++) {
+        input[n] = adcInput[n];
+    }
+    normalized.processBuffer(adcInput, NUM_SAMPLES, adcOutput);
+    produced = reference.processBuffer(input, NUM_SAMPLES, maOutput);
+    int32_t maxDiff = 0;
+    for (uint32_t k = 0; k < produced; k++) {
+        int32_t diff = abs(adcOutput[k] - (int32_t)lroundf(maOutput[k]));
+        maxDiff = (diff > maxDiff) ? diff : maxDiff;
+    }
+    printCheck(maxDiff <= 1, "Normalizada == CIC float (+-1 LSB)");
+
+    // Continua a fondo de escala durante mucho tiempo
+    CICFilterInt16 fullScale(INT_STAGES, INT_R);
+    for (uint32_t n = 0; n < NUM_SAMPLES; n++) {
+        adcInput[n] = 32767;
+    }
+    int16_t last = 0;
+    for (uint8_t run = 0; run < 20; run++) {
+        produced = fullScale.processBuffer(adcInput, NUM_SAMPLES, adcOutput);
+        last = adcOutput[produced - 1];
+    }
+    printCheck(last == 32767, "Fondo de escala sostenido sin error");
+
+    Serial.println();
+    Serial.print("  Diferencia con el CIC float:    "); Serial.println(maxDiff);
+    Serial.print("  RAM (bytes):                    "); Serial.println(cic.getMemoryUsage());
+}
+
+// ============================================================================
+// SETUP Y LOOP
+// ============================================================================
+
+void setup() {
+    Serial.begin(115200);
+    while (!Serial && millis() < 5000);
+
+    printTestHeader("TEST MovingAverage / CIC - BioFilterLib");
+
+    testBoxcar();
+    testInt16();
+    testChain();
+    testCic();
+    testCicInt16();
+
+    Serial.println();
+    printTestResult();
+}
+
+void loop() {
+    delay(1000);
+}
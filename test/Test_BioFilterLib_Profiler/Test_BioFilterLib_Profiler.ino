@@ -0,0 +1,197 @@
+/**
+ * @file Test_BioFilterLib_Profiler.ino
+ * @brief Test del histograma de ciclos por llamada y del monitor de plazo
+ * @author Test Suite
+ * @version 1.0.0
+ * @date 2025
+ *
+ * Este test evalúa:
+ * - Que Profiled<Filter> no cambia la salida ni el retardo del filtro envuelto
+ * - Con BIOFILTERLIB_PROFILE = 0: que la instrumentación no ocupa memoria
+ * - Con BIOFILTERLIB_PROFILE = 1 (en BioFilterLibConfig.h):
+ *   - Cubetas HDR: cada valor cae en su cubeta, de anchura <= 12.5 %
+ *   - Percentiles, plazos incumplidos y peor llamada con medidas sintéticas
+ *   - Medida real de una cadena IIR -> FIR con una etapa perfilada por filtro
+ */
+
+#include <BioFilterLib.h>
+
+// ============================================================================
+// CONFIGURACIÓN DEL TEST
+// ============================================================================
+
+#define SAMPLE_RATE  960
+#define BLOCK_SIZE   32
+#define NUM_SAMPLES  2048
+#define FILTERTAPS   31
+
+// Notch 60 Hz, Q = 30 (scipy.signal.iirnotch), a1/a2 negados para CMSIS-DSP
+float32_t notchCoeffs[5] = {
+    0.99349748f, -1.83574398f,  0.99349748f,
+    1.83574398f, -0.98699496f
+};
+
+static constexpr FIRTable<FILTERTAPS> LOWPASS = FIRDesign::table<FILTERTAPS>(FIRDesign::lowpassSpec(40.0 / SAMPLE_RATE));
+
+float32_t input[NUM_SAMPLES];
+float32_t plain[NUM_SAMPLES];
+float32_t profiled[NUM_SAMPLES];
+
+uint32_t seed = 12345;
+
+float32_t noise() {
+    seed = seed * 1664525UL + 1013904223UL;
+    return (int32_t)seed / 2147483648.0f;
+}
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+void testTransparent() {
+    printSeparator();
+    Serial.println("  Profiled<Filter> no altera el filtro");
+    printSeparator();
+
+    for (uint32_t n = 0; n < NUM_SAMPLES; n++) {
+        input[n] = sinf(2.0f * PI * 10.0f * n / SAMPLE_RATE) + 0.2f * noise();
+    }
+
+    FIRFilter bare(LOWPASS.coeffs, FILTERTAPS, BLOCK_SIZE);
+    FIRFilter wrapped(LOWPASS.coeffs, FILTERTAPS, BLOCK_SIZE);
+    Profiled<FIRFilter> stage(wrapped);
+
+    bare.processBuffer(input, plain, NUM_SAMPLES);
+    stage.processBuffer(input, profiled, NUM_SAMPLES);
+    printCheck(memcmp(plain, profiled, sizeof(plain)) == 0, "Misma salida que el filtro sin envolver");
+    printCheck(stage.getGroupDelay() == bare.getGroupDelay(), "Mismo retardo de grupo");
+
+#if BIOFILTERLIB_PROFILE
+    printCheck(stage.getHistogram().getCount() == 1, "Una medida por processBuffer()");
+#else
+    printCheck(stage.getMemoryUsage() == bare.getMemoryUsage(), "Desactivado: sin memoria adicional");
+    printCheck(sizeof(CycleHistogram) == 1, "Desactivado: CycleHistogram vacío");
+#endif
+}
+
+#if BIOFILTERLIB_PROFILE
+
+void testBuckets() {
+    printSeparator();
+    Serial.println("  Cubetas logarítmicas");
+    printSeparator();
+
+    bool contained = true;
+    float32_t worstError = 0.0f;
+    uint32_t value = 1;
+    while (value < 0x7FFFFFFFUL) {
+        uint16_t bucket = CycleHistogram::bucketOf(value);
+        uint32_t upper = CycleHistogram::bucketUpper(bucket);
+        uint32_t lower = (bucket == 0) ? 0 : CycleHistogram::bucketUpper(bucket - 1) + 1;
+        contained = contained && bucket < CycleHistogram::NUM_BUCKETS && lower <= value && value <= upper;
+        if (value >= 16) {                          // Por debajo, una cubeta por valor
+            worstError = fmaxf(worstError, (float32_t)(upper - lower + 1) / lower);
+        }
+        value += value / 7 + 1;
+    }
+    printCheck(contained, "Cada valor cae dentro de su cubeta");
+    printCheck(worstError <= 0.125f, "Anchura de cubeta <= 12.5 % del valor");
+    printCheck(CycleHistogram::bucketOf(0xFFFFFFFFUL) == CycleHistogram::NUM_BUCKETS - 1, "uint32_t completo en 240 cubetas");
+
+    Serial.println();
+    Serial.print("  Error relativo máximo:          "); Serial.println(worstError, 4);
+    Serial.print("  RAM por histograma (bytes):     "); Serial.println(sizeof(CycleHistogram));
+}
+
+void testDeadline() {
+    printSeparator();
+    Serial.println("  Percentiles, plazo y peor llamada");
+    printSeparator();
+
+    // 990 llamadas de ~100 ciclos y 10 picos de 5000 con un plazo de 1000
+    CycleHistogram histogram(1000);
+    for (uint32_t i = 0; i < 1000; i++) {
+        uint32_t cycles = (i % 100 == 37) ? 5000 + i : 95 + (i % 11);
+        histogram.record(cycles);
+    }
+    printCheck(histogram.getCount() == 1000, "1000 medidas");
+    printCheck(histogram.getOverruns() == 10, "10 llamadas fuera de plazo");
+    printCheck(histogram.getMax() == 5937 && histogram.getWorstCall() == 937, "Peor llamada: #937, 5937 ciclos");
+    printCheck(histogram.getMin() == 95, "Mínimo: 95 ciclos");
+
+    uint32_t p50 = histogram.getPercentile(0.5f);
+    uint32_t p99 = histogram.getPercentile(0.99f);
+    uint32_t p999 = histogram.getPercentile(0.999f);
+    printCheck(p50 >= 100 && p50 < 113, "p50 ~ 100 ciclos (resolución de la cubeta)");
+    printCheck(p99 < 1000, "p99 dentro del plazo");
+    printCheck(p999 >= 5000, "p99.9 captura los picos");
+
+    // Un bloque de 32 muestras tiene 32 plazos
+    CycleHistogram block(1000);
+    block.record(20000, 32);
+    block.record(40000, 32);
+    printCheck(block.getOverruns() == 1, "Plazo de bloque = plazo por muestra × longitud");
+
+    histogram.reset();
+    printCheck(histogram.getCount() == 0 && histogram.getMax() == 0 && histogram.getPercentile(0.5f) == 0, "reset()");
+}
+
+void testChain() {
+    printSeparator();
+    Serial.println("  Cadena IIR -> FIR medida por etapas");
+    printSeparator();
+
+    IIRFilter notch(notchCoeffs, 1, BLOCK_SIZE);
+    FIRFilter lowpass(LOWPASS.coeffs, FILTERTAPS, BLOCK_SIZE);
+    Profiled<IIRFilter> notchStage(notch);
+    Profiled<FIRFilter> lowpassStage(lowpass);
+    notchStage.getHistogram().setDeadline(SAMPLE_RATE);
+    lowpassStage.getHistogram().setDeadline(SAMPLE_RATE);
+    FilterChain<Profiled<IIRFilter>, Profiled<FIRFilter> > chain(BLOCK_SIZE, notchStage, lowpassStage);
+
+    CycleHistogram isr;
+    isr.setDeadline(SAMPLE_RATE);
+    for (uint32_t n = 0; n < NUM_SAMPLES; n++) {
+        CycleHistogram::Scope timer(isr);
+        profiled[n] = chain.processSample(input[n]);
+    }
+
+    printCheck(notchStage.getHistogram().getCount() == NUM_SAMPLES, "Una medida por muestra en cada etapa");
+    printCheck(isr.getCount() == NUM_SAMPLES, "Medida manual con Scope");
+    printCheck(isr.getOverruns() == 0, "Ninguna muestra supera 1/fs");
+    printCheck(isr.getDeadline() == CycleCounter::frequency() / SAMPLE_RATE, "Plazo = frecuencia / fs");
+
+    printCycleHistogram(notchStage.getHistogram(), "IIR notch");
+    printCycleHistogram(lowpassStage.getHistogram(), "FIR pasa-bajas");
+    printCycleHistogram(isr, "Cadena completa");
+}
+
+#endif // BIOFILTERLIB_PROFILE
+
+// ============================================================================
+// SETUP Y LOOP
+// ============================================================================
+
+void setup() {
+    Serial.begin(115200);
+    while (!Serial && millis() < 5000);
+
+    printTestHeader("TEST PERFILADO - BioFilterLib");
+    CycleCounter::begin();
+
+    testTransparent();
+#if BIOFILTERLIB_PROFILE
+    testBuckets();
+    testDeadline();
+    testChain();
+#else
+    Serial.println("  BIOFILTERLIB_PROFILE = 0: activarlo en BioFilterLibConfig.h para medir");
+#endif
+
+    Serial.println();
+    printTestResult();
+}
+
+void loop() {
+    delay(1000);
+}
@@ -0,0 +1,334 @@
+/**
+ * @file Test_BioFilterLib_QRS.ino
+ * @brief Test de QRSDetector sobre la salida de un pipeline notch + pasa-bajas
+ * @author Test Suite
+ * @version 1.0.0
+ * @date 2025
+ *
+ * Este test evalúa:
+ * - Sensibilidad y valor predictivo positivo en 60 s de ECG sintético a 960 Hz con
+ *   interferencia de 60 Hz, deriva de línea base y ruido, con picos R conocidos
+ * - Error de la marca de tiempo frente al pico R real (descontando el retardo del pipeline)
+ * - Recuperación por búsqueda hacia atrás de latidos de baja amplitud
+ * - Latencia de confirmación acotada por getLatency()
+ * - Bloques de entrada y del detector grandes (512 y 128 muestras): mismas detecciones
+ * - Ejecución a la frecuencia diezmada (240 Hz) y memoria del detector
+ */
+
+#include <BioFilterLib.h>
+
+// ============================================================================
+// CONFIGURACIÓN DEL TEST
+// ============================================================================
+
+#define SAMPLE_RATE 960
+#define DURATION    60             // Segundos
+#define BLOCK_SIZE  32
+#define FILTERTAPS  51
+#define MAX_BEATS   100
+#define TOLERANCE   0.050f         // Ventana de acierto (s)
+#define WEAK_EVERY  15             // Cada 15 latidos, uno de amplitud reducida
+#define LARGE_BLOCK 512            // Bloque de entrada grande
+#define QRS_BLOCK   128            // Bloque del detector grande (a 240 Hz)
+
+// Notch 60 Hz, Q = 30 (scipy.signal.iirnotch), a1/a2 negados para CMSIS-DSP
+float32_t notchCoeffs[5] = {
+    0.99349748f, -1.83574398f,  0.99349748f,
+    1.83574398f, -0.98699496f
+};
+
+// Pasa-bajas fc = 40 Hz, ventana de Hamming (el mismo de Test_BioFilterLib_FIR)
+float32_t lowpassCoeffs[FILTERTAPS] = {
+    +0.00096226f, +0.00110652f, +0.00123488f, +0.00128605f, +0.00115012f, +0.00068979f, -0.00022373f, -0.00166613f,
+    -0.00361514f, -0.00591523f, -0.00826092f, -0.01020548f, -0.01119776f, -0.01064514f, -0.00799553f, -0.00282748f,
+    +0.00506537f, +0.01560960f, +0.02841897f, +0.04280137f, +0.05780805f, +0.07232126f, +0.08517038f, +0.09526185f,
+    +0.10170564f, +0.10392083f, +0.10170564f, +0.09526185f, +0.08517038f, +0.07232126f, +0.05780805f, +0.04280137f,
+    +0.02841897f, +0.01560960f, +0.00506537f, -0.00282748f, -0.00799553f, -0.01064514f, -0.01119776f, -0.01020548f,
+    -0.00826092f, -0.00591523f, -0.00361514f, -0.00166613f, -0.00022373f, +0.00068979f, +0.00115012f, +0.00128605f,
+    +0.00123488f, +0.00110652f, +0.00096226f
+};
+
+// ============================================================================
+// VARIABLES GLOBALES
+// ============================================================================
+
+float32_t beatTimes[MAX_BEATS];     // Picos R reales (s)
+float32_t beatAmplitude[MAX_BEATS];
+uint32_t numBeats = 0;
+
+uint32_t detected[MAX_BEATS * 2];
+uint32_t numDetected = 0;
+
+uint32_t noiseState = 12345;
+
+// ============================================================================
+// SEÑAL SINTÉTICA
+// ============================================================================
+
+float32_t gaussian(float32_t t, float32_t center, float32_t sigma) {
+    float32_t x = (t - center) / sigma;
+    return expf(-0.5f * x * x);
+}
+
+/**
+ * @brief Ruido aproximadamente gaussiano (suma de 4 uniformes), RMS ~ 1
+ */
+float32_t noise() {
+    float32_t sum = 0.0f;
+    for (int i = 0; i < 4; i++) {
+        noiseState = noiseState * 1664525u + 1013904223u;
+        sum += (noiseState >> 8) * (1.0f / 16777216.0f) - 0.5f;
+    }
+    return sum * 1.732f;
+}
+
+void createBeats() {
+    float32_t t = 0.5f;
+    while (t < DURATION - 0.5f && numBeats < MAX_BEATS) {
+        beatTimes[numBeats] = t;
+        beatAmplitude[numBeats] = (numBeats % WEAK_EVERY == WEAK_EVERY - 1) ? 0.35f : 1.0f;
+        // RR entre 0.65 y 0.95 s (63-92 lpm) con variación respiratoria
+        t += 0.8f + 0.15f * sinf(2.0f * PI * 0.25f * t);
+        numBeats++;
+    }
+}
+
+float32_t ecgSample(float32_t t, uint32_t* first) {
+    while (*first < numBeats && beatTimes[*first] < t - 0.5f) {
+        (*first)++;
+    }
+    float32_t value = 0.0f;
+    for (uint32_t b = *first; b < numBeats && beatTimes[b] < t + 0.5f; b++) {
+        float32_t r = beatTimes[b];
+        float32_t a = beatAmplitude[b];
+        value += 0.15f * gaussian(t, r - 0.18f, 0.025f)
+               - 0.10f * a * gaussian(t, r - 0.025f, 0.008f)
+               + 1.00f * a * gaussian(t, r, 0.010f)
+               - 0.20f * a * gaussian(t, r + 0.025f, 0.008f)
+               + 0.30f * gaussian(t, r + 0.25f, 0.040f);
+    }
+    return value
+         + 0.3f * sinf(2.0f * PI * 60.0f * t)
+         + 0.3f * sinf(2.0f * PI * 0.25f * t)
+         + 0.03f * noise();
+}
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+void testDetector() {
+    printSeparator();
+    Serial.println("  QRSDetector: 60 s de ECG sintetico a 960 Hz");
+    printSeparator();
+
+    IIRFilter notch(notchCoeffs, 1, BLOCK_SIZE);
+    FIRFilter lowpass(lowpassCoeffs, FILTERTAPS, BLOCK_SIZE);
+    FilterChain<IIRFilter, FIRFilter> chain(BLOCK_SIZE, notch, lowpass);
+
+    QRSDetector qrs(SAMPLE_RATE);
+    qrs.setInputDelay(chain.getGroupDelay(10.0f / SAMPLE_RATE));
+
+    float32_t raw[BLOCK_SIZE], clean[BLOCK_SIZE];
+    uint32_t beats[4];
+    uint32_t first = 0;
+    float32_t maxLatency = 0.0f;
+    uint32_t detectorTime = 0;
+
+    for (uint32_t n = 0; n < (uint32_t)DURATION * SAMPLE_RATE; n += BLOCK_SIZE) {
+        for (uint32_t i = 0; i < BLOCK_SIZE; i++) {
+            raw[i] = ecgSample((n + i) / (float32_t)SAMPLE_RATE, &first);
+        }
+        chain.processBuffer(raw, clean, BLOCK_SIZE);
+
+        uint32_t start = micros();
+        uint32_t found = qrs.processBuffer(clean, BLOCK_SIZE, beats, 4);
+        detectorTime += micros() - start;
+
+        for (uint32_t k = 0; k < found && numDetected < MAX_BEATS * 2; k++) {
+            detected[numDetected++] = beats[k];
+            float32_t latency = (n + BLOCK_SIZE - beats[k]) / (float32_t)SAMPLE_RATE;
+            if (latency > maxLatency) {
+                maxLatency = latency;
+            }
+        }
+    }
+
+    // Emparejar detecciones con picos R reales, tras los 2 s de aprendizaje y sin los
+    // 2 s finales (un latido débil ahí aún estaría pendiente de búsqueda hacia atrás)
+    uint32_t truePositives = 0, expected = 0, weakFound = 0, weakTotal = 0;
+    float32_t errorSum = 0.0f, maxError = 0.0f;
+    for (uint32_t b = 0; b < numBeats; b++) {
+        if (beatTimes[b] < 2.5f || beatTimes[b] > DURATION - 2.0f) {
+            continue;
+        }
+        expected++;
+        bool weak = beatAmplitude[b] < 1.0f;
+        weakTotal += weak;
+        for (uint32_t d = 0; d < numDetected; d++) {
+            float32_t error = fabsf(detected[d] / (float32_t)SAMPLE_RATE - beatTimes[b]);
+            if (error < TOLERANCE) {
+                truePositives++;
+                weakFound += weak;
+                errorSum += error;
+                maxError = fmaxf(maxError, error);
+                break;
+            }
+        }
+    }
+    uint32_t reported = 0;
+    for (uint32_t d = 0; d < numDetected; d++) {
+        float32_t t = detected[d] / (float32_t)SAMPLE_RATE;
+        reported += (t >= 2.45f && t <= DURATION - 2.0f + TOLERANCE);
+    }
+
+    float32_t sensitivity = 100.0f * truePositives / expected;
+    float32_t ppv = 100.0f * truePositives / (reported ? reported : 1);
+    float32_t meanError = truePositives ? errorSum / truePositives : 1.0f;
+
+    printCheck(sensitivity >= 99.0f, "Sensibilidad >= 99 %");
+    printCheck(ppv >= 99.0f, "Valor predictivo positivo >= 99 %");
+    printCheck(meanError < 0.010f, "Error medio de la marca de tiempo < 10 ms");
+    printCheck(weakFound == weakTotal && qrs.getSearchBackCount() > 0, "Latidos debiles recuperados");
+    printCheck(qrs.getDecimation() == 4, "Diezmado automatico a 240 Hz");
+    printCheck(fabsf(qrs.getHeartRate() - 60.0f / 0.8f) < 10.0f, "Frecuencia cardiaca coherente");
+
+    Serial.println();
+    Serial.print("  Latidos reales / detectados:    "); Serial.print(expected); Serial.print(" / "); Serial.println(reported);
+    Serial.print("  Sensibilidad / VPP (%):         "); Serial.print(sensitivity, 1); Serial.print(" / "); Serial.println(ppv, 1);
+    Serial.print("  Error medio / maximo (ms):      "); Serial.print(meanError * 1000.0f, 2); Serial.print(" / "); Serial.println(maxError * 1000.0f, 2);
+    Serial.print("  Busquedas hacia atras:          "); Serial.println(qrs.getSearchBackCount());
+    Serial.print("  Frecuencia cardiaca (lpm):      "); Serial.println(qrs.getHeartRate(), 1);
+    Serial.print("  Latencia maxima medida (ms):    "); Serial.println(maxLatency * 1000.0f, 1);
+    Serial.print("  getLatency() (ms):              "); Serial.println(qrs.getLatency() * 1000.0f, 1);
+    Serial.print("  Frecuencia del detector (Hz):   "); Serial.println(qrs.getDecimatedRate(), 1);
+    Serial.print("  RAM detector (bytes):           "); Serial.println(qrs.getMemoryUsage());
+    Serial.print("  Tiempo detector, 60 s (us):     "); Serial.println(detectorTime);
+}
+
+void testLatency() {
+    printSeparator();
+    Serial.println("  QRSDetector: latencia de los latidos normales");
+    printSeparator();
+
+    // Señal limpia y sin latidos débiles: cada latido debe llegar dentro de getLatency()
+    // más el tamaño de bloque (el retardo del pipeline se descuenta en la marca)
+    IIRFilter notch(notchCoeffs, 1, BLOCK_SIZE);
+    FIRFilter lowpass(lowpassCoeffs, FILTERTAPS, BLOCK_SIZE);
+    FilterChain<IIRFilter, FIRFilter> chain(BLOCK_SIZE, notch, lowpass);
+    float32_t pipelineDelay = chain.getGroupDelay(10.0f / SAMPLE_RATE);
+
+    QRSDetector qrs(SAMPLE_RATE);
+    qrs.setInputDelay(pipelineDelay);
+
+    for (uint32_t b = 0; b < numBeats; b++) {
+        beatAmplitude[b] = 1.0f;
+    }
+
+    float32_t raw[BLOCK_SIZE], clean[BLOCK_SIZE];
+    uint32_t beats[4];
+    uint32_t first = 0;
+    float32_t maxLatency = 0.0f;
+    for (uint32_t n = 0; n < 20u * SAMPLE_RATE; n += BLOCK_SIZE) {
+        for (uint32_t i = 0; i < BLOCK_SIZE; i++) {
+            raw[i] = ecgSample((n + i) / (float32_t)SAMPLE_RATE, &first);
+        }
+        chain.processBuffer(raw, clean, BLOCK_SIZE);
+        uint32_t found = qrs.processBuffer(clean, BLOCK_SIZE, beats, 4);
+        for (uint32_t k = 0; k < found; k++) {
+            float32_t latency = (n + BLOCK_SIZE - beats[k]) / (float32_t)SAMPLE_RATE;
+            maxLatency = fmaxf(maxLatency, latency);
+        }
+    }
+    float32_t bound = qrs.getLatency() + (pipelineDelay + BLOCK_SIZE) / SAMPLE_RATE;
+    printCheck(qrs.getSearchBackCount() == 0, "Sin busquedas hacia atras en senal limpia");
+    printCheck(maxLatency <= bound, "Latencia <= getLatency() + pipeline + bloque");
+
+    Serial.println();
+    Serial.print("  Latencia maxima / cota (ms):    "); Serial.print(maxLatency * 1000.0f, 1);
+    Serial.print(" / "); Serial.println(bound * 1000.0f, 1);
+}
+
+void testLargeBlocks() {
+    printSeparator();
+    Serial.println("  QRSDetector: bloques de 512 muestras, blockSize = 128");
+    printSeparator();
+
+    // Un bloque diezmado de 128 muestras es mayor que la ventana de integración: el
+    // historial debe seguir conservando el tramo donde se busca el pico R
+    static float32_t raw[LARGE_BLOCK], clean[LARGE_BLOCK];
+    IIRFilter notch(notchCoeffs, 1, LARGE_BLOCK);
+    FIRFilter lowpass(lowpassCoeffs, FILTERTAPS, LARGE_BLOCK);
+    FilterChain<IIRFilter, FIRFilter> chain(LARGE_BLOCK, notch, lowpass);
+
+    QRSDetector qrs(SAMPLE_RATE, 0, QRS_BLOCK);
+    qrs.setInputDelay(chain.getGroupDelay(10.0f / SAMPLE_RATE));
+
+    uint32_t beats[16];
+    uint32_t first = 0;
+    numDetected = 0;
+    for (uint32_t n = 0; n < (uint32_t)DURATION * SAMPLE_RATE; n += LARGE_BLOCK) {
+        for (uint32_t i = 0; i < LARGE_BLOCK; i++) {
+            raw[i] = ecgSample((n + i) / (float32_t)SAMPLE_RATE, &first);
+        }
+        chain.processBuffer(raw, clean, LARGE_BLOCK);
+        uint32_t found = qrs.processBuffer(clean, LARGE_BLOCK, beats, 16);
+        for (uint32_t k = 0; k < found && numDetected < MAX_BEATS * 2; k++) {
+            detected[numDetected++] = beats[k];
+        }
+    }
+
+    uint32_t truePositives = 0, expected = 0;
+    float32_t maxError = 0.0f;
+    for (uint32_t b = 0; b < numBeats; b++) {
+        if (beatTimes[b] < 2.5f || beatTimes[b] > DURATION - 2.0f) {
+            continue;
+        }
+        expected++;
+        for (uint32_t d = 0; d < numDetected; d++) {
+            float32_t error = fabsf(detected[d] / (float32_t)SAMPLE_RATE - beatTimes[b]);
+            if (error < TOLERANCE) {
+                truePositives++;
+                maxError = fmaxf(maxError, error);
+                break;
+            }
+        }
+    }
+    uint32_t reported = 0;
+    for (uint32_t d = 0; d < numDetected; d++) {
+        float32_t t = detected[d] / (float32_t)SAMPLE_RATE;
+        reported += (t >= 2.45f && t <= DURATION - 2.0f + TOLERANCE);
+    }
+    float32_t sensitivity = 100.0f * truePositives / expected;
+    float32_t ppv = 100.0f * truePositives / (reported ? reported : 1);
+
+    printCheck(sensitivity >= 99.0f && ppv >= 99.0f, "Se y VPP >= 99 % con bloques grandes");
+    printCheck(maxError < 0.010f, "Error maximo de la marca de tiempo < 10 ms");
+
+    Serial.println();
+    Serial.print("  Sensibilidad / VPP (%):         "); Serial.print(sensitivity, 1); Serial.print(" / "); Serial.println(ppv, 1);
+    Serial.print("  Error maximo (ms):              "); Serial.println(maxError * 1000.0f, 2);
+}
+
+// ============================================================================
+// SETUP Y LOOP
+// ============================================================================
+
+void setup() {
+    Serial.begin(115200);
+    while (!Serial && millis() < 5000);
+
+    printTestHeader("TEST QRSDetector - BioFilterLib");
+
+    createBeats();
+    testDetector();
+    testLatency();
+    testLargeBlocks();
+
+    Serial.println();
+    printTestResult();
+}
+
+void loop() {
+    delay(1000);
+}
@@ -0,0 +1,232 @@
+/**
+ * @file Test_BioFilterLib_Resampler.ino
+ * @brief Test de PolyphaseResampler y FarrowResampler
+ * @author Test Suite
+ * @version 1.0.0
+ * @date 2025
+ *
+ * Este test evalúa:
+ * - 100 Hz -> 960 Hz (L = 48, M = 5): error frente a la senoide ideal, compensando el retardo
+ * - Que procesar en bloques de tamaños irregulares da la misma salida que un solo bloque
+ * - 250 Hz -> 100 Hz (L = 2, M = 5): paso de 10 Hz y rechazo de 80 Hz (aliasing)
+ * - Farrow 100 Hz -> 960 Hz: error de interpolación cúbica
+ * - Corrección de deriva: acelerómetro a 100.03 Hz (+300 ppm) sincronizado con un ECG a 960 Hz
+ */
+
+#include <BioFilterLib.h>
+
+// ============================================================================
+// CONFIGURACIÓN DEL TEST
+// ============================================================================
+
+#define ACCEL_RATE   100
+#define ECG_RATE     960
+#define UP_L         48
+#define UP_M         5
+#define UP_TAPS      768           // 16 × max(L, M)
+#define INPUT_LENGTH 400           // 4 s a 100 Hz
+#define OUTPUT_LENGTH (INPUT_LENGTH * UP_L / UP_M)
+
+#define DOWN_L       2
+#define DOWN_M       5
+#define DOWN_TAPS    80
+
+#define DRIFT_PPM    300.0f
+#define DRIFT_TICKS  4000          // Bloques de 96 muestras ECG (0.1 s)
+
+float32_t upCoeffs[UP_TAPS];
+float32_t downCoeffs[DOWN_TAPS];
+
+float32_t input[INPUT_LENGTH];
+float32_t output[OUTPUT_LENGTH + 8];
+float32_t chunked[OUTPUT_LENGTH + 8];
+
+float32_t testSignal(float32_t t) {
+    return sinf(2.0f * PI * 2.0f * t) + 0.5f * sinf(2.0f * PI * 7.0f * t);
+}
+
+/**
+ * @brief Error máximo frente a la señal ideal en los instantes de salida
+ * @param delay Retardo del conversor en muestras de entrada
+ */
+float32_t maxErrorVsIdeal(const float32_t* out, uint32_t length, float32_t outRate, float32_t delay, uint32_t skip) {
+    float32_t maxError = 0.0f;
+    for (uint32_t n = skip; n < length; n++) {
+        float32_t t = n / outRate - delay / ACCEL_RATE;
+        maxError = fmaxf(maxError, fabsf(out[n] - testSignal(t)));
+    }
+    return maxError;
+}
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+void testPolyphaseUp() {
+    printSeparator();
+    Serial.println("  PolyphaseResampler: 100 Hz -> 960 Hz (L = 48, M = 5)");
+    printSeparator();
+
+    PolyphaseResampler::designLowpass(upCoeffs, UP_TAPS, UP_L, UP_M);
+    PolyphaseResampler resampler(upCoeffs, UP_TAPS, UP_L, UP_M, 32);
+
+    uint32_t start = micros();
+    uint32_t produced = resampler.processBuffer(input, INPUT_LENGTH, output);
+    uint32_t elapsed = micros() - start;
+    printCheck(produced == OUTPUT_LENGTH, "Salidas = entradas x L / M");
+    printCheck(produced <= resampler.getMaxOutputLength(INPUT_LENGTH), "getMaxOutputLength() es cota superior");
+
+    float32_t delay = resampler.getGroupDelay();
+    float32_t error = maxErrorVsIdeal(output, produced, ECG_RATE, delay, 2 * UP_TAPS / UP_M);
+    printCheck(error < 5e-3f, "Error frente a la senoide ideal < 5e-3");
+
+    // Bloques irregulares: misma salida, muestra a muestra
+    PolyphaseResampler blocks(upCoeffs, UP_TAPS, UP_L, UP_M, 32);
+    const uint32_t sizes[] = {1, 7, 13, 64, 3, 50};
+    uint32_t consumed = 0, total = 0, k = 0;
+    while (consumed < INPUT_LENGTH) {
+        uint32_t n = sizes[k++ % 6];
+        if (n > INPUT_LENGTH - consumed) {
+            n = INPUT_LENGTH - consumed;
+        }
+        total += blocks.processBuffer(input + consumed, n, chunked + total);
+        consumed += n;
+    }
+    printCheck(total == produced && memcmp(chunked, output, produced * sizeof(float32_t)) == 0,
+               "Bloques irregulares == un solo bloque");
+
+    Serial.println();
+    Serial.print("  Retardo (muestras a 100 Hz):    "); Serial.println(delay, 2);
+    Serial.print("  Error maximo:                   "); Serial.println(error, 6);
+    Serial.print("  Coef. por salida (MACs):        "); Serial.println(UP_TAPS / UP_L);
+    Serial.print("  RAM (bytes):                    "); Serial.println(resampler.getMemoryUsage());
+    Serial.print("  Tiempo 4 s de senal (us):       "); Serial.println(elapsed);
+}
+
+void testPolyphaseDown() {
+    printSeparator();
+    Serial.println("  PolyphaseResampler: 250 Hz -> 100 Hz (L = 2, M = 5)");
+    printSeparator();
+
+    PolyphaseResampler::designLowpass(downCoeffs, DOWN_TAPS, DOWN_L, DOWN_M);
+    const uint32_t length = 1000;
+    float32_t* in = new float32_t[length];
+    float32_t* out = new float32_t[length];
+
+    // 10 Hz: dentro de la banda de paso
+    PolyphaseResampler pass(downCoeffs, DOWN_TAPS, DOWN_L, DOWN_M, 50);
+    for (uint32_t n = 0; n < length; n++) {
+        in[n] = sinf(2.0f * PI * 10.0f * n / 250.0f);
+    }
+    uint32_t produced = pass.processBuffer(in, length, out);
+    float32_t passRms = calculateRMS(out + 40, produced - 40);
+
+    // 80 Hz: por encima de la nueva Nyquist (50 Hz), se plegaría a 20 Hz
+    PolyphaseResampler stop(downCoeffs, DOWN_TAPS, DOWN_L, DOWN_M, 50);
+    for (uint32_t n = 0; n < length; n++) {
+        in[n] = sinf(2.0f * PI * 80.0f * n / 250.0f);
+    }
+    stop.processBuffer(in, length, out);
+    float32_t stopRms = calculateRMS(out + 40, produced - 40);
+
+    printCheck(produced == length * DOWN_L / DOWN_M, "Salidas = entradas x 2 / 5");
+    printCheck(fabsf(passRms - 0.7071f) < 0.01f, "10 Hz pasa sin atenuacion");
+    printCheck(stopRms < 0.01f, "80 Hz rechazado (sin aliasing)");
+
+    Serial.println();
+    Serial.print("  RMS 10 Hz / 80 Hz:              "); Serial.print(passRms, 4);
+    Serial.print(" / "); Serial.println(stopRms, 5);
+
+    delete[] in;
+    delete[] out;
+}
+
+void testFarrow() {
+    printSeparator();
+    Serial.println("  FarrowResampler: 100 Hz -> 960 Hz");
+    printSeparator();
+
+    FarrowResampler resampler(ACCEL_RATE, ECG_RATE, 32);
+    uint32_t produced = resampler.processBuffer(input, INPUT_LENGTH, output);
+    printCheck(produced >= OUTPUT_LENGTH - 1 && produced <= resampler.getMaxOutputLength(INPUT_LENGTH),
+               "Salidas ~ entradas x 9.6");
+
+    float32_t error = maxErrorVsIdeal(output, produced, ECG_RATE, resampler.getGroupDelay(), 40);
+    printCheck(error < 5e-3f, "Error de interpolacion cubica < 5e-3");
+
+    Serial.println();
+    Serial.print("  Error maximo:                   "); Serial.println(error, 6);
+    Serial.print("  RAM (bytes):                    "); Serial.println(resampler.getMemoryUsage());
+}
+
+void testDrift() {
+    printSeparator();
+    Serial.println("  FarrowResampler: deriva de +300 ppm del acelerometro");
+    printSeparator();
+
+    // Cada tick: el ECG consume 96 muestras (0.1 s); el acelerómetro entrega las
+    // muestras que su reloj real (100.03 Hz) ha generado en ese intervalo
+    FarrowResampler resampler(ACCEL_RATE, ECG_RATE, 16);
+    float32_t trueRate = ACCEL_RATE * (1.0f + DRIFT_PPM * 1e-6f);
+    float32_t accel[16];
+    float32_t out[200];
+    uint32_t generated = 0;
+    int32_t level = 0;
+    int32_t maxLevel = 0;
+    float32_t ppmSum = 0.0f;
+
+    for (uint32_t tick = 1; tick <= DRIFT_TICKS; tick++) {
+        uint32_t due = (uint32_t)(tick * 0.1f * trueRate);
+        uint32_t count = due - generated;
+        for (uint32_t i = 0; i < count; i++) {
+            accel[i] = sinf(2.0f * PI * 0.5f * (generated + i) / trueRate);
+        }
+        generated = due;
+
+        level += (int32_t)resampler.processBuffer(accel, count, out) - ECG_RATE / 10;
+        resampler.correctDrift((float32_t)level);
+        if (tick > DRIFT_TICKS / 2) {
+            // La entrada llega en paquetes de 10-11 muestras: el nivel (y la parte
+            // proporcional de la corrección) oscila de un tick a otro; se promedia
+            ppmSum += resampler.getDriftPpm();
+            if (abs(level) > maxLevel) {
+                maxLevel = abs(level);
+            }
+        }
+    }
+
+    float32_t ppm = ppmSum / (DRIFT_TICKS / 2);
+    printCheck(fabsf(ppm - DRIFT_PPM) < 30.0f, "Deriva estimada ~ +300 ppm");
+    printCheck(maxLevel <= 12, "Nivel del buffer acotado tras converger");
+
+    Serial.println();
+    Serial.print("  Deriva estimada (ppm):          "); Serial.println(ppm, 1);
+    Serial.print("  Desfase maximo (muestras):      "); Serial.println(maxLevel);
+}
+
+// ============================================================================
+// SETUP Y LOOP
+// ============================================================================
+
+void setup() {
+    Serial.begin(115200);
+    while (!Serial && millis() < 5000);
+
+    printTestHeader("TEST Resampler - BioFilterLib");
+
+    for (uint32_t n = 0; n < INPUT_LENGTH; n++) {
+        input[n] = testSignal((float32_t)n / ACCEL_RATE);
+    }
+
+    testPolyphaseUp();
+    testPolyphaseDown();
+    testFarrow();
+    testDrift();
+
+    Serial.println();
+    printTestResult();
+}
+
+void loop() {
+    delay(1000);
+}
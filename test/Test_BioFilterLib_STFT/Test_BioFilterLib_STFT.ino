@@ -0,0 +1,212 @@
+/**
+ * @file Test_BioFilterLib_STFT.ino
+ * @brief Test de la STFT en streaming
+ * @author Test Suite
+ * @version 1.0.0
+ * @date 2025
+ *
+ * Este test evalúa:
+ * - Número de tramas y que bloques de tamaños irregulares dan las mismas tramas
+ * - Que cada trama coincide con la DFT directa de su ventana de muestras
+ * - Amplitud normalizada (seno de amplitud A -> pico A) con Hann y rectangular
+ * - Salida en dB == 20·log10 de la magnitud
+ * - Planes de FFT compartidos y tamaños no soportados
+ */
+
+#include <BioFilterLib.h>
+
+// ============================================================================
+// CONFIGURACIÓN DEL TEST
+// ============================================================================
+
+#define SAMPLE_RATE  250
+#define FFT_SIZE     256
+#define HOP          64
+#define NUM_SAMPLES  2000          // 8 s: 4 s con un seno en el bin 10 y 4 s en el bin 31
+#define NUM_FRAMES   ((NUM_SAMPLES - FFT_SIZE) / HOP + 1)
+#define BINS         (FFT_SIZE / 2 + 1)
+
+float32_t signal[NUM_SAMPLES];
+float32_t magnitude[NUM_FRAMES + 1][BINS];
+float32_t chunked[NUM_FRAMES + 1][BINS];
+float32_t decibels[NUM_FRAMES + 1][BINS];
+float32_t complexFrames[NUM_FRAMES + 1][FFT_SIZE];
+float32_t window[FFT_SIZE];
+
+uint32_t seed = 12345;
+
+float32_t noise() {
+    seed = seed * 1664525UL + 1013904223UL;
+    return (int32_t)seed / 2147483648.0f;
+}
+
+void generateSignal() {
+    for (uint32_t n = 0; n < NUM_SAMPLES; n++) {
+        float32_t bin = (n < NUM_SAMPLES / 2) ? 10.0f : 31.0f;
+        float32_t amplitude = (n < NUM_SAMPLES / 2) ? 1.0f : 0.5f;
+        signal[n] = amplitude * sinf(2.0f * PI * bin * n / FFT_SIZE + 0.3f) + 0.01f * noise();
+    }
+}
+
+/**
+ * @brief Bin de mayor magnitud de una trama
+ */
+uint16_t peakBin(const float32_t* frame) {
+    uint16_t peak = 1;
+    for (uint16_t k = 1; k < BINS; k++) {
+        if (frame[k] > frame[peak]) {
+            peak = k;
+        }
+    }
+    return peak;
+}
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+void testFrames() {
+    printSeparator();
+    Serial.println("  Tramas en streaming");
+    printSeparator();
+
+    STFT stft(FFT_SIZE, HOP, STFT::WINDOW_HANN, STFT::OUTPUT_MAGNITUDE);
+    printCheck(stft.isValid() && stft.getFrameLength() == BINS, "256 puntos: 129 bins por trama");
+
+    uint32_t produced = 0;
+    bool bounded = true;
+    for (uint32_t start = 0; start < NUM_SAMPLES; start += 32) {
+        uint32_t n = stft.processBuffer(signal + start, 32, magnitude[produced]);
+        bounded = bounded && n <= stft.getMaxOutputFrames(32);
+        produced += n;
+    }
+    printCheck(produced == NUM_FRAMES && stft.getFrameCount() == NUM_FRAMES, "Una trama cada 64 muestras tras las 256 primeras");
+    printCheck(bounded, "getMaxOutputFrames() es cota superior");
+
+    STFT irregular(FFT_SIZE, HOP, STFT::WINDOW_HANN, STFT::OUTPUT_MAGNITUDE);
+    const uint32_t sizes[] = {1, 7, 300, 13, 64, 3, 100};
+    uint32_t consumed = 0, total = 0, k = 0;
+    while (consumed < NUM_SAMPLES) {
+        uint32_t n = sizes[k++ % 7];
+        if (n > NUM_SAMPLES - consumed) {
+            n = NUM_SAMPLES - consumed;
+        }
+        total += irregular.processBuffer(signal + consumed, n, chunked[total]);
+        consumed += n;
+    }
+    printCheck(total == NUM_FRAMES && memcmp(chunked, magnitude, NUM_FRAMES * BINS * sizeof(float32_t)) == 0,
+               "Bloques irregulares == bloques de 32");
+
+    // DFT directa de la trama 5 (muestras 320 .. 575)
+    STFT::designWindow(window, FFT_SIZE, STFT::WINDOW_HANN);
+    float32_t windowSum = 0.0f;
+    for (uint16_t n = 0; n < FFT_SIZE; n++) {
+        windowSum += window[n];
+    }
+    float32_t error = 0.0f;
+    for (uint16_t bin = 0; bin < BINS; bin += 7) {
+        float32_t re = 0.0f, im = 0.0f;
+        for (uint16_t n = 0; n < FFT_SIZE; n++) {
+            float32_t x = signal[5 * HOP + n] * window[n];
+            re += x * cosf(2.0f * PI * bin * n / FFT_SIZE);
+            im -= x * sinf(2.0f * PI * bin * n / FFT_SIZE);
+        }
+        float32_t reference = sqrtf(re * re + im * im) * 2.0f / windowSum;
+        if (bin == 0) {
+            reference *= 0.5f;
+        }
+        error = fmaxf(error, fabsf(magnitude[5][bin] - reference));
+    }
+    printCheck(error < 1e-3f, "Trama 5 == DFT directa de sus 256 muestras");
+
+    // Amplitud: 1.0 en el bin 10 al principio, 0.5 en el bin 31 al final
+    uint16_t first = peakBin(magnitude[2]);
+    uint16_t last = peakBin(magnitude[NUM_FRAMES - 1]);
+    printCheck(first == 10 && fabsf(magnitude[2][10] - 1.0f) < 0.01f, "Hann: bin 10 con amplitud 1.0");
+    printCheck(last == 31 && fabsf(magnitude[NUM_FRAMES - 1][31] - 0.5f) < 0.01f, "Hann: bin 31 con amplitud 0.5");
+
+    Serial.println();
+    Serial.print("  Tramas:                         "); Serial.println(produced);
+    Serial.print("  Error frente a DFT directa:     "); Serial.println(error, 6);
+    Serial.print("  Pico inicial / final:           "); Serial.print(magnitude[2][10], 4);
+    Serial.print(" / "); Serial.println(magnitude[NUM_FRAMES - 1][31], 4);
+    Serial.print("  RAM (bytes):                    "); Serial.println(stft.getMemoryUsage());
+}
+
+void testOutputs() {
+    printSeparator();
+    Serial.println("  Salidas en dB, compleja y ventana rectangular");
+    printSeparator();
+
+    STFT db(FFT_SIZE, HOP, STFT::WINDOW_HANN, STFT::OUTPUT_DB);
+    uint32_t frames = db.processBuffer(signal, NUM_SAMPLES, decibels[0]);
+    float32_t error = 0.0f;
+    for (uint32_t f = 0; f < frames; f++) {
+        for (uint16_t k = 0; k < BINS; k++) {
+            if (magnitude[f][k] > 1e-4f) {
+                error = fmaxf(error, fabsf(decibels[f][k] - 20.0f * log10f(magnitude[f][k])));
+            }
+        }
+    }
+    printCheck(frames == NUM_FRAMES && error < 0.01f, "dB == 20·log10(magnitud)");
+
+    STFT raw(FFT_SIZE, HOP, STFT::WINDOW_HANN, STFT::OUTPUT_COMPLEX);
+    printCheck(raw.getFrameLength() == FFT_SIZE, "Compleja: 256 valores por trama");
+    raw.processBuffer(signal, NUM_SAMPLES, complexFrames[0]);
+    float32_t re = complexFrames[2][2 * 10], im = complexFrames[2][2 * 10 + 1];
+    float32_t windowSum = 0.0f;
+    for (uint16_t n = 0; n < FFT_SIZE; n++) {
+        windowSum += window[n];
+    }
+    printCheck(fabsf(sqrtf(re * re + im * im) * 2.0f / windowSum - magnitude[2][10]) < 1e-4f,
+               "Compleja: |X10| coincide con la magnitud");
+
+    STFT rectangular(FFT_SIZE, FFT_SIZE, STFT::WINDOW_RECTANGULAR, STFT::OUTPUT_MAGNITUDE);
+    uint32_t n = rectangular.processBuffer(signal, NUM_SAMPLES, chunked[0]);
+    printCheck(n == NUM_SAMPLES / FFT_SIZE && fabsf(chunked[n - 1][31] - 0.5f) < 0.01f,
+               "Rectangular sin solape: bin 31 con amplitud 0.5");
+
+    Serial.println();
+    Serial.print("  Error dB maximo:                "); Serial.println(error, 5);
+    Serial.print("  Pico inicial (dB):              "); Serial.println(decibels[2][10], 3);
+}
+
+void testPlans() {
+    printSeparator();
+    Serial.println("  Planes de FFT compartidos");
+    printSeparator();
+
+    STFT a(FFT_SIZE, HOP);
+    STFT b(FFT_SIZE, 32, STFT::WINDOW_BLACKMAN);
+    arm_rfft_fast_instance_f32* plan = STFT::getPlan(FFT_SIZE);
+    printCheck(plan != nullptr && plan == STFT::getPlan(FFT_SIZE), "Un solo plan por tamano");
+    printCheck(STFT::getPlan(512) != plan && STFT::getPlan(512) != nullptr, "Otro tamano, otro plan");
+
+    STFT invalid(100, 10);
+    float32_t frame[BINS];
+    printCheck(!invalid.isValid() && STFT::getPlan(100) == nullptr && invalid.processBuffer(signal, 200, frame) == 0,
+               "Tamano no potencia de 2: isValid() == false");
+}
+
+// ============================================================================
+// SETUP Y LOOP
+// ============================================================================
+
+void setup() {
+    Serial.begin(115200);
+    while (!Serial && millis() < 5000);
+
+    printTestHeader("TEST STFT - BioFilterLib");
+
+    generateSignal();
+    testFrames();
+    testOutputs();
+    testPlans();
+
+    Serial.println();
+    printTestResult();
+}
+
+void loop() {
+    delay(1000);
+}
@@ -0,0 +1,185 @@
+/**
+ * @file Test_BioFilterLib_SavitzkyGolay.ino
+ * @brief Test de los filtros de Savitzky-Golay
+ * @author Test Suite
+ * @version 1.0.0
+ * @date 2025
+ *
+ * Este test evalúa:
+ * - Coeficientes constexpr frente a las tablas clásicas (ventana de 5, cuadrática)
+ * - Que un polinomio de grado <= Order sale exacto (valor y derivada)
+ * - Que el núcleo plegado coincide con dos FIRFilter con los mismos coeficientes
+ * - Derivada en unidades por segundo y segunda derivada
+ * - Tiempo por muestra: una pasada plegada frente a dos FIRFilter
+ */
+
+#include <BioFilterLib.h>
+
+// ============================================================================
+// CONFIGURACIÓN DEL TEST
+// ============================================================================
+
+#define SAMPLE_RATE  125           // PPG
+#define WINDOW       15
+#define ORDER        3
+#define BLOCK_SIZE   32
+#define NUM_SAMPLES  1024
+
+typedef SavitzkyGolay<WINDOW, ORDER, 1> PPGFilter;
+
+static constexpr FIRTable<5> SMOOTH5 = SavitzkyGolay<5, 2, 1>::table(0);
+static constexpr FIRTable<5> SLOPE5 = SavitzkyGolay<5, 2, 1>::table(1);
+static constexpr FIRTable<5> CURVE5 = SavitzkyGolay<5, 2, 2>::table(2);
+static constexpr FIRTable<WINDOW> SMOOTH = PPGFilter::table(0);
+static constexpr FIRTable<WINDOW> SLOPE = PPGFilter::table(1);
+
+float32_t input[NUM_SAMPLES];
+float32_t smoothed[NUM_SAMPLES];
+float32_t slope[NUM_SAMPLES];
+float32_t firSmoothed[NUM_SAMPLES];
+float32_t firSlope[NUM_SAMPLES];
+
+uint32_t seed = 12345;
+
+float32_t noise() {
+    seed = seed * 1664525UL + 1013904223UL;
+    return (int32_t)seed / 2147483648.0f;
+}
+
+bool matches(const float32_t* coeffs, const float32_t* expected, float32_t denominator, uint16_t length) {
+    bool ok = true;
+    for (uint16_t i = 0; i < length; i++) {
+        ok = ok && fabsf(coeffs[i] - expected[i] / denominator) < 1e-6f;
+    }
+    return ok;
+}
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+void testCoefficients() {
+    printSeparator();
+    Serial.println("  Coeficientes en compilación");
+    printSeparator();
+
+    const float32_t smooth[] = {-3.0f, 12.0f, 17.0f, 12.0f, -3.0f};
+    const float32_t first[] = {-2.0f, -1.0f, 0.0f, 1.0f, 2.0f};
+    const float32_t second[] = {2.0f, -1.0f, -2.0f, -1.0f, 2.0f};
+    printCheck(matches(SMOOTH5.coeffs, smooth, 35.0f, 5), "5 muestras, cuadrática: (-3 12 17 12 -3) / 35");
+    printCheck(matches(SLOPE5.coeffs, first, 10.0f, 5), "1ª derivada: (-2 -1 0 1 2) / 10");
+    printCheck(matches(CURVE5.coeffs, second, 7.0f, 5), "2ª derivada: (2 -1 -2 -1 2) / 7");
+
+    bool folded = true;
+    for (uint16_t k = 0; k <= PPGFilter::HALF; k++) {
+        folded = folded && PPGFilter::SMOOTHING.coeffs[k] == SMOOTH.coeffs[PPGFilter::HALF + k]
+                        && PPGFilter::DERIVATIVE.coeffs[k] == SLOPE.coeffs[PPGFilter::HALF + k]
+                        && fabsf(SLOPE.coeffs[PPGFilter::HALF + k] + SLOPE.coeffs[PPGFilter::HALF - k]) < 1e-7f;
+    }
+    printCheck(folded, "Mitades plegadas == núcleo completo (antisimétrico en la derivada)");
+}
+
+void testPolynomial() {
+    printSeparator();
+    Serial.println("  Polinomio cúbico: valor y derivada exactos");
+    printSeparator();
+
+    // x(t) = 0.5 + 2t - 3t² + t³ con t en segundos
+    PPGFilter filter(SAMPLE_RATE);
+    float32_t valueError = 0.0f, slopeError = 0.0f;
+    for (uint32_t n = 0; n < 200; n++) {
+        float32_t t = (float32_t)n / SAMPLE_RATE;
+        float32_t derivative;
+        float32_t value = filter.processSample(0.5f + 2.0f * t - 3.0f * t * t + t * t * t, derivative);
+        if (n >= WINDOW) {
+            float32_t c = (float32_t)(n - PPGFilter::HALF) / SAMPLE_RATE;
+            valueError = fmaxf(valueError, fabsf(value - (0.5f + 2.0f * c - 3.0f * c * c + c * c * c)));
+            slopeError = fmaxf(slopeError, fabsf(derivative - (2.0f - 6.0f * c + 3.0f * c * c)));
+        }
+    }
+    printCheck(valueError < 1e-5f, "Valor en el centro de la ventana");
+    printCheck(slopeError < 1e-3f, "Derivada en unidades por segundo");
+    printCheck(filter.getGroupDelay() == 7.0f, "Retardo de grupo: 7 muestras");
+
+    SavitzkyGolay<7, 2, 2> curvature(SAMPLE_RATE);
+    float32_t curveError = 0.0f;
+    for (uint32_t n = 0; n < 100; n++) {
+        float32_t t = (float32_t)n / SAMPLE_RATE;
+        float32_t second;
+        curvature.processSample(4.0f * t * t - t, second);
+        if (n >= 7) {
+            curveError = fmaxf(curveError, fabsf(second - 8.0f));
+        }
+    }
+    printCheck(curveError < 1e-2f, "2ª derivada de 4t² - t == 8");
+
+    Serial.println();
+    Serial.print("  Error valor / derivada:         "); Serial.print(valueError, 7);
+    Serial.print(" / "); Serial.println(slopeError, 6);
+}
+
+void testAgainstFIR() {
+    printSeparator();
+    Serial.println("  Núcleo plegado frente a dos FIRFilter");
+    printSeparator();
+
+    for (uint32_t n = 0; n < NUM_SAMPLES; n++) {
+        input[n] = sinf(2.0f * PI * 1.2f * n / SAMPLE_RATE) + 0.1f * noise();
+    }
+
+    PPGFilter filter;
+    FIRFilter firSmooth(SMOOTH.coeffs, WINDOW, BLOCK_SIZE);
+    FIRFilter firDerivative(SLOPE.coeffs, WINDOW, BLOCK_SIZE);
+
+    uint32_t foldedTime = 0, firTime = 0;
+    for (uint32_t n = 0; n < NUM_SAMPLES; n += BLOCK_SIZE) {
+        uint32_t start = micros();
+        filter.processBuffer(input + n, smoothed + n, slope + n, BLOCK_SIZE);
+        foldedTime += micros() - start;
+
+        start = micros();
+        firSmooth.processBuffer(input + n, firSmoothed + n, BLOCK_SIZE);
+        firDerivative.processBuffer(input + n, firSlope + n, BLOCK_SIZE);
+        firTime += micros() - start;
+    }
+
+    float32_t smoothError = 0.0f, slopeError = 0.0f;
+    for (uint32_t n = 0; n < NUM_SAMPLES; n++) {
+        smoothError = fmaxf(smoothError, fabsf(smoothed[n] - firSmoothed[n]));
+        slopeError = fmaxf(slopeError, fabsf(slope[n] - firSlope[n]));
+    }
+    printCheck(smoothError < 1e-5f && slopeError < 1e-5f, "Misma salida que FIRFilter (suavizado y derivada)");
+
+    PPGFilter single;
+    single.processBuffer(input, firSmoothed, NUM_SAMPLES);
+    printCheck(memcmp(firSmoothed, smoothed, sizeof(smoothed)) == 0, "Solo suavizado == suavizado de la pasada doble");
+    printCheck(filter.getMemoryUsage() < (2 * WINDOW + 4) * sizeof(float32_t), "Sin memoria dinámica: 2 × ventana");
+
+    Serial.println();
+    Serial.print("  Plegado / 2 FIR (us por muestra): ");
+    Serial.print((float32_t)foldedTime / NUM_SAMPLES, 3);
+    Serial.print(" / "); Serial.println((float32_t)firTime / NUM_SAMPLES, 3);
+    Serial.print("  RAM (bytes):                    "); Serial.println(filter.getMemoryUsage());
+}
+
+// ============================================================================
+// SETUP Y LOOP
+// ============================================================================
+
+void setup() {
+    Serial.begin(115200);
+    while (!Serial && millis() < 5000);
+
+    printTestHeader("TEST SAVITZKY-GOLAY - BioFilterLib");
+
+    testCoefficients();
+    testPolynomial();
+    testAgainstFIR();
+
+    Serial.println();
+    printTestResult();
+}
+
+void loop() {
+    delay(1000);
+}
@@ -0,0 +1,148 @@
+/**
+ * @file Test_BioFilterLib_SignalGenerator.ino
+ * @brief Test de BiosignalGenerator (señales sintéticas deterministas)
+ * @author Test Suite
+ * @version 1.0.0
+ * @date 2025
+ *
+ * Este test evalúa:
+ * - Que la misma semilla produce la misma señal y rewind() la repite exactamente
+ * - Que cada banda de EEG sigue su propia secuencia: activar otra banda no la altera
+ * - Que activar el resto de componentes (ECG, EMG, red, ruido blanco y rosa) tampoco
+ *   altera la señal de una banda
+ */
+
+#include <BioFilterLib.h>
+
+// ============================================================================
+// CONFIGURACIÓN DEL TEST
+// ============================================================================
+
+#define SAMPLE_RATE  256
+#define NUM_SAMPLES  2048
+#define SEED         42
+
+float32_t reference[NUM_SAMPLES];
+float32_t output[NUM_SAMPLES];
+float32_t others[NUM_SAMPLES];
+
+/**
+ * @brief Máxima diferencia entre reference y (output - others)
+ */
+float32_t maxDifference() {
+    float32_t maxError = 0.0f;
+    for (uint32_t i = 0; i < NUM_SAMPLES; i++) {
+        maxError = fmaxf(maxError, fabsf(output[i] - others[i] - reference[i]));
+    }
+    return maxError;
+}
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+void testDeterminism() {
+    printSeparator();
+    Serial.println("  Misma semilla, misma señal");
+    printSeparator();
+
+    BiosignalGenerator a(SAMPLE_RATE, SEED);
+    BiosignalGenerator b(SAMPLE_RATE, SEED);
+    a.setEEG(5.0f, 3.0f, 10.0f, 2.0f, 1.0f);
+    b.setEEG(5.0f, 3.0f, 10.0f, 2.0f, 1.0f);
+    a.setPinkNoise(1.0f);
+    b.setPinkNoise(1.0f);
+    a.generate(reference, NUM_SAMPLES);
+    b.generate(output, NUM_SAMPLES);
+    printCheck(memcmp(reference, output, sizeof(reference)) == 0, "Dos generadores con la misma semilla");
+
+    a.rewind();
+    a.generate(output, NUM_SAMPLES);
+    printCheck(memcmp(reference, output, sizeof(reference)) == 0, "rewind() repite la señal");
+}
+
+void testIndependentBands() {
+    printSeparator();
+    Serial.println("  Bandas de EEG independientes");
+    printSeparator();
+
+    // Cada banda sola como referencia; después, con todas las anteriores activas
+    // (las que consumían antes el generador compartido)
+    const char* names[5] = {"delta", "theta", "alfa", "beta", "gamma"};
+    bool independent = true;
+    for (uint8_t band = 1; band < 5; band++) {
+        float32_t alone[5] = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+        float32_t withOthers[5] = {1.0f, 1.0f, 1.0f, 1.0f, 0.0f};
+        float32_t onlyOthers[5] = {1.0f, 1.0f, 1.0f, 1.0f, 0.0f};
+        alone[band] = 1.0f;
+        withOthers[band] = 1.0f;
+        onlyOthers[band] = 0.0f;
+
+        BiosignalGenerator a(SAMPLE_RATE, SEED);
+        a.setEEG(alone[0], alone[1], alone[2], alone[3], alone[4]);
+        a.generate(reference, NUM_SAMPLES);
+
+        BiosignalGenerator b(SAMPLE_RATE, SEED);
+        b.setEEG(withOthers[0], withOthers[1], withOthers[2], withOthers[3], withOthers[4]);
+        b.generate(output, NUM_SAMPLES);
+
+        BiosignalGenerator c(SAMPLE_RATE, SEED);
+        c.setEEG(onlyOthers[0], onlyOthers[1], onlyOthers[2], onlyOthers[3], onlyOthers[4]);
+        c.generate(others, NUM_SAMPLES);
+
+        float32_t error = maxDifference();
+        if (error > 1e-4f) {
+            independent = false;
+            Serial.print("  Banda "); Serial.print(names[band]);
+            Serial.print(": diferencia "); Serial.println(error, 6);
+        }
+    }
+    printCheck(independent, "Activar otras bandas no altera una banda");
+}
+
+void testIndependentComponents() {
+    printSeparator();
+    Serial.println("  Resto de componentes");
+    printSeparator();
+
+    BiosignalGenerator a(SAMPLE_RATE, SEED);
+    a.setEEG(0.0f, 0.0f, 10.0f, 0.0f, 0.0f);
+    a.generate(reference, NUM_SAMPLES);
+
+    BiosignalGenerator b(SAMPLE_RATE, SEED);
+    BiosignalGenerator c(SAMPLE_RATE, SEED);
+    b.setEEG(0.0f, 0.0f, 10.0f, 0.0f, 0.0f);
+    BiosignalGenerator* both[2] = {&b, &c};
+    for (uint8_t k = 0; k < 2; k++) {
+        both[k]->setECG(72.0f, 1.0f, 5.0f);
+        both[k]->setEMG(0.3f);
+        both[k]->setPowerline(50.0f, 0.5f, 3, 0.2f);
+        both[k]->setWhiteNoise(0.1f);
+        both[k]->setPinkNoise(0.1f);
+    }
+    b.generate(output, NUM_SAMPLES);
+    c.generate(others, NUM_SAMPLES);
+    printCheck(maxDifference() < 1e-4f, "ECG, EMG, red y ruido no alteran el EEG");
+}
+
+// ============================================================================
+// SETUP Y LOOP
+// ============================================================================
+
+void setup() {
+    Serial.begin(115200);
+    while (!Serial && millis() < 5000);
+
+    printTestHeader("TEST BiosignalGenerator - BioFilterLib");
+
+    testDeterminism();
+    testIndependentBands();
+    testIndependentComponents();
+
+    Serial.println();
+    printTestResult();
+}
+
+void loop() {
+    delay(1000);
+}
@@ -0,0 +1,48 @@
+/**
+ * @file HostTest.h
+ * @brief Comprobaciones y resumen comunes a los tests de host
+ * @author Test Suite
+ * @version 1.0.0
+ * @date 2025
+ *
+ * Cada test de host es un programa aparte: este archivo solo se incluye desde el
+ * archivo principal del test (no hace falta añadirlo a la línea de compilación).
+ *
+ * @par Ejemplo
+ * @code
+ * #include "HostTest.h"
+ *
+ * int main() {
+ *     check(reader.open("rec.hea"), "open()");
+ *     return testResult();     // "TEST SUPERADO" / "TEST FALLIDO" y código de salida
+ * }
+ * @endcode
+ */
+
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <stdio.h>
+
+static int testFailures = 0;
+
+/**
+ * @brief Imprime una comprobación alineada con su resultado y cuenta los fallos
+ */
+static void check(bool condition, const char* name) {
+    printf("%-48s %s\n", name, condition ? "OK" : "FALLO");
+    if (!condition) {
+        testFailures++;
+    }
+}
+
+/**
+ * @brief Imprime el resumen del test
+ * @return Código de salida del programa (0 si no hubo fallos)
+ */
+static int testResult() {
+    printf("\n%s (%d fallos)\n", testFailures == 0 ? "TEST SUPERADO" : "TEST FALLIDO", testFailures);
+    return testFailures == 0 ? 0 : 1;
+}
+
+#endif // HOST_TEST_H
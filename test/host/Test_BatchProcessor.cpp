@@ -0,0 +1,185 @@
+/**
+ * @file Test_BatchProcessor.cpp
+ * @brief Test en host del procesamiento offline en paralelo (BatchProcessor / FilterPipeline)
+ * @author Test Suite
+ * @version 1.0.0
+ * @date 2025
+ *
+ * Este test evalúa:
+ * - Copia de FIRFilter / IIRFilter a mitad de señal: la copia continúa igual que el original
+ * - Copias de FilterPipeline que comparten coeficientes y no comparten estado
+ * - 200 registros de longitudes distintas con 1 y N trabajadores: salida idéntica a
+ *   procesar cada registro con un pipeline nuevo en un solo hilo
+ * - Memoria en vuelo acotada: nunca más registros abiertos que trabajadores
+ * - Throughput agregado y por núcleo
+ *
+ * Compilación (desde la raíz del repositorio, con CMSIS-DSP para arm_math.h):
+ * @code
+ * g++ -std=gnu++11 -O2 -pthread -I<CMSIS>/Include -Isrc test/host/Test_BatchProcessor.cpp \
+ *     src/filters/FIRFilter.cpp src/filters/IIRFilter.cpp src/utils/SignalGenerator.cpp \
+ *     src/utils/SignalSource.cpp src/utils/Waveforms.cpp src/utils/WaveformsData.cpp \
+ *     src/utils/utils.cpp -o test_batch && ./test_batch
+ * @endcode
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <thread>
+#include "host/BatchProcessor.h"
+#include "filters/FIRFilter.h"
+#include "filters/IIRFilter.h"
+#include "filters/FilterChain.h"
+#include "utils/SignalGenerator.h"
+#include "HostTest.h"
+
+#define NUM_RECORDS  200
+#define SAMPLE_RATE  500.0f
+#define BLOCK_SIZE   256
+#define SPLIT_LENGTH 4000
+
+// Notch 50 Hz (Q = 30, fs = 500 Hz), a1/a2 negados para CMSIS-DSP
+static float32_t notchCoeffs[5] = {
+    0.98963120f, -1.60127020f, 0.98963120f,
+    1.60127020f, -0.97926240f
+};
+
+// Pasa-bajas de 21 coeficientes (ventana de Hamming, fc = 40 Hz)
+static float32_t lowpassCoeffs[21] = {
+    -0.00137f, -0.00209f, -0.00227f,  0.00131f,  0.01254f,  0.03353f,  0.06329f,  0.09663f,
+     0.12581f,  0.14373f,  0.14977f,  0.14373f,  0.12581f,  0.09663f,  0.06329f,  0.03353f,
+     0.01254f,  0.00131f, -0.00227f, -0.00209f, -0.00137f
+};
+
+typedef FilterPipeline<IIRFilter, FIRFilter> Pipeline;
+
+static double checksums[NUM_RECORDS];
+static uint64_t totalLength = 0;
+
+static uint32_t recordLength(uint32_t record) {
+    // Longitudes muy distintas: de 1 s a ~2 min a 500 Hz
+    return 500 + (record * 7919u) % 60000u;
+}
+
+static SignalSource* openRecord(uint32_t record, void* context) {
+    (void)context;
+    BiosignalGenerator* source = new BiosignalGenerator(SAMPLE_RATE, record + 1, recordLength(record));
+    source->setECG(60.0f + record % 40, 1.0f, 5.0f);
+    source->setPowerline(50.0f, 0.3f, 2, 0.0f);
+    source->setWhiteNoise(0.02f);
+    return source;
+}
+
+static void closeRecord(SignalSource* source, uint32_t record, void* context) {
+    (void)record;
+    (void)context;
+    delete source;
+}
+
+static void onBlock(uint32_t record, const float32_t* block, uint32_t length, void* context) {
+    (void)context;
+    for (uint32_t i = 0; i < length; i++) {
+        checksums[record] += block[i] * (1.0 + (i & 7));
+    }
+}
+
+static void onReferenceBlock(const float32_t* block, uint32_t length, void* context) {
+    onBlock(*(uint32_t*)context, block, length, nullptr);
+}
+
+/**
+ * @brief Un filtro copiado a mitad de señal sigue exactamente igual que el original
+ */
+template <class Filter>
+static bool copyContinues(Filter& original) {
+    static float32_t input[2 * SPLIT_LENGTH];
+    static float32_t a[SPLIT_LENGTH];
+    static float32_t b[SPLIT_LENGTH];
+    for (uint32_t n = 0; n < 2 * SPLIT_LENGTH; n++) {
+        input[n] = sinf(0.05f * n) + 0.5f * sinf(2.0f * n);
+    }
+    original.processBuffer(input, a, SPLIT_LENGTH);
+
+    Filter copy(original);
+    original.processBuffer(input + SPLIT_LENGTH, a, SPLIT_LENGTH);
+    copy.processBuffer(input + SPLIT_LENGTH, b, SPLIT_LENGTH);
+    bool same = memcmp(a, b, sizeof(a)) == 0;
+
+    // reset(): la copia vuelve a empezar como un filtro nuevo
+    copy.reset();
+    Filter fresh(original);
+    fresh.reset();
+    copy.processBuffer(input, a, SPLIT_LENGTH);
+    fresh.processBuffer(input, b, SPLIT_LENGTH);
+    return same && memcmp(a, b, sizeof(a)) == 0;
+}
+
+static bool runBatch(const Pipeline& prototype, uint16_t workers, const double* reference, double* throughput) {
+    memset(checksums, 0, sizeof(checksums));
+    BatchProcessor<Pipeline> batch(prototype, workers, BLOCK_SIZE);
+    batch.setSink(onBlock);
+    batch.run(openRecord, closeRecord, nullptr, NUM_RECORDS);
+
+    *throughput = batch.getThroughput();
+    printf("  %2u trabajadores: %6.2f Msps (%.2f Msps/nucleo), %u abiertos como maximo, %u B\n",
+           workers, *throughput / 1e6, batch.getThroughputPerCore() / 1e6,
+           batch.getMaxRecordsInFlight(), batch.getMemoryUsage());
+
+    return batch.getSamplesProcessed() == totalLength &&
+           batch.getFailedRecords() == 0 &&
+           batch.getMaxRecordsInFlight() <= workers &&
+           memcmp(checksums, reference, sizeof(checksums)) == 0;
+}
+
+int main() {
+    FIRFilter fir(lowpassCoeffs, 21, 64);
+    check(copyContinues(fir), "FIRFilter copiado a mitad de senal");
+    IIRFilter iir(notchCoeffs, 1, 64);
+    check(copyContinues(iir), "IIRFilter copiado a mitad de senal");
+
+    Pipeline prototype(BLOCK_SIZE, iir, fir);
+    prototype.reset();
+    check(copyContinues(prototype), "FilterPipeline copiado a mitad de senal");
+    Pipeline clone(prototype);
+    check(clone.getMemoryUsage() == prototype.getMemoryUsage(), "clon: misma memoria que el prototipo");
+
+    // Referencia: un pipeline nuevo por registro, en un solo hilo
+    static double reference[NUM_RECORDS];
+    float32_t in[BLOCK_SIZE], out[BLOCK_SIZE];
+    for (uint32_t r = 0; r < NUM_RECORDS; r++) {
+        Pipeline pipeline(prototype);
+        pipeline.reset();
+        SignalSource* source = openRecord(r, nullptr);
+        checksums[r] = 0.0;
+        processSource(*source, pipeline, in, out, BLOCK_SIZE, onReferenceBlock, &r);
+        closeRecord(source, r, nullptr);
+        reference[r] = checksums[r];
+        totalLength += recordLength(r);
+    }
+
+    unsigned cores = std::thread::hardware_concurrency();
+    uint16_t workers = (uint16_t)(cores >= 4 ? cores : 4);
+
+    double single = 0.0, parallel = 0.0;
+    check(runBatch(prototype, 1, reference, &single), "1 trabajador == referencia");
+    check(runBatch(prototype, workers, reference, &parallel), "N trabajadores == referencia");
+    printf("  Nucleos: %u, escalado: %.2fx\n", cores, parallel / single);
+
+    // Fuentes ya abiertas
+    static SignalSource* sources[8];
+    static double subset[8];
+    memset(checksums, 0, sizeof(checksums));
+    for (uint32_t r = 0; r < 8; r++) {
+        sources[r] = openRecord(r, nullptr);
+        subset[r] = reference[r];
+    }
+    BatchProcessor<Pipeline> batch(prototype, 3, BLOCK_SIZE);
+    batch.setSink(onBlock);
+    batch.run(sources, 8);
+    check(memcmp(checksums, subset, sizeof(subset)) == 0, "run() con fuentes abiertas");
+    for (uint32_t r = 0; r < 8; r++) {
+        delete sources[r];
+    }
+
+    return testResult();
+}
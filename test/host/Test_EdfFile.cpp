@@ -0,0 +1,343 @@
+/**
+ * @file Test_EdfFile.cpp
+ * @brief Test en host del lector y escritor EDF/EDF+ (EdfReader / EdfWriter / EdfSource)
+ * @author Test Suite
+ * @version 1.0.0
+ * @date 2025
+ *
+ * Este test evalúa:
+ * - Escritura EDF+C con dos canales de distinta frecuencia (writeSamples en trozos)
+ * - Cabecera, escalado físico/digital y recorte fuera de rango
+ * - Lectura por registros, acceso aleatorio por canal y EdfSource por bloques
+ * - Anotaciones EDF+ (TAL de marca de tiempo y anotaciones con texto)
+ * - Copia filtrada de un archivo con EdfWriter::open(path, reader)
+ * - EDF+D: registros con huecos y anotaciones, y su copia con el mismo instante por
+ *   registro (copyRecordAnnotations())
+ * - Copia de un EDF+C de 3000 registros de 0,1 s (duración no exacta en binario): sigue
+ *   siendo EDF+C y con los instantes exactos
+ * - Último registro incompleto relleno con el valor físico 0
+ *
+ * Compilación (desde la raíz del repositorio, con CMSIS-DSP para arm_math.h):
+ * @code
+ * g++ -std=gnu++11 -O2 -I<CMSIS>/Include -Isrc test/host/Test_EdfFile.cpp \
+ *     src/host/EdfFile.cpp src/utils/SignalSource.cpp src/utils/Waveforms.cpp \
+ *     src/utils/WaveformsData.cpp -o test_edf && ./test_edf
+ * @endcode
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include <string.h>
+#include "host/EdfFile.h"
+#include "HostTest.h"
+
+#define NUM_RECORDS 5
+#define EEG_RATE    256         // Muestras por registro de 1 s
+#define RESP_RATE   10
+#define LONG_RECORDS 3000       // Registros de 0,1 s con RESP_RATE muestras (100 Hz)
+
+static float32_t eeg(uint32_t n) { return 80.0f * sinf(0.05f * n); }
+static float32_t resp(uint32_t n) { return 0.5f + 0.4f * cosf(0.3f * n); }
+
+struct AnnotationLog {
+    uint32_t count;
+    double onset;
+    double duration;
+    char text[32];
+};
+
+static void onAnnotation(double onset, double duration, const char* text, void* context) {
+    AnnotationLog* log = (AnnotationLog*)context;
+    log->count++;
+    log->onset = onset;
+    log->duration = duration;
+    snprintf(log->text, sizeof(log->text), "%s", text);
+}
+
+static bool writeFile() {
+    EdfWriter writer;
+    if (!writer.open("edftest.edf", 2, 1.0f, true)) {
+        return false;
+    }
+    writer.setSignal(0, "EEG Fpz-Cz", "uV", -100.0f, 100.0f, EEG_RATE, "HP:0.5Hz");
+    writer.setSignal(1, "Resp", "", 0.0f, 1.0f, RESP_RATE);
+    writer.setPatient("X F X Test");
+
+    // Canales entrelazados en trozos que no coinciden con el registro
+    float32_t chunk[70];
+    uint32_t eegDone = 0;
+    uint32_t respDone = 0;
+    while (eegDone < NUM_RECORDS * EEG_RATE) {
+        uint32_t n = 0;
+        for (; n < 70 && eegDone + n < NUM_RECORDS * EEG_RATE; n++) {
+            chunk[n] = eeg(eegDone + n);
+        }
+        eegDone += writer.writeSamples(0, chunk, n);
+
+        while (respDone < (eegDone / EEG_RATE + 1) * RESP_RATE && respDone < NUM_RECORDS * RESP_RATE) {
+            float32_t value = resp(respDone);
+            if (respDone == 7) {
+                value = 3.0f;       // Fuera de rango: se recorta a 1.0
+            }
+            if (writer.writeSamples(1, &value, 1) == 0) {
+                break;
+            }
+            respDone++;
+        }
+    }
+    return writer.close() && writer.getNumRecords() == NUM_RECORDS;
+}
+
+static void injectAnnotation() {
+    // Sustituir el canal de anotaciones del registro 2 por un TAL con texto
+    EdfReader reader;
+    reader.open("edftest.edf");
+    const EdfSignalInfo& info = reader.getSignalInfo(2);
+    long position = 256L * 4 + 2L * (2L * (EEG_RATE + RESP_RATE + info.samplesPerRecord) + info.recordOffset);
+    reader.close();
+
+    char tal[60];
+    memset(tal, 0, sizeof(tal));
+    const char text[] = "+2\x14\x14\0+2.5\x15" "1.5\x14" "Apnea\x14";
+    memcpy(tal, text, sizeof(text));
+    FILE* file = fopen("edftest.edf", "r+b");
+    fseek(file, position, SEEK_SET);
+    fwrite(tal, 1, sizeof(tal), file);
+    fclose(file);
+}
+
+/**
+ * @brief Registros 0-2 contiguos, 3-4 tras un hueco de 7 s, con una anotación en el 3
+ */
+static bool writeDiscontinuous() {
+    EdfWriter writer;
+    if (!writer.open("edftest_d.edf", 1, 1.0f, true)) {
+        return false;
+    }
+    writer.setSignal(0, "Resp", "", 0.0f, 1.0f, RESP_RATE);
+    float32_t record[RESP_RATE];
+    const float32_t* channels[2] = {record, nullptr};
+    bool ok = true;
+    for (uint32_t r = 0; r < NUM_RECORDS; r++) {
+        for (uint32_t i = 0; i < RESP_RATE; i++) {
+            record[i] = resp(r * RESP_RATE + i);
+        }
+        if (r == 3) {
+            writer.setRecordOnset(10.0);
+            ok &= writer.addAnnotation(10.25, -1.0, "Arousal");
+        }
+        ok &= writer.writeRecord(channels);
+    }
+    return writer.close() && ok;
+}
+
+static void discontinuousCopy() {
+    check(writeDiscontinuous(), "EdfWriter con setRecordOnset()/addAnnotation()");
+
+    EdfReader reader;
+    reader.open("edftest_d.edf");
+    AnnotationLog log = {0, 0.0, 0.0, ""};
+    check(reader.isEdfPlus() && !reader.isContinuous(), "hueco entre registros: EDF+D");
+    check(reader.getRecordOnset(2) == 2.0 && reader.getRecordOnset(3) == 10.0 &&
+          reader.getRecordOnset(4) == 11.0, "instantes de los registros EDF+D");
+    check(reader.readAnnotations(3, onAnnotation, &log) == 1 && log.onset == 10.25 &&
+          log.duration < 0.0 && strcmp(log.text, "Arousal") == 0, "addAnnotation()");
+
+    // Copia: mismo tipo, instantes y anotaciones
+    float32_t record[RESP_RATE];
+    float32_t* channels[2] = {record, nullptr};
+    EdfWriter copy;
+    bool ok = copy.open("edftest_d_copy.edf", reader);
+    for (uint32_t r = 0; r < reader.getNumRecords(); r++) {
+        reader.readRecord(r, channels);
+        ok &= copy.copyRecordAnnotations(reader, r);
+        ok &= copy.writeRecord(channels);
+    }
+    ok &= copy.close();
+    check(ok, "copia con copyRecordAnnotations()");
+
+    EdfReader copied;
+    copied.open("edftest_d_copy.edf");
+    log.count = 0;
+    bool onsets = copied.isEdfPlus() && !copied.isContinuous();
+    for (uint32_t r = 0; r < NUM_RECORDS; r++) {
+        onsets &= copied.getRecordOnset(r) == reader.getRecordOnset(r);
+    }
+    check(onsets, "copia EDF+D con los instantes del original");
+    check(copied.readAnnotations(3, onAnnotation, &log) == 1 && log.onset == 10.25 &&
+          strcmp(log.text, "Arousal") == 0, "anotaciones de la copia");
+
+    reader.close();
+    copied.close();
+    remove("edftest_d.edf");
+    remove("edftest_d_copy.edf");
+}
+
+/**
+ * @brief Copia registro a registro de un EDF+C largo con registros de 0,1 s
+ */
+static void continuousCopy() {
+    EdfWriter writer;
+    writer.open("edftest_c.edf", 1, 0.1, true);
+    writer.setSignal(0, "Resp", "", 0.0f, 1.0f, RESP_RATE);
+    float32_t record[RESP_RATE];
+    const float32_t* channels[2] = {record, nullptr};
+    bool ok = true;
+    for (uint32_t r = 0; r < LONG_RECORDS; r++) {
+        for (uint32_t i = 0; i < RESP_RATE; i++) {
+            record[i] = resp(r * RESP_RATE + i);
+        }
+        ok &= writer.writeRecord(channels);
+    }
+    ok &= writer.close();
+
+    EdfReader reader;
+    ok &= reader.open("edftest_c.edf") && reader.getRecordDuration() == 0.1;
+    float32_t* readChannels[2] = {record, nullptr};
+    EdfWriter copy;
+    ok &= copy.open("edftest_c_copy.edf", reader);
+    for (uint32_t r = 0; r < reader.getNumRecords(); r++) {
+        reader.readRecord(r, readChannels);
+        ok &= copy.copyRecordAnnotations(reader, r);
+        ok &= copy.writeRecord(readChannels);
+    }
+    ok &= copy.close();
+    check(ok, "copia de 3000 registros de 0,1 s");
+
+    EdfReader copied;
+    copied.open("edftest_c_copy.edf");
+    check(reader.isContinuous() && copied.isContinuous() &&
+          copied.getNumRecords() == LONG_RECORDS, "la copia sigue siendo EDF+C");
+    bool onsets = true;
+    for (uint32_t r = 0; r < LONG_RECORDS; r++) {
+        double expected = r * 0.1;
+        onsets &= fabs(copied.getRecordOnset(r) - expected) < 1e-9 &&
+                  fabs(reader.getRecordOnset(r) - expected) < 1e-9;
+    }
+    check(onsets, "instantes n x 0,1 s sin error acumulado");
+
+    reader.close();
+    copied.close();
+    remove("edftest_c.edf");
+    remove("edftest_c_copy.edf");
+}
+
+static void partialRecordPadding() {
+    // Rango asimétrico: el código digital 0 equivale a 40 uV, no a 0
+    EdfWriter writer;
+    writer.open("edftest_pad.edf", 1, 1.0f, false);
+    writer.setSignal(0, "EEG", "uV", -20.0f, 100.0f, EEG_RATE);
+    float32_t samples[EEG_RATE + EEG_RATE / 2];
+    for (uint32_t i = 0; i < EEG_RATE + EEG_RATE / 2; i++) {
+        samples[i] = 50.0f;
+    }
+    writer.writeSamples(0, samples, EEG_RATE + EEG_RATE / 2);
+    check(writer.close() && writer.getNumRecords() == 2, "close() con registro incompleto");
+
+    EdfReader reader;
+    reader.open("edftest_pad.edf");
+    float32_t record[EEG_RATE];
+    float32_t* channels[1] = {record};
+    reader.readRecord(1, channels);
+    float32_t step = reader.getSignalInfo(0).scale;
+    check(fabsf(record[EEG_RATE / 2 - 1] - 50.0f) <= step &&
+          fabsf(record[EEG_RATE / 2]) <= step && fabsf(record[EEG_RATE - 1]) <= step,
+          "relleno con el valor fisico 0");
+    reader.close();
+    remove("edftest_pad.edf");
+}
+
+int main() {
+    check(writeFile(), "EdfWriter (writeSamples en trozos)");
+    injectAnnotation();
+
+    EdfReader reader;
+    check(reader.open("edftest.edf"), "open()");
+    check(reader.isEdfPlus() && reader.isContinuous(), "EDF+C");
+    check(reader.getNumSignals() == 3 && reader.getNumRecords() == NUM_RECORDS, "canales y registros");
+    check(reader.findSignal("eeg fpz-cz") == 0 && reader.findSignal("EDF Annotations") == 2, "findSignal()");
+    check(reader.getSampleRate(0) == EEG_RATE && reader.getSampleRate(1) == RESP_RATE, "frecuencias de muestreo");
+    check(strcmp(reader.getPatient(), "X F X Test") == 0 &&
+          strcmp(reader.getSignalInfo(0).prefiltering, "HP:0.5Hz") == 0, "campos de texto");
+
+    // Registro completo: error máximo = medio paso de cuantificación
+    float32_t eegBuffer[EEG_RATE];
+    float32_t respBuffer[RESP_RATE];
+    float32_t* channels[3] = {eegBuffer, respBuffer, nullptr};
+    float32_t eegStep = reader.getSignalInfo(0).scale;
+    float32_t maxError = 0.0f;
+    bool clipped = false;
+    for (uint32_t r = 0; r < NUM_RECORDS; r++) {
+        reader.readRecord(r, channels);
+        for (uint32_t i = 0; i < EEG_RATE; i++) {
+            maxError = fmaxf(maxError, fabsf(eegBuffer[i] - eeg(r * EEG_RATE + i)));
+        }
+        if (r == 0) {
+            clipped = fabsf(respBuffer[7] - 1.0f) < 1e-4f;
+        }
+    }
+    check(maxError <= 0.5f * eegStep + 1e-4f, "readRecord() y escalado");
+    check(clipped, "recorte fuera de rango");
+
+    // Acceso aleatorio que cruza registros
+    float32_t span[300];
+    uint32_t got = reader.readChannel(0, 400, span, 300);
+    bool match = (got == 300);
+    for (uint32_t i = 0; i < got; i++) {
+        match &= fabsf(span[i] - eeg(400 + i)) <= 0.5f * eegStep + 1e-4f;
+    }
+    check(match, "readChannel() entre registros");
+    check(reader.readChannel(1, NUM_RECORDS * RESP_RATE - 3, span, 10) == 3, "readChannel() al final");
+
+    // EdfSource desde t = 2 s
+    EdfSource source(reader, 1);
+    source.seekTime(2.0f);
+    float32_t block[4];
+    uint32_t total = 0;
+    uint32_t count;
+    match = true;
+    while ((count = source.read(block, 4)) > 0) {
+        for (uint32_t i = 0; i < count; i++) {
+            match &= fabsf(block[i] - resp(2 * RESP_RATE + total + i)) < 1e-3f;
+        }
+        total += count;
+    }
+    check(match && total == (NUM_RECORDS - 2) * RESP_RATE, "EdfSource por bloques");
+
+    // Anotaciones
+    AnnotationLog log = {0, 0.0, 0.0, ""};
+    check(reader.readAnnotations(0, onAnnotation, &log) == 0, "TAL de marca de tiempo sin texto");
+    check(reader.getRecordOnset(3) == 3.0, "getRecordOnset()");
+    check(reader.readAnnotations(2, onAnnotation, &log) == 1 && log.onset == 2.5 &&
+          log.duration == 1.5 && strcmp(log.text, "Apnea") == 0, "anotacion con duracion");
+
+    // Copia filtrada (aquí, ganancia 0.5) con la misma estructura
+    EdfWriter copy;
+    check(copy.open("edftest_copy.edf", reader), "EdfWriter::open(path, reader)");
+    for (uint32_t r = 0; r < NUM_RECORDS; r++) {
+        reader.readRecord(r, channels);
+        for (uint32_t i = 0; i < EEG_RATE; i++) {
+            eegBuffer[i] *= 0.5f;
+        }
+        copy.writeRecord(channels);
+    }
+    check(copy.close(), "close()");
+
+    EdfReader check2;
+    check2.open("edftest_copy.edf");
+    check2.readRecord(4, channels);
+    check(check2.getNumRecords() == NUM_RECORDS &&
+          fabsf(eegBuffer[10] - 0.5f * eeg(4 * EEG_RATE + 10)) <= eegStep, "contenido de la copia");
+    check(check2.getRecordOnset(4) == 4.0, "marca de tiempo de la copia");
+
+    reader.close();
+    check2.close();
+    remove("edftest.edf");
+    remove("edftest_copy.edf");
+
+    discontinuousCopy();
+    continuousCopy();
+    partialRecordPadding();
+
+    return testResult();
+}
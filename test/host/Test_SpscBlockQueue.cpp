@@ -0,0 +1,151 @@
+/**
+ * @file Test_SpscBlockQueue.cpp
+ * @brief Test en host de SpscBlockQueue con un hilo productor en lugar de la ISR
+ * @author Test Suite
+ * @version 1.0.0
+ * @date 2025
+ *
+ * Este test evalúa:
+ * - Traspaso sin pérdidas de 2 millones de muestras entre dos hilos (beginWrite/endWrite)
+ * - Filtrado por bloques con processBlock() idéntico al filtrado de la señal completa
+ * - pushSample() con la cola llena: descarta sin esperar y cuenta overruns
+ * - Que cada bloque publicado es contiguo aunque haya descartes
+ *
+ * Compilación (desde la raíz del repositorio, con CMSIS-DSP para arm_math.h):
+ * @code
+ * g++ -std=gnu++11 -O2 -pthread -I<CMSIS>/Include -Isrc test/host/Test_SpscBlockQueue.cpp \
+ *     src/utils/SpscBlockQueue.cpp src/filters/FIRFilter.cpp src/utils/utils.cpp \
+ *     -o test_spsc && ./test_spsc
+ * @endcode
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include <thread>
+#include "utils/SpscBlockQueue.h"
+#include "filters/FIRFilter.h"
+#include "HostTest.h"
+
+#define BLOCK_SIZE  32
+#define NUM_BLOCKS  4
+#define NUM_SAMPLES (1u << 21)     // Enteros exactos en float32 (< 2^24)
+#define FILTER_SAMPLES (64u * 1024u)
+
+static float32_t lowpass[9] = {0.02f, 0.06f, 0.12f, 0.18f, 0.24f, 0.18f, 0.12f, 0.06f, 0.02f};
+
+/**
+ * @brief Traspaso sin pérdidas: el productor espera si la cola está llena
+ */
+static bool losslessTransfer() {
+    SpscBlockQueue queue(NUM_BLOCKS, BLOCK_SIZE);
+
+    std::thread producer([&queue]() {
+        uint32_t n = 0;
+        while (n < NUM_SAMPLES) {
+            float32_t* block = queue.beginWrite();
+            if (block == nullptr) {
+                std::this_thread::yield();
+                continue;
+            }
+            for (uint32_t i = 0; i < BLOCK_SIZE; i++) {
+                block[i] = (float32_t)(n++);
+            }
+            queue.endWrite();
+        }
+    });
+
+    uint32_t expected = 0;
+    bool ordered = true;
+    while (expected < NUM_SAMPLES) {
+        float32_t* block = queue.beginRead();
+        if (block == nullptr) {
+            std::this_thread::yield();
+            continue;
+        }
+        for (uint32_t i = 0; i < BLOCK_SIZE; i++) {
+            ordered &= block[i] == (float32_t)(expected++);
+        }
+        queue.endRead();
+    }
+    producer.join();
+    return ordered && queue.available() == 0;
+}
+
+/**
+ * @brief processBlock() entre hilos frente a FIR sobre la señal completa
+ */
+static float32_t filteredTransfer() {
+    static float32_t input[FILTER_SAMPLES];
+    static float32_t reference[FILTER_SAMPLES];
+    static float32_t output[FILTER_SAMPLES];
+    for (uint32_t n = 0; n < FILTER_SAMPLES; n++) {
+        input[n] = sinf(0.01f * n) + 0.3f * sinf(1.3f * n);
+    }
+    FIRFilter offline(lowpass, 9, BLOCK_SIZE);
+    offline.processBuffer(input, reference, FILTER_SAMPLES);
+
+    SpscBlockQueue queue(2, BLOCK_SIZE);        // Doble buffer
+    std::thread producer([&queue]() {
+        uint32_t n = 0;
+        while (n < FILTER_SAMPLES) {
+            if (!queue.pushSample(input[n])) {
+                std::this_thread::yield();      // Solo en el test: reintentar la muestra
+                continue;
+            }
+            n++;
+        }
+    });
+
+    FIRFilter online(lowpass, 9, BLOCK_SIZE);
+    uint32_t done = 0;
+    while (done < FILTER_SAMPLES) {
+        if (queue.processBlock(online, output + done)) {
+            done += BLOCK_SIZE;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    float32_t maxError = 0.0f;
+    for (uint32_t n = 0; n < FILTER_SAMPLES; n++) {
+        maxError = fmaxf(maxError, fabsf(output[n] - reference[n]));
+    }
+    return maxError;
+}
+
+int main() {
+    check(losslessTransfer(), "2M muestras entre hilos, en orden");
+    check(filteredTransfer() == 0.0f, "processBlock() == FIR sobre la señal completa");
+
+    SpscBlockQueue small(3, 8);
+    check(small.getNumBlocks() == 4 && small.getBlockSize() == 8, "numBlocks redondeado a potencia de 2");
+
+    // Consumidor detenido: el productor llena la cola y descarta sin bloquear
+    uint32_t pushed = 0;
+    for (uint32_t n = 0; n < 100; n++) {
+        if (small.pushSample((float32_t)n)) {
+            pushed++;
+        }
+    }
+    check(pushed == 32 && small.overruns() == 68 && small.available() == 4, "descarte con la cola llena");
+
+    // Liberar un bloque: el productor sigue con muestras nuevas en un bloque contiguo
+    small.endRead();
+    for (uint32_t n = 100; n < 108; n++) {
+        small.pushSample((float32_t)n);
+    }
+    bool contiguous = true;
+    float32_t* block;
+    uint32_t blocks = 0;
+    while ((block = small.beginRead()) != nullptr) {
+        for (uint32_t i = 1; i < 8; i++) {
+            contiguous &= block[i] == block[0] + i;
+        }
+        blocks++;
+        small.endRead();
+    }
+    check(contiguous && blocks == 4, "bloques contiguos tras descartes");
+
+    return testResult();
+}
@@ -0,0 +1,159 @@
+/**
+ * @file Test_StreamRuntime.cpp
+ * @brief Test en host del runtime multihilo de flujos (StreamRuntime / FilterStream)
+ * @author Test Suite
+ * @version 1.0.0
+ * @date 2025
+ *
+ * Este test evalúa:
+ * - 64 flujos ECG sintéticos, cada uno con su cadena notch IIR + pasa-bajas FIR
+ * - Salida idéntica a procesar cada flujo en un solo hilo, con 1 y con N trabajadores
+ * - Robo de trabajo cuando los flujos largos caen todos en el mismo trabajador
+ * - Throughput y escalado (muestras/s) frente a 1 trabajador
+ *
+ * Compilación (desde la raíz del repositorio, con CMSIS-DSP para arm_math.h):
+ * @code
+ * g++ -std=gnu++11 -O2 -pthread -I<CMSIS>/Include -Isrc test/host/Test_StreamRuntime.cpp \
+ *     src/host/StreamRuntime.cpp src/filters/FIRFilter.cpp src/filters/IIRFilter.cpp \
+ *     src/utils/SignalGenerator.cpp src/utils/SignalSource.cpp src/utils/Waveforms.cpp \
+ *     src/utils/WaveformsData.cpp src/utils/utils.cpp -o test_runtime && ./test_runtime
+ * @endcode
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <thread>
+#include "host/StreamRuntime.h"
+#include "filters/FIRFilter.h"
+#include "filters/IIRFilter.h"
+#include "filters/FilterChain.h"
+#include "utils/SignalGenerator.h"
+#include "HostTest.h"
+
+#define NUM_STREAMS  64
+#define SAMPLE_RATE  500.0f
+#define BLOCK_SIZE   128
+#define SHORT_LENGTH 20000
+#define LONG_LENGTH  120000
+
+// Notch 50 Hz (Q = 30, fs = 500 Hz), a1/a2 negados para CMSIS-DSP
+static float32_t notchCoeffs[5] = {
+    0.98963120f, -1.60127020f, 0.98963120f,
+    1.60127020f, -0.97926240f
+};
+
+// Pasa-bajas de 21 coeficientes (ventana de Hamming, fc = 40 Hz)
+static float32_t lowpassCoeffs[21] = {
+    -0.00137f, -0.00209f, -0.00227f,  0.00131f,  0.01254f,  0.03353f,  0.06329f,  0.09663f,
+     0.12581f,  0.14373f,  0.14977f,  0.14373f,  0.12581f,  0.09663f,  0.06329f,  0.03353f,
+     0.01254f,  0.00131f, -0.00227f, -0.00209f, -0.00137f
+};
+
+typedef FilterChain<IIRFilter, FIRFilter> Chain;
+
+/**
+ * @brief Todo lo que pertenece a un flujo: fuente, filtros y suma de comprobación
+ */
+struct Bed {
+    BiosignalGenerator* source;
+    IIRFilter* notch;
+    FIRFilter* lowpass;
+    Chain* chain;
+    FilterStream<Chain>* stream;
+    double checksum;
+};
+
+static Bed beds[NUM_STREAMS];
+
+static uint32_t streamLength(uint32_t i) {
+    // Los flujos largos son los múltiplos de 4: con reparto circular caen todos
+    // en el mismo trabajador si hay 4
+    return (i % 4 == 0) ? LONG_LENGTH : SHORT_LENGTH;
+}
+
+static void onBlock(uint32_t streamId, const float32_t* block, uint32_t length, void* context) {
+    (void)context;
+    for (uint32_t i = 0; i < length; i++) {
+        beds[streamId].checksum += block[i] * (1.0 + (i & 7));
+    }
+}
+
+static void onReferenceBlock(const float32_t* block, uint32_t length, void* context) {
+    onBlock((uint32_t)((Bed*)context - beds), block, length, nullptr);
+}
+
+static void createBeds() {
+    for (uint32_t i = 0; i < NUM_STREAMS; i++) {
+        Bed& bed = beds[i];
+        bed.source = new BiosignalGenerator(SAMPLE_RATE, i + 1, streamLength(i));
+        bed.source->setECG(60.0f + i % 30, 1.0f, 5.0f);
+        bed.source->setPowerline(50.0f, 0.3f, 2, 0.0f);
+        bed.source->setWhiteNoise(0.02f);
+        bed.notch = new IIRFilter(notchCoeffs, 1, BLOCK_SIZE);
+        bed.lowpass = new FIRFilter(lowpassCoeffs, 21, BLOCK_SIZE);
+        bed.chain = new Chain(BLOCK_SIZE, *bed.notch, *bed.lowpass);
+        bed.stream = new FilterStream<Chain>(i, *bed.source, *bed.chain, BLOCK_SIZE, onBlock);
+        bed.checksum = 0.0;
+    }
+}
+
+static void destroyBeds() {
+    for (uint32_t i = 0; i < NUM_STREAMS; i++) {
+        delete beds[i].stream;
+        delete beds[i].chain;
+        delete beds[i].lowpass;
+        delete beds[i].notch;
+        delete beds[i].source;
+    }
+}
+
+/**
+ * @brief Procesa todos los flujos con el runtime y devuelve el throughput
+ */
+static double runRuntime(uint16_t workers, double* checksums, uint32_t* steals) {
+    createBeds();
+    StreamRuntime runtime(workers, NUM_STREAMS);
+    for (uint32_t i = 0; i < NUM_STREAMS; i++) {
+        runtime.addStream(beds[i].stream);
+    }
+    runtime.run();
+
+    uint64_t expected = 0;
+    for (uint32_t i = 0; i < NUM_STREAMS; i++) {
+        checksums[i] = beds[i].checksum;
+        expected += streamLength(i);
+    }
+    *steals = runtime.getSteals();
+    double throughput = (runtime.getSamplesProcessed() == expected) ? runtime.getThroughput() : 0.0;
+    printf("  %2u trabajadores: %6.2f Msps, %u robos\n", workers, throughput / 1e6, *steals);
+    destroyBeds();
+    return throughput;
+}
+
+int main() {
+    // Referencia: cada flujo en un solo hilo con processSource()
+    static double reference[NUM_STREAMS];
+    createBeds();
+    float32_t in[BLOCK_SIZE], out[BLOCK_SIZE];
+    for (uint32_t i = 0; i < NUM_STREAMS; i++) {
+        processSource(*beds[i].source, *beds[i].chain, in, out, BLOCK_SIZE, onReferenceBlock, &beds[i]);
+        reference[i] = beds[i].checksum;
+    }
+    destroyBeds();
+
+    unsigned cores = std::thread::hardware_concurrency();
+    uint16_t workers = (uint16_t)(cores >= 4 ? cores : 4);
+
+    static double checksums[NUM_STREAMS];
+    uint32_t steals = 0;
+    double single = runRuntime(1, checksums, &steals);
+    check(single > 0.0 && memcmp(checksums, reference, sizeof(reference)) == 0, "1 trabajador == referencia");
+
+    double parallel = runRuntime(workers, checksums, &steals);
+    check(parallel > 0.0 && memcmp(checksums, reference, sizeof(reference)) == 0, "N trabajadores == referencia");
+    check(steals > 0, "robo de trabajo con carga desequilibrada");
+
+    printf("  Nucleos: %u, escalado: %.2fx\n", cores, parallel / single);
+
+    return testResult();
+}
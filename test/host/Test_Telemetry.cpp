@@ -0,0 +1,171 @@
+/**
+ * @file Test_Telemetry.cpp
+ * @brief Test en host del protocolo de telemetría (TelemetryTx / TelemetryDecoder)
+ * @author Test Suite
+ * @version 1.0.0
+ * @date 2025
+ *
+ * Este test evalúa:
+ * - CRC-16/CCITT-FALSE con el valor de comprobación estándar
+ * - COBS con ceros y con bloques de 254 bytes sin ceros
+ * - Ida y vuelta int16 y float32 multicanal, entregando los bytes en trozos aleatorios
+ * - Descarte no bloqueante con el buffer lleno y detección de pérdidas por secuencia
+ * - Detección de paquetes corruptos y resincronización
+ *
+ * Compilación (desde la raíz del repositorio, con CMSIS-DSP para arm_math.h):
+ * @code
+ * g++ -std=gnu++11 -O2 -I<CMSIS>/Include -Isrc test/host/Test_Telemetry.cpp \
+ *     src/utils/Telemetry.cpp -o test_telemetry && ./test_telemetry
+ * @endcode
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+#include "utils/Telemetry.h"
+#include "HostTest.h"
+
+#define CHANNELS     3
+#define NUM_FRAMES   2000
+#define CAPTURE_SIZE 65536
+
+/**
+ * @brief Puerto simulado: acepta como máximo 'space' bytes por llamada
+ */
+struct CapturePort {
+    uint8_t data[CAPTURE_SIZE];
+    uint32_t length;
+    int space;
+
+    int availableForWrite() { return space; }
+    size_t write(const uint8_t* buffer, size_t n) {
+        memcpy(data + length, buffer, n);
+        length += (uint32_t)n;
+        return n;
+    }
+};
+
+struct Received {
+    float32_t values[NUM_FRAMES][CHANNELS];
+    uint32_t frames;
+};
+
+static void onPacket(const TelemetryPacket& packet, void* context) {
+    Received* rx = (Received*)context;
+    for (uint8_t f = 0; f < packet.frames && rx->frames < NUM_FRAMES; f++) {
+        for (uint8_t c = 0; c < packet.channels; c++) {
+            rx->values[rx->frames][c] = packet.sample(f, c);
+        }
+        rx->frames++;
+    }
+}
+
+static float32_t signal(uint32_t n, uint8_t c) {
+    return 1.5f * sinf(0.01f * n * (c + 1)) + (c == 2 ? 0.25f : 0.0f);
+}
+
+static CapturePort port;
+static Received rx;
+
+static bool roundTrip(uint8_t type, float32_t tolerance) {
+    TelemetryTx tx(CHANNELS, type, 2.0f, 1024);
+    port.length = 0;
+    port.space = 64;
+
+    for (uint32_t n = 0; n < NUM_FRAMES; n++) {
+        float32_t frame[CHANNELS];
+        for (uint8_t c = 0; c < CHANNELS; c++) {
+            frame[c] = signal(n, c);
+        }
+        tx.push(frame);
+        tx.pump(port);
+    }
+    tx.flush();
+    while (tx.pendingBytes() > 0) {
+        tx.pump(port);
+    }
+
+    // Entregar al decodificador en trozos de tamaño aleatorio
+    memset(&rx, 0, sizeof(rx));
+    TelemetryDecoder decoder(onPacket, &rx);
+    uint32_t offset = 0;
+    srand(7);
+    while (offset < port.length) {
+        uint32_t chunk = 1 + rand() % 97;
+        if (chunk > port.length - offset) {
+            chunk = port.length - offset;
+        }
+        decoder.feed(port.data + offset, chunk);
+        offset += chunk;
+    }
+
+    float32_t maxError = 0.0f;
+    for (uint32_t n = 0; n < rx.frames; n++) {
+        for (uint8_t c = 0; c < CHANNELS; c++) {
+            maxError = fmaxf(maxError, fabsf(rx.values[n][c] - signal(n, c)));
+        }
+    }
+    return rx.frames == NUM_FRAMES && maxError <= tolerance && tx.droppedPackets() == 0 &&
+           decoder.crcErrors() == 0 && decoder.framingErrors() == 0 && decoder.lostPackets() == 0;
+}
+
+int main() {
+    const uint8_t checkString[] = "123456789";
+    check(telemetryCrc16(checkString, 9) == 0x29B1, "CRC-16/CCITT-FALSE (0x29B1)");
+
+    // COBS: ceros sueltos y bloque máximo sin ceros
+    uint8_t raw[TELEMETRY_MAX_PACKET];
+    uint8_t encoded[TELEMETRY_MAX_ENCODED];
+    uint8_t decoded[TELEMETRY_MAX_ENCODED];
+    bool cobsOk = true;
+    for (int pattern = 0; pattern < 3; pattern++) {
+        for (int i = 0; i < TELEMETRY_MAX_PACKET; i++) {
+            raw[i] = (pattern == 0) ? 0 : (pattern == 1) ? (uint8_t)(1 + i % 255) : (uint8_t)(i % 7);
+        }
+        size_t n = cobsEncode(raw, TELEMETRY_MAX_PACKET, encoded);
+        cobsOk &= n <= TELEMETRY_MAX_ENCODED && encoded[n - 1] == 0 && memchr(encoded, 0, n - 1) == nullptr;
+        cobsOk &= cobsDecode(encoded, n - 1, decoded) == TELEMETRY_MAX_PACKET &&
+                  memcmp(raw, decoded, TELEMETRY_MAX_PACKET) == 0;
+    }
+    check(cobsOk, "COBS ida y vuelta (254 bytes)");
+
+    check(roundTrip(TELEMETRY_INT16, 2.0f / 32767.0f), "int16, 3 canales, trozos aleatorios");
+    check(roundTrip(TELEMETRY_FLOAT32, 0.0f), "float32, 3 canales, exacto");
+
+    // Puerto bloqueado: el emisor descarta paquetes sin esperar
+    TelemetryTx tx(2, TELEMETRY_INT16, 1.0f, 256);
+    tx.setFramesPerPacket(10);
+    float32_t frame[2] = {0.5f, -0.5f};
+    for (int i = 0; i < 200; i++) {
+        tx.push(frame);
+    }
+    check(tx.droppedPackets() > 0 && tx.pendingBytes() <= 256, "descarte con buffer lleno");
+
+    port.length = 0;
+    port.space = 1 << 30;
+    tx.pump(port);
+    for (int i = 0; i < 20; i++) {
+        tx.push(frame);
+    }
+    tx.pump(port);
+
+    memset(&rx, 0, sizeof(rx));
+    TelemetryDecoder decoder(onPacket, &rx);
+    decoder.feed(port.data, port.length);
+    check(decoder.lostPackets() == tx.droppedPackets(), "perdidas detectadas por secuencia");
+
+    // Corromper un byte de un paquete: se pierde ese paquete y se resincroniza
+    uint32_t before = decoder.packets();
+    port.length = 0;
+    for (int i = 0; i < 30; i++) {
+        tx.push(frame);
+    }
+    tx.pump(port);
+    port.data[5] ^= 0x40;
+    decoder.feed(port.data, port.length);
+    check(decoder.crcErrors() + decoder.framingErrors() == 1 && decoder.packets() == before + 2,
+          "paquete corrupto descartado");
+
+    return testResult();
+}
@@ -0,0 +1,227 @@
+/**
+ * @file Test_Trace.cpp
+ * @brief Test en host de las trazas por llamada (TraceBuffer / Traced / ChromeTraceWriter)
+ * @author Test Suite
+ * @version 1.0.0
+ * @date 2025
+ *
+ * Este test evalúa:
+ * - Orden y contenido de los eventos de una cadena de etapas Traced<> anidadas
+ * - Anillo lleno: se descartan llamadas enteras y los pares inicio/fin siguen completos
+ * - 200000 llamadas desde otro hilo mientras el principal vacía el anillo
+ * - JSON de Chrome trace: pares B/E equilibrados, tiempos crecientes aunque la marca de
+ *   32 bits se desborde, nombres escapados y archivo bien cerrado
+ *
+ * Compilación (desde la raíz del repositorio, con CMSIS-DSP para arm_math.h):
+ * @code
+ * g++ -std=gnu++11 -O2 -pthread -DBIOFILTERLIB_TRACE=1 -I<CMSIS>/Include -Isrc \
+ *     test/host/Test_Trace.cpp src/utils/Trace.cpp src/host/TraceExport.cpp \
+ *     src/filters/FIRFilter.cpp src/filters/IIRFilter.cpp src/utils/utils.cpp \
+ *     -o test_trace && ./test_trace
+ * @endcode
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <thread>
+#include "utils/Trace.h"
+#include "host/TraceExport.h"
+#include "filters/FIRFilter.h"
+#include "filters/IIRFilter.h"
+#include "filters/FilterChain.h"
+#include "HostTest.h"
+
+#if !BIOFILTERLIB_TRACE
+#error "Compilar con -DBIOFILTERLIB_TRACE=1"
+#endif
+
+#define BLOCK_SIZE     32
+#define THREAD_CALLS   200000
+#define TRACE_PATH     "test_trace.json"
+
+// Notch 50 Hz (Q = 30, fs = 500 Hz), a1/a2 negados para CMSIS-DSP
+static float32_t notchCoeffs[5] = {
+    0.98963120f, -1.60127020f, 0.98963120f,
+    1.60127020f, -0.97926240f
+};
+
+static float32_t lowpass[9] = {
+    0.02f, 0.06f, 0.12f, 0.18f, 0.24f, 0.18f, 0.12f, 0.06f, 0.02f
+};
+
+/**
+ * @brief Anida la cadena dentro de una etapa "pipeline" y comprueba la secuencia
+ */
+static bool nestedOrder() {
+    TraceBuffer trace(64);
+    IIRFilter notch(notchCoeffs, 1, BLOCK_SIZE);
+    FIRFilter fir(lowpass, 9, BLOCK_SIZE);
+    Traced<IIRFilter> notchStage(notch, trace, "notch");
+    Traced<FIRFilter> firStage(fir, trace, "lowpass");
+    typedef FilterChain<Traced<IIRFilter>, Traced<FIRFilter> > Chain;
+    Chain chain(BLOCK_SIZE, notchStage, firStage);
+    Traced<Chain> pipeline(chain, trace, "pipeline");
+
+    float32_t block[BLOCK_SIZE] = {0};
+    block[0] = 1.0f;
+    pipeline.processBuffer(block, block, BLOCK_SIZE);
+
+    const uint16_t tracks[6] = {2, 0, 0, 1, 1, 2};
+    const uint8_t phases[6] = {TRACE_BEGIN, TRACE_BEGIN, TRACE_END, TRACE_BEGIN, TRACE_END, TRACE_END};
+    bool ok = trace.available() == 6;
+    uint32_t previous = 0;
+    TraceEvent event;
+    for (uint32_t i = 0; i < 6 && trace.pop(event); i++) {
+        ok &= event.track == tracks[i] && event.phase == phases[i];
+        ok &= event.length == (event.phase == TRACE_BEGIN ? BLOCK_SIZE : 0u);
+        ok &= i == 0 || (int32_t)(event.timestamp - previous) >= 0;
+        previous = event.timestamp;
+    }
+    ok &= !trace.pop(event) && trace.getDropped() == 0;
+    ok &= strcmp(trace.getTrackName(2), "pipeline") == 0;
+    return ok;
+}
+
+/**
+ * @brief Sin consumidor: llamadas anidadas de dos niveles en un anillo de 8 eventos
+ */
+static bool balancedWhenFull() {
+    TraceBuffer trace(8);
+    uint16_t outer = trace.addTrack("outer");
+    uint16_t inner = trace.addTrack("inner");
+    for (uint32_t call = 0; call < 10; call++) {
+        TraceBuffer::Scope a(trace, outer, 2);
+        TraceBuffer::Scope b(trace, inner, 1);
+    }
+    // Caben dos llamadas completas (8 eventos); las otras 8 externas y 8 internas se descartan
+    int32_t depth[2] = {0, 0};
+    bool ok = trace.available() == 8 && trace.getDropped() == 16;
+    TraceEvent event;
+    while (trace.pop(event)) {
+        depth[event.track] += (event.phase == TRACE_BEGIN) ? 1 : -1;
+        ok &= depth[event.track] >= 0 && depth[event.track] <= 1;
+    }
+    return ok && depth[0] == 0 && depth[1] == 0;
+}
+
+/**
+ * @brief Productor en otro hilo: todo evento leído forma parte de un par completo
+ */
+static bool threadedTransfer() {
+    TraceBuffer trace(256);
+    uint16_t track = trace.addTrack("worker");
+    std::thread producer([&trace, track]() {
+        for (uint32_t call = 0; call < THREAD_CALLS; call++) {
+            TraceBuffer::Scope scope(trace, track, call);
+        }
+    });
+
+    uint32_t pairs = 0;
+    uint32_t lastLength = 0;
+    bool open = false;
+    bool ok = true;
+    TraceEvent event;
+    while (true) {
+        bool running = pairs + trace.getDropped() < THREAD_CALLS;
+        if (!trace.pop(event)) {
+            if (!running) {
+                break;
+            }
+            std::this_thread::yield();
+            continue;
+        }
+        if (event.phase == TRACE_BEGIN) {
+            ok &= !open && (pairs == 0 || event.length > lastLength);
+            lastLength = event.length;
+            open = true;
+        } else {
+            ok &= open;
+            open = false;
+            pairs++;
+        }
+    }
+    producer.join();
+    return ok && !open && pairs + trace.getDropped() == THREAD_CALLS && pairs > 0;
+}
+
+/**
+ * @brief Cuenta las apariciones de un texto en el archivo
+ */
+static uint32_t countOccurrences(const char* text, const char* pattern) {
+    uint32_t count = 0;
+    for (const char* p = strstr(text, pattern); p != nullptr; p = strstr(p + 1, pattern)) {
+        count++;
+    }
+    return count;
+}
+
+/**
+ * @brief Exporta eventos con marcas que cruzan el desbordamiento de 32 bits
+ */
+static void exportTrace() {
+    static char json[1 << 16];
+    TraceBuffer trace(16);
+    uint16_t track = trace.addTrack("etapa \"1\"");
+
+    ChromeTraceWriter writer;
+    check(writer.open(TRACE_PATH, "test"), "open() crea el archivo");
+    writer.setThreadName(1, "hilo");
+
+    // Eventos sintéticos: las marcas pasan de 0xFFFFFF.. a 0x000000..
+    const uint32_t stamps[8] = {
+        0xFFFFFF00u, 0xFFFFFF80u, 0xFFFFFFF0u, 0x00000010u,
+        0x00000100u, 0x00000180u, 0x00000200u, 0x00000300u
+    };
+    for (uint32_t i = 0; i < 8; i++) {
+        TraceEvent event = {stamps[i], track, (uint8_t)(i & 1), 0, (i & 1) ? 0u : 16u};
+        writer.write(event, trace.getTrackName(track), 1);
+    }
+    // Y una llamada real por el anillo, en otra fila
+    {
+        TraceBuffer::Scope scope(trace, track, 4);
+    }
+    check(writer.drain(trace, 2) == 2, "drain() vacía el anillo");
+    check(writer.getEventCount() == 10, "10 eventos escritos");
+    check(writer.close(), "close() sin errores");
+
+    FILE* file = fopen(TRACE_PATH, "r");
+    size_t size = file ? fread(json, 1, sizeof(json) - 1, file) : 0;
+    if (file) {
+        fclose(file);
+    }
+    json[size] = '\0';
+    remove(TRACE_PATH);
+
+    check(countOccurrences(json, "\"ph\":\"B\"") == 5 && countOccurrences(json, "\"ph\":\"E\"") == 5,
+          "pares B/E equilibrados");
+    check(countOccurrences(json, "\"etapa \\\"1\\\"\"") == 10, "nombres escapados");
+    size_t length = strlen(json);
+    check(strncmp(json, "{\"displayTimeUnit\"", 18) == 0 && length > 4 &&
+          strcmp(json + length - 4, "\n]}\n") == 0, "objeto JSON cerrado");
+
+    // Tiempos de la fila 1: crecientes a través del desbordamiento
+    const double microsPerCount = 1e6 / CycleCounter::frequency();
+    bool increasing = true;
+    bool exact = true;
+    double previous = -1.0;
+    uint32_t index = 0;
+    for (const char* p = strstr(json, "\"ts\":"); p != nullptr && index < 8; p = strstr(p + 1, "\"ts\":")) {
+        double ts = 0.0;
+        sscanf(p + 5, "%lf", &ts);
+        double expected = (double)(uint32_t)(stamps[index] - stamps[0]) * microsPerCount;
+        increasing &= ts > previous;
+        exact &= ts - expected < 0.001 && expected - ts < 0.001;
+        previous = ts;
+        index++;
+    }
+    check(increasing && exact && index == 8, "marcas desenrolladas tras 2^32");
+}
+
+int main() {
+    check(nestedOrder(), "cadena anidada: orden, etapas y longitudes");
+    check(balancedWhenFull(), "anillo lleno: descarte de llamadas completas");
+    check(threadedTransfer(), "200000 llamadas entre hilos, pares completos");
+    exportTrace();
+
+    return testResult();
+}
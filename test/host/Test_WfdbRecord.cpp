@@ -0,0 +1,171 @@
+/**
+ * @file Test_WfdbRecord.cpp
+ * @brief Test en host del lector WFDB (WfdbRecord / WfdbSource)
+ * @author Test Suite
+ * @version 1.0.0
+ * @date 2025
+ *
+ * Este test evalúa:
+ * - Lectura de la cabecera .hea (ganancia, línea base, descripción, unidades)
+ * - Decodificación de formato 212 (2 señales entrelazadas) y 16 con offset
+ * - Acceso aleatorio por muestra y por tiempo, y lectura por bloques con WfdbSource
+ * - Anotaciones MIT con SKIP, NUM, CHN y AUX
+ *
+ * Escribe un registro sintético en el directorio actual y lo vuelve a leer.
+ *
+ * Compilación (desde la raíz del repositorio, con CMSIS-DSP para arm_math.h):
+ * @code
+ * g++ -std=gnu++11 -O2 -I<CMSIS>/Include -Isrc test/host/Test_WfdbRecord.cpp \
+ *     src/host/WfdbRecord.cpp src/host/MappedFile.cpp src/utils/SignalSource.cpp \
+ *     src/utils/Waveforms.cpp src/utils/WaveformsData.cpp -o test_wfdb && ./test_wfdb
+ * @endcode
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include <string.h>
+#include "host/WfdbRecord.h"
+#include "HostTest.h"
+
+#define NUM_SAMPLES 1000
+#define SAMPLE_RATE 360
+
+// Valores ADC de prueba: cubren todo el rango de 12 bits, con signo
+static int16_t adc0(uint32_t n) { return (int16_t)((n * 37) % 4000) - 2000; }
+static int16_t adc1(uint32_t n) { return (int16_t)(1000 - (int32_t)((n * 11) % 2000)); }
+static int16_t adc2(uint32_t n) { return (int16_t)(n * 61 - 30000); }
+
+static void writeRecord() {
+    FILE* header = fopen("wfdbtest.hea", "w");
+    fprintf(header, "# Registro sintético\n");
+    fprintf(header, "wfdbtest 3 %d %d\n", SAMPLE_RATE, NUM_SAMPLES);
+    fprintf(header, "wfdbtest.dat 212 200(24)/mV 11 1024 0 0 0 MLII\n");
+    fprintf(header, "wfdbtest.dat 212 400 11 10 0 0 0 V5\n");
+    fprintf(header, "wfdbtest_16.dat 16+6 1000(-5)/uV 16 0 0 0 0 Canal con espacios\n");
+    fclose(header);
+
+    // 212: dos señales por trama -> 3 bytes por trama
+    FILE* data = fopen("wfdbtest.dat", "wb");
+    for (uint32_t n = 0; n < NUM_SAMPLES; n++) {
+        uint16_t a = (uint16_t)adc0(n) & 0xFFF;
+        uint16_t b = (uint16_t)adc1(n) & 0xFFF;
+        fputc(a & 0xFF, data);
+        fputc(((a >> 8) & 0x0F) | ((b >> 4) & 0xF0), data);
+        fputc(b & 0xFF, data);
+    }
+    fclose(data);
+
+    // 16 con 6 bytes de cabecera propia que hay que saltar
+    data = fopen("wfdbtest_16.dat", "wb");
+    for (int i = 0; i < 6; i++) {
+        fputc(0xAA, data);
+    }
+    for (uint32_t n = 0; n < NUM_SAMPLES; n++) {
+        uint16_t v = (uint16_t)adc2(n);
+        fputc(v & 0xFF, data);
+        fputc(v >> 8, data);
+    }
+    fclose(data);
+
+    // Anotaciones: N@10 (chan 1), SKIP hasta 2000+, V@2010 (num 3) con texto auxiliar, N@2020
+    FILE* ann = fopen("wfdbtest.atr", "wb");
+    uint16_t words[] = {
+        (uint16_t)((1 << 10) | 10),          // N, +10
+        (uint16_t)((62 << 10) | 1),          // CHN = 1
+        (uint16_t)(59 << 10),                // SKIP
+        0x0000, 2000,                        // +2000 (palabra alta, palabra baja)
+        (uint16_t)((5 << 10) | 0),           // V, +0
+        (uint16_t)((60 << 10) | 3),          // NUM = 3
+        (uint16_t)((63 << 10) | 3),          // AUX de 3 bytes (+1 de relleno)
+    };
+    fwrite(words, sizeof(uint16_t), sizeof(words) / sizeof(words[0]), ann);
+    fwrite("(AF", 1, 4, ann);
+    uint16_t tail[] = { (uint16_t)((1 << 10) | 10), 0 };
+    fwrite(tail, sizeof(uint16_t), 2, ann);
+    fclose(ann);
+}
+
+int main() {
+    writeRecord();
+
+    WfdbRecord record;
+    check(record.open("wfdbtest.hea"), "open()");
+    check(record.getNumSignals() == 3, "numero de senales");
+    check(record.getSampleRate() == SAMPLE_RATE, "frecuencia de muestreo");
+    check(record.getNumSamples() == NUM_SAMPLES, "numero de muestras");
+    check(record.findSignal("mlii") == 0 && record.findSignal("V5") == 1, "findSignal()");
+
+    const WfdbSignalInfo& v5 = record.getSignalInfo(1);
+    const WfdbSignalInfo& ch2 = record.getSignalInfo(2);
+    check(v5.baseline == 10 && v5.gain == 400.0f, "linea base por defecto = adczero");
+    check(ch2.baseline == -5 && ch2.byteOffset == 6, "linea base explicita y offset");
+    check(strcmp(ch2.description, "Canal con espacios") == 0 &&
+          strcmp(ch2.units, "uV") == 0, "descripcion y unidades");
+
+    // Comparar todas las muestras de las tres señales
+    static float32_t buffer[NUM_SAMPLES];
+    float32_t maxError[3] = {0, 0, 0};
+    for (uint8_t ch = 0; ch < 3; ch++) {
+        const WfdbSignalInfo& info = record.getSignalInfo(ch);
+        uint32_t got = record.readSamples(ch, 0, buffer, NUM_SAMPLES + 10);
+        if (got != NUM_SAMPLES) {
+            maxError[ch] = 1e9f;
+        }
+        for (uint32_t n = 0; n < got; n++) {
+            int32_t adc = (ch == 0) ? adc0(n) : (ch == 1) ? adc1(n) : adc2(n);
+            float32_t expected = (adc - info.baseline) / info.gain;
+            float32_t error = fabsf(buffer[n] - expected) / (1.0f + fabsf(expected));
+            if (error > maxError[ch]) {
+                maxError[ch] = error;
+            }
+        }
+    }
+    check(maxError[0] < 1e-6f, "formato 212, senal par");
+    check(maxError[1] < 1e-6f, "formato 212, senal impar");
+    check(maxError[2] < 1e-6f, "formato 16 con offset");
+
+    // Acceso aleatorio: muestra impar en 212
+    float32_t one;
+    record.readSamples(1, 777, &one, 1);
+    check(fabsf(one - (adc1(777) - 10) / 400.0f) < 1e-6f, "acceso aleatorio");
+
+    // WfdbSource por bloques desde t = 1 s, 100 muestras
+    WfdbSource source(record, 0, 0, 0);
+    source.seekTime(1.0f);
+    check(source.position() == SAMPLE_RATE, "seekTime()");
+    WfdbSource limited(record, 0, SAMPLE_RATE, 100);
+    float32_t block[32];
+    uint32_t total = 0;
+    uint32_t count;
+    bool match = true;
+    while ((count = limited.read(block, 32)) > 0) {
+        for (uint32_t i = 0; i < count; i++) {
+            match &= fabsf(block[i] - (adc0(SAMPLE_RATE + total + i) - 24) / 200.0f) < 1e-6f;
+        }
+        total += count;
+    }
+    check(total == 100 && match, "WfdbSource por bloques");
+
+    // Anotaciones
+    check(record.loadAnnotations("atr"), "loadAnnotations()");
+    check(record.getNumAnnotations() == 3, "numero de anotaciones");
+    if (record.getNumAnnotations() == 3) {
+        const WfdbAnnotation& a0 = record.getAnnotation(0);
+        const WfdbAnnotation& a1 = record.getAnnotation(1);
+        const WfdbAnnotation& a2 = record.getAnnotation(2);
+        check(a0.sample == 10 && a0.channel == 1 &&
+              WfdbRecord::annotationSymbol(a0.code) == 'N', "anotacion N con CHN");
+        check(a1.sample == 2010 && a1.num == 3 &&
+              WfdbRecord::annotationSymbol(a1.code) == 'V', "anotacion V tras SKIP con NUM");
+        check(a2.sample == 2020 && a2.channel == 1 && a2.num == 3, "AUX omitido, chan/num heredados");
+        check(record.findAnnotation(2005) == 1 && record.findAnnotation(5000) == 3, "findAnnotation()");
+        check(WfdbRecord::isBeat(a1.code) && !WfdbRecord::isBeat(28), "isBeat()");
+    }
+
+    remove("wfdbtest.hea");
+    remove("wfdbtest.dat");
+    remove("wfdbtest_16.dat");
+    remove("wfdbtest.atr");
+
+    return testResult();
+}